@@ -13,5 +13,6 @@
 #include "MidpointCircle.hpp"
 #include "BresenhamLine.hpp"
 #include "ClipLine.hpp"
+#include "Bitset.hpp"
 
 #endif /* NP_ENGINE_ALGORITHMS_HPP */
\ No newline at end of file
@@ -0,0 +1,71 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#ifndef NP_ENGINE_BITSET_HPP
+#define NP_ENGINE_BITSET_HPP
+
+#include <algorithm>
+
+#include "NP-Engine/Foundation/Foundation.hpp"
+#include "NP-Engine/Primitive/Primitive.hpp"
+#include "NP-Engine/Container/Container.hpp"
+
+namespace np::alg
+{
+	/*
+		dense set of indices on [0, size), packed 64 to a word -- a fraction of the memory of a hash set of points, and
+		every lookup is a shift and a mask
+		not safe to write from more than one thread, since neighboring indices share words
+	*/
+	class Bitset
+	{
+	private:
+		con::vector<ui64> _words;
+		siz _size;
+
+	public:
+		Bitset(siz size = 0): _words((size + 63) / 64, 0), _size(size) {}
+
+		siz GetSize() const
+		{
+			return _size;
+		}
+
+		/*
+			resizes and clears every index
+		*/
+		void Resize(siz size)
+		{
+			_words.assign((size + 63) / 64, 0);
+			_size = size;
+		}
+
+		void Clear()
+		{
+			::std::fill(_words.begin(), _words.end(), 0);
+		}
+
+		bl Contains(siz index) const
+		{
+			NP_ENGINE_ASSERT(index < _size, "index must be within our size");
+			return (_words[index >> 6] >> (index & 63)) & 1;
+		}
+
+		void Insert(siz index)
+		{
+			NP_ENGINE_ASSERT(index < _size, "index must be within our size");
+			_words[index >> 6] |= (ui64)1 << (index & 63);
+		}
+
+		void Erase(siz index)
+		{
+			NP_ENGINE_ASSERT(index < _size, "index must be within our size");
+			_words[index >> 6] &= ~((ui64)1 << (index & 63));
+		}
+	};
+} // namespace np::alg
+
+#endif /* NP_ENGINE_BITSET_HPP */
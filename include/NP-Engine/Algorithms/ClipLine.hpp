@@ -146,57 +146,57 @@ namespace np::alg
 			break;
 
 		case 0x01:
-			retval.clipped = __detail::ClipQLeft(p, left);
+			retval.clipped = __detail::ClipQLeft(p, q, left);
 			retval.visible = true;
 			break;
 
 		case 0x02:
-			retval.clipped = __detail::ClipQRight(p, right);
+			retval.clipped = __detail::ClipQRight(p, q, right);
 			retval.visible = true;
 			break;
 
 		case 0x04:
-			retval.clipped = __detail::ClipQBottom(p, bottom);
+			retval.clipped = __detail::ClipQBottom(p, q, bottom);
 			retval.visible = true;
 			break;
 
 		case 0x05:
-			retval.clipped = __detail::ClipQLeft(p, left);
+			retval.clipped = __detail::ClipQLeft(p, q, left);
 			if (q.y < bottom)
-				retval.clipped |= __detail::ClipQBottom(p, bottom);
+				retval.clipped |= __detail::ClipQBottom(p, q, bottom);
 			retval.visible = true;
 			break;
 
 		case 0x06:
-			retval.clipped = __detail::ClipQRight(p, right);
+			retval.clipped = __detail::ClipQRight(p, q, right);
 			if (q.y < bottom)
-				retval.clipped |= __detail::ClipQBottom(p, bottom);
+				retval.clipped |= __detail::ClipQBottom(p, q, bottom);
 			retval.visible = true;
 			break;
 
 		case 0x08:
-			retval.clipped = __detail::ClipQTop(p, top);
+			retval.clipped = __detail::ClipQTop(p, q, top);
 			retval.visible = true;
 			break;
 
 		case 0x09:
-			retval.clipped = __detail::ClipQLeft(p, left);
+			retval.clipped = __detail::ClipQLeft(p, q, left);
 			if (q.y > top)
-				retval.clipped |= __detail::ClipQTop(p, top);
+				retval.clipped |= __detail::ClipQTop(p, q, top);
 			retval.visible = true;
 			break;
 
 		case 0x0A:
-			retval.clipped = __detail::ClipQRight(p, right);
+			retval.clipped = __detail::ClipQRight(p, q, right);
 			if (q.y > top)
-				retval.clipped |= __detail::ClipQTop(p, top);
+				retval.clipped |= __detail::ClipQTop(p, q, top);
 			retval.visible = true;
 			break;
 
 			//---------------------------------------------
 
 		case 0x10:
-			retval.clipped = __detail::ClipPLeft(p, left);
+			retval.clipped = __detail::ClipPLeft(p, q, left);
 			retval.visible = true;
 			break;
 
@@ -204,16 +204,16 @@ namespace np::alg
 			break;
 
 		case 0x12:
-			retval.clipped = __detail::ClipPLeft(p, left);
-			retval.clipped |= __detail::ClipQRight(p, right);
+			retval.clipped = __detail::ClipPLeft(p, q, left);
+			retval.clipped |= __detail::ClipQRight(p, q, right);
 			retval.visible = true;
 			break;
 
 		case 0x14:
-			retval.clipped = __detail::ClipPLeft(p, left);
+			retval.clipped = __detail::ClipPLeft(p, q, left);
 			if (p.y >= bottom)
 			{
-				retval.clipped |= __detail::ClipQBottom(p, bottom);
+				retval.clipped |= __detail::ClipQBottom(p, q, bottom);
 				retval.visible = true;
 			}
 			break;
@@ -222,21 +222,21 @@ namespace np::alg
 			break;
 
 		case 0x16:
-			retval.clipped = __detail::ClipPLeft(p, left);
+			retval.clipped = __detail::ClipPLeft(p, q, left);
 			if (p.y >= bottom)
 			{
-				retval.clipped |= __detail::ClipQBottom(p, bottom);
+				retval.clipped |= __detail::ClipQBottom(p, q, bottom);
 				if (q.x > right)
-					retval.clipped |= __detail::ClipQRight(p, right);
+					retval.clipped |= __detail::ClipQRight(p, q, right);
 				retval.visible = true;
 			}
 			break;
 
 		case 0x18:
-			retval.clipped = __detail::ClipPLeft(p, left);
+			retval.clipped = __detail::ClipPLeft(p, q, left);
 			if (p.y <= top)
 			{
-				retval.clipped |= __detail::ClipQTop(p, top);
+				retval.clipped |= __detail::ClipQTop(p, q, top);
 				retval.visible = true;
 			}
 			break;
@@ -245,12 +245,12 @@ namespace np::alg
 			break;
 
 		case 0x1A:
-			retval.clipped = __detail::ClipPLeft(p, left);
+			retval.clipped = __detail::ClipPLeft(p, q, left);
 			if (p.y <= top)
 			{
-				retval.clipped |= __detail::ClipQTop(p, top);
+				retval.clipped |= __detail::ClipQTop(p, q, top);
 				if (q.x > right)
-					retval.clipped |= __detail::ClipQRight(p, right);
+					retval.clipped |= __detail::ClipQRight(p, q, right);
 				retval.visible = true;
 			}
 			break;
@@ -258,13 +258,13 @@ namespace np::alg
 			//---------------------------------------------
 
 		case 0x20:
-			retval.clipped = __detail::ClipPRight(p, right);
+			retval.clipped = __detail::ClipPRight(p, q, right);
 			retval.visible = true;
 			break;
 
 		case 0x21:
-			retval.clipped = __detail::ClipPRight(p, right);
-			retval.clipped |= __detail::ClipQLeft(p, left);
+			retval.clipped = __detail::ClipPRight(p, q, right);
+			retval.clipped |= __detail::ClipQLeft(p, q, left);
 			retval.visible = true;
 			break;
 
@@ -272,21 +272,21 @@ namespace np::alg
 			break;
 
 		case 0x24:
-			retval.clipped = __detail::ClipPRight(p, right);
+			retval.clipped = __detail::ClipPRight(p, q, right);
 			if (p.y >= bottom)
 			{
-				retval.clipped |= __detail::ClipQBottom(p, bottom);
+				retval.clipped |= __detail::ClipQBottom(p, q, bottom);
 				retval.visible = true;
 			}
 			break;
 
 		case 0x25:
-			retval.clipped = __detail::ClipPRight(p, right);
+			retval.clipped = __detail::ClipPRight(p, q, right);
 			if (p.y >= bottom)
 			{
-				retval.clipped |= __detail::ClipQBottom(p, bottom);
+				retval.clipped |= __detail::ClipQBottom(p, q, bottom);
 				if (q.x < left)
-					retval.clipped |= __detail::ClipQLeft(p, left);
+					retval.clipped |= __detail::ClipQLeft(p, q, left);
 				retval.visible = true;
 			}
 			break;
@@ -295,21 +295,21 @@ namespace np::alg
 			break;
 
 		case 0x28:
-			retval.clipped = __detail::ClipPRight(p, right);
+			retval.clipped = __detail::ClipPRight(p, q, right);
 			if (p.y <= top)
 			{
-				retval.clipped |= __detail::ClipQTop(p, top);
+				retval.clipped |= __detail::ClipQTop(p, q, top);
 				retval.visible = true;
 			}
 			break;
 
 		case 0x29:
-			retval.clipped = __detail::ClipPRight(p, right);
+			retval.clipped = __detail::ClipPRight(p, q, right);
 			if (p.y <= top)
 			{
-				retval.clipped |= __detail::ClipQTop(p, top);
+				retval.clipped |= __detail::ClipQTop(p, q, top);
 				if (q.x < left)
-					retval.clipped |= __detail::ClipQLeft(p, left);
+					retval.clipped |= __detail::ClipQLeft(p, q, left);
 				retval.visible = true;
 			}
 			break;
@@ -320,26 +320,26 @@ namespace np::alg
 			//---------------------------------------------
 
 		case 0x40:
-			retval.clipped = __detail::ClipPBottom(p, bottom);
+			retval.clipped = __detail::ClipPBottom(p, q, bottom);
 			retval.visible = true;
 			break;
 
 		case 0x41:
-			retval.clipped = __detail::ClipPBottom(p, bottom);
+			retval.clipped = __detail::ClipPBottom(p, q, bottom);
 			if (p.x >= left)
 			{
-				retval.clipped |= __detail::ClipQLeft(p, left);
+				retval.clipped |= __detail::ClipQLeft(p, q, left);
 				if (q.y < bottom)
-					retval.clipped |= __detail::ClipQBottom(p, bottom);
+					retval.clipped |= __detail::ClipQBottom(p, q, bottom);
 				retval.visible = true;
 			}
 			break;
 
 		case 0x42:
-			retval.clipped = __detail::ClipPBottom(p, bottom);
+			retval.clipped = __detail::ClipPBottom(p, q, bottom);
 			if (p.x <= right)
 			{
-				retval.clipped |= __detail::ClipQRight(p, right);
+				retval.clipped |= __detail::ClipQRight(p, q, right);
 				retval.visible = true;
 			}
 			break;
@@ -354,29 +354,29 @@ namespace np::alg
 			break;
 
 		case 0x48:
-			retval.clipped = __detail::ClipPBottom(p, bottom);
-			retval.clipped |= __detail::ClipQTop(p, top);
+			retval.clipped = __detail::ClipPBottom(p, q, bottom);
+			retval.clipped |= __detail::ClipQTop(p, q, top);
 			retval.visible = true;
 			break;
 
 		case 0x49:
-			retval.clipped = __detail::ClipPBottom(p, bottom);
+			retval.clipped = __detail::ClipPBottom(p, q, bottom);
 			if (p.x >= left)
 			{
-				retval.clipped |= __detail::ClipQLeft(p, left);
+				retval.clipped |= __detail::ClipQLeft(p, q, left);
 				if (q.y > top)
-					retval.clipped |= __detail::ClipQTop(p, top);
+					retval.clipped |= __detail::ClipQTop(p, q, top);
 				retval.visible = true;
 			}
 			break;
 
 		case 0x4A:
-			retval.clipped = __detail::ClipPBottom(p, bottom);
+			retval.clipped = __detail::ClipPBottom(p, q, bottom);
 			if (p.x <= right)
 			{
-				retval.clipped |= __detail::ClipQRight(p, right);
+				retval.clipped |= __detail::ClipQRight(p, q, right);
 				if (q.y > top)
-					retval.clipped |= __detail::ClipQTop(p, top);
+					retval.clipped |= __detail::ClipQTop(p, q, top);
 				retval.visible = true;
 			}
 			break;
@@ -384,9 +384,9 @@ namespace np::alg
 			//---------------------------------------------
 
 		case 0x50:
-			retval.clipped = __detail::ClipPLeft(p, left);
+			retval.clipped = __detail::ClipPLeft(p, q, left);
 			if (p.y < bottom)
-				retval.clipped |= __detail::ClipPBottom(p, bottom);
+				retval.clipped |= __detail::ClipPBottom(p, q, bottom);
 			retval.visible = true;
 			break;
 
@@ -394,12 +394,12 @@ namespace np::alg
 			break;
 
 		case 0x52:
-			retval.clipped = __detail::ClipQRight(p, right);
+			retval.clipped = __detail::ClipQRight(p, q, right);
 			if (q.y >= bottom)
 			{
-				retval.clipped |= __detail::ClipPBottom(p, bottom);
+				retval.clipped |= __detail::ClipPBottom(p, q, bottom);
 				if (p.x < left)
-					retval.clipped |= __detail::ClipPLeft(p, left);
+					retval.clipped |= __detail::ClipPLeft(p, q, left);
 				retval.visible = true;
 			}
 			break;
@@ -414,29 +414,30 @@ namespace np::alg
 			break;
 
 		case 0x58:
-			retval.clipped = __detail::ClipQTop(p, top);
+			retval.clipped = __detail::ClipQTop(p, q, top);
 			if (q.x >= left)
 			{
-				retval.clipped |= __detail::ClipPBottom(p, bottom);
+				retval.clipped |= __detail::ClipPBottom(p, q, bottom);
 				if (p.x < left)
-					retval.clipped |= __detail::ClipPLeft(p, left);
+					retval.clipped |= __detail::ClipPLeft(p, q, left);
 				retval.visible = true;
 			}
+			break;
 
 		case 0x59:
 			break;
 
 		case 0x5A:
-			retval.clipped = __detail::ClipPLeft(p, left);
-			if (p.y >= left)
+			retval.clipped = __detail::ClipPLeft(p, q, left);
+			if (p.y <= top)
 			{
-				retval.clipped |= __detail::ClipQRight(p, right);
+				retval.clipped |= __detail::ClipQRight(p, q, right);
 				if (q.y >= bottom)
 				{
 					if (p.y < bottom)
-						retval.clipped |= __detail::ClipPBottom(p, bottom);
+						retval.clipped |= __detail::ClipPBottom(p, q, bottom);
 					if (q.y > top)
-						retval.clipped |= __detail::ClipQTop(p, top);
+						retval.clipped |= __detail::ClipQTop(p, q, top);
 					retval.visible = true;
 				}
 			}
@@ -445,19 +446,19 @@ namespace np::alg
 			//---------------------------------------------
 
 		case 0x60:
-			retval.clipped = __detail::ClipPRight(p, right);
+			retval.clipped = __detail::ClipPRight(p, q, right);
 			if (p.y < bottom)
-				retval.clipped |= __detail::ClipPBottom(p, bottom);
+				retval.clipped |= __detail::ClipPBottom(p, q, bottom);
 			retval.visible = true;
 			break;
 
 		case 0x61:
-			retval.clipped = __detail::ClipQLeft(p, left);
+			retval.clipped = __detail::ClipQLeft(p, q, left);
 			if (q.y >= bottom)
 			{
-				retval.clipped |= __detail::ClipPBottom(p, bottom);
+				retval.clipped |= __detail::ClipPBottom(p, q, bottom);
 				if (p.x > right)
-					retval.clipped |= __detail::ClipPRight(p, right);
+					retval.clipped |= __detail::ClipPRight(p, q, right);
 				retval.visible = true;
 			}
 			break;
@@ -475,27 +476,27 @@ namespace np::alg
 			break;
 
 		case 0x68:
-			retval.clipped = __detail::ClipQTop(p, top);
+			retval.clipped = __detail::ClipQTop(p, q, top);
 			if (q.x <= right)
 			{
-				retval.clipped |= __detail::ClipPRight(p, right);
+				retval.clipped |= __detail::ClipPRight(p, q, right);
 				if (p.y < bottom)
-					retval.clipped |= __detail::ClipPBottom(p, bottom);
+					retval.clipped |= __detail::ClipPBottom(p, q, bottom);
 				retval.visible = true;
 			}
 			break;
 
 		case 0x69:
-			retval.clipped = __detail::ClipQLeft(p, left);
+			retval.clipped = __detail::ClipQLeft(p, q, left);
 			if (q.y >= bottom)
 			{
-				retval.clipped |= __detail::ClipPRight(p, right);
+				retval.clipped |= __detail::ClipPRight(p, q, right);
 				if (p.y <= top)
 				{
 					if (q.y > top)
-						retval.clipped |= __detail::ClipQTop(p, top);
+						retval.clipped |= __detail::ClipQTop(p, q, top);
 					if (p.y < bottom)
-						retval.clipped |= __detail::ClipPBottom(p, bottom);
+						retval.clipped |= __detail::ClipPBottom(p, q, bottom);
 					retval.visible = true;
 				}
 			}
@@ -507,52 +508,52 @@ namespace np::alg
 			//---------------------------------------------
 
 		case 0x80:
-			retval.clipped = __detail::ClipPTop(p, top);
+			retval.clipped = __detail::ClipPTop(p, q, top);
 			retval.visible = true;
 			break;
 
 		case 0x81:
-			retval.clipped = __detail::ClipPTop(p, top);
+			retval.clipped = __detail::ClipPTop(p, q, top);
 			if (p.x >= left)
 			{
-				retval.clipped |= __detail::ClipQLeft(p, left);
+				retval.clipped |= __detail::ClipQLeft(p, q, left);
 				retval.visible = true;
 			}
 			break;
 
 		case 0x82:
-			retval.clipped = __detail::ClipPTop(p, top);
+			retval.clipped = __detail::ClipPTop(p, q, top);
 			if (p.x <= right)
 			{
-				retval.clipped |= __detail::ClipQRight(p, right);
+				retval.clipped |= __detail::ClipQRight(p, q, right);
 				retval.visible = true;
 			}
 			break;
 
 		case 0x84:
-			retval.clipped = __detail::ClipPTop(p, top);
-			retval.clipped |= __detail::ClipQBottom(p, bottom);
+			retval.clipped = __detail::ClipPTop(p, q, top);
+			retval.clipped |= __detail::ClipQBottom(p, q, bottom);
 			retval.visible = true;
 			break;
 
 		case 0x85:
-			retval.clipped = __detail::ClipPTop(p, top);
+			retval.clipped = __detail::ClipPTop(p, q, top);
 			if (p.x >= left)
 			{
-				retval.clipped |= __detail::ClipQLeft(p, left);
+				retval.clipped |= __detail::ClipQLeft(p, q, left);
 				if (q.y < bottom)
-					retval.clipped |= __detail::ClipQBottom(p, bottom);
+					retval.clipped |= __detail::ClipQBottom(p, q, bottom);
 				retval.visible = true;
 			}
 			break;
 
 		case 0x86:
-			retval.clipped = __detail::ClipPTop(p, top);
+			retval.clipped = __detail::ClipPTop(p, q, top);
 			if (p.x <= right)
 			{
-				retval.clipped |= __detail::ClipQRight(p, right);
+				retval.clipped |= __detail::ClipQRight(p, q, right);
 				if (q.y < bottom)
-					retval.clipped |= __detail::ClipQBottom(p, bottom);
+					retval.clipped |= __detail::ClipQBottom(p, q, bottom);
 				retval.visible = true;
 			}
 			break;
@@ -569,9 +570,9 @@ namespace np::alg
 			//---------------------------------------------
 
 		case 0x90:
-			retval.clipped = __detail::ClipPLeft(p, left);
+			retval.clipped = __detail::ClipPLeft(p, q, left);
 			if (p.y > top)
-				retval.clipped |= __detail::ClipPTop(p, top);
+				retval.clipped |= __detail::ClipPTop(p, q, top);
 			retval.visible = true;
 			break;
 
@@ -579,23 +580,23 @@ namespace np::alg
 			break;
 
 		case 0x92:
-			retval.clipped = __detail::ClipQRight(p, right);
+			retval.clipped = __detail::ClipQRight(p, q, right);
 			if (q.y <= top)
 			{
-				retval.clipped |= __detail::ClipPTop(p, top);
+				retval.clipped |= __detail::ClipPTop(p, q, top);
 				if (p.x < left)
-					retval.clipped |= __detail::ClipPLeft(p, left);
+					retval.clipped |= __detail::ClipPLeft(p, q, left);
 				retval.visible = true;
 			}
 			break;
 
 		case 0x94:
-			retval.clipped = __detail::ClipQBottom(p, bottom);
+			retval.clipped = __detail::ClipQBottom(p, q, bottom);
 			if (q.x >= left)
 			{
-				retval.clipped |= __detail::ClipPLeft(p, left);
+				retval.clipped |= __detail::ClipPLeft(p, q, left);
 				if (p.y > top)
-					retval.clipped |= __detail::ClipPTop(p, top);
+					retval.clipped |= __detail::ClipPTop(p, q, top);
 				retval.visible = true;
 			}
 			break;
@@ -604,16 +605,16 @@ namespace np::alg
 			break;
 
 		case 0x96:
-			retval.clipped = __detail::ClipPLeft(p, left);
+			retval.clipped = __detail::ClipPLeft(p, q, left);
 			if (p.y >= bottom)
 			{
-				retval.clipped |= __detail::ClipQRight(p, right);
+				retval.clipped |= __detail::ClipQRight(p, q, right);
 				if (q.y <= top)
 				{
 					if (p.y > top)
-						retval.clipped |= __detail::ClipPTop(p, top);
+						retval.clipped |= __detail::ClipPTop(p, q, top);
 					if (q.y < bottom)
-						retval.clipped |= __detail::ClipQBottom(p, bottom);
+						retval.clipped |= __detail::ClipQBottom(p, q, bottom);
 					retval.visible = true;
 				}
 			}
@@ -631,19 +632,19 @@ namespace np::alg
 			//---------------------------------------------
 
 		case 0xA0:
-			retval.clipped = __detail::ClipPRight(p, right);
+			retval.clipped = __detail::ClipPRight(p, q, right);
 			if (p.y > top)
-				retval.clipped |= __detail::ClipPTop(p, top);
+				retval.clipped |= __detail::ClipPTop(p, q, top);
 			retval.visible = true;
 			break;
 
 		case 0xA1:
-			retval.clipped = __detail::ClipQLeft(p, left);
+			retval.clipped = __detail::ClipQLeft(p, q, left);
 			if (q.y <= top)
 			{
-				retval.clipped |= __detail::ClipPTop(p, top);
+				retval.clipped |= __detail::ClipPTop(p, q, top);
 				if (p.x > right)
-					retval.clipped |= __detail::ClipPRight(p, right);
+					retval.clipped |= __detail::ClipPRight(p, q, right);
 				retval.visible = true;
 			}
 			break;
@@ -652,27 +653,27 @@ namespace np::alg
 			break;
 
 		case 0xA4:
-			retval.clipped = __detail::ClipQBottom(p, bottom);
+			retval.clipped = __detail::ClipQBottom(p, q, bottom);
 			if (q.x <= right)
 			{
-				retval.clipped |= __detail::ClipPRight(p, right);
+				retval.clipped |= __detail::ClipPRight(p, q, right);
 				if (p.y > top)
-					retval.clipped |= __detail::ClipPTop(p, top);
+					retval.clipped |= __detail::ClipPTop(p, q, top);
 				retval.visible = true;
 			}
 			break;
 
 		case 0xA5:
-			retval.clipped = __detail::ClipQLeft(p, left);
+			retval.clipped = __detail::ClipQLeft(p, q, left);
 			if (q.y <= top)
 			{
-				retval.clipped |= __detail::ClipPRight(p, right);
+				retval.clipped |= __detail::ClipPRight(p, q, right);
 				if (p.y >= bottom)
 				{
 					if (q.y < bottom)
-						retval.clipped |= __detail::ClipQBottom(p, bottom);
+						retval.clipped |= __detail::ClipQBottom(p, q, bottom);
 					if (p.y > top)
-						retval.clipped |= __detail::ClipPTop(p, top);
+						retval.clipped |= __detail::ClipPTop(p, q, top);
 					retval.visible = true;
 				}
 			}
@@ -701,7 +702,7 @@ namespace np::alg
 	template <typename T>
 	static inline ClipLineReturn ClipLine(::glm::vec<2, T>& p, ::glm::vec<2, T>& q, T top, T right)
 	{
-		return ClipLine<T>(p, top, right, 0, 0);
+		return ClipLine<T>(p, q, top, right, 0, 0);
 	}
 } // namespace np::alg
 
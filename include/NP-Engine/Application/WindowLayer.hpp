@@ -22,7 +22,7 @@ namespace np::app
 	{
 	private:
 		const thr::thread::id _owning_thread_id;
-		mutexed_wrapper<con::vector<mem::sptr<win::Window>>> _windows;
+		shared_mutexed_wrapper<con::vector<mem::sptr<win::Window>>> _windows;
 		mutexed_wrapper<con::uset<uid::Uid>> _to_destroy;
 		evnt::EventQueue _deferred_event_queue{};
 
@@ -44,7 +44,7 @@ namespace np::app
 				mem::sptr<win::WindowTitleEvent> event = e;
 				win::WindowTitleEventData& data = event->GetData();
 
-				auto windows = _windows.get_access();
+				auto windows = _windows.get_shared_access();
 				for (auto it = windows->begin(); it != windows->end(); it++)
 					if ((*it)->GetUid() == data.windowId)
 					{
@@ -63,7 +63,7 @@ namespace np::app
 
 				if (data.isFocused)
 				{
-					auto windows = _windows.get_access();
+					auto windows = _windows.get_shared_access();
 					for (auto it = windows->begin(); it != windows->end(); it++)
 						if ((*it)->GetUid() == data.windowId)
 						{
@@ -81,7 +81,7 @@ namespace np::app
 				mem::sptr<win::WindowMaximizeEvent> event = e;
 				win::WindowMaximizeEventData& data = event->GetData();
 
-				auto windows = _windows.get_access();
+				auto windows = _windows.get_shared_access();
 				for (auto it = windows->begin(); it != windows->end(); it++)
 					if ((*it)->GetUid() == data.windowId)
 					{
@@ -101,7 +101,7 @@ namespace np::app
 				mem::sptr<win::WindowMinimizeEvent> event = e;
 				win::WindowMinimizeEventData& data = event->GetData();
 
-				auto windows = _windows.get_access();
+				auto windows = _windows.get_shared_access();
 				for (auto it = windows->begin(); it != windows->end(); it++)
 					if ((*it)->GetUid() == data.windowId)
 					{
@@ -121,7 +121,7 @@ namespace np::app
 				mem::sptr<win::WindowPositionEvent> event = e;
 				win::WindowPositionEventData& data = event->GetData();
 
-				auto windows = _windows.get_access();
+				auto windows = _windows.get_shared_access();
 				for (auto it = windows->begin(); it != windows->end(); it++)
 					if ((*it)->GetUid() == data.windowId)
 					{
@@ -138,7 +138,7 @@ namespace np::app
 				mem::sptr<win::WindowSizeEvent> event = e;
 				win::WindowSizeEventData& data = event->GetData();
 
-				auto windows = _windows.get_access();
+				auto windows = _windows.get_shared_access();
 				for (auto it = windows->begin(); it != windows->end(); it++)
 					if ((*it)->GetUid() == data.windowId)
 					{
@@ -153,7 +153,7 @@ namespace np::app
 			mem::sptr<win::WindowCloseEvent> event = e;
 			win::WindowEventData& data = event->GetData();
 
-			auto windows = _windows.get_access();
+			auto windows = _windows.get_shared_access();
 			for (auto it = windows->begin(); it != windows->end(); it++)
 				if ((*it)->GetUid() == data.windowId)
 				{
@@ -167,7 +167,7 @@ namespace np::app
 			mem::sptr<win::WindowCloseEvent> event = e;
 			win::WindowEventData& data = event->GetData();
 
-			auto windows = _windows.get_access();
+			auto windows = _windows.get_shared_access();
 			for (auto it = windows->begin(); it != windows->end(); it++)
 			{
 				if ((*it)->GetUid() == data.windowId)
@@ -236,6 +236,15 @@ namespace np::app
 			}
 		}
 
+		bl HasNullWindow() const
+		{
+			auto windows = _windows.get_shared_access();
+			for (auto it = windows->begin(); it != windows->end(); it++)
+				if (!*it)
+					return true;
+			return false;
+		}
+
 		bl IsOwningThread() const
 		{
 			return _owning_thread_id == thr::this_thread::get_id();
@@ -246,6 +255,7 @@ namespace np::app
 		{
 			win::Window::Init(win::DetailType::Glfw);
 			win::Window::Init(win::DetailType::Sdl);
+			win::Window::Init(win::DetailType::Headless);
 		}
 
 		virtual ~WindowLayer()
@@ -255,6 +265,7 @@ namespace np::app
 
 			win::Window::Terminate(win::DetailType::Glfw);
 			win::Window::Terminate(win::DetailType::Sdl);
+			win::Window::Terminate(win::DetailType::Headless);
 		}
 
 		mem::sptr<win::Window> CreateWindow(win::DetailType detail_type, uid::Uid id)
@@ -277,7 +288,7 @@ namespace np::app
 		mem::sptr<win::Window> Get(uid::Uid id)
 		{
 			mem::sptr<win::Window> window = nullptr;
-			auto windows = _windows.get_access();
+			auto windows = _windows.get_shared_access();
 			for (auto it = windows->begin(); !window && it != windows->end(); it++)
 				if ((*it)->GetUid() == id)
 					window = *it;
@@ -307,10 +318,14 @@ namespace np::app
 		{
 			win::Window::Update(win::DetailType::Glfw);
 			win::Window::Update(win::DetailType::Sdl);
+			win::Window::Update(win::DetailType::Headless);
 		}
 
 		void CleanupPoll() override
 		{
+			if (_to_destroy.get_access()->empty() && !HasNullWindow())
+				return;
+
 			auto windows = _windows.get_access();
 			for (auto wit = windows->begin(); wit != windows->end();)
 			{
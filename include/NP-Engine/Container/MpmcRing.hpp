@@ -0,0 +1,147 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+/*
+	Reference:
+		- <https://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue>
+*/
+
+#ifndef NP_ENGINE_CON_MPMC_RING_HPP
+#define NP_ENGINE_CON_MPMC_RING_HPP
+
+#include <utility>
+
+#include "NP-Engine/Primitive/Primitive.hpp"
+
+#include "Container.hpp"
+
+namespace np::con
+{
+	/*
+		bounded multi-producer multi-consumer ring, in the order values were pushed
+		producers and consumers only touch their claimed slot, with one cas on the shared position
+		capacity is rounded up to a power of 2
+	*/
+	template <class T>
+	class mpmc_ring
+	{
+	protected:
+		struct slot
+		{
+			atm_siz sequence{0};
+			T value{};
+		};
+
+		vector<slot> _slots;
+		siz _mask;
+		alignas(64) atm_siz _push_position;
+		alignas(64) atm_siz _pop_position;
+
+		static siz calc_capacity(siz capacity)
+		{
+			siz c = 2;
+			while (c < capacity)
+				c <<= 1;
+			return c;
+		}
+
+	public:
+		mpmc_ring(siz capacity):
+			_slots(calc_capacity(capacity)),
+			_mask(_slots.size() - 1),
+			_push_position(0),
+			_pop_position(0)
+		{
+			for (siz i = 0; i < _slots.size(); i++)
+				_slots[i].sequence.store(i, mo_relaxed);
+		}
+
+		/*
+			assigns the given value to a free slot, returns false when full
+			T may take assignment from other types, so values can be built in place in the slot's storage
+		*/
+		template <class U>
+		bl try_push(U&& value)
+		{
+			siz position = _push_position.load(mo_relaxed);
+			slot* s = nullptr;
+
+			while (!s)
+			{
+				slot& candidate = _slots[position & _mask];
+				const siz sequence = candidate.sequence.load(mo_acquire);
+				const i64 difference = (i64)sequence - (i64)position;
+
+				if (difference == 0)
+				{
+					if (_push_position.compare_exchange_weak(position, position + 1, mo_relaxed))
+						s = &candidate;
+				}
+				else if (difference < 0)
+				{
+					return false;
+				}
+				else
+				{
+					position = _push_position.load(mo_relaxed);
+				}
+			}
+
+			s->value = ::std::forward<U>(value);
+			s->sequence.store(position + 1, mo_release);
+			return true;
+		}
+
+		/*
+			swaps the oldest value into the given one, returns false when empty
+			swapping hands the slot the given value's old storage, so buffers inside T keep getting reused
+		*/
+		bl try_pop(T& value)
+		{
+			siz position = _pop_position.load(mo_relaxed);
+			slot* s = nullptr;
+
+			while (!s)
+			{
+				slot& candidate = _slots[position & _mask];
+				const siz sequence = candidate.sequence.load(mo_acquire);
+				const i64 difference = (i64)sequence - (i64)(position + 1);
+
+				if (difference == 0)
+				{
+					if (_pop_position.compare_exchange_weak(position, position + 1, mo_relaxed))
+						s = &candidate;
+				}
+				else if (difference < 0)
+				{
+					return false;
+				}
+				else
+				{
+					position = _pop_position.load(mo_relaxed);
+				}
+			}
+
+			::std::swap(value, s->value);
+			s->sequence.store(position + _mask + 1, mo_release);
+			return true;
+		}
+
+		siz size() const
+		{
+			const siz pushed = _push_position.load(mo_relaxed);
+			const siz popped = _pop_position.load(mo_relaxed);
+			return pushed > popped ? pushed - popped : 0;
+		}
+
+		siz capacity() const
+		{
+			return _slots.size();
+		}
+	};
+} // namespace np::con
+
+#endif /* NP_ENGINE_CON_MPMC_RING_HPP */
@@ -13,6 +13,7 @@
 #include "NP-Engine/Primitive/Primitive.hpp"
 #include "NP-Engine/Memory/Memory.hpp"
 #include "NP-Engine/Container/Container.hpp"
+#include "NP-Engine/Insight/Metrics.hpp"
 
 #include "EventImpl.hpp"
 
@@ -30,6 +31,24 @@ namespace np::evnt
 			return flag ? _events_queues.front() : _events_queues.back();
 		}
 
+		static nsit::metric_counter& GetPushedCounter()
+		{
+			static nsit::metric_counter& counter = nsit::metrics::get_counter("np_evnt_events_pushed_total", "events pushed");
+			return counter;
+		}
+
+		static nsit::metric_counter& GetPoppedCounter()
+		{
+			static nsit::metric_counter& counter = nsit::metrics::get_counter("np_evnt_events_popped_total", "events popped");
+			return counter;
+		}
+
+		static nsit::metric_gauge& GetDepthGauge()
+		{
+			static nsit::metric_gauge& gauge = nsit::metrics::get_gauge("np_evnt_queued_events", "events waiting in event queues");
+			return gauge;
+		}
+
 	public:
 		EventQueue(): _flag(true) {}
 
@@ -42,6 +61,8 @@ namespace np::evnt
 		void Push(mem::sptr<Event> e)
 		{
 			GetQueue(_flag.load(mo_acquire)).get_access()->emplace(e);
+			GetPushedCounter().increment();
+			GetDepthGauge().increment();
 		}
 
 		mem::sptr<Event> Pop()
@@ -52,6 +73,8 @@ namespace np::evnt
 			{
 				e = queue->front();
 				queue->pop();
+				GetPoppedCounter().increment();
+				GetDepthGauge().decrement();
 			}
 			return e;
 		}
@@ -61,6 +84,7 @@ namespace np::evnt
 			for (auto it = _events_queues.begin(); it != _events_queues.end(); it++)
 			{
 				auto queue = it->get_access();
+				GetDepthGauge().sub((i64)queue->size());
 				while (!queue->empty())
 					queue->pop();
 			}
@@ -58,6 +58,27 @@ namespace np::fsys
 			::std::filesystem::create_directories(::std::filesystem::path(s));
 	}
 
+	/*
+		removes the given file, or the given dir and everything in it
+	*/
+	static inline void remove_all(::std::string s)
+	{
+		::std::error_code error;
+		if (s.size() > 0)
+			::std::filesystem::remove_all(::std::filesystem::path(s), error);
+	}
+
+	/*
+		moves the given file or dir to the given path, replacing a file there -- returns false when it could not
+	*/
+	static inline bl rename(::std::string from, ::std::string to)
+	{
+		::std::error_code error;
+		if (from.size() > 0 && to.size() > 0)
+			::std::filesystem::rename(::std::filesystem::path(from), ::std::filesystem::path(to), error);
+		return from.size() > 0 && to.size() > 0 && !error;
+	}
+
 	/*
 		gets the current working directory path
 	*/
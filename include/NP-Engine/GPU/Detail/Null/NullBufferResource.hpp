@@ -0,0 +1,118 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#ifndef NP_ENGINE_GPU_NULL_BUFFER_RESOURCE_HPP
+#define NP_ENGINE_GPU_NULL_BUFFER_RESOURCE_HPP
+
+#include "NP-Engine/Primitive/Primitive.hpp"
+#include "NP-Engine/Memory/Memory.hpp"
+#include "NP-Engine/Container/Container.hpp"
+
+#include "NP-Engine/GPU/Interface/BufferResource.hpp"
+
+namespace np::gpu::__detail
+{
+	/*
+		host memory standing in for device memory, so writes cost what a mapped write would
+	*/
+	class NullBufferResource : public BufferResource
+	{
+	private:
+		mem::sptr<Device> _device;
+		BufferResourceUsage _usage;
+		con::vector<DeviceQueueFamily> _queue_families;
+		con::vector<ui8> _bytes;
+
+		bl IsInRange(siz offset, siz byte_count) const
+		{
+			return offset <= _bytes.size() && byte_count <= _bytes.size() - offset;
+		}
+
+	public:
+		NullBufferResource(mem::sptr<Device> device, BufferResourceUsage usage, siz size,
+						   const con::vector<DeviceQueueFamily>& queue_families):
+			_device(device),
+			_usage(usage),
+			_queue_families(queue_families),
+			_bytes(size)
+		{}
+
+		virtual ~NullBufferResource() = default;
+
+		virtual DetailType GetDetailType() const override
+		{
+			return DetailType::Null;
+		}
+
+		virtual mem::sptr<srvc::Services> GetServices() const override
+		{
+			return _device->GetServices();
+		}
+
+		virtual mem::sptr<Device> GetDevice() const override
+		{
+			return _device;
+		}
+
+		BufferResourceUsage GetUsage() const
+		{
+			return _usage;
+		}
+
+		virtual siz GetSize() const override
+		{
+			return _bytes.size();
+		}
+
+		virtual con::vector<DeviceQueueFamily> GetDeviceQueueFamilies() const override
+		{
+			return _queue_families;
+		}
+
+		virtual bl Resize(siz size) override
+		{
+			_bytes.resize(size);
+			return true;
+		}
+
+		virtual bl SetBytes(siz offset, const void* src, siz byte_count) override
+		{
+			if (!IsInRange(offset, byte_count))
+				return false;
+
+			if (byte_count > 0)
+				mem::copy_bytes(_bytes.data() + offset, src, byte_count);
+			return true;
+		}
+
+		virtual bl GetBytes(siz offset, void* dst, siz byte_count) override
+		{
+			if (!IsInRange(offset, byte_count))
+				return false;
+
+			if (byte_count > 0)
+				mem::copy_bytes(dst, _bytes.data() + offset, byte_count);
+			return true;
+		}
+
+		virtual void* GetMapping() const override
+		{
+			return _usage.Contains(BufferResourceUsage::HostAccessible) ? (void*)_bytes.data() : nullptr;
+		}
+
+		virtual bl ClearCacheForDevice(siz offset, siz size) override
+		{
+			return IsInRange(offset, size);
+		}
+
+		virtual bl ClearCacheForHost(siz offset, siz size) override
+		{
+			return IsInRange(offset, size);
+		}
+	};
+} // namespace np::gpu::__detail
+
+#endif /* NP_ENGINE_GPU_NULL_BUFFER_RESOURCE_HPP */
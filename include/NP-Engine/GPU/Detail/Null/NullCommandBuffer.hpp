@@ -0,0 +1,127 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#ifndef NP_ENGINE_GPU_NULL_COMMAND_BUFFER_HPP
+#define NP_ENGINE_GPU_NULL_COMMAND_BUFFER_HPP
+
+#include "NP-Engine/Primitive/Primitive.hpp"
+#include "NP-Engine/Memory/Memory.hpp"
+#include "NP-Engine/Container/Container.hpp"
+
+#include "NP-Engine/GPU/Interface/CommandBuffer.hpp"
+#include "NP-Engine/GPU/Interface/CommandStream.hpp"
+
+namespace np::gpu::__detail
+{
+	/*
+		keeps the type of every command recorded into it, and the secondary command buffers it executes, until reset
+		commands apply through const command buffers, so recording goes through const methods too
+	*/
+	class NullCommandBuffer : public CommandBuffer
+	{
+	private:
+		mem::sptr<srvc::Services> _services;
+		bl _is_secondary;
+		mutable con::vector<CommandType> _commands;
+		mutable con::vector<const NullCommandBuffer*> _executed;
+		con::vector<mem::sptr<CommandBuffer>> _dependencies;
+
+	public:
+		NullCommandBuffer(mem::sptr<srvc::Services> services, bl is_secondary):
+			_services(services),
+			_is_secondary(is_secondary)
+		{}
+
+		virtual ~NullCommandBuffer() = default;
+
+		virtual DetailType GetDetailType() const override
+		{
+			return DetailType::Null;
+		}
+
+		virtual mem::sptr<srvc::Services> GetServices() const override
+		{
+			return _services;
+		}
+
+		bl IsSecondary() const
+		{
+			return _is_secondary;
+		}
+
+		void AddCommand(CommandType type) const
+		{
+			_commands.emplace_back(type);
+		}
+
+		void AddExecuted(const CommandBuffer* command_buffer) const
+		{
+			if (command_buffer && command_buffer->GetDetailType() == DetailType::Null)
+				_executed.emplace_back(static_cast<const NullCommandBuffer*>(command_buffer));
+		}
+
+		const con::vector<CommandType>& GetCommands() const
+		{
+			return _commands;
+		}
+
+		const con::vector<const NullCommandBuffer*>& GetExecuted() const
+		{
+			return _executed;
+		}
+
+		void Clear()
+		{
+			_commands.clear();
+			_executed.clear();
+		}
+
+		virtual bl DependOn(mem::sptr<CommandBuffer> other) override
+		{
+			if (!other)
+				return false;
+
+			_dependencies.emplace_back(other);
+			return true;
+		}
+
+		virtual con::vector<mem::sptr<CommandBuffer>> GetDependencies() const override
+		{
+			return _dependencies;
+		}
+
+		/*
+			walks the stream's packets like VulkanCommandStream does, so the null backend pays for the same traversal
+		*/
+		static bl Record(const NullCommandBuffer& command_buffer, const CommandStream& stream)
+		{
+			bl recorded = true;
+			const ui8* it = stream.GetData();
+			const ui8* end = it + stream.GetSize();
+			for (; recorded && it < end; it += ((const CommandStream::Packet*)it)->size)
+			{
+				const CommandStream::Packet* packet = (const CommandStream::Packet*)it;
+				recorded = packet->type != CommandType::None && packet->size >= sizeof(CommandStream::Packet);
+				if (!recorded)
+					break;
+
+				command_buffer.AddCommand(packet->type);
+				if (packet->type == CommandType::ExecuteCommands)
+				{
+					const CommandStream::ExecuteCommandsPayload* payload =
+						CommandStream::GetPayload<CommandStream::ExecuteCommandsPayload>(packet);
+					CommandBuffer* const* command_buffers = CommandStream::GetArray<CommandBuffer*>(payload);
+					for (siz i = 0; i < payload->commandBufferCount; i++)
+						command_buffer.AddExecuted(command_buffers[i]);
+				}
+			}
+
+			return recorded;
+		}
+	};
+} // namespace np::gpu::__detail
+
+#endif /* NP_ENGINE_GPU_NULL_COMMAND_BUFFER_HPP */
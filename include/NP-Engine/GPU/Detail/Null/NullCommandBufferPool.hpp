@@ -0,0 +1,122 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#ifndef NP_ENGINE_GPU_NULL_COMMAND_BUFFER_POOL_HPP
+#define NP_ENGINE_GPU_NULL_COMMAND_BUFFER_POOL_HPP
+
+#include <algorithm>
+
+#include "NP-Engine/Primitive/Primitive.hpp"
+#include "NP-Engine/Memory/Memory.hpp"
+#include "NP-Engine/Container/Container.hpp"
+
+#include "NP-Engine/GPU/Interface/CommandBufferPool.hpp"
+
+#include "NullCommandBuffer.hpp"
+
+namespace np::gpu::__detail
+{
+	class NullCommandBufferPool : public CommandBufferPool
+	{
+	private:
+		mem::sptr<srvc::Services> _services;
+		CommandBufferPoolUsage _usage;
+		con::vector<mem::wptr<NullCommandBuffer>> _command_buffers; // for ResetAll
+
+		mem::sptr<CommandBuffer> CreateCommandBuffer(bl is_secondary)
+		{
+			_command_buffers.erase(::std::remove_if(_command_buffers.begin(), _command_buffers.end(),
+													[](const mem::wptr<NullCommandBuffer>& command_buffer)
+													{
+														return command_buffer.is_expired();
+													}),
+								   _command_buffers.end());
+
+			mem::sptr<NullCommandBuffer> command_buffer =
+				mem::create_sptr<NullCommandBuffer>(_services->GetAllocator(), _services, is_secondary);
+			_command_buffers.emplace_back(command_buffer);
+			return command_buffer;
+		}
+
+		static NullCommandBuffer* GetNullCommandBuffer(mem::sptr<CommandBuffer> command_buffer)
+		{
+			return command_buffer && command_buffer->GetDetailType() == DetailType::Null
+				? static_cast<NullCommandBuffer*>(mem::address_of(*command_buffer))
+				: nullptr;
+		}
+
+	public:
+		NullCommandBufferPool(mem::sptr<srvc::Services> services, CommandBufferPoolUsage usage):
+			_services(services),
+			_usage(usage)
+		{}
+
+		virtual ~NullCommandBufferPool() = default;
+
+		virtual DetailType GetDetailType() const override
+		{
+			return DetailType::Null;
+		}
+
+		virtual mem::sptr<srvc::Services> GetServices() const override
+		{
+			return _services;
+		}
+
+		virtual mem::sptr<CommandBuffer> CreateCommandBuffer() override
+		{
+			return CreateCommandBuffer(false);
+		}
+
+		virtual mem::sptr<CommandBuffer> CreateSecondaryCommandBuffer() override
+		{
+			return CreateCommandBuffer(true);
+		}
+
+		virtual bl Begin(mem::sptr<CommandBuffer> command_buffer, CommandBufferUsage usage) override
+		{
+			NullCommandBuffer* null_command_buffer = GetNullCommandBuffer(command_buffer);
+			if (null_command_buffer)
+				null_command_buffer->Clear();
+			return null_command_buffer != nullptr;
+		}
+
+		virtual bl BeginSecondary(mem::sptr<CommandBuffer> command_buffer, CommandBufferUsage usage,
+								  mem::sptr<Framebuffer> framebuffer, ui32 subpass_index) override
+		{
+			NullCommandBuffer* null_command_buffer = GetNullCommandBuffer(command_buffer);
+			if (null_command_buffer)
+				null_command_buffer->Clear();
+			return null_command_buffer && null_command_buffer->IsSecondary();
+		}
+
+		virtual bl End(mem::sptr<CommandBuffer> command_buffer, CommandBufferUsage usage) override
+		{
+			return GetNullCommandBuffer(command_buffer) != nullptr;
+		}
+
+		virtual bl Reset(mem::sptr<CommandBuffer> command_buffer, CommandBufferUsage usage) override
+		{
+			NullCommandBuffer* null_command_buffer = GetNullCommandBuffer(command_buffer);
+			if (null_command_buffer)
+				null_command_buffer->Clear();
+			return null_command_buffer != nullptr;
+		}
+
+		virtual bl ResetAll() override
+		{
+			for (mem::wptr<NullCommandBuffer>& weak_command_buffer : _command_buffers)
+			{
+				mem::sptr<NullCommandBuffer> command_buffer = weak_command_buffer.get_sptr();
+				if (command_buffer)
+					command_buffer->Clear();
+			}
+			return true;
+		}
+	};
+} // namespace np::gpu::__detail
+
+#endif /* NP_ENGINE_GPU_NULL_COMMAND_BUFFER_POOL_HPP */
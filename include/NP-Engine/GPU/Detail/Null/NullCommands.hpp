@@ -0,0 +1,89 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#ifndef NP_ENGINE_GPU_NULL_COMMANDS_HPP
+#define NP_ENGINE_GPU_NULL_COMMANDS_HPP
+
+#include "NP-Engine/Primitive/Primitive.hpp"
+#include "NP-Engine/Memory/Memory.hpp"
+
+#include "NP-Engine/GPU/Interface/Commands.hpp"
+
+#include "NullCommandBuffer.hpp"
+
+namespace np::gpu::__detail
+{
+	/*
+		every command type applies the same way here -- its type is recorded into the null command buffer
+	*/
+	template <typename COMMAND>
+	class NullCommand : public COMMAND
+	{
+	protected:
+		virtual bl ApplyTo(const CommandBuffer* command_buffer) override
+		{
+			if (!command_buffer || command_buffer->GetDetailType() != DetailType::Null)
+				return false;
+
+			static_cast<const NullCommandBuffer*>(command_buffer)->AddCommand(COMMAND::GetCommandType());
+			return true;
+		}
+
+	public:
+		virtual DetailType GetDetailType() const override
+		{
+			return DetailType::Null;
+		}
+
+		virtual bl IsPrepared() const override
+		{
+			return true;
+		}
+	};
+
+	class NullExecuteCommandsCommand : public NullCommand<ExecuteCommandsCommand>
+	{
+	protected:
+		virtual bl ApplyTo(const CommandBuffer* command_buffer) override
+		{
+			if (!NullCommand<ExecuteCommandsCommand>::ApplyTo(command_buffer))
+				return false;
+
+			const NullCommandBuffer* null_command_buffer = static_cast<const NullCommandBuffer*>(command_buffer);
+			for (const mem::sptr<CommandBuffer>& executed : commandBuffers)
+				null_command_buffer->AddExecuted(executed ? mem::address_of(*executed) : nullptr);
+			return true;
+		}
+	};
+
+	/*
+		writes the payloads into the null buffer as given, so they can be inspected there
+	*/
+	template <typename COMMAND, typename PAYLOAD>
+	class NullIndirectCommand : public NullCommand<COMMAND>
+	{
+	public:
+		virtual bl Prepare(siz offset, const con::vector<PAYLOAD>& payloads) override
+		{
+			bl prepared = this->buffer && this->buffer->GetDetailType() == DetailType::Null &&
+				this->buffer->SetBytes(offset, payloads.data(), payloads.size() * sizeof(PAYLOAD));
+
+			if (prepared)
+			{
+				this->payloadOffset = offset;
+				this->payloadCount = payloads.size();
+			}
+
+			return prepared;
+		}
+	};
+
+	using NullDrawIndirectCommand = NullIndirectCommand<DrawIndirectCommand, DrawIndirectCommandPayload>;
+	using NullDrawIndexedIndirectCommand =
+		NullIndirectCommand<DrawIndexedIndirectCommand, DrawIndexedIndirectCommandPayload>;
+} // namespace np::gpu::__detail
+
+#endif /* NP_ENGINE_GPU_NULL_COMMANDS_HPP */
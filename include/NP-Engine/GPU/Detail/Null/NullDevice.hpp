@@ -0,0 +1,204 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#ifndef NP_ENGINE_GPU_NULL_DEVICE_HPP
+#define NP_ENGINE_GPU_NULL_DEVICE_HPP
+
+#include <algorithm>
+
+#include "NP-Engine/Primitive/Primitive.hpp"
+#include "NP-Engine/Memory/Memory.hpp"
+#include "NP-Engine/Container/Container.hpp"
+#include "NP-Engine/Time/Time.hpp"
+
+#include "NP-Engine/GPU/Interface/Device.hpp"
+#include "NP-Engine/GPU/Interface/Queue.hpp"
+
+#include "NullInstance.hpp"
+#include "NullCommandBuffer.hpp"
+#include "NullFence.hpp"
+#include "NullSemaphore.hpp"
+#include "NullFlag.hpp"
+#include "NullPipelineCache.hpp"
+
+namespace np::gpu::__detail
+{
+	/*
+		everything submitted to a null device's queues, counting the secondary command buffers they executed
+	*/
+	struct NullRecord
+	{
+		siz submitCount = 0;
+		siz commandBufferCount = 0;
+		siz commandCount = 0;
+		siz drawCount = 0;
+		siz presentCount = 0;
+		con::vector<siz> commandCounts = con::vector<siz>((siz)CommandType::DrawIndexedIndirect + 1); // by CommandType
+		tim::milliseconds executeTime{0}; // fake gpu time
+	};
+
+	/*
+		one queue family that does everything, and a fake gpu timeline that runs submissions one after another
+	*/
+	class NullDevice : public Device
+	{
+	private:
+		mem::sptr<NullInstance> _instance;
+		mem::sptr<PresentTarget> _target;
+		mem::sptr<PipelineCache> _pipeline_cache;
+		mutable mutex _m;
+		NullLatencies _latencies;
+		NullRecord _record;
+		tim::steady_timestamp _idle_timestamp; // when the fake gpu finishes what was submitted
+
+		void AddToRecord(const NullCommandBuffer& command_buffer)
+		{
+			_record.commandBufferCount++;
+			for (CommandType type : command_buffer.GetCommands())
+			{
+				_record.commandCount++;
+				_record.commandCounts[(siz)type]++;
+				if (type == CommandType::Draw || type == CommandType::DrawIndexed || type == CommandType::DrawIndirect ||
+					type == CommandType::DrawIndexedIndirect)
+					_record.drawCount++;
+			}
+
+			for (const NullCommandBuffer* executed : command_buffer.GetExecuted())
+				AddToRecord(*executed);
+		}
+
+	public:
+		NullDevice(mem::sptr<DetailInstance> instance, DeviceUsage usage, mem::sptr<PresentTarget> target):
+			_instance(instance),
+			_target(target),
+			_pipeline_cache(mem::create_sptr<NullPipelineCache>(_instance->GetServices()->GetAllocator())),
+			_latencies(_instance->GetLatencies()),
+			_record{},
+			_idle_timestamp(tim::steady_clock::now())
+		{}
+
+		virtual ~NullDevice() = default;
+
+		virtual DetailType GetDetailType() const override
+		{
+			return DetailType::Null;
+		}
+
+		virtual mem::sptr<srvc::Services> GetServices() const override
+		{
+			return _instance->GetServices();
+		}
+
+		virtual mem::sptr<DetailInstance> GetDetailInstance() const override
+		{
+			return _instance;
+		}
+
+		virtual mem::sptr<PresentTarget> GetPresentTarget() const override
+		{
+			return _target;
+		}
+
+		virtual con::vector<DeviceQueueFamily> GetDeviceQueueFamilies() const override
+		{
+			return {{0, 1, DeviceQueueUsage::Present | DeviceQueueUsage::Graphics | DeviceQueueUsage::Compute}};
+		}
+
+		virtual mem::sptr<PipelineCache> GetPipelineCache() const override
+		{
+			return _pipeline_cache;
+		}
+
+		virtual mem::sptr<PipelineCache> CreatePipelineCache(const con::vector<ui8>& bytes) const override
+		{
+			return mem::create_sptr<NullPipelineCache>(GetServices()->GetAllocator());
+		}
+
+		virtual mem::sptr<Fence> CreateFence() override
+		{
+			return mem::create_sptr<NullFence>(GetServices()->GetAllocator(), GetServices());
+		}
+
+		virtual mem::sptr<Semaphore> CreateSemaphore() override
+		{
+			return mem::create_sptr<NullSemaphore>(GetServices()->GetAllocator(), GetServices());
+		}
+
+		virtual mem::sptr<Flag> CreateFlag() override
+		{
+			return mem::create_sptr<NullFlag>(GetServices()->GetAllocator(), GetServices());
+		}
+
+		virtual void WaitUntilIdle() const override
+		{
+			tim::steady_timestamp idle_timestamp;
+			{
+				scoped_lock lock(_m);
+				idle_timestamp = _idle_timestamp;
+			}
+
+			while (tim::steady_clock::now() < idle_timestamp)
+				thr::this_thread::yield();
+		}
+
+		/*
+			counts the given submittals and queues their fake gpu time, returning when it completes
+			spends the submit latency on this thread first
+		*/
+		tim::steady_timestamp Submit(const con::vector<gpu::Submit>& submittals)
+		{
+			null_spend(GetLatencies().submit);
+
+			scoped_lock lock(_m);
+			for (const gpu::Submit& submit : submittals)
+			{
+				_record.submitCount++;
+				for (const mem::sptr<CommandBuffer>& command_buffer : submit.commandBuffers)
+					if (command_buffer && command_buffer->GetDetailType() == DetailType::Null)
+						AddToRecord(static_cast<const NullCommandBuffer&>(*command_buffer));
+			}
+
+			_idle_timestamp = ::std::max(_idle_timestamp, tim::steady_clock::now()) +
+				tim::duration_cast<tim::steady_clock::duration>(_latencies.execute);
+			_record.executeTime += _latencies.execute;
+			return _idle_timestamp;
+		}
+
+		void Present()
+		{
+			null_spend(GetLatencies().present);
+
+			scoped_lock lock(_m);
+			_record.presentCount++;
+		}
+
+		NullLatencies GetLatencies() const
+		{
+			scoped_lock lock(_m);
+			return _latencies;
+		}
+
+		void SetLatencies(const NullLatencies& latencies)
+		{
+			scoped_lock lock(_m);
+			_latencies = latencies;
+		}
+
+		NullRecord GetRecord() const
+		{
+			scoped_lock lock(_m);
+			return _record;
+		}
+
+		void ResetRecord()
+		{
+			scoped_lock lock(_m);
+			_record = {};
+		}
+	};
+} // namespace np::gpu::__detail
+
+#endif /* NP_ENGINE_GPU_NULL_DEVICE_HPP */
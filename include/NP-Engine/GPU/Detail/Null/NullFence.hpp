@@ -0,0 +1,110 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#ifndef NP_ENGINE_GPU_NULL_FENCE_HPP
+#define NP_ENGINE_GPU_NULL_FENCE_HPP
+
+#include "NP-Engine/Primitive/Primitive.hpp"
+#include "NP-Engine/Memory/Memory.hpp"
+#include "NP-Engine/Time/Time.hpp"
+#include "NP-Engine/Thread/Thread.hpp"
+
+#include "NP-Engine/GPU/Interface/Fence.hpp"
+
+namespace np::gpu::__detail
+{
+	/*
+		signals once the fake gpu time of the submission it was given to has passed
+		made signaled, like our vulkan fences, and waiting on one nothing was submitted with returns NotReady at once
+		instead of blocking forever
+	*/
+	class NullFence : public Fence
+	{
+	private:
+		mem::sptr<srvc::Services> _services;
+		mutable mutex _m;
+		mutable bl _is_signaled;
+		bl _is_pending;
+		tim::steady_timestamp _signal_timestamp;
+
+		/*
+			must be called under our lock
+		*/
+		bl IsSignaled(tim::steady_timestamp now) const
+		{
+			if (!_is_signaled && _is_pending && now >= _signal_timestamp)
+				_is_signaled = true;
+			return _is_signaled;
+		}
+
+	public:
+		NullFence(mem::sptr<srvc::Services> services):
+			_services(services),
+			_is_signaled(true),
+			_is_pending(false),
+			_signal_timestamp()
+		{}
+
+		virtual ~NullFence() = default;
+
+		virtual DetailType GetDetailType() const override
+		{
+			return DetailType::Null;
+		}
+
+		virtual mem::sptr<srvc::Services> GetServices() const override
+		{
+			return _services;
+		}
+
+		/*
+			called by NullQueue::Submit with the fake time the submission completes
+		*/
+		void Signal(tim::steady_timestamp timestamp)
+		{
+			scoped_lock lock(_m);
+			_is_signaled = false;
+			_is_pending = true;
+			_signal_timestamp = timestamp;
+		}
+
+		virtual Result Wait(tim::milliseconds timeout) const override
+		{
+			const tim::steady_timestamp start = tim::steady_clock::now();
+			for (tim::steady_timestamp now = start;; now = tim::steady_clock::now())
+			{
+				{
+					scoped_lock lock(_m);
+					if (IsSignaled(now))
+						return Result::Success;
+					if (!_is_pending)
+						return Result::NotReady;
+				}
+
+				if (now - start >= timeout)
+					return Result::NotReady;
+
+				thr::this_thread::yield();
+			}
+		}
+
+		virtual Result GetStatus() const override
+		{
+			scoped_lock lock(_m);
+			return IsSignaled(tim::steady_clock::now()) ? Result::Success : Result::NotReady;
+		}
+
+		virtual Result Reset() override
+		{
+			scoped_lock lock(_m);
+			_is_signaled = false;
+			_is_pending = false;
+			return Result::Success;
+		}
+	};
+} // namespace np::gpu::__detail
+
+#endif /* NP_ENGINE_GPU_NULL_FENCE_HPP */
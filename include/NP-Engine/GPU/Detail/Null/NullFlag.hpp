@@ -0,0 +1,57 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#ifndef NP_ENGINE_GPU_NULL_FLAG_HPP
+#define NP_ENGINE_GPU_NULL_FLAG_HPP
+
+#include "NP-Engine/Primitive/Primitive.hpp"
+#include "NP-Engine/Memory/Memory.hpp"
+
+#include "NP-Engine/GPU/Interface/Flag.hpp"
+
+namespace np::gpu::__detail
+{
+	class NullFlag : public Flag
+	{
+	private:
+		mem::sptr<srvc::Services> _services;
+		atm_bl _is_set;
+
+	public:
+		NullFlag(mem::sptr<srvc::Services> services): _services(services), _is_set(false) {}
+
+		virtual ~NullFlag() = default;
+
+		virtual DetailType GetDetailType() const override
+		{
+			return DetailType::Null;
+		}
+
+		virtual mem::sptr<srvc::Services> GetServices() const override
+		{
+			return _services;
+		}
+
+		virtual Result Set() override
+		{
+			_is_set.store(true, mo_release);
+			return Result::Success;
+		}
+
+		virtual Result GetStatus() const override
+		{
+			return _is_set.load(mo_acquire) ? Result::Success : Result::NotReady;
+		}
+
+		virtual Result Reset() override
+		{
+			_is_set.store(false, mo_release);
+			return Result::Success;
+		}
+	};
+} // namespace np::gpu::__detail
+
+#endif /* NP_ENGINE_GPU_NULL_FLAG_HPP */
@@ -0,0 +1,205 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#ifndef NP_ENGINE_GPU_NULL_FRAME_CONTEXT_HPP
+#define NP_ENGINE_GPU_NULL_FRAME_CONTEXT_HPP
+
+// number of frames a null frame context cycles through, like a swapchain with triple buffering
+#ifndef NP_ENGINE_GPU_NULL_FRAME_COUNT
+	#define NP_ENGINE_GPU_NULL_FRAME_COUNT 3
+#endif
+
+#include "NP-Engine/Primitive/Primitive.hpp"
+#include "NP-Engine/Memory/Memory.hpp"
+#include "NP-Engine/Container/Container.hpp"
+#include "NP-Engine/Services/Services.hpp"
+
+#include "NP-Engine/Vendor/GlmInclude.hpp"
+
+#include "NP-Engine/GPU/Interface/FrameContext.hpp"
+#include "NP-Engine/GPU/Interface/PresentTarget.hpp"
+#include "NP-Engine/GPU/Interface/ImageResource.hpp"
+
+namespace np::gpu::__detail
+{
+	struct NullFrame : public Frame
+	{
+		mem::sptr<srvc::Services> services;
+		siz index;
+		mem::sptr<ImageResource> image;
+		mem::sptr<ImageResourceView> view;
+
+		NullFrame(mem::sptr<srvc::Services> services_, siz index_, mem::sptr<ImageResource> image_,
+				  mem::sptr<ImageResourceView> view_):
+			services(services_),
+			index(index_),
+			image(image_),
+			view(view_)
+		{}
+
+		virtual ~NullFrame() = default;
+
+		virtual DetailType GetDetailType() const override
+		{
+			return DetailType::Null;
+		}
+
+		virtual mem::sptr<srvc::Services> GetServices() const override
+		{
+			return services;
+		}
+
+		virtual mem::sptr<ImageResourceView> GetImageResourceView() const override
+		{
+			return view;
+		}
+	};
+
+	/*
+		frames take turns in order, sized to the framebuffer of the device's present target window
+		acquiring reports OutOfDate once that framebuffer is resized, so callers rebuild like they would a swapchain
+	*/
+	class NullFrameContext : public FrameContext
+	{
+	private:
+		mem::sptr<Device> _device;
+		con::vector<DeviceQueueFamily> _queue_families;
+		::glm::uvec2 _extent;
+		con::vector<mem::sptr<NullFrame>> _frames;
+		siz _acquire_frame_timeout;
+		siz _acquired_frame_index;
+		siz _prev_acquired_frame_index;
+
+		::glm::uvec2 GetTargetExtent() const
+		{
+			mem::sptr<PresentTarget> target = _device->GetPresentTarget();
+			mem::sptr<win::Window> window = target ? target->GetWindow() : nullptr;
+			return window ? window->GetFramebufferSize() : _extent;
+		}
+
+		void RebuildFrames()
+		{
+			const ImageResourceUsage usage = ImageResourceUsage::Color;
+			mem::sptr<srvc::Services> services = _device->GetServices();
+
+			_frames.clear();
+			for (siz i = 0; i < NP_ENGINE_GPU_NULL_FRAME_COUNT; i++)
+			{
+				mem::sptr<ImageResource> image = ImageResource::Create(_device, usage | ImageResourceUsage::Present,
+																	   GetFrameFormat(), 1, 1, 1, _extent.x, _extent.y, 1,
+																	   _queue_families);
+				_frames.emplace_back(mem::create_sptr<NullFrame>(services->GetAllocator(), services, i, image,
+																 ImageResourceView::Create(_device, image, usage)));
+			}
+		}
+
+	public:
+		NullFrameContext(mem::sptr<Device> device, const con::vector<DeviceQueueFamily>& queue_families):
+			_device(device),
+			_queue_families(queue_families),
+			_extent(0),
+			_acquire_frame_timeout(SIZ_MAX),
+			_acquired_frame_index(SIZ_MAX),
+			_prev_acquired_frame_index(SIZ_MAX)
+		{
+			_extent = GetTargetExtent();
+			RebuildFrames();
+		}
+
+		virtual ~NullFrameContext() = default;
+
+		virtual DetailType GetDetailType() const override
+		{
+			return DetailType::Null;
+		}
+
+		virtual mem::sptr<srvc::Services> GetServices() const override
+		{
+			return _device->GetServices();
+		}
+
+		virtual mem::sptr<Device> GetDevice() const override
+		{
+			return _device;
+		}
+
+		virtual con::vector<DeviceQueueFamily> GetDeviceQueueFamilies() const override
+		{
+			return _queue_families;
+		}
+
+		virtual siz GetFrameWidth() const override
+		{
+			return _extent.x;
+		}
+
+		virtual siz GetFrameHeight() const override
+		{
+			return _extent.y;
+		}
+
+		virtual Format GetFrameFormat() const override
+		{
+			return Format{Format::Unsigned | Format::Integer | Format::GammaCorrection, 4, sizeof(ui8)};
+		}
+
+		virtual con::vector<mem::sptr<Frame>> GetFrames() const override
+		{
+			return {_frames.begin(), _frames.end()};
+		}
+
+		/*
+			frames are always ready, so we never wait
+		*/
+		virtual void SetAcquireFrameTimeout(siz timeout) override
+		{
+			_acquire_frame_timeout = timeout;
+		}
+
+		/*
+			semaphore and fence are left as they are -- our fake gpu never has a frame in use when it is acquired
+		*/
+		virtual Result TryAcquireFrame(mem::sptr<Semaphore> semaphore, mem::sptr<Fence> fence) override
+		{
+			if (GetTargetExtent() != _extent)
+				return Result::OutOfDate;
+
+			_prev_acquired_frame_index = _acquired_frame_index;
+			_acquired_frame_index = _acquired_frame_index < _frames.size() ? (_acquired_frame_index + 1) % _frames.size() : 0;
+			return Result::Success;
+		}
+
+		virtual mem::sptr<Frame> GetPrevAcquiredFrame() const override
+		{
+			return _prev_acquired_frame_index < _frames.size() ? _frames[_prev_acquired_frame_index] : nullptr;
+		}
+
+		virtual mem::sptr<Frame> GetAcquiredFrame() const override
+		{
+			return _acquired_frame_index < _frames.size() ? _frames[_acquired_frame_index] : nullptr;
+		}
+
+		virtual siz GetPrevAcquiredFrameIndex() const override
+		{
+			return _prev_acquired_frame_index;
+		}
+
+		virtual siz GetAcquiredFrameIndex() const override
+		{
+			return _acquired_frame_index;
+		}
+
+		virtual void Rebuild() override
+		{
+			_extent = GetTargetExtent();
+			_acquired_frame_index = SIZ_MAX;
+			_prev_acquired_frame_index = SIZ_MAX;
+			RebuildFrames();
+		}
+	};
+} // namespace np::gpu::__detail
+
+#endif /* NP_ENGINE_GPU_NULL_FRAME_CONTEXT_HPP */
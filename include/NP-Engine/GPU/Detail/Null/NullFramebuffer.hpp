@@ -0,0 +1,75 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#ifndef NP_ENGINE_GPU_NULL_FRAMEBUFFER_HPP
+#define NP_ENGINE_GPU_NULL_FRAMEBUFFER_HPP
+
+#include "NP-Engine/Memory/Memory.hpp"
+#include "NP-Engine/Container/Container.hpp"
+
+#include "NP-Engine/GPU/Interface/Framebuffer.hpp"
+
+namespace np::gpu::__detail
+{
+	class NullFramebuffer : public Framebuffer
+	{
+	private:
+		mem::sptr<RenderPass> _render_pass;
+		siz _width;
+		siz _height;
+		siz _layer_count;
+		con::vector<mem::sptr<ImageResourceView>> _views;
+
+	public:
+		NullFramebuffer(mem::sptr<RenderPass> render_pass, siz width, siz height, siz layer_count,
+						const con::vector<mem::sptr<ImageResourceView>>& views):
+			_render_pass(render_pass),
+			_width(width),
+			_height(height),
+			_layer_count(layer_count),
+			_views(views)
+		{}
+
+		virtual ~NullFramebuffer() = default;
+
+		virtual DetailType GetDetailType() const override
+		{
+			return DetailType::Null;
+		}
+
+		virtual mem::sptr<srvc::Services> GetServices() const override
+		{
+			return _render_pass->GetServices();
+		}
+
+		virtual mem::sptr<RenderPass> GetRenderPass() const override
+		{
+			return _render_pass;
+		}
+
+		virtual siz GetWidth() const override
+		{
+			return _width;
+		}
+
+		virtual siz GetHeight() const override
+		{
+			return _height;
+		}
+
+		virtual siz GetLayerCount() const override
+		{
+			return _layer_count;
+		}
+
+		virtual con::vector<mem::sptr<ImageResourceView>> GetImageResourceViews() const override
+		{
+			return _views;
+		}
+	};
+} // namespace np::gpu::__detail
+
+#endif /* NP_ENGINE_GPU_NULL_FRAMEBUFFER_HPP */
@@ -0,0 +1,76 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#ifndef NP_ENGINE_GPU_NULL_GRAPHICS_PIPELINE_HPP
+#define NP_ENGINE_GPU_NULL_GRAPHICS_PIPELINE_HPP
+
+#include "NP-Engine/Memory/Memory.hpp"
+#include "NP-Engine/Container/Container.hpp"
+
+#include "NP-Engine/GPU/Interface/GraphicsPipeline.hpp"
+
+namespace np::gpu::__detail
+{
+	/*
+		nothing is compiled, so only what binding and resource groups ask of a pipeline is kept
+	*/
+	class NullGraphicsPipeline : public GraphicsPipeline
+	{
+	private:
+		mem::sptr<RenderPass> _render_pass;
+		PipelineUsage _usage;
+		mem::sptr<PipelineResourceLayout> _layout;
+		con::vector<mem::sptr<Shader>> _shaders;
+
+	public:
+		NullGraphicsPipeline(mem::sptr<RenderPass> render_pass, PipelineUsage usage, mem::sptr<PipelineResourceLayout> layout,
+							 const con::vector<mem::sptr<Shader>>& shaders):
+			_render_pass(render_pass),
+			_usage(usage),
+			_layout(layout),
+			_shaders(shaders)
+		{}
+
+		virtual ~NullGraphicsPipeline() = default;
+
+		virtual DetailType GetDetailType() const override
+		{
+			return DetailType::Null;
+		}
+
+		virtual mem::sptr<srvc::Services> GetServices() const override
+		{
+			return _render_pass->GetServices();
+		}
+
+		virtual mem::sptr<Device> GetDevice() const override
+		{
+			return _render_pass->GetDevice();
+		}
+
+		virtual mem::sptr<PipelineResourceLayout> GetPipelineResourceLayout() const override
+		{
+			return _layout;
+		}
+
+		mem::sptr<RenderPass> GetRenderPass() const
+		{
+			return _render_pass;
+		}
+
+		PipelineUsage GetUsage() const
+		{
+			return _usage;
+		}
+
+		con::vector<mem::sptr<Shader>> GetShaders() const
+		{
+			return _shaders;
+		}
+	};
+} // namespace np::gpu::__detail
+
+#endif /* NP_ENGINE_GPU_NULL_GRAPHICS_PIPELINE_HPP */
@@ -0,0 +1,120 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#ifndef NP_ENGINE_GPU_NULL_IMAGE_RESOURCE_HPP
+#define NP_ENGINE_GPU_NULL_IMAGE_RESOURCE_HPP
+
+#include "NP-Engine/Primitive/Primitive.hpp"
+#include "NP-Engine/Memory/Memory.hpp"
+#include "NP-Engine/Container/Container.hpp"
+
+#include "NP-Engine/GPU/Interface/ImageResource.hpp"
+
+namespace np::gpu::__detail
+{
+	/*
+		images are only ever touched through commands, which we never execute, so we keep no texels
+	*/
+	class NullImageResource : public ImageResource
+	{
+	private:
+		mem::sptr<Device> _device;
+		ImageResourceUsage _usage;
+		Format _format;
+		siz _mip_count;
+		siz _layer_count;
+		siz _sample_count;
+		siz _width;
+		siz _height;
+		siz _depth;
+		con::vector<DeviceQueueFamily> _queue_families;
+
+	public:
+		NullImageResource(mem::sptr<Device> device, ImageResourceUsage usage, Format format, siz mip_count, siz layer_count,
+						  siz sample_count, siz width, siz height, siz depth,
+						  const con::vector<DeviceQueueFamily>& queue_families):
+			_device(device),
+			_usage(usage),
+			_format(format),
+			_mip_count(mip_count),
+			_layer_count(layer_count),
+			_sample_count(sample_count),
+			_width(width),
+			_height(height),
+			_depth(depth),
+			_queue_families(queue_families)
+		{}
+
+		virtual ~NullImageResource() = default;
+
+		static bl IsSupported(mem::sptr<Device> device, ImageResourceUsage usage, Format format, Format format_features)
+		{
+			return format != Format::None;
+		}
+
+		virtual DetailType GetDetailType() const override
+		{
+			return DetailType::Null;
+		}
+
+		virtual mem::sptr<srvc::Services> GetServices() const override
+		{
+			return _device->GetServices();
+		}
+
+		virtual mem::sptr<Device> GetDevice() const override
+		{
+			return _device;
+		}
+
+		ImageResourceUsage GetUsage() const
+		{
+			return _usage;
+		}
+
+		virtual Format GetFormat() const override
+		{
+			return _format;
+		}
+
+		virtual siz GetMipCount() const override
+		{
+			return _mip_count;
+		}
+
+		virtual siz GetLayerCount() const override
+		{
+			return _layer_count;
+		}
+
+		virtual siz GetSampleCount() const override
+		{
+			return _sample_count;
+		}
+
+		virtual siz GetWidth() const override
+		{
+			return _width;
+		}
+
+		virtual siz GetHeight() const override
+		{
+			return _height;
+		}
+
+		virtual siz GetDepth() const override
+		{
+			return _depth;
+		}
+
+		virtual con::vector<DeviceQueueFamily> GetDeviceQueueFamilies() const override
+		{
+			return _queue_families;
+		}
+	};
+} // namespace np::gpu::__detail
+
+#endif /* NP_ENGINE_GPU_NULL_IMAGE_RESOURCE_HPP */
@@ -0,0 +1,59 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#ifndef NP_ENGINE_GPU_NULL_IMAGE_RESOURCE_VIEW_HPP
+#define NP_ENGINE_GPU_NULL_IMAGE_RESOURCE_VIEW_HPP
+
+#include "NP-Engine/Memory/Memory.hpp"
+
+#include "NP-Engine/GPU/Interface/ImageResourceView.hpp"
+
+namespace np::gpu::__detail
+{
+	class NullImageResourceView : public ImageResourceView
+	{
+	private:
+		mem::sptr<Device> _device;
+		mem::sptr<ImageResource> _image;
+		ImageResourceUsage _usage;
+
+	public:
+		NullImageResourceView(mem::sptr<Device> device, mem::sptr<ImageResource> image, ImageResourceUsage usage):
+			_device(device),
+			_image(image),
+			_usage(usage)
+		{}
+
+		virtual ~NullImageResourceView() = default;
+
+		virtual DetailType GetDetailType() const override
+		{
+			return DetailType::Null;
+		}
+
+		virtual mem::sptr<srvc::Services> GetServices() const override
+		{
+			return _device->GetServices();
+		}
+
+		virtual mem::sptr<Device> GetDevice() const override
+		{
+			return _device;
+		}
+
+		virtual mem::sptr<ImageResource> GetImageResource() const override
+		{
+			return _image;
+		}
+
+		ImageResourceUsage GetUsage() const
+		{
+			return _usage;
+		}
+	};
+} // namespace np::gpu::__detail
+
+#endif /* NP_ENGINE_GPU_NULL_IMAGE_RESOURCE_VIEW_HPP */
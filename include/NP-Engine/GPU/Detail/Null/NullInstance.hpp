@@ -0,0 +1,80 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#ifndef NP_ENGINE_GPU_NULL_INSTANCE_HPP
+#define NP_ENGINE_GPU_NULL_INSTANCE_HPP
+
+#include "NP-Engine/Primitive/Primitive.hpp"
+#include "NP-Engine/Memory/Memory.hpp"
+#include "NP-Engine/Services/Services.hpp"
+#include "NP-Engine/Time/Time.hpp"
+#include "NP-Engine/Thread/Thread.hpp"
+
+#include "NP-Engine/GPU/Interface/Detail.hpp"
+
+namespace np::gpu::__detail
+{
+	/*
+		what the null backend pretends to spend, so frame pacing behaves like it would on a device
+	*/
+	struct NullLatencies
+	{
+		tim::milliseconds submit{0}; // spent on the submitting thread by each Queue::Submit, like a driver would
+		tim::milliseconds execute{0}; // fake gpu time of each submission before its fence signals, queued behind others
+		tim::milliseconds present{0}; // spent blocking in each Queue::Present, like vsync would
+	};
+
+	/*
+		spends the given time on this thread, yielding, since sleeping is far coarser than the latencies we fake
+	*/
+	static inline void null_spend(tim::milliseconds duration)
+	{
+		if (duration.count() <= 0)
+			return;
+
+		const tim::steady_timestamp end = tim::steady_clock::now() + tim::duration_cast<tim::steady_clock::duration>(duration);
+		while (tim::steady_clock::now() < end)
+			thr::this_thread::yield();
+	}
+
+	/*
+		a backend without hardware -- everything lives in host memory, and what is submitted is counted for inspection
+		the latencies set here are given to each device made after
+	*/
+	class NullInstance : public DetailInstance
+	{
+	private:
+		mem::sptr<srvc::Services> _services;
+		NullLatencies _latencies;
+
+	public:
+		NullInstance(mem::sptr<srvc::Services> services): _services(services), _latencies{} {}
+
+		virtual ~NullInstance() = default;
+
+		virtual DetailType GetDetailType() const override
+		{
+			return DetailType::Null;
+		}
+
+		virtual mem::sptr<srvc::Services> GetServices() const override
+		{
+			return _services;
+		}
+
+		const NullLatencies& GetLatencies() const
+		{
+			return _latencies;
+		}
+
+		void SetLatencies(const NullLatencies& latencies)
+		{
+			_latencies = latencies;
+		}
+	};
+} // namespace np::gpu::__detail
+
+#endif /* NP_ENGINE_GPU_NULL_INSTANCE_HPP */
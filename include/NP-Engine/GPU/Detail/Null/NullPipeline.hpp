@@ -0,0 +1,76 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#ifndef NP_ENGINE_GPU_NULL_PIPELINE_HPP
+#define NP_ENGINE_GPU_NULL_PIPELINE_HPP
+
+#include "NP-Engine/Memory/Memory.hpp"
+#include "NP-Engine/Container/Container.hpp"
+
+#include "NP-Engine/GPU/Interface/Pipeline.hpp"
+
+namespace np::gpu::__detail
+{
+	class NullPipelineResourceLayout : public PipelineResourceLayout
+	{
+	private:
+		mem::sptr<Device> _device;
+		con::vector<mem::sptr<ResourceLayout>> _resource_layouts;
+		PushData _push_data;
+
+	public:
+		NullPipelineResourceLayout(mem::sptr<Device> device, const con::vector<mem::sptr<ResourceLayout>>& resource_layouts,
+								   PushData push_data):
+			_device(device),
+			_resource_layouts(resource_layouts),
+			_push_data(push_data)
+		{}
+
+		virtual ~NullPipelineResourceLayout() = default;
+
+		virtual DetailType GetDetailType() const override
+		{
+			return DetailType::Null;
+		}
+
+		virtual mem::sptr<srvc::Services> GetServices() const override
+		{
+			return _device->GetServices();
+		}
+
+		virtual mem::sptr<Device> GetDevice() const override
+		{
+			return _device;
+		}
+
+		virtual con::vector<mem::sptr<ResourceLayout>> GetResourceLayouts() const override
+		{
+			return _resource_layouts;
+		}
+
+		virtual PushData GetPushData() const override
+		{
+			return _push_data;
+		}
+
+		virtual bl SetPushDataEntry(siz index, const PushDataEntry& entry) override
+		{
+			bl set = false;
+			if (index < _push_data.entries.size())
+			{
+				PushDataEntry& e = _push_data.entries[index];
+				if (e.stage == entry.stage && e.bytes.size() == entry.bytes.size())
+				{
+					e = entry;
+					set = true;
+				}
+			}
+			return set;
+		}
+	};
+} // namespace np::gpu::__detail
+
+#endif /* NP_ENGINE_GPU_NULL_PIPELINE_HPP */
@@ -0,0 +1,37 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#ifndef NP_ENGINE_GPU_NULL_PIPELINE_CACHE_HPP
+#define NP_ENGINE_GPU_NULL_PIPELINE_CACHE_HPP
+
+#include "NP-Engine/Memory/Memory.hpp"
+#include "NP-Engine/Container/Container.hpp"
+
+#include "NP-Engine/GPU/Interface/PipelineCache.hpp"
+
+namespace np::gpu::__detail
+{
+	/*
+		we compile nothing, so there is nothing to keep
+	*/
+	class NullPipelineCache : public PipelineCache
+	{
+	public:
+		virtual ~NullPipelineCache() = default;
+
+		virtual con::vector<ui8> GetBytes() const override
+		{
+			return {};
+		}
+
+		virtual bl Absorb(mem::sptr<PipelineCache> cache) override
+		{
+			return (bl)cache;
+		}
+	};
+} // namespace np::gpu::__detail
+
+#endif /* NP_ENGINE_GPU_NULL_PIPELINE_CACHE_HPP */
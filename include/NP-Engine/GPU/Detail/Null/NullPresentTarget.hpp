@@ -0,0 +1,57 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#ifndef NP_ENGINE_GPU_NULL_PRESENT_TARGET_HPP
+#define NP_ENGINE_GPU_NULL_PRESENT_TARGET_HPP
+
+#include "NP-Engine/Memory/Memory.hpp"
+#include "NP-Engine/Window/Window.hpp"
+
+#include "NP-Engine/GPU/Interface/PresentTarget.hpp"
+
+namespace np::gpu::__detail
+{
+	/*
+		there is no surface to present to, so any window will do -- headless windows are the usual choice
+		frame contexts size their frames to the window's framebuffer
+	*/
+	class NullPresentTarget : public PresentTarget
+	{
+	private:
+		mem::sptr<DetailInstance> _instance;
+		mem::sptr<win::Window> _window;
+
+	public:
+		NullPresentTarget(mem::sptr<DetailInstance> instance, mem::sptr<win::Window> window):
+			_instance(instance),
+			_window(window)
+		{}
+
+		virtual ~NullPresentTarget() = default;
+
+		virtual DetailType GetDetailType() const override
+		{
+			return DetailType::Null;
+		}
+
+		virtual mem::sptr<srvc::Services> GetServices() const override
+		{
+			return _instance->GetServices();
+		}
+
+		virtual mem::sptr<DetailInstance> GetDetailInstance() const override
+		{
+			return _instance;
+		}
+
+		virtual mem::sptr<win::Window> GetWindow() const override
+		{
+			return _window;
+		}
+	};
+} // namespace np::gpu::__detail
+
+#endif /* NP_ENGINE_GPU_NULL_PRESENT_TARGET_HPP */
@@ -0,0 +1,97 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#ifndef NP_ENGINE_GPU_NULL_QUEUE_HPP
+#define NP_ENGINE_GPU_NULL_QUEUE_HPP
+
+#include "NP-Engine/Primitive/Primitive.hpp"
+#include "NP-Engine/Memory/Memory.hpp"
+#include "NP-Engine/Container/Container.hpp"
+
+#include "NP-Engine/GPU/Interface/Queue.hpp"
+
+#include "NullDevice.hpp"
+#include "NullCommandBufferPool.hpp"
+#include "NullFence.hpp"
+
+namespace np::gpu::__detail
+{
+	class NullQueue : public Queue
+	{
+	private:
+		mem::sptr<NullDevice> _device;
+		DeviceQueueFamily _family;
+		siz _index;
+
+	public:
+		NullQueue(mem::sptr<Device> device, DeviceQueueFamily family, siz index):
+			_device(device),
+			_family(family),
+			_index(index)
+		{}
+
+		virtual ~NullQueue() = default;
+
+		virtual DetailType GetDetailType() const override
+		{
+			return DetailType::Null;
+		}
+
+		virtual mem::sptr<srvc::Services> GetServices() const override
+		{
+			return _device->GetServices();
+		}
+
+		virtual mem::sptr<Device> GetDevice() const override
+		{
+			return _device;
+		}
+
+		virtual DeviceQueueFamily GetDeviceQueueFamily() const override
+		{
+			return _family;
+		}
+
+		virtual siz GetQueueIndex() const override
+		{
+			return _index;
+		}
+
+		virtual mem::sptr<CommandBufferPool> CreateCommandBufferPool(CommandBufferPoolUsage usage) override
+		{
+			return mem::create_sptr<NullCommandBufferPool>(GetServices()->GetAllocator(), GetServices(), usage);
+		}
+
+		virtual Result Submit(const con::vector<gpu::Submit>& submittals, mem::sptr<Fence> fence) override
+		{
+			const tim::steady_timestamp complete_timestamp = _device->Submit(submittals);
+			if (fence && fence->GetDetailType() == DetailType::Null)
+				static_cast<NullFence&>(*fence).Signal(complete_timestamp);
+
+			return Result::Success;
+		}
+
+		/*
+			there is nothing to show, so every frame context presents successfully after the present latency
+		*/
+		virtual PresentResults Present(const gpu::Present& present) override
+		{
+			_device->Present();
+
+			PresentResults results{};
+			results.overallResult = Result::Success;
+			results.individualResults.assign(present.frameContexts.size(), Result::Success);
+			return results;
+		}
+
+		virtual void WaitUntilIdle() const override
+		{
+			_device->WaitUntilIdle();
+		}
+	};
+} // namespace np::gpu::__detail
+
+#endif /* NP_ENGINE_GPU_NULL_QUEUE_HPP */
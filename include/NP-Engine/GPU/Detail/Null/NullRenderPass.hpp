@@ -0,0 +1,68 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#ifndef NP_ENGINE_GPU_NULL_RENDER_PASS_HPP
+#define NP_ENGINE_GPU_NULL_RENDER_PASS_HPP
+
+#include "NP-Engine/Memory/Memory.hpp"
+#include "NP-Engine/Container/Container.hpp"
+
+#include "NP-Engine/GPU/Interface/RenderPass.hpp"
+
+namespace np::gpu::__detail
+{
+	class NullRenderPass : public RenderPass
+	{
+	private:
+		mem::sptr<Device> _device;
+		con::vector<ImageResourceDescription> _descriptions;
+		con::vector<SubpassDescription> _subpasses;
+		con::vector<SubpassDependency> _dependencies;
+
+	public:
+		NullRenderPass(mem::sptr<Device> device, const con::vector<ImageResourceDescription>& descriptions,
+					   const con::vector<SubpassDescription>& subpasses, const con::vector<SubpassDependency>& dependencies):
+			_device(device),
+			_descriptions(descriptions),
+			_subpasses(subpasses),
+			_dependencies(dependencies)
+		{}
+
+		virtual ~NullRenderPass() = default;
+
+		virtual DetailType GetDetailType() const override
+		{
+			return DetailType::Null;
+		}
+
+		virtual mem::sptr<srvc::Services> GetServices() const override
+		{
+			return _device->GetServices();
+		}
+
+		virtual mem::sptr<Device> GetDevice() const override
+		{
+			return _device;
+		}
+
+		virtual con::vector<ImageResourceDescription> GetImageResourceDescriptions() const override
+		{
+			return _descriptions;
+		}
+
+		virtual con::vector<SubpassDescription> GetSubpassDescriptions() const override
+		{
+			return _subpasses;
+		}
+
+		virtual con::vector<SubpassDependency> GetSubpassDepenedencies() const override
+		{
+			return _dependencies;
+		}
+	};
+} // namespace np::gpu::__detail
+
+#endif /* NP_ENGINE_GPU_NULL_RENDER_PASS_HPP */
@@ -0,0 +1,65 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#ifndef NP_ENGINE_GPU_NULL_RESOURCE_HPP
+#define NP_ENGINE_GPU_NULL_RESOURCE_HPP
+
+#include "NP-Engine/Memory/Memory.hpp"
+#include "NP-Engine/Container/Container.hpp"
+
+#include "NP-Engine/GPU/Interface/Resource.hpp"
+
+namespace np::gpu::__detail
+{
+	class NullResourceLayout : public ResourceLayout
+	{
+	private:
+		mem::sptr<Device> _device;
+		con::vector<ResourceDescription> _descriptions;
+
+	public:
+		NullResourceLayout(mem::sptr<Device> device, const con::vector<ResourceDescription>& descriptions):
+			_device(device),
+			_descriptions(descriptions)
+		{}
+
+		virtual ~NullResourceLayout() = default;
+
+		virtual DetailType GetDetailType() const override
+		{
+			return DetailType::Null;
+		}
+
+		virtual mem::sptr<srvc::Services> GetServices() const override
+		{
+			return _device->GetServices();
+		}
+
+		virtual mem::sptr<Device> GetDevice() const override
+		{
+			return _device;
+		}
+
+		virtual con::vector<ResourceDescription> GetResourceDescriptions() const override
+		{
+			return _descriptions;
+		}
+
+		virtual bl IsCompatible(mem::sptr<ResourceLayout> other) const override
+		{
+			con::vector<ResourceDescription> other_descriptions =
+				other ? other->GetResourceDescriptions() : con::vector<ResourceDescription>{};
+			bl is = other && other->GetDetailType() == DetailType::Null && _descriptions.size() == other_descriptions.size();
+
+			for (siz i = 0; is && i < _descriptions.size(); i++)
+				is &= _descriptions[i].IsCompatible(other_descriptions[i]);
+
+			return is;
+		}
+	};
+} // namespace np::gpu::__detail
+
+#endif /* NP_ENGINE_GPU_NULL_RESOURCE_HPP */
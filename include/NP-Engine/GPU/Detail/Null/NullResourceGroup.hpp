@@ -0,0 +1,147 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#ifndef NP_ENGINE_GPU_NULL_RESOURCE_GROUP_HPP
+#define NP_ENGINE_GPU_NULL_RESOURCE_GROUP_HPP
+
+#include "NP-Engine/Memory/Memory.hpp"
+#include "NP-Engine/Container/Container.hpp"
+
+#include "NP-Engine/GPU/Interface/ResourceGroup.hpp"
+
+namespace np::gpu::__detail
+{
+	/*
+		assignments are checked against our layout like a device would, then dropped since nothing reads them
+	*/
+	class NullResourceGroup : public ResourceGroup
+	{
+	private:
+		mem::sptr<ResourceLayout> _resource_layout;
+
+		template <typename Assignment>
+		static bl IsAssignmentCompatible(const Assignment& assignment, const con::vector<ResourceDescription>& descriptions,
+										   ResourceType type)
+		{
+			if (assignment.resourceDescriptionIndex >= descriptions.size())
+				return false;
+
+			const ResourceDescription& description = descriptions[assignment.resourceDescriptionIndex];
+			const bl is_count_compatible = description.isIndexed
+				? !assignment.contexts.empty() && assignment.arrayIndex + assignment.contexts.size() <= description.count
+				: assignment.arrayIndex == 0 && description.count == assignment.contexts.size();
+			return is_count_compatible && description.type.Contains(type);
+		}
+
+	public:
+		NullResourceGroup(mem::sptr<ResourceLayout> layout): _resource_layout(layout) {}
+
+		virtual ~NullResourceGroup() = default;
+
+		virtual DetailType GetDetailType() const override
+		{
+			return DetailType::Null;
+		}
+
+		virtual mem::sptr<srvc::Services> GetServices() const override
+		{
+			return _resource_layout->GetServices();
+		}
+
+		virtual mem::sptr<ResourceLayout> GetResourceLayout() const override
+		{
+			return _resource_layout;
+		}
+
+		virtual siz GetResourceCount() const override
+		{
+			return _resource_layout->GetResourceDescriptions().size();
+		}
+
+		virtual Result ApplyResourceAssignments(const ResourceAssignments& assignments) override
+		{
+			const con::vector<ResourceDescription> descriptions = _resource_layout->GetResourceDescriptions();
+			bl is_compatible = true;
+
+			for (auto it = assignments.imageAssignments.begin(); is_compatible && it != assignments.imageAssignments.end(); it++)
+				is_compatible &= IsAssignmentCompatible(*it, descriptions, ResourceType::Image);
+
+			for (auto it = assignments.bufferAssignments.begin(); is_compatible && it != assignments.bufferAssignments.end(); it++)
+				is_compatible &= IsAssignmentCompatible(*it, descriptions, ResourceType::Buffer);
+
+			for (auto it = assignments.copyAssignments.begin(); is_compatible && it != assignments.copyAssignments.end(); it++)
+				is_compatible &= it->dstResourceGroup && it->srcResourceGroup;
+
+			return is_compatible ? Result::Success : Result::Error;
+		}
+
+		virtual bl IsCompatible(mem::sptr<ResourceGroup> other) const override
+		{
+			return IsCompatible(other->GetResourceLayout());
+		}
+
+		virtual bl IsCompatible(mem::sptr<ResourceLayout> layout) const override
+		{
+			return _resource_layout->IsCompatible(layout);
+		}
+	};
+
+	/*
+		groups are plain host objects, so the pool never runs out
+	*/
+	class NullResourceGroupPool : public ResourceGroupPool
+	{
+	private:
+		mem::sptr<Device> _device;
+		siz _size;
+		con::vector<ResourceDescription> _descriptions;
+
+	public:
+		NullResourceGroupPool(mem::sptr<Device> device, siz size, const con::vector<ResourceDescription>& descriptions):
+			_device(device),
+			_size(size),
+			_descriptions(descriptions)
+		{}
+
+		virtual ~NullResourceGroupPool() = default;
+
+		virtual DetailType GetDetailType() const override
+		{
+			return DetailType::Null;
+		}
+
+		virtual mem::sptr<srvc::Services> GetServices() const override
+		{
+			return _device->GetServices();
+		}
+
+		virtual mem::sptr<Device> GetDevice() const override
+		{
+			return _device;
+		}
+
+		virtual siz GetSize() const override
+		{
+			return _size;
+		}
+
+		virtual mem::sptr<ResourceGroup> CreateResourceGroup(mem::sptr<ResourceLayout> layout) override
+		{
+			return layout ? mem::create_sptr<NullResourceGroup>(GetServices()->GetAllocator(), layout) : nullptr;
+		}
+
+		virtual con::vector<mem::sptr<ResourceGroup>> CreateResourceGroups(
+			const con::vector<mem::sptr<ResourceLayout>>& layouts) override
+		{
+			con::vector<mem::sptr<ResourceGroup>> groups{};
+			for (const mem::sptr<ResourceLayout>& layout : layouts)
+				groups.emplace_back(CreateResourceGroup(layout));
+			return groups;
+		}
+	};
+} // namespace np::gpu::__detail
+
+#endif /* NP_ENGINE_GPU_NULL_RESOURCE_GROUP_HPP */
@@ -0,0 +1,88 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#ifndef NP_ENGINE_GPU_NULL_SAMPLER_RESOURCE_HPP
+#define NP_ENGINE_GPU_NULL_SAMPLER_RESOURCE_HPP
+
+#include "NP-Engine/Memory/Memory.hpp"
+
+#include "NP-Engine/GPU/Interface/SamplerResource.hpp"
+
+namespace np::gpu::__detail
+{
+	class NullSamplerResource : public SamplerResource
+	{
+	private:
+		mem::sptr<Device> _device;
+		SamplerResourceUsage _usage;
+		dbl _anisotrophy;
+		CompareOperation _compare_operation;
+		LodBounds _lod_bounds;
+		SamplerBorder _border;
+		SamplerAddressModes _address_modes;
+
+	public:
+		NullSamplerResource(mem::sptr<Device> device, SamplerResourceUsage usage, dbl anisotrophy, CompareOperation op,
+							LodBounds lod_bounds, SamplerBorder border, SamplerAddressModes address_modes):
+			_device(device),
+			_usage(usage),
+			_anisotrophy(anisotrophy),
+			_compare_operation(op),
+			_lod_bounds(lod_bounds),
+			_border(border),
+			_address_modes(address_modes)
+		{}
+
+		virtual ~NullSamplerResource() = default;
+
+		virtual DetailType GetDetailType() const override
+		{
+			return DetailType::Null;
+		}
+
+		virtual mem::sptr<srvc::Services> GetServices() const override
+		{
+			return _device->GetServices();
+		}
+
+		virtual mem::sptr<Device> GetDevice() const override
+		{
+			return _device;
+		}
+
+		SamplerResourceUsage GetUsage() const
+		{
+			return _usage;
+		}
+
+		virtual dbl GetAnisotrophy() const override
+		{
+			return _anisotrophy;
+		}
+
+		virtual CompareOperation GetCompareOperation() const override
+		{
+			return _compare_operation;
+		}
+
+		virtual LodBounds GetLodBounds() const override
+		{
+			return _lod_bounds;
+		}
+
+		virtual SamplerBorder GetBorder() const override
+		{
+			return _border;
+		}
+
+		virtual SamplerAddressModes GetAddressModes() const override
+		{
+			return _address_modes;
+		}
+	};
+} // namespace np::gpu::__detail
+
+#endif /* NP_ENGINE_GPU_NULL_SAMPLER_RESOURCE_HPP */
@@ -0,0 +1,41 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#ifndef NP_ENGINE_GPU_NULL_SEMAPHORE_HPP
+#define NP_ENGINE_GPU_NULL_SEMAPHORE_HPP
+
+#include "NP-Engine/Memory/Memory.hpp"
+
+#include "NP-Engine/GPU/Interface/Semaphore.hpp"
+
+namespace np::gpu::__detail
+{
+	/*
+		our fake gpu runs submissions one after another, so every wait on a semaphore is already met
+	*/
+	class NullSemaphore : public Semaphore
+	{
+	private:
+		mem::sptr<srvc::Services> _services;
+
+	public:
+		NullSemaphore(mem::sptr<srvc::Services> services): _services(services) {}
+
+		virtual ~NullSemaphore() = default;
+
+		virtual DetailType GetDetailType() const override
+		{
+			return DetailType::Null;
+		}
+
+		virtual mem::sptr<srvc::Services> GetServices() const override
+		{
+			return _services;
+		}
+	};
+} // namespace np::gpu::__detail
+
+#endif /* NP_ENGINE_GPU_NULL_SEMAPHORE_HPP */
@@ -0,0 +1,82 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#ifndef NP_ENGINE_GPU_NULL_SHADER_HPP
+#define NP_ENGINE_GPU_NULL_SHADER_HPP
+
+#include "NP-Engine/Memory/Memory.hpp"
+#include "NP-Engine/String/String.hpp"
+
+#include "NP-Engine/GPU/Interface/Shader.hpp"
+
+namespace np::gpu::__detail
+{
+	/*
+		nothing runs our shaders, so we only keep what they were created with and never read the file
+	*/
+	class NullShader : public Shader
+	{
+	private:
+		mem::sptr<Device> _device;
+		Stage _stage;
+		str _filename;
+		str _entrypoint;
+
+	public:
+		NullShader(mem::sptr<Device> device, Stage stage, str filename, str entrypoint):
+			_device(device),
+			_stage(stage),
+			_filename(filename),
+			_entrypoint(entrypoint)
+		{}
+
+		virtual ~NullShader() = default;
+
+		virtual DetailType GetDetailType() const override
+		{
+			return DetailType::Null;
+		}
+
+		virtual mem::sptr<srvc::Services> GetServices() const override
+		{
+			return _device->GetServices();
+		}
+
+		virtual mem::sptr<Device> GetDevice() const override
+		{
+			return _device;
+		}
+
+		virtual void Load(str filename) override
+		{
+			_filename = filename;
+		}
+
+		virtual void Reload() override {}
+
+		virtual str GetFilename() const override
+		{
+			return _filename;
+		}
+
+		virtual str GetEntrypoint() const override
+		{
+			return _entrypoint;
+		}
+
+		virtual void SetEntrypoint(str entrypoint) override
+		{
+			_entrypoint = entrypoint;
+		}
+
+		virtual Stage GetStage() const override
+		{
+			return _stage;
+		}
+	};
+} // namespace np::gpu::__detail
+
+#endif /* NP_ENGINE_GPU_NULL_SHADER_HPP */
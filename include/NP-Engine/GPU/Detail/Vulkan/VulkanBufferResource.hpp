@@ -180,18 +180,26 @@ namespace np::gpu::__detail
 			return false;
 		}
 
-		virtual bl SetBytes(siz offset, const con::vector<ui8>& bytes) override
+		using BufferResource::SetBytes;
+		using BufferResource::GetBytes;
+
+		virtual bl SetBytes(siz offset, const void* src, siz byte_count) override
 		{
 			VulkanDeviceMemoryRegion region = _memory_allocation->GetRegion();
-			region = { region.offset + offset, bytes.size() };
-			return _memory_allocation->GetDeviceMemory()->SetBytes(region, bytes);
+			region = { region.offset + offset, byte_count };
+			return _memory_allocation->GetDeviceMemory()->SetBytes(region, src, byte_count);
 		}
 
-		virtual con::vector<ui8> GetBytes(siz offset, siz size) override
+		virtual bl GetBytes(siz offset, void* dst, siz byte_count) override
 		{
 			VulkanDeviceMemoryRegion region = _memory_allocation->GetRegion();
-			region = { region.offset + offset, size };
-			return _memory_allocation->GetDeviceMemory()->GetBytes(region);
+			region = { region.offset + offset, byte_count };
+			return _memory_allocation->GetDeviceMemory()->GetBytes(region, dst, byte_count);
+		}
+
+		virtual void* GetMapping() const override
+		{
+			return _memory_allocation->GetMapping();
 		}
 
 		virtual bl ClearCacheForDevice(siz offset, siz size) override
@@ -23,7 +23,6 @@ namespace np::gpu::__detail
 		VkCommandBufferUsageFlags GetVkCommandBufferUsageFlags() const
 		{
 			/*
-				VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT = 0x00000002,
 				VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT = 0x00000004,
 				VK_COMMAND_BUFFER_USAGE_FLAG_BITS_MAX_ENUM = 0x7FFFFFFF
 			*/
@@ -32,6 +31,8 @@ namespace np::gpu::__detail
 
 			if (Contains(SingleUse))
 				flags |= VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+			if (Contains(RenderPassContinue))
+				flags |= VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
 
 			return flags;
 		}
@@ -17,6 +17,7 @@
 
 #include "VulkanCommandBuffer.hpp"
 #include "VulkanLogicalDevice.hpp"
+#include "VulkanFramebuffer.hpp"
 
 namespace np::gpu::__detail
 {
@@ -81,11 +82,12 @@ namespace np::gpu::__detail
 		mem::sptr<VulkanLogicalDevice> _device;
 		VkCommandPool _pool;
 
-		static VkCommandBufferAllocateInfo GetVkCommandBufferAllocateInfo(VkCommandPool pool, siz count)
+		static VkCommandBufferAllocateInfo GetVkCommandBufferAllocateInfo(VkCommandPool pool, siz count,
+																		   VkCommandBufferLevel level)
 		{
 			VkCommandBufferAllocateInfo info{};
 			info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
-			info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+			info.level = level;
 			info.commandPool = pool;
 			info.commandBufferCount = count;
 			return info;
@@ -149,7 +151,7 @@ namespace np::gpu::__detail
 			return _device->GetServices();
 		}
 
-		virtual mem::sptr<CommandBuffer> CreateCommandBuffer() override
+		mem::sptr<CommandBuffer> CreateCommandBuffer(VkCommandBufferLevel level)
 		{
 			using destroyer_type = VulkanCommandBufferDestroyer;
 			using resource_type = mem::smart_ptr_resource<VulkanCommandBuffer, destroyer_type>;
@@ -161,7 +163,7 @@ namespace np::gpu::__detail
 
 			if (contiguous_block)
 			{
-				VkCommandBufferAllocateInfo info = GetVkCommandBufferAllocateInfo(_pool, 1);
+				VkCommandBufferAllocateInfo info = GetVkCommandBufferAllocateInfo(_pool, 1, level);
 				VkCommandBuffer command_buffer = nullptr;
 				VkResult result = vkAllocateCommandBuffers(*_device, &info, &command_buffer);
 
@@ -176,6 +178,16 @@ namespace np::gpu::__detail
 			return {resource};
 		}
 
+		virtual mem::sptr<CommandBuffer> CreateCommandBuffer() override
+		{
+			return CreateCommandBuffer(VK_COMMAND_BUFFER_LEVEL_PRIMARY);
+		}
+
+		virtual mem::sptr<CommandBuffer> CreateSecondaryCommandBuffer() override
+		{
+			return CreateCommandBuffer(VK_COMMAND_BUFFER_LEVEL_SECONDARY);
+		}
+
 		virtual bl Begin(mem::sptr<CommandBuffer> command_buffer, CommandBufferUsage usage) override
 		{
 			bl begin = false;
@@ -191,6 +203,32 @@ namespace np::gpu::__detail
 			return begin;
 		}
 
+		virtual bl BeginSecondary(mem::sptr<CommandBuffer> command_buffer, CommandBufferUsage usage,
+								  mem::sptr<Framebuffer> framebuffer_, ui32 subpass_index) override
+		{
+			bl begin = false;
+			mem::sptr<VulkanCommandBuffer> vulkan_command_buffer =
+				DetailObject::EnsureIsDetailType(command_buffer, DetailType::Vulkan);
+			mem::sptr<VulkanFramebuffer> framebuffer = DetailObject::EnsureIsDetailType(framebuffer_, DetailType::Vulkan);
+			if (vulkan_command_buffer && framebuffer)
+			{
+				mem::sptr<VulkanRenderPass> render_pass = framebuffer->GetRenderPass();
+				VkCommandBufferInheritanceInfo inheritance_info{};
+				inheritance_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+				inheritance_info.renderPass = *render_pass;
+				inheritance_info.subpass = subpass_index;
+				inheritance_info.framebuffer = *framebuffer;
+
+				VkCommandBufferBeginInfo info =
+					GetVkCommandBufferBeginInfo(VulkanCommandBufferUsage{usage | CommandBufferUsage::RenderPassContinue});
+				info.pInheritanceInfo = &inheritance_info;
+				VkResult result = vkBeginCommandBuffer(*vulkan_command_buffer, &info);
+				begin = result == VK_SUCCESS;
+			}
+
+			return begin;
+		}
+
 		virtual bl End(mem::sptr<CommandBuffer> command_buffer, CommandBufferUsage usage) override
 		{
 			bl end = false;
@@ -217,6 +255,11 @@ namespace np::gpu::__detail
 			}
 			return reset;
 		}
+
+		virtual bl ResetAll() override
+		{
+			return _pool && vkResetCommandPool(*_device, _pool, 0) == VK_SUCCESS;
+		}
 	};
 } // namespace np::gpu::__detail
 
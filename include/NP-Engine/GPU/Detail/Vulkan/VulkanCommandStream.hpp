@@ -0,0 +1,394 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#ifndef NP_ENGINE_GPU_VULKAN_COMMAND_STREAM_HPP
+#define NP_ENGINE_GPU_VULKAN_COMMAND_STREAM_HPP
+
+#include "NP-Engine/Vendor/VulkanInclude.hpp"
+
+#include "NP-Engine/GPU/Interface/CommandStream.hpp"
+
+#include "VulkanCommands.hpp"
+
+namespace np::gpu::__detail
+{
+	/*
+		translates a CommandStream to vkCmd* calls in one pass over its packets
+		conversions that need arrays go through per-thread scratch that keeps its capacity, so a recording thread stops
+		allocating once it has seen its largest packet
+		every packet checks that the objects it references are vulkan objects before casting them, like the VulkanCommand
+		classes do, so a stream holding another backend's objects is rejected instead of recorded
+	*/
+	class VulkanCommandStream
+	{
+	private:
+		struct Scratch
+		{
+			con::vector<VkBufferCopy> bufferCopies;
+			con::vector<VkClearValue> clearValues;
+			con::vector<VkBuffer> buffers;
+			con::vector<VkDeviceSize> offsets;
+			con::vector<VkDescriptorSet> descriptorSets;
+			con::vector<VkCommandBuffer> commandBuffers;
+			con::vector<VkViewport> viewports;
+			con::vector<VkRect2D> scissors;
+		};
+
+		static Scratch& GetScratch()
+		{
+			thread_local Scratch scratch{};
+			return scratch;
+		}
+
+		static bl IsVulkan(const DetailObject* object)
+		{
+			return object && object->GetDetailType() == DetailType::Vulkan;
+		}
+
+		/*
+			a pipeline is only usable if its resource layout is a vulkan object as well
+		*/
+		static bl IsVulkan(const Pipeline* pipeline)
+		{
+			return IsVulkan(static_cast<const DetailObject*>(pipeline)) &&
+				IsVulkan(pipeline->GetPipelineResourceLayout().get());
+		}
+
+		static VkPipelineBindPoint GetVkPipelineBindPoint(const Pipeline* pipeline)
+		{
+			return pipeline->GetPipelineType() == PipelineType::Compute ? VK_PIPELINE_BIND_POINT_COMPUTE
+																		 : VK_PIPELINE_BIND_POINT_GRAPHICS;
+		}
+
+		static VkBuffer GetVkBuffer(BufferResource* buffer)
+		{
+			return buffer ? (VkBuffer)(*static_cast<VulkanBufferResource*>(buffer)) : static_cast<VkBuffer>(nullptr);
+		}
+
+		static bl RecordBeginRenderPass(VkCommandBuffer command_buffer, const CommandStream::BeginRenderPassPayload* payload,
+										Scratch& scratch)
+		{
+			if (!IsVulkan(payload->framebuffer))
+				return false;
+
+			const VulkanFramebuffer* framebuffer = static_cast<const VulkanFramebuffer*>(payload->framebuffer);
+			const con::vector<mem::sptr<ImageResourceView>> views = framebuffer->GetImageResourceViews();
+			if (views.size() != payload->clearColorCount)
+				return false;
+
+			const ClearColor* clear_colors = CommandStream::GetArray<ClearColor>(payload);
+			scratch.clearValues.resize(payload->clearColorCount);
+			for (siz i = 0; i < scratch.clearValues.size(); i++)
+			{
+				mem::sptr<VulkanImageResourceView> view = views[i];
+				mem::sptr<VulkanImageResource> image = view->GetImageResource();
+				const VulkanClearColor clear_color{clear_colors[i]};
+				const VulkanFormat format{image->GetFormat()};
+
+				if (format.ContainsAny(VulkanImageResourceUsage::Depth | VulkanImageResourceUsage::Stencil))
+					scratch.clearValues[i].depthStencil = clear_color.GetVkClearDepthStencilValue();
+				else
+					scratch.clearValues[i].color = clear_color.GetVkClearColorValue();
+			}
+
+			mem::sptr<VulkanRenderPass> render_pass = framebuffer->GetRenderPass();
+			VkRenderPassBeginInfo info{};
+			info.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+			info.framebuffer = *framebuffer;
+			info.renderPass = *render_pass;
+			info.renderArea = VulkanRenderArea{payload->renderArea}.GetVkRect2D();
+			info.clearValueCount = scratch.clearValues.size();
+			info.pClearValues = scratch.clearValues.empty() ? nullptr : scratch.clearValues.data();
+
+			vkCmdBeginRenderPass(command_buffer, &info, VulkanSubpassUsage{payload->usage}.GetVkSubpassContents());
+			return true;
+		}
+
+		static bl RecordBindPipeline(VkCommandBuffer command_buffer, const CommandStream::BindPipelinePayload* payload)
+		{
+			if (!IsVulkan(payload->pipeline))
+				return false;
+
+			VkPipeline pipeline = nullptr;
+			switch (payload->pipeline->GetPipelineType())
+			{
+			case PipelineType::Compute:
+				pipeline = *static_cast<VulkanComputePipeline*>(payload->pipeline);
+				break;
+
+			case PipelineType::Graphics:
+				pipeline = *static_cast<VulkanGraphicsPipeline*>(payload->pipeline);
+				break;
+
+			case PipelineType::None:
+			default:
+				break;
+			}
+
+			if (pipeline)
+				vkCmdBindPipeline(command_buffer, VulkanPipelineUsage{payload->usage}.GetVkPipelineBindPoint(), pipeline);
+
+			return pipeline != nullptr;
+		}
+
+		static bl RecordBindResourceGroups(VkCommandBuffer command_buffer,
+										   const CommandStream::BindResourceGroupsPayload* payload, Scratch& scratch)
+		{
+			if (!IsVulkan(payload->pipeline) || payload->pipeline->GetPipelineType() == PipelineType::None)
+				return false;
+
+			mem::sptr<VulkanPipelineResourceLayout> layout = payload->pipeline->GetPipelineResourceLayout();
+			const con::vector<mem::sptr<ResourceLayout>> resource_layouts = layout->GetResourceLayouts();
+			if (resource_layouts.size() < payload->resourceLayoutBeginIndex + payload->resourceGroupCount)
+				return false;
+
+			ResourceGroup* const* resource_groups = CommandStream::GetArray<ResourceGroup*>(payload);
+			const ui32* offsets = CommandStream::GetNextArray<ui32>(resource_groups, payload->resourceGroupCount);
+
+			scratch.descriptorSets.resize(payload->resourceGroupCount);
+			for (siz i = 0; i < scratch.descriptorSets.size(); i++)
+			{
+				ResourceGroup* resource_group = resource_groups[i];
+				if (!IsVulkan(resource_group) ||
+					!resource_group->IsCompatible(resource_layouts[payload->resourceLayoutBeginIndex + i]))
+					return false;
+
+				scratch.descriptorSets[i] = *static_cast<VulkanResourceGroup*>(resource_group);
+			}
+
+			vkCmdBindDescriptorSets(command_buffer, GetVkPipelineBindPoint(payload->pipeline), *layout,
+									payload->resourceLayoutBeginIndex, scratch.descriptorSets.size(),
+									scratch.descriptorSets.empty() ? nullptr : scratch.descriptorSets.data(),
+									payload->dynamicResourceOffsetCount,
+									payload->dynamicResourceOffsetCount == 0 ? nullptr : offsets);
+			return true;
+		}
+
+	public:
+		/*
+			returns false at the first packet that could not be recorded, leaving the ones before it recorded
+		*/
+		static bl Record(const VulkanCommandBuffer& command_buffer_, const CommandStream& stream)
+		{
+			const VkCommandBuffer command_buffer = command_buffer_;
+			Scratch& scratch = GetScratch();
+			bl recorded = true;
+
+			const ui8* it = stream.GetData();
+			const ui8* end = it + stream.GetSize();
+			for (; recorded && it < end; it += ((const CommandStream::Packet*)it)->size)
+			{
+				const CommandStream::Packet* packet = (const CommandStream::Packet*)it;
+				switch (packet->type)
+				{
+				case CommandType::CopyBuffer:
+				{
+					const CommandStream::CopyBufferPayload* payload =
+						CommandStream::GetPayload<CommandStream::CopyBufferPayload>(packet);
+					const CopyBufferRange* ranges = CommandStream::GetArray<CopyBufferRange>(payload);
+					recorded = IsVulkan(payload->dst) && IsVulkan(payload->src);
+					if (!recorded)
+						break;
+
+					scratch.bufferCopies.resize(payload->rangeCount);
+					for (siz i = 0; i < scratch.bufferCopies.size(); i++)
+						scratch.bufferCopies[i] = VulkanCopyBufferRange{ranges[i]}.GetVkBufferCopy();
+
+					vkCmdCopyBuffer(command_buffer, GetVkBuffer(payload->src), GetVkBuffer(payload->dst),
+									scratch.bufferCopies.size(),
+									scratch.bufferCopies.empty() ? nullptr : scratch.bufferCopies.data());
+					break;
+				}
+				case CommandType::FillBuffer:
+				{
+					const CommandStream::FillBufferPayload* payload =
+						CommandStream::GetPayload<CommandStream::FillBufferPayload>(packet);
+					recorded = IsVulkan(payload->buffer);
+					if (!recorded)
+						break;
+
+					vkCmdFillBuffer(command_buffer, GetVkBuffer(payload->buffer), payload->offset, payload->count,
+									payload->value);
+					break;
+				}
+				case CommandType::AssignBuffer:
+				{
+					const CommandStream::AssignBufferPayload* payload =
+						CommandStream::GetPayload<CommandStream::AssignBufferPayload>(packet);
+					recorded = IsVulkan(payload->buffer);
+					if (!recorded)
+						break;
+
+					vkCmdUpdateBuffer(command_buffer, GetVkBuffer(payload->buffer), payload->offset, payload->byteCount,
+									  CommandStream::GetArray<ui8>(payload));
+					break;
+				}
+				case CommandType::BeginRenderPass:
+				{
+					recorded = RecordBeginRenderPass(
+						command_buffer, CommandStream::GetPayload<CommandStream::BeginRenderPassPayload>(packet), scratch);
+					break;
+				}
+				case CommandType::EndRenderPass:
+				{
+					vkCmdEndRenderPass(command_buffer);
+					break;
+				}
+				case CommandType::NextSubpass:
+				{
+					const CommandStream::NextSubpassPayload* payload =
+						CommandStream::GetPayload<CommandStream::NextSubpassPayload>(packet);
+					vkCmdNextSubpass(command_buffer, VulkanSubpassUsage{payload->usage}.GetVkSubpassContents());
+					break;
+				}
+				case CommandType::BindPipeline:
+				{
+					recorded =
+						RecordBindPipeline(command_buffer, CommandStream::GetPayload<CommandStream::BindPipelinePayload>(packet));
+					break;
+				}
+				case CommandType::BindIndexBuffer:
+				{
+					const CommandStream::BindIndexBufferPayload* payload =
+						CommandStream::GetPayload<CommandStream::BindIndexBufferPayload>(packet);
+					recorded = IsVulkan(payload->buffer);
+					if (!recorded)
+						break;
+
+					const VkIndexType index_type = payload->stride == sizeof(ui16) ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32;
+					vkCmdBindIndexBuffer(command_buffer, GetVkBuffer(payload->buffer), payload->offset, index_type);
+					break;
+				}
+				case CommandType::BindVertexBuffers:
+				{
+					const CommandStream::BindVertexBuffersPayload* payload =
+						CommandStream::GetPayload<CommandStream::BindVertexBuffersPayload>(packet);
+					BufferResource* const* buffers = CommandStream::GetArray<BufferResource*>(payload);
+					const siz* offsets = CommandStream::GetNextArray<siz>(buffers, payload->bufferCount);
+
+					scratch.buffers.resize(payload->bufferCount);
+					scratch.offsets.resize(payload->bufferCount);
+					for (siz i = 0; recorded && i < scratch.buffers.size(); i++)
+					{
+						recorded = !buffers[i] || IsVulkan(buffers[i]); // null binds nothing
+						if (recorded)
+						{
+							scratch.buffers[i] = GetVkBuffer(buffers[i]);
+							scratch.offsets[i] = offsets[i];
+						}
+					}
+
+					if (recorded && !scratch.buffers.empty())
+						vkCmdBindVertexBuffers(command_buffer, payload->bindingBeginIndex, scratch.buffers.size(),
+											   scratch.buffers.data(), scratch.offsets.data());
+					break;
+				}
+				case CommandType::BindResourceGroups:
+				{
+					recorded = RecordBindResourceGroups(
+						command_buffer, CommandStream::GetPayload<CommandStream::BindResourceGroupsPayload>(packet), scratch);
+					break;
+				}
+				case CommandType::ExecuteCommands:
+				{
+					const CommandStream::ExecuteCommandsPayload* payload =
+						CommandStream::GetPayload<CommandStream::ExecuteCommandsPayload>(packet);
+					CommandBuffer* const* command_buffers = CommandStream::GetArray<CommandBuffer*>(payload);
+
+					scratch.commandBuffers.resize(payload->commandBufferCount);
+					for (siz i = 0; recorded && i < scratch.commandBuffers.size(); i++)
+					{
+						recorded = IsVulkan(command_buffers[i]);
+						if (recorded)
+							scratch.commandBuffers[i] = *static_cast<VulkanCommandBuffer*>(command_buffers[i]);
+					}
+
+					if (recorded && !scratch.commandBuffers.empty())
+						vkCmdExecuteCommands(command_buffer, scratch.commandBuffers.size(), scratch.commandBuffers.data());
+					break;
+				}
+				case CommandType::PushData:
+				{
+					const CommandStream::PushDataPayload* payload =
+						CommandStream::GetPayload<CommandStream::PushDataPayload>(packet);
+					recorded = IsVulkan(payload->pipeline);
+					if (!recorded)
+						break;
+
+					mem::sptr<VulkanPipelineResourceLayout> layout = payload->pipeline->GetPipelineResourceLayout();
+					vkCmdPushConstants(command_buffer, *layout, VulkanStage{payload->stage}.GetVkShaderStageFlags(),
+									   payload->offset, payload->byteCount, CommandStream::GetArray<ui8>(payload));
+					break;
+				}
+				case CommandType::SetViewports:
+				{
+					const CommandStream::SetViewportsPayload* payload =
+						CommandStream::GetPayload<CommandStream::SetViewportsPayload>(packet);
+					const CommandStream::ViewportRecord* viewports =
+						CommandStream::GetArray<CommandStream::ViewportRecord>(payload);
+
+					scratch.viewports.resize(payload->viewportCount);
+					for (siz i = 0; i < scratch.viewports.size(); i++)
+						scratch.viewports[i] = {(flt)viewports[i].position.x, (flt)viewports[i].position.y,
+												(flt)viewports[i].width, (flt)viewports[i].height,
+												(flt)viewports[i].minDepth, (flt)viewports[i].maxDepth};
+
+					if (!scratch.viewports.empty())
+						vkCmdSetViewport(command_buffer, payload->viewportBeginIndex, scratch.viewports.size(),
+										 scratch.viewports.data());
+					break;
+				}
+				case CommandType::SetScissors:
+				{
+					const CommandStream::SetScissorsPayload* payload =
+						CommandStream::GetPayload<CommandStream::SetScissorsPayload>(packet);
+					const Scissor* scissors = CommandStream::GetArray<Scissor>(payload);
+
+					scratch.scissors.resize(payload->scissorCount);
+					for (siz i = 0; i < scratch.scissors.size(); i++)
+						scratch.scissors[i] = VulkanScissor{scissors[i]}.GetVkRect2D();
+
+					if (!scratch.scissors.empty())
+						vkCmdSetScissor(command_buffer, payload->scissorBeginIndex, scratch.scissors.size(),
+										scratch.scissors.data());
+					break;
+				}
+				case CommandType::Dispatch:
+				{
+					const CommandStream::DispatchPayload* payload =
+						CommandStream::GetPayload<CommandStream::DispatchPayload>(packet);
+					vkCmdDispatch(command_buffer, payload->x, payload->y, payload->z);
+					break;
+				}
+				case CommandType::Draw:
+				{
+					const CommandStream::DrawPayload* payload = CommandStream::GetPayload<CommandStream::DrawPayload>(packet);
+					vkCmdDraw(command_buffer, payload->vertexCount, payload->instanceCount, payload->vertexBeginIndex,
+							  payload->instanceBeginIndex);
+					break;
+				}
+				case CommandType::DrawIndexed:
+				{
+					const CommandStream::DrawIndexedPayload* payload =
+						CommandStream::GetPayload<CommandStream::DrawIndexedPayload>(packet);
+					vkCmdDrawIndexed(command_buffer, payload->indexCount, payload->instanceCount, payload->indexBeginIndex,
+									 payload->vertexOffset, payload->instanceBeginIndex);
+					break;
+				}
+				default:
+				{
+					recorded = false;
+					break;
+				}
+				}
+			}
+
+			return recorded;
+		}
+	};
+} // namespace np::gpu::__detail
+
+#endif /* NP_ENGINE_GPU_VULKAN_COMMAND_STREAM_HPP */
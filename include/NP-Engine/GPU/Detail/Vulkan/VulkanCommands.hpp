@@ -801,6 +801,7 @@ namespace np::gpu::__detail
 		VulkanImageRange range;
 
 		VulkanImageBarrier(const ImageBarrier& other = {}) :
+			VulkanBarrier(other),
 			image(other.image),
 			dstImageResourceUsage(other.dstImageResourceUsage),
 			srcImageResourceUsage(other.srcImageResourceUsage),
@@ -1290,9 +1291,7 @@ namespace np::gpu::__detail
 				for (siz i = 0; i < payloads.size(); i++)
 					payloads[i] = VulkanDrawIndirectCommandPayload{payloads_[i]}.GetVkDrawIndirectCommand();
 
-				con::vector<ui8> bytes(payloads.size() * sizeof(VkDrawIndirectCommand));
-				mem::copy_bytes(bytes.data(), payloads.data(), bytes.size());
-				prepared = buffer->SetBytes(offset, bytes);
+				prepared = buffer->SetBytes(offset, payloads.data(), payloads.size() * sizeof(VkDrawIndirectCommand));
 				
 				if (prepared)
 				{
@@ -1379,9 +1378,7 @@ namespace np::gpu::__detail
 				for (siz i = 0; i < payloads.size(); i++)
 					payloads[i] = VulkanDrawIndexedIndirectCommandPayload{payloads_[i]}.GetVkDrawIndexedIndirectCommand();
 
-				con::vector<ui8> bytes(payloads.size() * sizeof(VkDrawIndexedIndirectCommand));
-				mem::copy_bytes(bytes.data(), payloads.data(), bytes.size());
-				prepared = buffer->SetBytes(offset, bytes);
+				prepared = buffer->SetBytes(offset, payloads.data(), payloads.size() * sizeof(VkDrawIndexedIndirectCommand));
 
 				if (prepared)
 				{
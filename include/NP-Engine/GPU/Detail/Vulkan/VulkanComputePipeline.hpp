@@ -42,7 +42,9 @@ namespace np::gpu::__detail
 			mem::sptr<VulkanDevice> device = shader->GetDevice();
 			mem::sptr<VulkanInstance> instance = device->GetDetailInstance();
 			VkPipeline pipeline = nullptr;
-			VkResult result = vkCreateComputePipelines(*device->GetLogicalDevice(), nullptr, 1, &info, instance->GetVulkanAllocationCallbacks(), &pipeline);
+			VkResult result = cache ? cache->CreateVkComputePipeline(info, pipeline)
+									: vkCreateComputePipelines(*device->GetLogicalDevice(), nullptr, 1, &info,
+															   instance->GetVulkanAllocationCallbacks(), &pipeline);
 			return result == VK_SUCCESS ? pipeline : nullptr;
 		}
 
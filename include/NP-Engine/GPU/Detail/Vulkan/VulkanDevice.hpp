@@ -48,7 +48,7 @@ namespace np::gpu::__detail
 		siz _memory_type_index;
 		siz _size;
 		VkDeviceMemory _memory;
-		mutexed_wrapper<void*> _mapping; //for access to memory
+		void* _mapping; //host visible memory stays mapped for its whole lifetime
 
 		static VkMemoryAllocateInfo CreateVkMemoryAllocateInfo(siz memory_type_index, siz size)
 		{
@@ -68,16 +68,44 @@ namespace np::gpu::__detail
 			return result == VK_SUCCESS ? memory : nullptr;
 		}
 
-		void* Map(VulkanDeviceMemoryRegion region)
+		/*
+			vulkan only allows one mapping per VkDeviceMemory at a time, so we map all of it once and hand out offsets
+		*/
+		void* Map()
 		{
 			void* mapping = nullptr;
-			VulkanResult result = vkMapMemory(*_device, _memory, region.offset, region.size, 0, &mapping);
-			return result.Contains(VulkanResult::Success) ? mapping : nullptr;
+			if (_memory && IsMappable())
+			{
+				VulkanResult result = vkMapMemory(*_device, _memory, 0, VK_WHOLE_SIZE, 0, &mapping);
+				if (!result.Contains(VulkanResult::Success))
+					mapping = nullptr;
+			}
+			return mapping;
 		}
 
 		void UnMap()
 		{
-			vkUnmapMemory(*_device, _memory);
+			if (_mapping)
+			{
+				vkUnmapMemory(*_device, _memory);
+				_mapping = nullptr;
+			}
+		}
+
+		VulkanResult ClearCache(VulkanDeviceMemoryRegion region, bl for_device)
+		{
+			VulkanResult result = VulkanResult::None;
+			if (_mapping && Contains(region))
+			{
+				VkMappedMemoryRange range{};
+				range.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+				range.memory = _memory;
+				range.offset = region.offset;
+				range.size = region.offset + region.size == _size ? VK_WHOLE_SIZE : region.size;
+				result = for_device ? vkFlushMappedMemoryRanges(*GetLogicalDevice(), 1, &range)
+									: vkInvalidateMappedMemoryRanges(*GetLogicalDevice(), 1, &range);
+			}
+			return result;
 		}
 
 	public:
@@ -85,11 +113,14 @@ namespace np::gpu::__detail
 			_device(device),
 			_memory_type_index(memory_type_index),
 			_size(size),
-			_memory(CreateVkDeviceMemory(_device, _memory_type_index, _size))
+			_memory(CreateVkDeviceMemory(_device, _memory_type_index, _size)),
+			_mapping(Map())
 		{}
 
 		~VulkanDeviceMemory()
 		{
+			UnMap();
+
 			if (_memory)
 			{
 				mem::sptr<VulkanInstance> instance = _device->GetPhysicalDevice().GetDetailInstance();
@@ -160,82 +191,38 @@ namespace np::gpu::__detail
 			return region.IsValid() && region.offset < _size && (region.offset + region.size) <= _size;
 		}
 
-		bl SetBytes(VulkanDeviceMemoryRegion region, const con::vector<ui8>& bytes)
+		/*
+			returns the persistent host pointer to the beginning of the given region, or nullptr if it cannot be mapped
+		*/
+		void* GetMapping(VulkanDeviceMemoryRegion region) const
 		{
-			bl set = false;
-			if (IsMappable() && Contains(region) && !bytes.empty())
-			{
-				auto mapping = _mapping.get_access();
-				*mapping = Map(region);
-				if (*mapping)
-				{
-					const siz byte_count = region.size < bytes.size() ? region.size : bytes.size();
-					mem::copy_bytes(*mapping, bytes.data(), byte_count);
-					set = true;
-					UnMap();
-				}
-			}
-			return set;
+			return _mapping && Contains(region) ? static_cast<ui8*>(_mapping) + region.offset : nullptr;
 		}
 
-		con::vector<ui8> GetBytes(VulkanDeviceMemoryRegion region)
+		bl SetBytes(VulkanDeviceMemoryRegion region, const void* src, siz byte_count)
 		{
-			con::vector<ui8> bytes{};
-			if (IsMappable() && Contains(region))
-			{
-				auto mapping = _mapping.get_access();
-				*mapping = Map(region);
-				if (*mapping)
-				{
-					const siz byte_count = region.size < bytes.size() ? region.size : bytes.size();
-					bytes.resize(byte_count);
-					mem::copy_bytes(bytes.data(), *mapping, bytes.size());
-					UnMap();
-				}
-			}
-			return bytes;
+			void* dst = GetMapping(region);
+			if (dst && src && byte_count > 0)
+				mem::copy_bytes(dst, src, ::std::min(region.size, byte_count));
+			return dst && src && byte_count > 0;
+		}
+
+		bl GetBytes(VulkanDeviceMemoryRegion region, void* dst, siz byte_count) const
+		{
+			const void* src = GetMapping(region);
+			if (dst && src && byte_count > 0)
+				mem::copy_bytes(dst, src, ::std::min(region.size, byte_count));
+			return dst && src && byte_count > 0;
 		}
 
 		bl ClearCacheForDevice(VulkanDeviceMemoryRegion region)
 		{
-			VulkanResult result = VulkanResult::None;
-			auto mapping = _mapping.get_access();
-			*mapping = Map(region);
-			if (*mapping)
-			{
-				if (Contains(region))
-				{
-					VkMappedMemoryRange range{};
-					range.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
-					range.memory = _memory;
-					range.offset = region.offset;
-					range.size = region.size;
-					result = vkFlushMappedMemoryRanges(*GetLogicalDevice(), 1, &range);
-				}
-				UnMap();
-			}
-			return result.Contains(VulkanResult::Success);
+			return ClearCache(region, true).Contains(VulkanResult::Success);
 		}
 
 		bl ClearCacheForHost(VulkanDeviceMemoryRegion region)
 		{
-			VulkanResult result = VulkanResult::None;
-			auto mapping = _mapping.get_access();
-			*mapping = Map(region);
-			if (*mapping)
-			{
-				if (Contains(region))
-				{
-					VkMappedMemoryRange range{};
-					range.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
-					range.memory = _memory;
-					range.offset = region.offset;
-					range.size = region.size;
-					result = vkInvalidateMappedMemoryRanges(*GetLogicalDevice(), 1, &range);
-				}
-				UnMap();
-			}
-			return result.Contains(VulkanResult::Success);
+			return ClearCache(region, false).Contains(VulkanResult::Success);
 		}
 	};
 
@@ -243,13 +230,13 @@ namespace np::gpu::__detail
 	{
 	protected:
 		mem::sptr<VulkanDeviceMemory> _memory;
-		siz _alignment_offset;
+		ui32 _node; //our handle from the pool's allocator
 		VulkanDeviceMemoryRegion _region;
 
 	public:
-		VulkanDeviceMemoryAllocation(mem::sptr<VulkanDeviceMemory> memory, siz alignment_offset, VulkanDeviceMemoryRegion region) :
+		VulkanDeviceMemoryAllocation(mem::sptr<VulkanDeviceMemory> memory, ui32 node, VulkanDeviceMemoryRegion region) :
 			_memory(memory),
-			_alignment_offset(alignment_offset),
+			_node(node),
 			_region(region)
 		{}
 
@@ -258,9 +245,9 @@ namespace np::gpu::__detail
 			return _memory;
 		}
 
-		siz GetAlignmentOffset() const
+		ui32 GetNode() const
 		{
-			return _alignment_offset;
+			return _node;
 		}
 
 		VulkanDeviceMemoryRegion GetRegion() const
@@ -287,6 +274,14 @@ namespace np::gpu::__detail
 			};
 			return _memory->ClearCacheForHost(region);
 		}
+
+		/*
+			persistent host pointer to the beginning of this allocation, or nullptr when it is not host visible
+		*/
+		void* GetMapping() const
+		{
+			return _memory->GetMapping(_region);
+		}
 	};
 
 	class VulkanDeviceMemoryPool
@@ -317,111 +312,29 @@ namespace np::gpu::__detail
 
 			void destruct_object(VulkanDeviceMemoryAllocation* ptr) override
 			{
-				_pool.ReleaseRegion(ptr->GetAlignmentOffset(), ptr->GetRegion());
+				_pool.ReleaseRegion(ptr->GetNode());
 				base::destruct_object(ptr);
 			}
 		};
 
 		mem::sptr<VulkanDeviceMemory> _memory;
-		mutexed_wrapper<con::vector<VulkanDeviceMemoryRegion>> _free_regions;
-
-		void ReleaseRegion(VulkanDeviceMemoryRegion region)
-		{
-			auto free_regions = _free_regions.get_access();
-			if (free_regions->empty())
-			{
-				free_regions->emplace_back(region);
-			}
-			else
-			{
-				for (auto it = free_regions->begin(); it != free_regions->end(); it++)
-					if (it->offset > region.offset)
-					{
-						free_regions->insert(it, region);
-						break;
-					}
-			}
-
-			//coalesce
-			for (siz i = 0; i < free_regions->size() - 1;)
-			{
-				VulkanDeviceMemoryRegion& a = (*free_regions)[i];
-				VulkanDeviceMemoryRegion& b = (*free_regions)[i + 1];
-
-				if (a.offset + a.size == b.offset)
-				{
-					b.offset = a.offset;
-					b.size += a.size;
-					free_regions->erase(free_regions->begin() + i);
-				}
-				else
-				{
-					i++;
-				}
-			}
-		}
+		mutexed_wrapper<mem::tlsf_offset_allocator> _allocator;
 
-		void ReleaseRegion(siz alignment_offset, VulkanDeviceMemoryRegion region)
+		void ReleaseRegion(ui32 node)
 		{
-			region.offset -= alignment_offset;
-			region.size += alignment_offset;
-			ReleaseRegion(region);
+			_allocator.get_access()->deallocate(node);
 		}
 
-		::std::pair<siz, VulkanDeviceMemoryRegion> AcquireRegion(VkMemoryRequirements requirements, VkMemoryPropertyFlags flags)
+		mem::tlsf_offset_allocator::allocation AcquireRegion(VkMemoryRequirements requirements, VkMemoryPropertyFlags flags)
 		{
-			VulkanDeviceMemoryRegion region{};
-			siz alignment_offset = 0;
-
-			auto free_regions = _free_regions.get_access();
-			//determine best fitting region via index
-			siz index = SIZ_MAX;
-			for (siz i = 0; i < free_regions->size(); i++)
-				if ((*free_regions)[i].size >= requirements.size)
-					if (index > free_regions->size() || (*free_regions)[i].size < (*free_regions)[index].size)
-						index = i;
-
-			region = index < free_regions->size() ?
-				(*free_regions)[index] : VulkanDeviceMemoryRegion{};
-
-			if (region.IsValid())
-			{
-				//align region
-				alignment_offset = mem::is_aligned(region.offset, requirements.alignment) ?
-					0 : mem::calc_aligned_value(region.offset, requirements.alignment) - region.offset;
-
-				NP_ENGINE_ASSERT(alignment_offset < region.size,
-					"alignment offset must be less than region size so that our region remains valid after alignment");
-
-				region.offset += alignment_offset;
-				region.size -= alignment_offset;
-
-				NP_ENGINE_ASSERT(region.size >= requirements.size,
-					"aligning region should not reduce region size below required size");
-
-				//split region to reduce as much as reasonable, so we update at index or erase it from free_regions
-				if (region.size - requirements.size > mem::DEFAULT_ALIGNMENT) //TODO: default alignment as threshold is arbitrary
-				{
-					//update at index for split region
-					(*free_regions)[index] = { region.offset + requirements.size, region.size - requirements.size };
-					region.size = requirements.size;
-				}
-				else
-				{
-					free_regions->erase(free_regions->begin() + index);
-				}
-			}
-
-			return { alignment_offset, region };
+			return _allocator.get_access()->allocate(requirements.size, requirements.alignment);
 		}
 
 	public:
 		VulkanDeviceMemoryPool(mem::sptr<VulkanDeviceMemory> memory) :
 			_memory(memory),
-			_free_regions{}
-		{
-			_free_regions.get_access()->emplace_back(VulkanDeviceMemoryRegion{ 0, memory->GetSize()});
-		}
+			_allocator(memory->GetSize())
+		{}
 
 		mem::sptr<VulkanDeviceMemoryAllocation> AllocateDeviceMemory(VkMemoryRequirements requirements, VkMemoryPropertyFlags flags)
 		{
@@ -429,9 +342,9 @@ namespace np::gpu::__detail
 			using resource_type = mem::smart_ptr_resource<VulkanDeviceMemoryAllocation, destroyer_type>;
 			using contiguous_block_type = mem::smart_ptr_contiguous_block<VulkanDeviceMemoryAllocation, resource_type>;
 
-			::std::pair<siz, VulkanDeviceMemoryRegion> acquired = AcquireRegion(requirements, flags);
+			mem::tlsf_offset_allocator::allocation acquired = AcquireRegion(requirements, flags);
 			resource_type* resource = nullptr;
-			if (acquired.second.IsValid())
+			if (acquired.is_valid())
 			{
 				mem::allocator& a = GetServices()->GetAllocator();
 				contiguous_block_type* contiguous_block = mem::create<contiguous_block_type>(a);
@@ -439,19 +352,25 @@ namespace np::gpu::__detail
 				if (contiguous_block)
 				{
 					VulkanDeviceMemoryAllocation* object =
-						mem::construct<VulkanDeviceMemoryAllocation>(contiguous_block->object_block, _memory, acquired.first, acquired.second);
+						mem::construct<VulkanDeviceMemoryAllocation>(contiguous_block->object_block, _memory, acquired.node,
+							VulkanDeviceMemoryRegion{ acquired.offset, acquired.size });
 					resource = mem::construct<resource_type>(contiguous_block->resource_block,
 						destroyer_type{ *this, a }, object);
 				}
 				else
 				{
-					ReleaseRegion(acquired.first, acquired.second);
+					ReleaseRegion(acquired.node);
 				}
 			}
 
 			return { resource };
 		}
 
+		mem::tlsf_offset_allocator::stats GetStats()
+		{
+			return _allocator.get_access()->get_stats();
+		}
+
 		mem::sptr<srvc::Services> GetServices() const
 		{
 			return _memory->GetServices();
@@ -519,6 +438,25 @@ namespace np::gpu::__detail
 			}
 			return allocation;
 		}
+
+		/*
+			stats summed over all of our pools, where largest free size is the largest of any one pool
+		*/
+		mem::tlsf_offset_allocator::stats GetStats()
+		{
+			mem::tlsf_offset_allocator::stats stats{};
+			auto pools = _pools.get_access();
+			for (const mem::sptr<VulkanDeviceMemoryPool>& pool : *pools)
+			{
+				const mem::tlsf_offset_allocator::stats pool_stats = pool->GetStats();
+				stats.size += pool_stats.size;
+				stats.free_size += pool_stats.free_size;
+				stats.largest_free_size = ::std::max(stats.largest_free_size, pool_stats.largest_free_size);
+				stats.free_block_count += pool_stats.free_block_count;
+				stats.allocation_count += pool_stats.allocation_count;
+			}
+			return stats;
+		}
 	};
 
 	class VulkanDevice : public Device
@@ -529,6 +467,7 @@ namespace np::gpu::__detail
 		VkPresentModeKHR _present_mode;
 		mem::sptr<VulkanLogicalDevice> _logical_device;
 		con::vector<mem::sptr<VulkanDeviceMemoryAccumulatingPool>> _memory_pools; //one accumulating pool per memory type that we have
+		mem::sptr<VulkanPipelineCache> _pipeline_cache;
 
 		static ::std::optional<VulkanPhysicalDevice> ChoosePhysicalDevice(mem::sptr<VulkanInstance> instance, DeviceUsage usage,
 																		  mem::sptr<VulkanPresentTarget> target)
@@ -598,7 +537,8 @@ namespace np::gpu::__detail
 			_surface_format(),
 			_present_mode(),
 			_logical_device(nullptr),
-			_memory_pools{}
+			_memory_pools{},
+			_pipeline_cache(nullptr)
 		{
 			mem::sptr<VulkanInstance> vulkan_instance = DetailObject::EnsureIsDetailType(instance, DetailType::Vulkan);
 			if (vulkan_instance)
@@ -615,6 +555,8 @@ namespace np::gpu::__detail
 						services->GetAllocator(), physical_device, CreateVkQueueCreateInfos(physical_device, usage, _target));
 
 					_memory_pools = CreateMemoryPools(_logical_device);
+					_pipeline_cache = mem::create_sptr<VulkanPipelineCache>(services->GetAllocator(), _logical_device,
+																			con::vector<ui8>{});
 				}
 			}
 		}
@@ -668,7 +610,12 @@ namespace np::gpu::__detail
 
 		virtual mem::sptr<PipelineCache> GetPipelineCache() const override
 		{
-			return mem::create_sptr<VulkanPipelineCache>(GetServices()->GetAllocator(), GetLogicalDevice(), con::vector<ui8>{});
+			return _pipeline_cache;
+		}
+
+		virtual mem::sptr<PipelineCache> CreatePipelineCache(const con::vector<ui8>& bytes) const override
+		{
+			return mem::create_sptr<VulkanPipelineCache>(GetServices()->GetAllocator(), GetLogicalDevice(), bytes);
 		}
 
 		virtual mem::sptr<Fence> CreateFence() override
@@ -327,7 +327,9 @@ namespace np::gpu::__detail
 			mem::sptr<VulkanDevice> device = render_pass->GetDevice();
 			mem::sptr<VulkanInstance> instance = device->GetDetailInstance();
 			VkPipeline pipeline = nullptr;
-			VkResult result = vkCreateGraphicsPipelines(*device->GetLogicalDevice(), nullptr, 1, &info, instance->GetVulkanAllocationCallbacks(), &pipeline);
+			VkResult result = cache ? cache->CreateVkGraphicsPipeline(info, pipeline)
+									: vkCreateGraphicsPipelines(*device->GetLogicalDevice(), nullptr, 1, &info,
+																instance->GetVulkanAllocationCallbacks(), &pipeline);
 			return result == VK_SUCCESS ? pipeline : nullptr;
 		}
 
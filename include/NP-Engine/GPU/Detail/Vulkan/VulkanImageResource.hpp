@@ -359,9 +359,12 @@ namespace np::gpu::__detail
 			_enable_destroy(false)
 		{}
 
+		/*
+			without allocate_memory the image is left unbound for BindMemory, so its memory can be placed by the caller
+		*/
 		VulkanImageResource(mem::sptr<Device> device, ImageResourceUsage usage, Format format, siz mip_count, siz layer_count,
 							siz sample_count, siz width, siz height, siz depth,
-							const con::vector<DeviceQueueFamily>& queue_families):
+							const con::vector<DeviceQueueFamily>& queue_families, bl allocate_memory = true):
 			_format(VulkanFormat::None),
 			_enable_destroy(true)
 		{
@@ -388,11 +391,14 @@ namespace np::gpu::__detail
 
 			_image = CreateVkImage(_device, vulkan_usage, _format, _mip_count, _layer_count, _sample_count, _width, _height,
 								   _depth, queue_families);
-			_memory_allocation = _device->AllocateDeviceMemory(
-				GetVkMemoryRequirements(_device, _image), vulkan_usage.GetVkMemoryPropertyFlags());
+			if (allocate_memory)
+			{
+				_memory_allocation = _device->AllocateDeviceMemory(
+					GetVkMemoryRequirements(_device, _image), vulkan_usage.GetVkMemoryPropertyFlags());
 
-			//TODO: check if _memory_allocation is valid?
-			BindMemory();
+				//TODO: check if _memory_allocation is valid?
+				BindMemory();
+			}
 		}
 
 		virtual ~VulkanImageResource()
@@ -410,6 +416,27 @@ namespace np::gpu::__detail
 			return _image;
 		}
 
+		VkMemoryRequirements GetVkMemoryRequirements() const
+		{
+			return GetVkMemoryRequirements(_device, _image);
+		}
+
+		/*
+			binds an image made without memory to the given allocation at the given offset into it, sharing the allocation
+			with any other image bound there -- returns false if this image already has memory
+		*/
+		bl BindMemory(mem::sptr<VulkanDeviceMemoryAllocation> allocation, siz offset)
+		{
+			if (_memory_allocation || !allocation || offset + GetVkMemoryRequirements().size > allocation->GetRegion().size)
+				return false;
+
+			VulkanResult result = allocation->GetDeviceMemory()->Bind(_image, allocation->GetRegion().offset + offset);
+			if (result.Contains(VulkanResult::Success))
+				_memory_allocation = allocation;
+
+			return _memory_allocation;
+		}
+
 		virtual DetailType GetDetailType() const override
 		{
 			return DetailType::Vulkan;
@@ -272,6 +272,19 @@ namespace np
 				return {properties, vk12_properties};
 			}
 
+			::std::pair<VkPhysicalDeviceProperties2, VkPhysicalDeviceIDProperties> GetVkIdProperties() const
+			{
+				VkPhysicalDeviceIDProperties id_properties{};
+				id_properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ID_PROPERTIES;
+
+				VkPhysicalDeviceProperties2 properties{};
+				properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+				properties.pNext = &id_properties;
+
+				vkGetPhysicalDeviceProperties2(_device, &properties);
+				return {properties, id_properties};
+			}
+
 			VkPhysicalDeviceProperties2 GetVkProperties2() const
 			{
 				VkPhysicalDeviceProperties2 properties{};
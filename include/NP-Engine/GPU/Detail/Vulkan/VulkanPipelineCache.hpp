@@ -7,7 +7,11 @@
 #ifndef NP_ENGINE_GPU_VULKAN_PIPELINE_CACHE_HPP
 #define NP_ENGINE_GPU_VULKAN_PIPELINE_CACHE_HPP
 
+#include <cstring>
+
 #include "NP-Engine/Memory/Memory.hpp"
+#include "NP-Engine/Math/Math.hpp"
+#include "NP-Engine/Insight/Insight.hpp"
 
 #include "NP-Engine/Vendor/VulkanInclude.hpp"
 
@@ -17,10 +21,35 @@
 
 namespace np::gpu::__detail
 {
+	/*
+		vkCreate*Pipelines may share our VkPipelineCache across threads, but vkMergePipelineCaches needs it to itself, so
+		creation takes our lock shared and Absorb takes it exclusive
+	*/
 	class VulkanPipelineCache : public PipelineCache
 	{
 	private:
+		/*
+			leads our serialized bytes -- the driver validates its own header too, but some drivers have crashed on data from
+			other drivers, so we refuse anything not built by this exact device and driver before the driver sees it
+		*/
+		struct Header
+		{
+			ui32 magic;
+			ui32 version;
+			ui32 vendorId;
+			ui32 deviceId;
+			ui32 driverVersion;
+			ui8 driverUuid[VK_UUID_SIZE];
+			ui8 pipelineCacheUuid[VK_UUID_SIZE];
+			ui64 dataSize;
+			ui64 dataHash;
+		};
+
+		constexpr static ui32 MAGIC = 0x4350504E; // "NPPC"
+		constexpr static ui32 VERSION = 1;
+
 		mem::sptr<VulkanLogicalDevice> _device;
+		mutable shared_mutex _m;
 		VkPipelineCache _cache;
 
 		static VkPipelineCacheCreateInfo CreateVkInfo()
@@ -30,11 +59,59 @@ namespace np::gpu::__detail
 			return info;
 		}
 
+		/*
+			dataSize and dataHash are left for the caller
+		*/
+		static Header CreateHeader(mem::sptr<VulkanLogicalDevice> device)
+		{
+			const ::std::pair<VkPhysicalDeviceProperties2, VkPhysicalDeviceIDProperties> properties =
+				device->GetPhysicalDevice().GetVkIdProperties();
+
+			Header header{};
+			header.magic = MAGIC;
+			header.version = VERSION;
+			header.vendorId = properties.first.properties.vendorID;
+			header.deviceId = properties.first.properties.deviceID;
+			header.driverVersion = properties.first.properties.driverVersion;
+			mem::copy_bytes(header.driverUuid, properties.second.driverUUID, VK_UUID_SIZE);
+			mem::copy_bytes(header.pipelineCacheUuid, properties.first.properties.pipelineCacheUUID, VK_UUID_SIZE);
+			return header;
+		}
+
+		/*
+			returns whether the given bytes carry driver data this device made, without touching that data
+		*/
+		static bl IsCompatible(mem::sptr<VulkanLogicalDevice> device, const con::vector<ui8>& bytes)
+		{
+			if (bytes.size() < sizeof(Header))
+				return false;
+
+			Header header{};
+			mem::copy_bytes(mem::address_of(header), bytes.data(), sizeof(Header));
+
+			const Header expected = CreateHeader(device);
+			const ui8* data = bytes.data() + sizeof(Header);
+			return header.magic == expected.magic && header.version == expected.version &&
+				header.vendorId == expected.vendorId && header.deviceId == expected.deviceId &&
+				header.driverVersion == expected.driverVersion &&
+				::std::memcmp(header.driverUuid, expected.driverUuid, VK_UUID_SIZE) == 0 &&
+				::std::memcmp(header.pipelineCacheUuid, expected.pipelineCacheUuid, VK_UUID_SIZE) == 0 &&
+				header.dataSize == bytes.size() - sizeof(Header) &&
+				header.dataHash == mat::hash_fnv1a_ui64(data, header.dataSize);
+		}
+
 		static VkPipelineCache CreateVkPipelineCache(mem::sptr<VulkanLogicalDevice> device, const con::vector<ui8>& bytes)
 		{
 			VkPipelineCacheCreateInfo info = CreateVkInfo();
-			info.initialDataSize = bytes.size();
-			info.pInitialData = info.initialDataSize > 0 ? bytes.data() : nullptr;
+			if (IsCompatible(device, bytes))
+			{
+				info.initialDataSize = bytes.size() - sizeof(Header);
+				info.pInitialData = info.initialDataSize > 0 ? bytes.data() + sizeof(Header) : nullptr;
+			}
+			else if (!bytes.empty())
+			{
+				NP_ENGINE_LOG_INFO("pipeline cache bytes are from another device or driver, starting empty");
+			}
 
 			mem::sptr<VulkanInstance> instance = device->GetPhysicalDevice().GetDetailInstance();
 			VkPipelineCache cache = nullptr;
@@ -43,7 +120,7 @@ namespace np::gpu::__detail
 		}
 
 	public:
-		VulkanPipelineCache(mem::sptr<VulkanLogicalDevice> device, con::vector<ui8> bytes):
+		VulkanPipelineCache(mem::sptr<VulkanLogicalDevice> device, const con::vector<ui8>& bytes):
 			PipelineCache(),
 			_device(device),
 			_cache(CreateVkPipelineCache(_device, bytes))
@@ -76,20 +153,59 @@ namespace np::gpu::__detail
 			return _device->GetServices();
 		}
 
+		VkResult CreateVkGraphicsPipeline(const VkGraphicsPipelineCreateInfo& info, VkPipeline& pipeline) const
+		{
+			mem::sptr<VulkanInstance> instance = _device->GetPhysicalDevice().GetDetailInstance();
+			shared_lock lock(_m);
+			return vkCreateGraphicsPipelines(*_device, _cache, 1, &info, instance->GetVulkanAllocationCallbacks(), &pipeline);
+		}
+
+		VkResult CreateVkComputePipeline(const VkComputePipelineCreateInfo& info, VkPipeline& pipeline) const
+		{
+			mem::sptr<VulkanInstance> instance = _device->GetPhysicalDevice().GetDetailInstance();
+			shared_lock lock(_m);
+			return vkCreateComputePipelines(*_device, _cache, 1, &info, instance->GetVulkanAllocationCallbacks(), &pipeline);
+		}
+
 		virtual bl Absorb(mem::sptr<PipelineCache> cache) override
 		{
-			return false; //TODO: absorb given cache!
+			mem::sptr<VulkanPipelineCache> other = cache;
+			if (!_cache || !other || !other->_cache || mem::address_of(*other) == this || !(other->_device == _device))
+				return false;
+
+			VkPipelineCache src = *other;
+			exclusive_lock lock(_m);
+			return vkMergePipelineCaches(*_device, _cache, 1, &src) == VK_SUCCESS;
 		}
 
 		virtual con::vector<ui8> GetBytes() const override
 		{
+			con::vector<ui8> bytes;
+			if (!_cache)
+				return bytes;
+
+			shared_lock lock(_m);
 			siz size = 0;
-			vkGetPipelineCacheData(*_device, _cache, &size, nullptr);
-			con::vector<ui8> bytes(size);
-			vkGetPipelineCacheData(*_device, _cache, &size, bytes.data());
+			VkResult result = VK_INCOMPLETE;
+			while (result == VK_INCOMPLETE)
+			{
+				// the cache may grow between calls while other threads create pipelines
+				vkGetPipelineCacheData(*_device, _cache, &size, nullptr);
+				bytes.resize(sizeof(Header) + size);
+				result = vkGetPipelineCacheData(*_device, _cache, &size, bytes.data() + sizeof(Header));
+			}
+
+			if (result != VK_SUCCESS || size == 0)
+				return {};
+
+			bytes.resize(sizeof(Header) + size);
+			Header header = CreateHeader(_device);
+			header.dataSize = size;
+			header.dataHash = mat::hash_fnv1a_ui64(bytes.data() + sizeof(Header), size);
+			mem::copy_bytes(bytes.data(), mem::address_of(header), sizeof(Header));
 			return bytes;
 		}
 	};
 } //namespace np::gpu::__detail
 
-#endif /* NP_ENGINE_GPU_VULKAN_PIPELINE_CACHE_HPP */
\ No newline at end of file
+#endif /* NP_ENGINE_GPU_VULKAN_PIPELINE_CACHE_HPP */
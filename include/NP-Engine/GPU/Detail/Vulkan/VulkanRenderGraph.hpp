@@ -0,0 +1,99 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#ifndef NP_ENGINE_GPU_VULKAN_RENDER_GRAPH_HPP
+#define NP_ENGINE_GPU_VULKAN_RENDER_GRAPH_HPP
+
+#include "NP-Engine/Primitive/Primitive.hpp"
+#include "NP-Engine/Container/Container.hpp"
+#include "NP-Engine/Memory/Memory.hpp"
+
+#include "NP-Engine/Vendor/VulkanInclude.hpp"
+
+#include "NP-Engine/GPU/Interface/RenderGraph.hpp"
+
+#include "VulkanDevice.hpp"
+#include "VulkanImageResource.hpp"
+
+namespace np::gpu::__detail
+{
+	/*
+		makes a graph's transient images without memory so the driver can size them, lets the graph place them, then
+		binds every image of a heap into one allocation from the device's memory pools -- images share that allocation, so
+		it is released with the last of them
+	*/
+	class VulkanRenderGraph
+	{
+	public:
+		static bl Realize(RenderGraph& graph, mem::sptr<Device> device_, const con::vector<DeviceQueueFamily>& queue_families)
+		{
+			if (!device_ || device_->GetDetailType() != DetailType::Vulkan)
+				return false;
+
+			mem::sptr<VulkanDevice> device = device_;
+			mem::allocator& allocator = device->GetServices()->GetAllocator();
+			con::vector<mem::sptr<VulkanImageResource>> images(graph.GetResourceCount());
+
+			for (siz i = 0; i < images.size(); i++)
+			{
+				if (!graph.IsTransient(i))
+					continue;
+
+				const RenderGraphImageDescription& description = graph.GetImageDescription(i);
+				images[i] = mem::create_sptr<VulkanImageResource>(
+					allocator, device_, description.usage, description.format, description.mipCount, description.layerCount,
+					description.sampleCount, description.width, description.height, description.depth, queue_families, false);
+
+				const VkMemoryRequirements requirements = images[i]->GetVkMemoryRequirements();
+				graph.SetImage(i, nullptr);
+				graph.SetMemoryRequirements(i, {requirements.size, requirements.alignment, requirements.memoryTypeBits});
+			}
+
+			graph.Compile();
+
+			con::vector<mem::sptr<VulkanDeviceMemoryAllocation>> heaps(graph.GetHeapCount());
+			for (siz i = 0; i < heaps.size(); i++)
+			{
+				// the heap takes the memory properties of the first image placed in it
+				VkMemoryPropertyFlags flags = 0;
+				for (siz j = 0; j < images.size(); j++)
+				{
+					if (images[j] && graph.GetPlacement(j).heap == i)
+					{
+						flags = VulkanImageResourceUsage{graph.GetImageDescription(j).usage}.GetVkMemoryPropertyFlags();
+						break;
+					}
+				}
+
+				const RenderGraphMemoryRequirements heap = graph.GetHeapRequirements(i);
+				VkMemoryRequirements requirements{};
+				requirements.size = mem::calc_aligned_size(heap.size, heap.alignment);
+				requirements.alignment = heap.alignment;
+				requirements.memoryTypeBits = heap.typeBits;
+				heaps[i] = device->AllocateDeviceMemory(requirements, flags);
+				if (!heaps[i])
+					return false;
+			}
+
+			// culled images have no placement and are dropped here
+			for (siz i = 0; i < images.size(); i++)
+			{
+				const RenderGraphPlacement placement = graph.GetPlacement(i);
+				if (images[i] && placement.IsValid())
+				{
+					if (!images[i]->BindMemory(heaps[placement.heap], placement.offset))
+						return false;
+
+					graph.SetImage(i, images[i]);
+				}
+			}
+
+			return true;
+		}
+	};
+} // namespace np::gpu::__detail
+
+#endif /* NP_ENGINE_GPU_VULKAN_RENDER_GRAPH_HPP */
@@ -75,22 +75,25 @@ namespace np::gpu::__detail
 		VulkanResourceUsage usage = VulkanResourceUsage::None; //TODO: we might be just fine with ResourceUsage
 		ui32 count = 0;
 		VulkanStage stage = VulkanStage::None;
+		bl isIndexed = false;
 
 		VulkanResourceDescription(const ResourceDescription& other = {}):
 			type(other.type),
 			usage(other.usage),
 			count(other.count),
-			stage(other.stage)
+			stage(other.stage),
+			isIndexed(other.isIndexed)
 		{}
 
 		operator ResourceDescription() const
 		{
-			return {type, usage, count, stage};
+			return {type, usage, count, stage, isIndexed};
 		}
 
 		bl operator==(const VulkanResourceDescription& other) const
 		{
-			return type == other.type && usage == other.usage && count == other.count && stage == other.stage;
+			return type == other.type && usage == other.usage && count == other.count && stage == other.stage &&
+				isIndexed == other.isIndexed;
 		}
 
 		VkDescriptorType GetVkDescriptorType() const
@@ -181,6 +184,49 @@ namespace np::gpu::__detail
 			binding.descriptorCount = count;
 			return binding;
 		}
+
+		/*
+			indexed bindings are always partially bound, and update after bind when the device supports it for our type
+		*/
+		VkDescriptorBindingFlags GetVkDescriptorBindingFlags(const VkPhysicalDeviceVulkan12Features& features) const
+		{
+			VkDescriptorBindingFlags flags = 0;
+			if (isIndexed && features.descriptorBindingPartiallyBound)
+			{
+				flags |= VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT;
+
+				VkBool32 is_update_after_bind_supported = VK_FALSE;
+				switch (GetVkDescriptorType())
+				{
+				case VK_DESCRIPTOR_TYPE_SAMPLER:
+				case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+				case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+					is_update_after_bind_supported = features.descriptorBindingSampledImageUpdateAfterBind;
+					break;
+				case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+					is_update_after_bind_supported = features.descriptorBindingStorageImageUpdateAfterBind;
+					break;
+				case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+					is_update_after_bind_supported = features.descriptorBindingUniformTexelBufferUpdateAfterBind;
+					break;
+				case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+					is_update_after_bind_supported = features.descriptorBindingStorageTexelBufferUpdateAfterBind;
+					break;
+				case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+					is_update_after_bind_supported = features.descriptorBindingUniformBufferUpdateAfterBind;
+					break;
+				case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+					is_update_after_bind_supported = features.descriptorBindingStorageBufferUpdateAfterBind;
+					break;
+				default: // dynamic buffers may never update after bind
+					break;
+				}
+
+				if (is_update_after_bind_supported && features.descriptorBindingUpdateUnusedWhilePending)
+					flags |= VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT | VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT;
+			}
+			return flags;
+		}
 	};
 
 	class VulkanResourceLayout : public ResourceLayout
@@ -200,16 +246,34 @@ namespace np::gpu::__detail
 		static VkDescriptorSetLayout CreateVkDescriptorSetLayout(mem::sptr<VulkanDevice> device,
 																 const con::vector<VulkanResourceDescription>& descriptions)
 		{
+			const VkPhysicalDeviceVulkan12Features features =
+				device->GetLogicalDevice()->GetPhysicalDevice().GetVk12Features().second;
+
 			con::vector<VkDescriptorSetLayoutBinding> bindings(descriptions.size());
+			con::vector<VkDescriptorBindingFlags> binding_flags(descriptions.size());
+			bl is_indexed = false;
+			bl is_update_after_bind = false;
 			for (siz i = 0; i < bindings.size(); i++)
 			{
 				bindings[i] = descriptions[i].GetVkDescriptorSetLayoutBinding();
 				bindings[i].binding = i;
+				binding_flags[i] = descriptions[i].GetVkDescriptorBindingFlags(features);
+				is_indexed |= descriptions[i].isIndexed;
+				is_update_after_bind |= (binding_flags[i] & VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT) != 0;
 			}
 
+			VkDescriptorSetLayoutBindingFlagsCreateInfo flags_info{};
+			flags_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO;
+			flags_info.bindingCount = (ui32)binding_flags.size();
+			flags_info.pBindingFlags = binding_flags.empty() ? nullptr : binding_flags.data();
+
 			VkDescriptorSetLayoutCreateInfo info = CreateInfo();
 			info.bindingCount = (ui32)bindings.size();
 			info.pBindings = bindings.empty() ? nullptr : bindings.data();
+			if (is_indexed)
+				info.pNext = &flags_info;
+			if (is_update_after_bind)
+				info.flags |= VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT;
 
 			mem::sptr<VulkanInstance> instance = device->GetDetailInstance();
 			VkDescriptorSetLayout layout = nullptr;
@@ -7,6 +7,8 @@
 #ifndef NP_ENGINE_GPU_VULKAN_RESOURCE_GROUP_HPP
 #define NP_ENGINE_GPU_VULKAN_RESOURCE_GROUP_HPP
 
+#include <algorithm>
+
 #include "NP-Engine/Primitive/Primitive.hpp"
 #include "NP-Engine/Container/Container.hpp"
 
@@ -96,20 +98,23 @@ namespace np::gpu::__detail
 	struct VulkanImageResourceAssignment : public VulkanResourceAssignment
 	{
 		con::vector<VulkanImageResourceAssignmentContext> contexts;
+		ui32 arrayIndex;
 
 		VulkanImageResourceAssignment(const ImageResourceAssignment& other = {}) :
 			VulkanResourceAssignment(other),
-			contexts{ other.contexts.begin(), other.contexts.end() }
+			contexts{ other.contexts.begin(), other.contexts.end() },
+			arrayIndex(other.arrayIndex)
 		{}
 
 		operator ImageResourceAssignment() const
 		{
-			return { resourceDescriptionIndex, { contexts.begin(), contexts.end() } };
+			return { resourceDescriptionIndex, { contexts.begin(), contexts.end() }, arrayIndex };
 		}
 
 		VkWriteDescriptorSet GetVkWriteDescriptorSet() const
 		{
 			VkWriteDescriptorSet writer = VulkanResourceAssignment::GetVkWriteDescriptorSet();
+			writer.dstArrayElement = arrayIndex;
 			writer.descriptorCount = contexts.size();
 			return writer;
 		}
@@ -124,27 +129,33 @@ namespace np::gpu::__detail
 
 		virtual bl IsCompatible(const ResourceDescription& description) const
 		{
-			return description.count == contexts.size() && description.type.Contains(ResourceType::Image);
+			const bl is_count_compatible = description.isIndexed
+				? !contexts.empty() && arrayIndex + contexts.size() <= description.count
+				: arrayIndex == 0 && description.count == contexts.size();
+			return is_count_compatible && description.type.Contains(ResourceType::Image);
 		}
 	};
 
 	struct VulkanBufferResourceAssignment : public VulkanResourceAssignment
 	{
 		con::vector<VulkanBufferResourceAssignmentContext> contexts;
+		ui32 arrayIndex;
 
 		VulkanBufferResourceAssignment(const BufferResourceAssignment& other = {}) :
 			VulkanResourceAssignment(other),
-			contexts{ other.contexts.begin(), other.contexts.end() }
+			contexts{ other.contexts.begin(), other.contexts.end() },
+			arrayIndex(other.arrayIndex)
 		{}
 
 		operator BufferResourceAssignment() const
 		{
-			return { resourceDescriptionIndex, { contexts.begin(), contexts.end() } };
+			return { resourceDescriptionIndex, { contexts.begin(), contexts.end() }, arrayIndex };
 		}
 
 		VkWriteDescriptorSet GetVkWriteDescriptorSet() const
 		{
 			VkWriteDescriptorSet writer = VulkanResourceAssignment::GetVkWriteDescriptorSet();
+			writer.dstArrayElement = arrayIndex;
 			writer.descriptorCount = contexts.size();
 			return writer;
 		}
@@ -159,7 +170,10 @@ namespace np::gpu::__detail
 
 		virtual bl IsCompatible(const ResourceDescription& description) const
 		{
-			return description.count == contexts.size() && description.type.Contains(ResourceType::Buffer);
+			const bl is_count_compatible = description.isIndexed
+				? !contexts.empty() && arrayIndex + contexts.size() <= description.count
+				: arrayIndex == 0 && description.count == contexts.size();
+			return is_count_compatible && description.type.Contains(ResourceType::Buffer);
 		}
 	};
 
@@ -345,7 +359,6 @@ namespace np::gpu::__detail
 				siz writer_offset = 0;
 				for (siz i = 0; i < assignments.imageAssignments.size(); i++)
 				{
-					//TODO: support array images
 					const VulkanImageResourceAssignment& assignment = assignments.imageAssignments[i];
 					VkWriteDescriptorSet& writer = writers[writer_offset + i];
 					writer = assignment.GetVkWriteDescriptorSet();
@@ -454,7 +467,7 @@ namespace np::gpu::__detail
 		mem::sptr<VulkanDevice> _device;
 		siz _size;
 		con::vector<VulkanResourceDescription> _descriptions;
-		VkDescriptorPool _pool;
+		con::vector<VkDescriptorPool> _pools; // we allocate from the last, each twice the size of the one before
 
 		static VkDescriptorSetAllocateInfo GetVkDescriptorSetAllocateInfo(VkDescriptorPool pool, siz count)
 		{
@@ -481,6 +494,37 @@ namespace np::gpu::__detail
 			return descriptor_set;
 		}
 
+		/*
+			allocates from our newest pool, and adds a pool twice its size when it runs out
+		*/
+		VkDescriptorSet AllocateVkDescriptorSet(VkDescriptorSetLayout layout, VkDescriptorPool& pool)
+		{
+			VkDescriptorSet set = nullptr;
+			VkResult result = VK_ERROR_OUT_OF_POOL_MEMORY;
+			if (!_pools.empty())
+			{
+				VkDescriptorSetAllocateInfo info = GetVkDescriptorSetAllocateInfo(_pools.back(), 1);
+				info.pSetLayouts = &layout;
+				result = vkAllocateDescriptorSets(*_device->GetLogicalDevice(), &info, &set);
+			}
+
+			if (result == VK_ERROR_OUT_OF_POOL_MEMORY || result == VK_ERROR_FRAGMENTED_POOL)
+			{
+				const siz size = ::std::max(_size, (siz)1) << _pools.size();
+				VkDescriptorPool grown = CreateVkDescriptorPool(_device, size, _descriptions);
+				if (grown)
+				{
+					_pools.emplace_back(grown);
+					VkDescriptorSetAllocateInfo info = GetVkDescriptorSetAllocateInfo(grown, 1);
+					info.pSetLayouts = &layout;
+					result = vkAllocateDescriptorSets(*_device->GetLogicalDevice(), &info, &set);
+				}
+			}
+
+			pool = _pools.empty() ? nullptr : _pools.back();
+			return result == VK_SUCCESS ? set : nullptr;
+		}
+
 		static VkDescriptorPoolCreateInfo CreateVkInfo(siz size)
 		{
 			/*
@@ -502,27 +546,38 @@ namespace np::gpu::__detail
 		static VkDescriptorPool CreateVkDescriptorPool(mem::sptr<VulkanDevice> device, siz size,
 			const con::vector<VulkanResourceDescription>& descriptions)
 		{
+			const VkPhysicalDeviceVulkan12Features features =
+				device->GetLogicalDevice()->GetPhysicalDevice().GetVk12Features().second;
+
+			// every set may need every description's full array
 			con::vector<VkDescriptorPoolSize> pool_sizes{};
+			bl is_update_after_bind = false;
 			for (const VulkanResourceDescription& description : descriptions)
 			{
 				const VkDescriptorType type = description.GetVkDescriptorType();
+				const ui32 count = ::std::max(description.count, (ui32)1) * (ui32)size;
 				bl found = false;
 
 				for (auto it = pool_sizes.rbegin(); !found && it != pool_sizes.rend(); it++)
 				{
 					found |= type == it->type;
 					if (found)
-						it->descriptorCount++;
+						it->descriptorCount += count;
 				}
 
 				if (!found)
-					pool_sizes.emplace_back(VkDescriptorPoolSize{ type, 1 });
+					pool_sizes.emplace_back(VkDescriptorPoolSize{ type, count });
+
+				is_update_after_bind |=
+					(description.GetVkDescriptorBindingFlags(features) & VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT) != 0;
 			}
 
 			VkDescriptorPoolCreateInfo info = CreateVkInfo(size);
 			info.poolSizeCount = pool_sizes.size();
 			info.pPoolSizes = pool_sizes.empty() ? nullptr : pool_sizes.data();
 			info.flags |= VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT; //enforce
+			if (is_update_after_bind)
+				info.flags |= VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT;
 
 			mem::sptr<VulkanInstance> instance = device->GetDetailInstance();
 			VkDescriptorPool pool = nullptr;
@@ -534,18 +589,19 @@ namespace np::gpu::__detail
 		VulkanResourceGroupPool(mem::sptr<Device> device, siz size, const con::vector<ResourceDescription>& descriptions) :
 			_device(device),
 			_size(size),
-			_descriptions(descriptions.begin(), descriptions.end()),
-			_pool(CreateVkDescriptorPool(_device, _size, _descriptions))
-		{}
+			_descriptions(descriptions.begin(), descriptions.end())
+		{
+			VkDescriptorPool pool = CreateVkDescriptorPool(_device, ::std::max(_size, (siz)1), _descriptions);
+			if (pool)
+				_pools.emplace_back(pool);
+		}
 
 		virtual ~VulkanResourceGroupPool()
 		{
-			if (_pool)
-			{
-				mem::sptr<VulkanInstance> instance = _device->GetDetailInstance();
-				vkDestroyDescriptorPool(*_device->GetLogicalDevice(), _pool, instance->GetVulkanAllocationCallbacks());
-				_pool = nullptr;
-			}
+			mem::sptr<VulkanInstance> instance = _device->GetDetailInstance();
+			for (VkDescriptorPool pool : _pools)
+				vkDestroyDescriptorPool(*_device->GetLogicalDevice(), pool, instance->GetVulkanAllocationCallbacks());
+			_pools.clear();
 		}
 
 		virtual DetailType GetDetailType() const override
@@ -583,20 +639,15 @@ namespace np::gpu::__detail
 				mem::sptr<VulkanResourceLayout> vulkan_layout = DetailObject::EnsureIsDetailType(layout, DetailType::Vulkan);
 				if (vulkan_layout)
 				{
-					const VkDescriptorSetLayout vk_layout = *vulkan_layout;
-
-					VkDescriptorSetAllocateInfo info = GetVkDescriptorSetAllocateInfo(_pool, 1);
-					info.pSetLayouts = &vk_layout;
-
-					VkDescriptorSet set = nullptr;
-					VulkanResult result = vkAllocateDescriptorSets(*_device->GetLogicalDevice(), &info, &set);
+					VkDescriptorPool pool = nullptr;
+					VkDescriptorSet set = AllocateVkDescriptorSet(*vulkan_layout, pool);
 
-					if (result.Contains(VulkanResult::Success))
+					if (set)
 					{
 						VulkanResourceGroup* object =
 							mem::construct<VulkanResourceGroup>(contiguous_block->object_block, vulkan_layout, set);
 						resource = mem::construct<resource_type>(contiguous_block->resource_block,
-							destroyer_type{ _device, _pool, a }, object);
+							destroyer_type{ _device, pool, a }, object);
 					}
 				}
 			}
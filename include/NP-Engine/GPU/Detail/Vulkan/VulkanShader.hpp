@@ -21,6 +21,7 @@
 #include "NP-Engine/GPU/Interface/Shader.hpp"
 
 #include "VulkanDevice.hpp"
+#include "VulkanShaderCache.hpp"
 #include "VulkanStage.hpp"
 
 namespace np::gpu::__detail
@@ -33,6 +34,7 @@ namespace np::gpu::__detail
 		str _filename;
 		str _entrypoint;
 		str _filename_spv;
+		ui64 _key; // VulkanShaderCache key of what _bytes were compiled from
 		siz _size; // we keep track of byte count in _size separate from _bytes.size() since it may not be ui32 aligned
 		con::vector<ui32> _bytes; //using ui32 since VkShaderModuleCreateInfo requires a ui32*
 		VkShaderModule _module;
@@ -44,32 +46,22 @@ namespace np::gpu::__detail
 			return info;
 		}
 
-		void CompileSpirV()
+		/*
+			returns true when the spir-v changed -- a reload of unchanged sources keeps our bytes and module
+		*/
+		bl Read(str filename)
 		{
-			// TODO: do we want to do a hash check to see if we need to compile or not?
+			const ui64 key = VulkanShaderCache::GetKey(filename, _stage);
+			if (key != 0 && key == _key && filename == _filename && _module)
+				return false;
 
-			str cmd(NP_ENGINE_VULKAN_GLSLC);
-			cmd += " -fshader-stage=" + _stage.GetCompileName();
-			cmd += " " + fsys::append(".", _filename);
-			cmd += " -o " + fsys::append(".", _filename_spv);
-
-			if (fsys::exists(_filename))
-			{
-				NP_ENGINE_LOG_INFO("Compiling: '" + cmd + "'");
-				sys::run(cmd);
-			}
-			else
-			{
-				NP_ENGINE_LOG_ERROR("Cannot find: '" + _filename + "'\n" + sys::get_default_working_directory());
-			}
-		}
-
-		void Read(str filename)
-		{
 			_filename = filename;
-			_filename_spv = _filename + ".spv";
-			CompileSpirV();
-			::std::ifstream ifile(_filename_spv, ::std::ios::ate | ::std::ios::binary);
+			_key = key;
+			_filename_spv = VulkanShaderCache::GetSpirVFilename(_key);
+
+			::std::ifstream ifile;
+			if (VulkanShaderCache::Ensure(_filename, _stage, _key))
+				ifile.open(_filename_spv, ::std::ios::ate | ::std::ios::binary);
 
 			if (ifile.is_open())
 			{
@@ -84,6 +76,8 @@ namespace np::gpu::__detail
 				_size = 0;
 				_bytes.clear();
 			}
+
+			return true;
 		}
 
 		void CreateVkModule()
@@ -120,6 +114,7 @@ namespace np::gpu::__detail
 			_filename(filename),
 			_entrypoint(entrypoint),
 			_filename_spv(""),
+			_key(0),
 			_size(0),
 			_bytes({}),
 			_module(nullptr)
@@ -154,8 +149,8 @@ namespace np::gpu::__detail
 
 		virtual void Load(str filename) override
 		{
-			Read(filename);
-			CreateVkModule();
+			if (Read(filename))
+				CreateVkModule();
 		}
 
 		virtual void Reload() override
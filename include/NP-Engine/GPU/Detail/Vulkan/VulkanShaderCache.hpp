@@ -0,0 +1,220 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#ifndef NP_ENGINE_GPU_VULKAN_SHADER_CACHE_HPP
+#define NP_ENGINE_GPU_VULKAN_SHADER_CACHE_HPP
+
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <sstream>
+
+#include "NP-Engine/Primitive/Primitive.hpp"
+#include "NP-Engine/String/String.hpp"
+#include "NP-Engine/Container/Container.hpp"
+#include "NP-Engine/Memory/Memory.hpp"
+#include "NP-Engine/Math/Math.hpp"
+#include "NP-Engine/FileSystem/FileSystem.hpp"
+#include "NP-Engine/System/System.hpp"
+#include "NP-Engine/Thread/Thread.hpp"
+#include "NP-Engine/JobSystem/JobSystem.hpp"
+#include "NP-Engine/Insight/Insight.hpp"
+
+#include "NP-Engine/GPU/Interface/Shader.hpp"
+
+#include "VulkanStage.hpp"
+
+namespace np::gpu::__detail
+{
+	/*
+		spir-v compiled by glslc, kept in GetDirectory under a hash of the glsl source, every file it includes, its stage,
+		and the compile command -- so a shader only compiles when one of those changes, and switching back to an older
+		version of a shader is a cache hit
+	*/
+	class VulkanShaderCache
+	{
+	private:
+		struct Miss
+		{
+			str filename;
+			VulkanStage stage;
+			ui64 key;
+		};
+
+		static str GetCompileCommand(const VulkanStage& stage)
+		{
+			return str(NP_ENGINE_VULKAN_GLSLC) + " -fshader-stage=" + stage.GetCompileName();
+		}
+
+		static bl ReadFile(const str& filename, str& contents)
+		{
+			::std::ifstream ifile(filename, ::std::ios::binary);
+			if (!ifile.is_open())
+				return false;
+
+			::std::stringstream ss;
+			ss << ifile.rdbuf();
+			contents = ss.str();
+			return true;
+		}
+
+		/*
+			hashes the given file and then every file it includes with #include "filename", resolved next to the including
+			file like glslc does, each file only once
+		*/
+		static bl HashIncludeClosure(const str& filename, con::vector<str>& visited, ui64& hash)
+		{
+			str contents;
+			if (!ReadFile(filename, contents))
+				return false;
+
+			hash = mat::hash_fnv1a_ui64(filename.data(), filename.size(), hash);
+			hash = mat::hash_fnv1a_ui64(contents.data(), contents.size(), hash);
+
+			const str directive = "#include";
+			for (siz i = contents.find(directive); i != str::npos; i = contents.find(directive, i + directive.size()))
+			{
+				const siz begin = contents.find('"', i + directive.size());
+				const siz line_end = contents.find('\n', i);
+				if (begin == str::npos || (line_end != str::npos && begin > line_end))
+					continue;
+
+				const siz end = contents.find('"', begin + 1);
+				if (end == str::npos || (line_end != str::npos && end > line_end))
+					continue;
+
+				const str include = fsys::append(fsys::get_parent_path(filename), str(contents.substr(begin + 1, end - begin - 1)));
+				if (::std::find(visited.begin(), visited.end(), include) == visited.end())
+				{
+					visited.emplace_back(include);
+					// a missing include still changes the key, glslc will report it
+					if (!HashIncludeClosure(include, visited, hash))
+						hash = mat::hash_fnv1a_ui64(include.data(), include.size(), hash);
+				}
+			}
+
+			return true;
+		}
+
+		static str ToHex(ui64 value)
+		{
+			::std::stringstream ss;
+			ss << ::std::hex << ::std::setw(16) << ::std::setfill('0') << value;
+			return ss.str();
+		}
+
+		/*
+			compiles to a file only this thread writes, then renames it into place so no reader sees a partial file
+		*/
+		static bl Compile(const str& filename, const VulkanStage& stage, const str& filename_spv)
+		{
+			const str filename_tmp =
+				filename_spv + "." + ToHex((ui64)::std::hash<thr::thread::id>{}(thr::this_thread::get_id())) + ".tmp";
+
+			str cmd = GetCompileCommand(stage);
+			cmd += " " + fsys::append(".", filename);
+			cmd += " -o " + fsys::append(".", filename_tmp);
+
+			NP_ENGINE_LOG_INFO("Compiling: '" + cmd + "'");
+			const bl compiled = sys::run(cmd) == 0 && fsys::exists(filename_tmp);
+
+			// another thread may have put the same key in place first, which is just as good
+			if (compiled)
+				fsys::rename(filename_tmp, filename_spv);
+
+			fsys::remove_all(filename_tmp);
+			return compiled && fsys::exists(filename_spv);
+		}
+
+		static void EnsureMiss(void* payload, siz participant, siz index)
+		{
+			const Miss& miss = (*(const con::vector<Miss>*)payload)[index];
+			Ensure(miss.filename, miss.stage, miss.key);
+		}
+
+	public:
+		static str GetDirectory()
+		{
+			return fsys::append("Vulkan", "shader-cache");
+		}
+
+		/*
+			returns 0 when the given glsl file cannot be read
+		*/
+		static ui64 GetKey(const str& filename, const VulkanStage& stage)
+		{
+			const str cmd = GetCompileCommand(stage);
+			ui64 hash = mat::hash_fnv1a_ui64(cmd.data(), cmd.size());
+			con::vector<str> visited{filename};
+			if (!HashIncludeClosure(filename, visited, hash))
+				return 0;
+
+			return hash == 0 ? 1 : hash; // 0 is reserved for missing sources
+		}
+
+		static void Clear()
+		{
+			fsys::remove_all(GetDirectory());
+		}
+
+		static str GetSpirVFilename(ui64 key)
+		{
+			return fsys::append(GetDirectory(), ToHex(key) + ".spv");
+		}
+
+		/*
+			compiles the given glsl file unless the cache already holds the given key, returning whether it now does
+		*/
+		static bl Ensure(const str& filename, const VulkanStage& stage, ui64 key)
+		{
+			if (key == 0)
+			{
+				NP_ENGINE_LOG_ERROR("Cannot find: '" + filename + "'\n" + sys::get_default_working_directory());
+				return false;
+			}
+
+			const str filename_spv = GetSpirVFilename(key);
+			if (fsys::exists(filename_spv))
+				return true;
+
+			fsys::create_directories(GetDirectory());
+			return Compile(filename, stage, filename_spv);
+		}
+
+		/*
+			ensures every given source is cached -- keys are hashed here, and each distinct miss is compiled once across the
+			job workers and this thread, returning once all are done
+		*/
+		static void Prepare(const con::vector<ShaderSource>& sources, jsys::JobSystem* job_system)
+		{
+			con::vector<Miss> misses;
+			for (const ShaderSource& source : sources)
+			{
+				const VulkanStage stage(source.stage);
+				const ui64 key = GetKey(source.filename, stage);
+				bl is_listed = false;
+				for (siz i = 0; i < misses.size() && !is_listed; i++)
+					is_listed = misses[i].key == key;
+
+				if (key == 0 || (!is_listed && !fsys::exists(GetSpirVFilename(key))))
+					misses.push_back({source.filename, stage, key});
+			}
+
+			if (job_system)
+			{
+				job_system->ParallelFor(misses.size(), EnsureMiss, mem::address_of(misses));
+			}
+			else
+			{
+				for (siz i = 0; i < misses.size(); i++)
+					EnsureMiss(mem::address_of(misses), 0, i);
+			}
+		}
+	};
+} // namespace np::gpu::__detail
+
+#endif /* NP_ENGINE_GPU_VULKAN_SHADER_CACHE_HPP */
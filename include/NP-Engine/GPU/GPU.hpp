@@ -17,6 +17,7 @@
 #include "Interface/CommandBuffer.hpp"
 #include "Interface/CommandBufferPool.hpp"
 #include "Interface/Commands.hpp"
+#include "Interface/CommandStream.hpp"
 #include "Interface/ComputePipeline.hpp"
 #include "Interface/DepthStencil.hpp"
 #include "Interface/Detail.hpp"
@@ -24,6 +25,7 @@
 #include "Interface/DmsImage.hpp"
 #include "Interface/DmsLineSegment.hpp"
 #include "Interface/DrawableImage.hpp"
+#include "Interface/DrawList.hpp"
 #include "Interface/Dynamic.hpp"
 #include "Interface/Fence.hpp"
 #include "Interface/Flag.hpp"
@@ -44,15 +46,19 @@
 #include "Interface/PushData.hpp"
 #include "Interface/Queue.hpp"
 #include "Interface/Rasterization.hpp"
+#include "Interface/RenderGraph.hpp"
 #include "Interface/RenderPass.hpp"
 #include "Interface/Resource.hpp"
 #include "Interface/ResourceGroup.hpp"
+#include "Interface/ResourceGroupCache.hpp"
 #include "Interface/Result.hpp"
 #include "Interface/SamplerResource.hpp"
 #include "Interface/Scissor.hpp"
+#include "Interface/SecondaryCommandRecorder.hpp"
 #include "Interface/Semaphore.hpp"
 #include "Interface/Shader.hpp"
 #include "Interface/Stage.hpp"
+#include "Interface/StagingRing.hpp"
 #include "Interface/Subview.hpp"
 #include "Interface/Topology.hpp"
 #include "Interface/Viewport.hpp"
@@ -60,9 +60,29 @@ namespace np::gpu
 
 		virtual bl Resize(siz size) = 0;
 
-		virtual bl SetBytes(siz offset, const con::vector<ui8>& bytes) = 0;
+		virtual bl SetBytes(siz offset, const void* src, siz byte_count) = 0;
 
-		virtual con::vector<ui8> GetBytes(siz offset, siz size) = 0;
+		virtual bl GetBytes(siz offset, void* dst, siz byte_count) = 0;
+
+		virtual bl SetBytes(siz offset, const con::vector<ui8>& bytes)
+		{
+			return SetBytes(offset, bytes.data(), bytes.size());
+		}
+
+		virtual con::vector<ui8> GetBytes(siz offset, siz size)
+		{
+			con::vector<ui8> bytes(size);
+			if (!GetBytes(offset, bytes.data(), bytes.size()))
+				bytes.clear();
+			return bytes;
+		}
+
+		/*
+			HostAccessible buffers stay mapped for their whole lifetime, so callers can write straight into this pointer
+			returns nullptr when the buffer is not host accessible
+			writes to memory without AutoClearCache still require ClearCacheForDevice
+		*/
+		virtual void* GetMapping() const = 0;
 	};
 } // namespace np::gpu
 
@@ -72,6 +72,7 @@ namespace np::gpu
 	};
 
 	class CommandBuffer;
+	class CommandStream;
 
 	class Command : public DetailObject //ONLY inherit this virtually for our commands
 										//<https://en.cppreference.com/w/cpp/language/derived_class.html>
@@ -99,6 +100,7 @@ namespace np::gpu
 	{
 	public:
 		constexpr static ui32 SingleUse = BIT(0);
+		constexpr static ui32 RenderPassContinue = BIT(1); // secondary command buffers recorded entirely inside a subpass
 
 		CommandBufferUsage(ui32 value): enm_ui32(value) {}
 	};
@@ -112,6 +114,11 @@ namespace np::gpu
 			return command && command->ApplyTo(this);
 		}
 
+		/*
+			records every packet of the given stream in order, returning false at the first one that could not be recorded
+		*/
+		bl Record(const CommandStream& stream);
+
 		virtual bl DependOn(mem::sptr<CommandBuffer> other) = 0;
 
 		virtual con::vector<mem::sptr<CommandBuffer>> GetDependencies() const = 0;
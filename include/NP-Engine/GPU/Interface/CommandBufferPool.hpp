@@ -11,6 +11,7 @@
 #include "NP-Engine/Memory/Memory.hpp"
 
 #include "CommandBuffer.hpp"
+#include "Framebuffer.hpp"
 #include "Detail.hpp"
 
 namespace np::gpu
@@ -30,11 +31,29 @@ namespace np::gpu
 
 		virtual mem::sptr<CommandBuffer> CreateCommandBuffer() = 0;
 
+		/*
+			secondary command buffers are recorded with BeginSecondary, and run from a primary with ExecuteCommands
+		*/
+		virtual mem::sptr<CommandBuffer> CreateSecondaryCommandBuffer() = 0;
+
 		virtual bl Begin(mem::sptr<CommandBuffer> command_buffer, CommandBufferUsage usage) = 0;
 
+		/*
+			begins a secondary command buffer that continues the given subpass of the given framebuffer's render pass
+			nothing is inherited from the primary but the render pass, so bind pipelines and set viewports and scissors again
+		*/
+		virtual bl BeginSecondary(mem::sptr<CommandBuffer> command_buffer, CommandBufferUsage usage,
+								  mem::sptr<Framebuffer> framebuffer, ui32 subpass_index) = 0;
+
 		virtual bl End(mem::sptr<CommandBuffer> command_buffer, CommandBufferUsage usage) = 0;
 
 		virtual bl Reset(mem::sptr<CommandBuffer> command_buffer, CommandBufferUsage usage) = 0;
+
+		/*
+			resets every command buffer made by this pool at once, keeping them and their memory for reuse
+			none of them may still be pending on the gpu
+		*/
+		virtual bl ResetAll() = 0;
 	};
 } //namespace np::gpu
 
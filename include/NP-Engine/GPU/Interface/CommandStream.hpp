@@ -0,0 +1,479 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#ifndef NP_ENGINE_GPU_INTERFACE_COMMAND_STREAM_HPP
+#define NP_ENGINE_GPU_INTERFACE_COMMAND_STREAM_HPP
+
+#include <algorithm>
+#include <type_traits>
+
+#include "NP-Engine/Foundation/Foundation.hpp"
+#include "NP-Engine/Primitive/Primitive.hpp"
+#include "NP-Engine/Container/Container.hpp"
+#include "NP-Engine/Memory/Memory.hpp"
+
+#include "Commands.hpp"
+
+namespace np::gpu
+{
+	/*
+		records commands as tagged packets with their payloads inline in one linear buffer, for CommandBuffer::Record to
+		translate in a single pass -- recording a draw is a few stores instead of a Command allocation
+		- resources are referenced, not owned, so keep them alive until the command buffer is done with them
+		- a stream is not thread safe -- give each job its own stream, then Record or Append them in a fixed order
+		- Clear keeps capacity, so a stream rebuilt every frame stops allocating once it has seen its largest frame
+		- barriers, flags, image copies, and indirect commands are still recorded with Command objects
+	*/
+	class CommandStream
+	{
+	public:
+		/*
+			each packet's payload follows it directly, trailed by its arrays, each padded to ALIGNMENT
+		*/
+		struct Packet
+		{
+			CommandType type;
+			ui32 size; // bytes of this packet, payload, and arrays
+		};
+
+		constexpr static siz ALIGNMENT = sizeof(ui64);
+
+		struct CopyBufferPayload
+		{
+			BufferResource* dst;
+			BufferResource* src;
+			siz rangeCount; // CopyBufferRange[rangeCount]
+		};
+
+		struct FillBufferPayload
+		{
+			BufferResource* buffer;
+			siz offset;
+			siz count;
+			ui32 value;
+		};
+
+		struct AssignBufferPayload
+		{
+			BufferResource* buffer;
+			siz offset;
+			siz byteCount; // ui8[byteCount]
+		};
+
+		struct BeginRenderPassPayload
+		{
+			Framebuffer* framebuffer;
+			RenderArea renderArea;
+			ui32 usage;
+			siz clearColorCount; // ClearColor[clearColorCount]
+		};
+
+		struct NextSubpassPayload
+		{
+			ui32 usage;
+		};
+
+		struct BindPipelinePayload
+		{
+			Pipeline* pipeline;
+			ui32 usage;
+		};
+
+		struct BindIndexBufferPayload
+		{
+			BufferResource* buffer;
+			siz offset;
+			siz stride;
+		};
+
+		struct BindVertexBuffersPayload
+		{
+			siz bindingBeginIndex;
+			siz bufferCount; // BufferResource*[bufferCount], then siz offsets[bufferCount]
+		};
+
+		struct BindResourceGroupsPayload
+		{
+			Pipeline* pipeline;
+			siz resourceLayoutBeginIndex;
+			siz resourceGroupCount; // ResourceGroup*[resourceGroupCount], then ui32 offsets[dynamicResourceOffsetCount]
+			siz dynamicResourceOffsetCount;
+		};
+
+		struct ExecuteCommandsPayload
+		{
+			siz commandBufferCount; // CommandBuffer*[commandBufferCount]
+		};
+
+		struct PushDataPayload
+		{
+			Pipeline* pipeline;
+			ui32 stage;
+			siz offset;
+			siz byteCount; // ui8[byteCount]
+		};
+
+		/*
+			Viewport holds a mat::range, which is not trivially copyable, so viewports are stored as these
+		*/
+		struct ViewportRecord
+		{
+			::glm::dvec2 position;
+			dbl width;
+			dbl height;
+			dbl minDepth;
+			dbl maxDepth;
+		};
+
+		struct SetViewportsPayload
+		{
+			siz viewportBeginIndex;
+			siz viewportCount; // ViewportRecord[viewportCount]
+		};
+
+		struct SetScissorsPayload
+		{
+			siz scissorBeginIndex;
+			siz scissorCount; // Scissor[scissorCount]
+		};
+
+		struct DispatchPayload
+		{
+			siz x;
+			siz y;
+			siz z;
+		};
+
+		struct DrawPayload
+		{
+			siz vertexCount;
+			siz vertexBeginIndex;
+			siz instanceCount;
+			siz instanceBeginIndex;
+		};
+
+		struct DrawIndexedPayload
+		{
+			siz indexCount;
+			siz indexBeginIndex;
+			siz vertexOffset;
+			siz instanceCount;
+			siz instanceBeginIndex;
+		};
+
+	private:
+		con::vector<ui64> _words;
+		siz _size;
+		siz _packet_count;
+
+		static constexpr siz Align(siz byte_count)
+		{
+			return (byte_count + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+		}
+
+		/*
+			bumps our size by the given aligned byte count, returning where those bytes begin
+		*/
+		ui8* Grow(siz byte_count)
+		{
+			const siz word_count = (_size + byte_count) / ALIGNMENT;
+			if (word_count > _words.size())
+			{
+				if (word_count > _words.capacity())
+					_words.reserve(::std::max(word_count, _words.capacity() * 2));
+				_words.resize(word_count);
+			}
+
+			ui8* bytes = (ui8*)_words.data() + _size;
+			_size += byte_count;
+			return bytes;
+		}
+
+		/*
+			reserves a packet with room for the given payload and array bytes, returning the payload
+		*/
+		template <typename T>
+		T* Allocate(CommandType type, siz array_byte_count = 0)
+		{
+			NP_ENGINE_STATIC_ASSERT(::std::is_trivially_copyable_v<T>, "payloads must be trivially copyable");
+
+			const siz packet_size = sizeof(Packet) + Align(sizeof(T)) + array_byte_count;
+			NP_ENGINE_ASSERT(packet_size <= UI32_MAX, "packet is too large");
+
+			ui8* bytes = Grow(packet_size);
+			Packet* packet = (Packet*)bytes;
+			packet->type = type;
+			packet->size = (ui32)packet_size;
+			_packet_count++;
+			return (T*)(bytes + sizeof(Packet));
+		}
+
+		/*
+			copies the given array to the given location, returning where the next array goes
+		*/
+		template <typename T>
+		static ui8* WriteArray(ui8* dst, const T* src, siz count)
+		{
+			NP_ENGINE_STATIC_ASSERT(::std::is_trivially_copyable_v<T>, "arrays must be trivially copyable");
+
+			if (count > 0)
+				mem::copy_bytes(dst, src, sizeof(T) * count);
+			return dst + Align(sizeof(T) * count);
+		}
+
+		template <typename T>
+		static ui8* GetArrayBegin(T* payload)
+		{
+			return (ui8*)payload + Align(sizeof(T));
+		}
+
+	public:
+		CommandStream(): _size(0), _packet_count(0) {}
+
+		/*
+			returns the first array after the given payload
+		*/
+		template <typename A, typename T>
+		static const A* GetArray(const T* payload)
+		{
+			return (const A*)((const ui8*)payload + Align(sizeof(T)));
+		}
+
+		/*
+			returns the array after the given array of count elements
+		*/
+		template <typename A, typename P>
+		static const A* GetNextArray(const P* array, siz count)
+		{
+			return (const A*)((const ui8*)array + Align(sizeof(P) * count));
+		}
+
+		template <typename T>
+		static const T* GetPayload(const Packet* packet)
+		{
+			return (const T*)((const ui8*)packet + sizeof(Packet));
+		}
+
+		void Reserve(siz byte_count)
+		{
+			_words.reserve(Align(byte_count) / ALIGNMENT);
+		}
+
+		void Clear()
+		{
+			_size = 0;
+			_packet_count = 0;
+		}
+
+		bl IsEmpty() const
+		{
+			return _size == 0;
+		}
+
+		/*
+			bytes in use, always a multiple of ALIGNMENT
+		*/
+		siz GetSize() const
+		{
+			return _size;
+		}
+
+		siz GetPacketCount() const
+		{
+			return _packet_count;
+		}
+
+		const ui8* GetData() const
+		{
+			return (const ui8*)_words.data();
+		}
+
+		/*
+			appends the packets of the given stream after ours
+		*/
+		void Append(const CommandStream& other)
+		{
+			NP_ENGINE_ASSERT(mem::address_of(other) != this, "cannot append a stream to itself");
+			if (other.IsEmpty())
+				return;
+
+			mem::copy_bytes(Grow(other._size), other.GetData(), other._size);
+			_packet_count += other._packet_count;
+		}
+
+		void CopyBuffer(BufferResource* dst, BufferResource* src, const CopyBufferRange ranges[], siz range_count)
+		{
+			CopyBufferPayload* payload =
+				Allocate<CopyBufferPayload>(CommandType::CopyBuffer, Align(sizeof(CopyBufferRange) * range_count));
+			payload->dst = dst;
+			payload->src = src;
+			payload->rangeCount = range_count;
+			WriteArray(GetArrayBegin(payload), ranges, range_count);
+		}
+
+		void FillBuffer(BufferResource* buffer, siz offset, siz count, ui32 value)
+		{
+			FillBufferPayload* payload = Allocate<FillBufferPayload>(CommandType::FillBuffer);
+			payload->buffer = buffer;
+			payload->offset = offset;
+			payload->count = count;
+			payload->value = value;
+		}
+
+		/*
+			the given bytes are copied into the stream
+		*/
+		void AssignBuffer(BufferResource* buffer, siz offset, const void* bytes, siz byte_count)
+		{
+			AssignBufferPayload* payload = Allocate<AssignBufferPayload>(CommandType::AssignBuffer, Align(byte_count));
+			payload->buffer = buffer;
+			payload->offset = offset;
+			payload->byteCount = byte_count;
+			WriteArray(GetArrayBegin(payload), (const ui8*)bytes, byte_count);
+		}
+
+		/*
+			one clear color for each image view in the given framebuffer
+		*/
+		void BeginRenderPass(Framebuffer* framebuffer, const RenderArea& render_area, const ClearColor clear_colors[],
+							 siz clear_color_count, SubpassUsage usage = SubpassUsage::None)
+		{
+			BeginRenderPassPayload* payload = Allocate<BeginRenderPassPayload>(
+				CommandType::BeginRenderPass, Align(sizeof(ClearColor) * clear_color_count));
+			payload->framebuffer = framebuffer;
+			payload->renderArea = render_area;
+			payload->usage = usage;
+			payload->clearColorCount = clear_color_count;
+			WriteArray(GetArrayBegin(payload), clear_colors, clear_color_count);
+		}
+
+		void EndRenderPass()
+		{
+			Allocate<ui64>(CommandType::EndRenderPass); // unused payload, keeps every packet the same shape
+		}
+
+		void NextSubpass(SubpassUsage usage = SubpassUsage::None)
+		{
+			Allocate<NextSubpassPayload>(CommandType::NextSubpass)->usage = usage;
+		}
+
+		void BindPipeline(Pipeline* pipeline, PipelineUsage usage)
+		{
+			BindPipelinePayload* payload = Allocate<BindPipelinePayload>(CommandType::BindPipeline);
+			payload->pipeline = pipeline;
+			payload->usage = usage;
+		}
+
+		void BindIndexBuffer(BufferResource* buffer, siz offset, siz stride)
+		{
+			BindIndexBufferPayload* payload = Allocate<BindIndexBufferPayload>(CommandType::BindIndexBuffer);
+			payload->buffer = buffer;
+			payload->offset = offset;
+			payload->stride = stride;
+		}
+
+		void BindVertexBuffers(BufferResource* const buffers[], const siz offsets[], siz buffer_count,
+							   siz binding_begin_index = 0)
+		{
+			BindVertexBuffersPayload* payload = Allocate<BindVertexBuffersPayload>(
+				CommandType::BindVertexBuffers, Align(sizeof(BufferResource*) * buffer_count) + Align(sizeof(siz) * buffer_count));
+			payload->bindingBeginIndex = binding_begin_index;
+			payload->bufferCount = buffer_count;
+			WriteArray(WriteArray(GetArrayBegin(payload), buffers, buffer_count), offsets, buffer_count);
+		}
+
+		void BindResourceGroups(Pipeline* pipeline, siz resource_layout_begin_index, ResourceGroup* const resource_groups[],
+								siz resource_group_count, const ui32 dynamic_resource_offsets[] = nullptr,
+								siz dynamic_resource_offset_count = 0)
+		{
+			BindResourceGroupsPayload* payload = Allocate<BindResourceGroupsPayload>(
+				CommandType::BindResourceGroups,
+				Align(sizeof(ResourceGroup*) * resource_group_count) + Align(sizeof(ui32) * dynamic_resource_offset_count));
+			payload->pipeline = pipeline;
+			payload->resourceLayoutBeginIndex = resource_layout_begin_index;
+			payload->resourceGroupCount = resource_group_count;
+			payload->dynamicResourceOffsetCount = dynamic_resource_offset_count;
+			WriteArray(WriteArray(GetArrayBegin(payload), resource_groups, resource_group_count), dynamic_resource_offsets,
+					   dynamic_resource_offset_count);
+		}
+
+		/*
+			the given command buffers must be secondary, and ended before this stream is recorded
+		*/
+		void ExecuteCommands(CommandBuffer* const command_buffers[], siz command_buffer_count)
+		{
+			ExecuteCommandsPayload* payload = Allocate<ExecuteCommandsPayload>(
+				CommandType::ExecuteCommands, Align(sizeof(CommandBuffer*) * command_buffer_count));
+			payload->commandBufferCount = command_buffer_count;
+			WriteArray(GetArrayBegin(payload), command_buffers, command_buffer_count);
+		}
+
+		/*
+			the given bytes are copied into the stream, so each draw can push its own
+		*/
+		void PushData(Pipeline* pipeline, Stage stage, const void* bytes, siz byte_count, siz offset = 0)
+		{
+			PushDataPayload* payload = Allocate<PushDataPayload>(CommandType::PushData, Align(byte_count));
+			payload->pipeline = pipeline;
+			payload->stage = stage;
+			payload->offset = offset;
+			payload->byteCount = byte_count;
+			WriteArray(GetArrayBegin(payload), (const ui8*)bytes, byte_count);
+		}
+
+		void SetViewports(const Viewport viewports[], siz viewport_count, siz viewport_begin_index = 0)
+		{
+			SetViewportsPayload* payload =
+				Allocate<SetViewportsPayload>(CommandType::SetViewports, Align(sizeof(ViewportRecord) * viewport_count));
+			payload->viewportBeginIndex = viewport_begin_index;
+			payload->viewportCount = viewport_count;
+
+			ViewportRecord* records = (ViewportRecord*)GetArrayBegin(payload);
+			for (siz i = 0; i < viewport_count; i++)
+				records[i] = {viewports[i].position, viewports[i].width, viewports[i].height, viewports[i].depthBounds.min,
+							  viewports[i].depthBounds.max};
+		}
+
+		void SetScissors(const Scissor scissors[], siz scissor_count, siz scissor_begin_index = 0)
+		{
+			SetScissorsPayload* payload =
+				Allocate<SetScissorsPayload>(CommandType::SetScissors, Align(sizeof(Scissor) * scissor_count));
+			payload->scissorBeginIndex = scissor_begin_index;
+			payload->scissorCount = scissor_count;
+			WriteArray(GetArrayBegin(payload), scissors, scissor_count);
+		}
+
+		void Dispatch(siz x, siz y, siz z)
+		{
+			DispatchPayload* payload = Allocate<DispatchPayload>(CommandType::Dispatch);
+			payload->x = x;
+			payload->y = y;
+			payload->z = z;
+		}
+
+		void Draw(siz vertex_count, siz vertex_begin_index = 0, siz instance_count = 1, siz instance_begin_index = 0)
+		{
+			DrawPayload* payload = Allocate<DrawPayload>(CommandType::Draw);
+			payload->vertexCount = vertex_count;
+			payload->vertexBeginIndex = vertex_begin_index;
+			payload->instanceCount = instance_count;
+			payload->instanceBeginIndex = instance_begin_index;
+		}
+
+		void DrawIndexed(siz index_count, siz index_begin_index = 0, siz vertex_offset = 0, siz instance_count = 1,
+						 siz instance_begin_index = 0)
+		{
+			DrawIndexedPayload* payload = Allocate<DrawIndexedPayload>(CommandType::DrawIndexed);
+			payload->indexCount = index_count;
+			payload->indexBeginIndex = index_begin_index;
+			payload->vertexOffset = vertex_offset;
+			payload->instanceCount = instance_count;
+			payload->instanceBeginIndex = instance_begin_index;
+		}
+	};
+} // namespace np::gpu
+
+#endif /* NP_ENGINE_GPU_INTERFACE_COMMAND_STREAM_HPP */
@@ -19,7 +19,8 @@ namespace np::gpu
 		Vulkan,
 		OpenGL,
 		DirectX,
-		Metal
+		Metal,
+		Null // headless, for tests and cpu benchmarks
 	};
 
 	class DetailObject
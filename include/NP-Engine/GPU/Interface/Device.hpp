@@ -81,8 +81,17 @@ namespace np::gpu
 
 		virtual con::vector<DeviceQueueFamily> GetDeviceQueueFamilies() const = 0;
 
+		/*
+			returns the cache this device shares with every caller, so pipelines created on any thread warm it for the rest
+		*/
 		virtual mem::sptr<PipelineCache> GetPipelineCache() const = 0;
 
+		/*
+			bytes are from PipelineCache::GetBytes or PipelineCache::Load, and ones saved by another device or driver give an
+			empty cache
+		*/
+		virtual mem::sptr<PipelineCache> CreatePipelineCache(const con::vector<ui8>& bytes) const = 0;
+
 		virtual mem::sptr<Fence> CreateFence() = 0;
 
 		virtual mem::sptr<Semaphore> CreateSemaphore() = 0;
@@ -90,8 +99,6 @@ namespace np::gpu
 		virtual mem::sptr<Flag> CreateFlag() = 0;
 
 		virtual void WaitUntilIdle() const = 0;
-
-		//virtual mem::sptr<PipelineCache> CreatePipelineCache(str filename) const = 0; //TODO: how do we want to do this?
 	};
 } // namespace np::gpu
 
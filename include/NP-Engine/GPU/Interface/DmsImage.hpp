@@ -7,11 +7,23 @@
 #ifndef NP_ENGINE_GPU_INTERFACE_DMS_IMAGE_HPP
 #define NP_ENGINE_GPU_INTERFACE_DMS_IMAGE_HPP
 
+// rows of pixels each extraction job labels and marches
+#ifndef NP_ENGINE_DMS_IMAGE_TILE_HEIGHT
+	#define NP_ENGINE_DMS_IMAGE_TILE_HEIGHT 64
+#endif
+
+#include <algorithm>
+#include <cmath>
+
 #include "NP-Engine/Foundation/Foundation.hpp"
 #include "NP-Engine/Primitive/Primitive.hpp"
+#include "NP-Engine/Container/Container.hpp"
+#include "NP-Engine/Memory/Memory.hpp"
+#include "NP-Engine/Thread/Thread.hpp"
 #include "NP-Engine/Math/Math.hpp"
 #include "NP-Engine/Algorithms/Algorithms.hpp"
 #include "NP-Engine/Geometry/Geometry.hpp"
+#include "NP-Engine/JobSystem/JobSystem.hpp"
 
 #include "Color.hpp"
 #include "Image.hpp"
@@ -31,47 +43,96 @@ namespace np::alg // TODO: refactor DMS stuff to DualMarchingSquares
 		using DmsLineSegmentLoop = con::vector<DmsLineSegment>;
 		using Extraction = con::vector<con::vector<con::vector<DmsPoint>>>;
 
-		struct Payload : public FloodFillImage::Payload
-		{
-			dbl isothreshold = 0.5;
-			gpu::ColorChannel channel = gpu::ColorChannel::Alpha;
-			con::uset<DmsPoint>* edgePoints = nullptr;
-			con::uset<DmsPoint>* visited = nullptr;
-		};
-
 	private:
-		ImageSubview _image_subview;
+		constexpr static ui32 NO_PIXEL = UINT32_MAX;
+		constexpr static ui32 NO_LINK = UINT32_MAX;
 
-		static bl IsNotVisitedAndUnderIsothreshold(mem::delegate_bl& d)
+		/*
+			a marched segment with its endpoints quantized to 32nds (x in the high bits, y in the low) so shared endpoints
+			match as integers -- pixel is a corner of its cell at or under the isothreshold, and later the index of its shape
+		*/
+		struct TileSegment
 		{
-			using Relation = FloodFillImage::PointRelation;
-			Payload& payload = *((Payload*)d.GetPayload());
-			Point point = payload.point;
-
-			if (payload.relation.Contains(Relation::Upper))
-				point.y++;
-			if (payload.relation.Contains(Relation::Lower))
-				point.y--;
-			if (payload.relation.Contains(Relation::Right))
-				point.x++;
-			if (payload.relation.Contains(Relation::Left))
-				point.x--;
-
-			return !payload.visited->count(point) &&
-				GetIsovalue(*payload.imageSubview, point, payload.channel) < payload.isothreshold;
-		}
+			ui64 begin;
+			ui64 end;
+			ui32 pixel;
+		};
 
-		static void MarkAsVisited(mem::delegate_void& d)
+		/*
+			lives on the stack of GetExtraction -- only touched by jobs while they hold a claimed index
+		*/
+		struct ExtractionContext
 		{
-			Payload& payload = *((Payload*)d.GetPayload());
-			payload.visited->emplace(payload.point);
-		}
+			const ImageSubview* imageSubview;
+			dbl isothreshold;
+			gpu::ColorChannel channel = gpu::ColorChannel::Alpha;
+			ui32 width;
+			ui32 height;
+			con::vector<ui32> parents; // union-find over pixels, NO_PIXEL when over the isothreshold
+			con::vector<con::vector<TileSegment>> tileSegments;
+			con::vector<TileSegment> shapeSegments;
+			con::vector<ui32> shapeOffsets;
+			Extraction* extraction;
+		};
 
-		static void ExtractEdgePoint(mem::delegate_void& d)
+		/*
+			open addressed endpoint to first link table, sized for a load under one half -- one allocation per shape
+			instead of one per endpoint
+		*/
+		class EndpointMap
 		{
-			Payload& payload = *((Payload*)d.GetPayload());
-			payload.edgePoints->emplace(payload.point);
-		}
+		private:
+			constexpr static ui64 EMPTY = UINT64_MAX; // quantized endpoints never use the top bit
+
+			struct Slot
+			{
+				ui64 endpoint;
+				ui32 link;
+			};
+
+			con::vector<Slot> _slots;
+			ui64 _mask;
+
+			siz GetSlotIndex(ui64 endpoint) const
+			{
+				return (siz)(((endpoint ^ (endpoint >> 29)) * 0x9E3779B97F4A7C15ULL) >> 32) & _mask;
+			}
+
+		public:
+			EndpointMap(siz endpoint_count)
+			{
+				siz capacity = 16;
+				while (capacity < endpoint_count * 2)
+					capacity <<= 1;
+
+				_slots.assign(capacity, {EMPTY, NO_LINK});
+				_mask = capacity - 1;
+			}
+
+			/*
+				gets the first link for endpoint, adding it with NO_LINK when missing
+			*/
+			ui32& operator[](ui64 endpoint)
+			{
+				siz i = GetSlotIndex(endpoint);
+				while (_slots[i].endpoint != endpoint && _slots[i].endpoint != EMPTY)
+					i = (i + 1) & _mask;
+
+				_slots[i].endpoint = endpoint;
+				return _slots[i].link;
+			}
+
+			ui32 Find(ui64 endpoint) const
+			{
+				for (siz i = GetSlotIndex(endpoint); _slots[i].endpoint != EMPTY; i = (i + 1) & _mask)
+					if (_slots[i].endpoint == endpoint)
+						return _slots[i].link;
+
+				return NO_LINK;
+			}
+		};
+
+		ImageSubview _image_subview;
 
 		/*
 			- gets the dms iso value [0.0 - 1.0] at given point
@@ -149,18 +210,14 @@ namespace np::alg // TODO: refactor DMS stuff to DualMarchingSquares
 		}
 
 		/*
-			getting line segments of a b c d:
+			marches the cell:
 			a b
 			d c
+			writing each segment as a pair of points, and returning how many points were written (up to 4)
 		*/
-		void GetLineSegments(con::uset<DmsLineSegment>& segments, dbl isothreshold, gpu::ColorChannel channel,
-							 const DmsPoint& a, const DmsPoint& b, const DmsPoint& c, const DmsPoint& d)
+		static ui32 MarchCell(dbl isothreshold, const DmsPoint& a, const DmsPoint& b, const DmsPoint& c, const DmsPoint& d,
+							  dbl a_iso, dbl b_iso, dbl c_iso, dbl d_iso, DmsPoint* points)
 		{
-			dbl a_iso = GetIsovalue(a, channel);
-			dbl b_iso = GetIsovalue(b, channel);
-			dbl c_iso = GetIsovalue(c, channel);
-			dbl d_iso = GetIsovalue(d, channel);
-
 			ui8 segment_type = 0;
 			segment_type |= a_iso > isothreshold ? BIT(0) : 0;
 			segment_type |= b_iso > isothreshold ? BIT(1) : 0;
@@ -171,38 +228,42 @@ namespace np::alg // TODO: refactor DMS stuff to DualMarchingSquares
 			{
 			case 0:
 			case 15:
-				break;
+				return 0;
 			case 1:
 			case 14:
 			{
 				dbl ab_t = (isothreshold - a_iso) / (b_iso - a_iso);
 				dbl ad_t = (isothreshold - a_iso) / (d_iso - a_iso);
-				AddLineSegment(segments, ::glm::lerp(a, b, ab_t), ::glm::lerp(a, d, ad_t));
-				break;
+				points[0] = ::glm::lerp(a, b, ab_t);
+				points[1] = ::glm::lerp(a, d, ad_t);
+				return 2;
 			}
 			case 2:
 			case 13:
 			{
 				dbl ab_t = (isothreshold - a_iso) / (b_iso - a_iso);
 				dbl bc_t = (isothreshold - b_iso) / (c_iso - b_iso);
-				AddLineSegment(segments, ::glm::lerp(a, b, ab_t), ::glm::lerp(b, c, bc_t));
-				break;
+				points[0] = ::glm::lerp(a, b, ab_t);
+				points[1] = ::glm::lerp(b, c, bc_t);
+				return 2;
 			}
 			case 3:
 			case 12:
 			{
 				dbl ad_t = (isothreshold - a_iso) / (d_iso - a_iso);
 				dbl bc_t = (isothreshold - b_iso) / (c_iso - b_iso);
-				AddLineSegment(segments, ::glm::lerp(a, d, ad_t), ::glm::lerp(b, c, bc_t));
-				break;
+				points[0] = ::glm::lerp(a, d, ad_t);
+				points[1] = ::glm::lerp(b, c, bc_t);
+				return 2;
 			}
 			case 4:
 			case 11:
 			{
 				dbl bc_t = (isothreshold - b_iso) / (c_iso - b_iso);
 				dbl dc_t = (isothreshold - d_iso) / (c_iso - d_iso);
-				AddLineSegment(segments, ::glm::lerp(b, c, bc_t), ::glm::lerp(d, c, dc_t));
-				break;
+				points[0] = ::glm::lerp(b, c, bc_t);
+				points[1] = ::glm::lerp(d, c, dc_t);
+				return 2;
 			}
 			case 5:
 			{
@@ -210,25 +271,29 @@ namespace np::alg // TODO: refactor DMS stuff to DualMarchingSquares
 				dbl bc_t = (isothreshold - b_iso) / (c_iso - b_iso);
 				dbl dc_t = (isothreshold - d_iso) / (c_iso - d_iso);
 				dbl ad_t = (isothreshold - a_iso) / (d_iso - a_iso);
-				AddLineSegment(segments, ::glm::lerp(a, d, ad_t), ::glm::lerp(a, b, ab_t));
-				AddLineSegment(segments, ::glm::lerp(d, c, dc_t), ::glm::lerp(b, c, bc_t));
-				break;
+				points[0] = ::glm::lerp(a, d, ad_t);
+				points[1] = ::glm::lerp(a, b, ab_t);
+				points[2] = ::glm::lerp(d, c, dc_t);
+				points[3] = ::glm::lerp(b, c, bc_t);
+				return 4;
 			}
 			case 6:
 			case 9:
 			{
 				dbl ab_t = (isothreshold - a_iso) / (b_iso - a_iso);
 				dbl dc_t = (isothreshold - d_iso) / (c_iso - d_iso);
-				AddLineSegment(segments, ::glm::lerp(a, b, ab_t), ::glm::lerp(d, c, dc_t));
-				break;
+				points[0] = ::glm::lerp(a, b, ab_t);
+				points[1] = ::glm::lerp(d, c, dc_t);
+				return 2;
 			}
 			case 7:
 			case 8:
 			{
 				dbl ad_t = (isothreshold - a_iso) / (d_iso - a_iso);
 				dbl dc_t = (isothreshold - d_iso) / (c_iso - d_iso);
-				AddLineSegment(segments, ::glm::lerp(a, d, ad_t), ::glm::lerp(d, c, dc_t));
-				break;
+				points[0] = ::glm::lerp(a, d, ad_t);
+				points[1] = ::glm::lerp(d, c, dc_t);
+				return 2;
 			}
 			case 10:
 			{
@@ -236,158 +301,453 @@ namespace np::alg // TODO: refactor DMS stuff to DualMarchingSquares
 				dbl bc_t = (isothreshold - b_iso) / (c_iso - b_iso);
 				dbl dc_t = (isothreshold - d_iso) / (c_iso - d_iso);
 				dbl ad_t = (isothreshold - a_iso) / (d_iso - a_iso);
-				AddLineSegment(segments, ::glm::lerp(a, b, ab_t), ::glm::lerp(b, c, bc_t));
-				AddLineSegment(segments, ::glm::lerp(a, d, ad_t), ::glm::lerp(d, c, dc_t));
-				break;
+				points[0] = ::glm::lerp(a, b, ab_t);
+				points[1] = ::glm::lerp(b, c, bc_t);
+				points[2] = ::glm::lerp(a, d, ad_t);
+				points[3] = ::glm::lerp(d, c, dc_t);
+				return 4;
 			}
 			default:
 				NP_ENGINE_ASSERT(false, "unknown dms line segment type");
-				break;
+				return 0;
 			}
 		}
 
-	public:
-		DmsImage(ImageSubview& image_subview): _image_subview(image_subview) {}
+		/*
+			getting line segments of a b c d:
+			a b
+			d c
+		*/
+		void GetLineSegments(con::uset<DmsLineSegment>& segments, dbl isothreshold, gpu::ColorChannel channel,
+							 const DmsPoint& a, const DmsPoint& b, const DmsPoint& c, const DmsPoint& d)
+		{
+			DmsPoint points[4];
+			ui32 point_count = MarchCell(isothreshold, a, b, c, d, GetIsovalue(a, channel), GetIsovalue(b, channel),
+										 GetIsovalue(c, channel), GetIsovalue(d, channel), points);
 
-		DmsImage(ImageSubview&& image_subview): _image_subview(::std::move(image_subview)) {}
+			for (ui32 i = 0; i < point_count; i += 2)
+				AddLineSegment(segments, points[i], points[i + 1]);
+		}
 
-		DmsImage(gpu::Image& image): _image_subview(image) {}
+		struct IsUnderIsothreshold
+		{
+			const ImageSubview& imageSubview;
+			dbl isothreshold;
+			gpu::ColorChannel channel;
 
-		DmsImage(gpu::Image& image, Subview subview): _image_subview(image, subview) {}
+			bl operator()(const Point& point) const
+			{
+				return GetIsovalue(imageSubview, point, channel) < isothreshold;
+			}
+		};
 
-		virtual ~DmsImage() = default;
+		/*
+			every cell around a filled pixel can hold part of its outline
+		*/
+		struct GatherLineSegments
+		{
+			DmsImage& dmsImage;
+			con::uset<DmsLineSegment>& segments;
+			dbl isothreshold;
+			gpu::ColorChannel channel;
 
-		dbl GetIsovalue(const Point& point, gpu::ColorChannel channel) const
+			void operator()(ui32 y, ui32 begin_x, ui32 end_x)
+			{
+				for (ui32 x = begin_x; x < end_x; x++)
+					dmsImage.GetLineSegments(segments, isothreshold, channel, DmsPoint{x, y});
+			}
+		};
+
+		/*
+			same rounding as AddLineSegment
+		*/
+		static ui64 QuantizeEndpoint(const DmsPoint& point)
 		{
-			return GetIsovalue(_image_subview, point, channel);
+			return ((ui64)::std::llround((point.x + 0.5) * 32.0) << 32) | (ui64)::std::llround((point.y + 0.5) * 32.0);
 		}
 
 		/*
-			performs the dual marching squares algorithm
-			return object is a vector of shapes with holes
+			the midpoint of the segment between the quantized endpoints, as DmsLineSegment::Midpoint would give
 		*/
-		Extraction GetExtraction(dbl isothreshold, gpu::ColorChannel channel)
+		static DmsPoint GetMidpoint(const TileSegment& segment)
 		{
-			NP_ENGINE_ASSERT(isothreshold >= 0.0 && isothreshold <= 1.0, "isothreshold must be on range [0, 1]");
-			NP_ENGINE_ASSERT(channel.IsSingleChannel(), "GetExtraction requires use of only one color channel");
+			return {(dbl)((segment.begin >> 32) + (segment.end >> 32)) / 64.0,
+					(dbl)((segment.begin & UINT32_MAX) + (segment.end & UINT32_MAX)) / 64.0};
+		}
 
-			Extraction extraction;
-			ui32 width = _image_subview.GetWidth();
-			ui32 height = _image_subview.GetHeight();
-			con::uset<DmsPoint> visited;
-			con::uset<DmsPoint> edge_points;
-			con::uset<DmsLineSegment> segments;
-			con::vector<DmsLineSegmentLoop> loops;
+		/*
+			roots are always the lowest pixel index of their set, so every parent index is at most its child's
+		*/
+		static ui32 FindRoot(con::vector<ui32>& parents, ui32 pixel)
+		{
+			ui32 root = pixel;
+			while (parents[root] != root)
+				root = parents[root];
+
+			while (parents[pixel] != root)
+			{
+				ui32 next = parents[pixel];
+				parents[pixel] = root;
+				pixel = next;
+			}
 
-			Payload payload{};
-			payload.isothreshold = isothreshold;
-			payload.channel = channel;
-			payload.edgePoints = &edge_points;
-			payload.visited = &visited;
-			payload.enableDiagonal = true;
+			return root;
+		}
 
-			FloodFillImage extract_edge_points_flood(_image_subview);
-			extract_edge_points_flood.GetIsApprovedDelegate().SetCallback(IsNotVisitedAndUnderIsothreshold);
-			extract_edge_points_flood.GetApprovedActionDelegate().SetCallback(MarkAsVisited);
-			extract_edge_points_flood.GetRejectedActionDelegate().SetCallback(ExtractEdgePoint);
+		static void Unite(con::vector<ui32>& parents, ui32 a, ui32 b)
+		{
+			a = FindRoot(parents, a);
+			b = FindRoot(parents, b);
 
-			DmsPoint point;
-			for (ui32 y = 0; y < height; y++)
+			if (a < b)
+				parents[b] = a;
+			else if (b < a)
+				parents[a] = b;
+		}
+
+		static void LoadIsovalues(const ExtractionContext& context, ui32 y, con::vector<dbl>& isovalues)
+		{
+			for (ui32 x = 0; x < context.width; x++)
+				isovalues[x] = GetIsovalue(*context.imageSubview, {x, y}, context.channel);
+		}
+
+		/*
+			labels row y of pixels at or under the isothreshold, joining them with their 8 neighbors in this tile
+		*/
+		static void LabelRow(ExtractionContext& context, ui32 y, bl has_lower, const con::vector<dbl>& lower,
+							 const con::vector<dbl>& row)
+		{
+			const ui32 width = context.width;
+			const dbl isothreshold = context.isothreshold;
+			con::vector<ui32>& parents = context.parents;
+
+			for (ui32 x = 0; x < width; x++)
 			{
-				for (ui32 x = 0; x < width; x++)
+				const ui32 pixel = y * width + x;
+				if (row[x] > isothreshold)
 				{
-					point = {x, y};
-					if (visited.count(point) || GetIsovalue(point, channel) >= isothreshold)
-						continue;
+					parents[pixel] = NO_PIXEL;
+					continue;
+				}
 
-					// extract edge points
-					edge_points.clear();
-					payload.point = point;
-					extract_edge_points_flood.Fill(payload);
+				// the pixel under is joined to every other neighbor already, and so are the left and lower left pixels
+				if (has_lower && lower[x] <= isothreshold)
+				{
+					parents[pixel] = pixel - width;
+					continue;
+				}
 
-					// gather segments from edge points
-					segments.clear();
-					for (const DmsPoint& edge_point : edge_points)
-						GetLineSegments(segments, isothreshold, channel, edge_point);
+				ui32 neighbor = NO_PIXEL;
+				if (x > 0 && row[x - 1] <= isothreshold)
+					neighbor = pixel - 1;
+				else if (has_lower && x > 0 && lower[x - 1] <= isothreshold)
+					neighbor = pixel - width - 1;
 
-					// TODO: get segments along the edges of image
+				if (has_lower && x + 1 < width && lower[x + 1] <= isothreshold)
+				{
+					if (neighbor == NO_PIXEL)
+						neighbor = pixel - width + 1;
+					else
+						Unite(parents, neighbor, pixel - width + 1);
+				}
 
-					// prime first loop
-					// put our first segment into our last loop
-					loops.emplace_back();
-					loops.back().emplace_back(*segments.begin());
-					segments.erase(segments.begin());
+				parents[pixel] = neighbor == NO_PIXEL ? pixel : neighbor;
+			}
+		}
 
-					while (segments.size())
-					{
-						bl found_next = false;
-						for (const DmsLineSegment& s : segments)
-						{
-							if (s.Begin() == loops.back().back().Begin() || s.Begin() == loops.back().back().End() ||
-								s.End() == loops.back().back().Begin() || s.End() == loops.back().back().End())
-							{
-								// seg matches up on back's begin or end
-								loops.back().emplace_back(s);
-								segments.erase(s);
-								found_next = true;
-								break;
-							}
-						}
-
-						if (!found_next || segments.empty())
-						{
-							// does the segment at the end of our loop match with the segment at the front of the loop?
-							if (loops.back().back().Begin() == loops.back().front().Begin() ||
-								loops.back().back().Begin() == loops.back().front().End() ||
-								loops.back().back().End() == loops.back().front().Begin() ||
-								loops.back().back().End() == loops.back().front().End())
-							{
-								// can we do another loop?
-								if (segments.size())
-								{
-									// prime next loop
-									loops.emplace_back();
-									loops.back().emplace_back(*segments.begin());
-									segments.erase(segments.begin());
-								}
-							}
-						}
-					}
+		/*
+			marches the row of cells between pixel rows y and y + 1
+			pixels of one cell at or under the isothreshold are always 8 connected, so any of them names the cell's shape
+		*/
+		static void MarchRow(const ExtractionContext& context, ui32 y, const con::vector<dbl>& lower,
+							 const con::vector<dbl>& upper, con::vector<TileSegment>& segments)
+		{
+			const dbl isothreshold = context.isothreshold;
+			DmsPoint points[4];
 
-					// sort our loops
-					::std::sort(loops.begin(), loops.end(),
-								[](const con::vector<DmsLineSegment>& a, const con::vector<DmsLineSegment>& b) -> bl
-								{
-									return a.size() > b.size();
-								});
+			for (ui32 x = 0; x + 1 < context.width; x++)
+			{
+				const bl is_over = lower[x] > isothreshold;
+				if (is_over == (lower[x + 1] > isothreshold) && is_over == (upper[x] > isothreshold) &&
+					is_over == (upper[x + 1] > isothreshold))
+					continue;
+
+				const ui32 point_count = MarchCell(isothreshold, {x, y + 1}, {x + 1, y + 1}, {x + 1, y}, {x, y},
+												   upper[x], upper[x + 1], lower[x + 1], lower[x], points);
+				ui32 pixel = y * context.width + x;
+				if (lower[x] > isothreshold)
+					pixel = lower[x + 1] <= isothreshold ? pixel + 1 : upper[x] <= isothreshold ? pixel + context.width
+																							  : pixel + context.width + 1;
+
+				for (ui32 i = 0; i < point_count; i += 2)
+				{
+					TileSegment segment{QuantizeEndpoint(points[i]), QuantizeEndpoint(points[i + 1]), pixel};
+					if (segment.begin != segment.end) // contributes no length, and would link to itself
+						segments.emplace_back(segment);
+				}
+			}
+		}
+
+		/*
+			labels and marches the rows of one tile -- cells on the tile's top edge read the next tile's first row, and
+			labels that cross tiles are joined afterwards by StitchTiles
+		*/
+		static void ExtractTile(void* payload, siz participant, siz tile)
+		{
+			ExtractionContext& context = *(ExtractionContext*)payload;
+			const ui32 begin_y = (ui32)tile * NP_ENGINE_DMS_IMAGE_TILE_HEIGHT;
+			const ui32 end_y = ::std::min(begin_y + NP_ENGINE_DMS_IMAGE_TILE_HEIGHT, context.height);
+			con::vector<TileSegment>& segments = context.tileSegments[tile];
+			con::vector<dbl> lower(context.width);
+			con::vector<dbl> row(context.width);
+
+			for (ui32 y = begin_y; y < end_y; y++)
+			{
+				LoadIsovalues(context, y, row);
+				LabelRow(context, y, y > begin_y, lower, row);
+
+				if (y > begin_y)
+					MarchRow(context, y - 1, lower, row, segments);
+
+				lower.swap(row);
+			}
+
+			if (end_y < context.height)
+			{
+				LoadIsovalues(context, end_y, row);
+				MarchRow(context, end_y - 1, lower, row, segments);
+			}
+		}
 
-					// get the midpoints of all line segments
-					// organize them into a vector of shapes with holes
-					// a shape with holes is a vector of polygons (first one being the largest polygon)
-					// a polygon is loop of midpoints
+		/*
+			joins labels across the seam under the first row of every tile but the first
+		*/
+		static void StitchTiles(ExtractionContext& context)
+		{
+			const ui32 width = context.width;
+			con::vector<ui32>& parents = context.parents;
+
+			for (ui32 y = NP_ENGINE_DMS_IMAGE_TILE_HEIGHT; y < context.height; y += NP_ENGINE_DMS_IMAGE_TILE_HEIGHT)
+			{
+				for (ui32 x = 0; x < width; x++)
+				{
+					const ui32 pixel = y * width + x;
+					if (parents[pixel] == NO_PIXEL)
+						continue;
+
+					if (x > 0 && parents[pixel - width - 1] != NO_PIXEL)
+						Unite(parents, pixel, pixel - width - 1);
+					if (parents[pixel - width] != NO_PIXEL)
+						Unite(parents, pixel, pixel - width);
+					if (x + 1 < width && parents[pixel - width + 1] != NO_PIXEL)
+						Unite(parents, pixel, pixel - width + 1);
+				}
+			}
+		}
+
+		/*
+			buckets every segment by the root of its shape, with shapes in the order their first pixel is met row by row
+		*/
+		static void GroupShapes(ExtractionContext& context)
+		{
+			Bitset is_root(context.parents.size());
+			con::vector<ui32> roots;
+			siz segment_count = 0;
 
-					extraction.emplace_back();
-					for (DmsLineSegmentLoop& loop : loops)
+			for (con::vector<TileSegment>& segments : context.tileSegments)
+			{
+				for (TileSegment& segment : segments)
+				{
+					segment.pixel = FindRoot(context.parents, segment.pixel);
+					if (!is_root.Contains(segment.pixel))
 					{
-						extraction.back().emplace_back();
-						for (DmsLineSegment& segment : loop)
-							extraction.back().back().emplace_back(segment.Midpoint());
+						is_root.Insert(segment.pixel);
+						roots.emplace_back(segment.pixel);
 					}
+				}
+
+				segment_count += segments.size();
+			}
+
+			// from here on a segment's pixel is its shape index
+			::std::sort(roots.begin(), roots.end());
+			context.shapeOffsets.assign(roots.size() + 1, 0);
+			for (con::vector<TileSegment>& segments : context.tileSegments)
+			{
+				for (TileSegment& segment : segments)
+				{
+					segment.pixel = (ui32)(::std::lower_bound(roots.begin(), roots.end(), segment.pixel) - roots.begin());
+					context.shapeOffsets[segment.pixel + 1]++;
+				}
+			}
+
+			for (siz i = 1; i < context.shapeOffsets.size(); i++)
+				context.shapeOffsets[i] += context.shapeOffsets[i - 1];
+
+			con::vector<ui32> cursors(context.shapeOffsets.begin(), context.shapeOffsets.end() - 1);
+			context.shapeSegments.resize(segment_count);
+			for (con::vector<TileSegment>& segments : context.tileSegments)
+			{
+				for (const TileSegment& segment : segments)
+					context.shapeSegments[cursors[segment.pixel]++] = segment;
+
+				con::vector<TileSegment>().swap(segments);
+			}
+		}
+
+		static ui32 FindUnusedSegment(const EndpointMap& heads, const con::vector<ui32>& links, const Bitset& used,
+									  ui64 endpoint)
+		{
+			for (ui32 link = heads.Find(endpoint); link != NO_LINK; link = links[link])
+				if (!used.Contains(link >> 1))
+					return link >> 1;
+
+			return NO_LINK;
+		}
+
+		/*
+			walks from endpoint through unused segments, appending their midpoints in order
+			returns the endpoint the walk stopped on
+		*/
+		static ui64 WalkSegments(const TileSegment* segments, const EndpointMap& heads,
+								 const con::vector<ui32>& links, Bitset& used, ui64 endpoint,
+								 con::vector<DmsPoint>& midpoints)
+		{
+			for (ui32 next = FindUnusedSegment(heads, links, used, endpoint); next != NO_LINK;
+				 next = FindUnusedSegment(heads, links, used, endpoint))
+			{
+				used.Insert(next);
+				midpoints.emplace_back(GetMidpoint(segments[next]));
+				endpoint = segments[next].begin == endpoint ? segments[next].end : segments[next].begin;
+			}
+
+			return endpoint;
+		}
+
+		/*
+			chains the segments of one shape into loops through an endpoint to segment map -- each endpoint heads a list
+			of links (two per segment) so every segment is found in constant time
+			outlines that run off the image do not close, so they are walked from both ends
+		*/
+		static void ChainShape(void* payload, siz participant, siz shape_index)
+		{
+			ExtractionContext& context = *(ExtractionContext*)payload;
+			const ui32 offset = context.shapeOffsets[shape_index];
+			const ui32 count = context.shapeOffsets[shape_index + 1] - offset;
+			const TileSegment* segments = context.shapeSegments.data() + offset;
+			con::vector<con::vector<DmsPoint>>& shape = (*context.extraction)[shape_index];
+
+			EndpointMap heads(count); // closed loops have as many endpoints as segments
+			con::vector<ui32> links(count * 2);
+			Bitset used(count);
+			con::vector<DmsPoint> backward;
+
+			for (ui32 i = 0; i < count; i++)
+			{
+				ui32& begin_head = heads[segments[i].begin];
+				links[i * 2] = begin_head;
+				begin_head = i * 2;
 
-					::std::sort(extraction.back().begin(), extraction.back().end(),
-								[](const con::vector<DmsPoint>& a, const con::vector<DmsPoint>& b)
-								{
-									return a.size() > b.size();
-								});
+				ui32& end_head = heads[segments[i].end];
+				links[i * 2 + 1] = end_head;
+				end_head = i * 2 + 1;
+			}
 
-					if (extraction.back().back().empty())
-						extraction.back().erase(extraction.back().end() - 1);
+			for (ui32 i = 0; i < count; i++)
+			{
+				if (used.Contains(i))
+					continue;
 
-					if (extraction.back().empty())
-						extraction.erase(extraction.end() - 1);
+				used.Insert(i);
+				shape.emplace_back();
+				con::vector<DmsPoint>& polygon = shape.back();
+				polygon.emplace_back(GetMidpoint(segments[i]));
+
+				if (WalkSegments(segments, heads, links, used, segments[i].end, polygon) != segments[i].begin)
+				{
+					backward.clear();
+					WalkSegments(segments, heads, links, used, segments[i].begin, backward);
+					polygon.insert(polygon.begin(), backward.rbegin(), backward.rend());
 				}
 			}
 
+			// a shape with holes is a vector of polygons (first one being the largest polygon)
+			::std::stable_sort(shape.begin(), shape.end(),
+							   [](const con::vector<DmsPoint>& a, const con::vector<DmsPoint>& b)
+							   {
+								   return a.size() > b.size();
+							   });
+		}
+
+		/*
+			calls function for every index on [0, count) across the job workers (when given) and this thread, returning
+			once all are done
+		*/
+		static void RunParallel(jsys::JobSystem* job_system, siz count, jsys::ParallelForFunction function,
+								ExtractionContext& context)
+		{
+			if (job_system)
+			{
+				job_system->ParallelFor(count, function, mem::address_of(context));
+			}
+			else
+			{
+				for (siz i = 0; i < count; i++)
+					function(mem::address_of(context), 0, i);
+			}
+		}
+
+	public:
+		DmsImage(ImageSubview& image_subview): _image_subview(image_subview) {}
+
+		DmsImage(ImageSubview&& image_subview): _image_subview(::std::move(image_subview)) {}
+
+		DmsImage(gpu::Image& image): _image_subview(image) {}
+
+		DmsImage(gpu::Image& image, Subview subview): _image_subview(image, subview) {}
+
+		virtual ~DmsImage() = default;
+
+		dbl GetIsovalue(const Point& point, gpu::ColorChannel channel) const
+		{
+			return GetIsovalue(_image_subview, point, channel);
+		}
+
+		/*
+			performs the dual marching squares algorithm
+			return object is a vector of shapes with holes
+			- a shape is an 8 connected region of pixels at or under the isothreshold, in the order its first pixel is met
+			- each polygon is a loop of segment midpoints, and outlines running off the image are left open
+			- tiles of rows are labeled and marched on the job system (when given) then stitched along their seams
+		*/
+		Extraction GetExtraction(dbl isothreshold, gpu::ColorChannel channel, jsys::JobSystem* job_system = nullptr)
+		{
+			NP_ENGINE_ASSERT(isothreshold >= 0.0 && isothreshold <= 1.0, "isothreshold must be on range [0, 1]");
+			NP_ENGINE_ASSERT(channel.IsSingleChannel(), "GetExtraction requires use of only one color channel");
+
+			Extraction extraction;
+			ExtractionContext context{};
+			context.imageSubview = mem::address_of(_image_subview);
+			context.isothreshold = isothreshold;
+			context.channel = channel;
+			context.width = _image_subview.GetWidth();
+			context.height = _image_subview.GetHeight();
+			context.extraction = mem::address_of(extraction);
+
+			NP_ENGINE_ASSERT((ui64)context.width * context.height < NO_PIXEL, "GetExtraction requires fewer pixels");
+
+			const siz tile_count =
+				((siz)context.height + NP_ENGINE_DMS_IMAGE_TILE_HEIGHT - 1) / NP_ENGINE_DMS_IMAGE_TILE_HEIGHT;
+			context.parents.resize((siz)context.width * context.height);
+			context.tileSegments.resize(tile_count);
+
+			RunParallel(job_system, tile_count, ExtractTile, context);
+			StitchTiles(context);
+			GroupShapes(context);
+			con::vector<ui32>().swap(context.parents);
+
+			extraction.resize(context.shapeOffsets.empty() ? 0 : context.shapeOffsets.size() - 1);
+			RunParallel(job_system, extraction.size(), ChainShape, context);
 			return extraction;
 		}
 
@@ -425,43 +785,18 @@ namespace np::alg // TODO: refactor DMS stuff to DualMarchingSquares
 			NP_ENGINE_ASSERT(isothreshold >= 0.0 && isothreshold <= 1.0, "isothreshold must be on range [0, 1]");
 			NP_ENGINE_ASSERT(channel.IsSingleChannel(), "GetExtraction requires use of only one color channel");
 
-			con::uset<DmsPoint> visited;
-			con::uset<DmsPoint> edge_points;
+			ui32 width = _image_subview.GetWidth();
+			ui32 height = _image_subview.GetHeight();
+			Bitset visited((siz)width * height);
 			con::uset<DmsLineSegment> segments;
 
-			Payload payload{};
-			payload.isothreshold = isothreshold;
-			payload.channel = channel;
-			payload.edgePoints = &edge_points;
-			payload.visited = &visited;
-			payload.enableDiagonal = true;
+			FloodFillImage flood(_image_subview);
+			IsUnderIsothreshold is_under_isothreshold{_image_subview, isothreshold, channel};
+			GatherLineSegments gather_line_segments{*this, segments, isothreshold, channel};
 
-			FloodFillImage extract_edge_points_flood(_image_subview);
-			extract_edge_points_flood.GetIsApprovedDelegate().SetCallback(IsNotVisitedAndUnderIsothreshold);
-			extract_edge_points_flood.GetApprovedActionDelegate().SetCallback(MarkAsVisited);
-			extract_edge_points_flood.GetRejectedActionDelegate().SetCallback(ExtractEdgePoint);
-
-			ui32 width = _image_subview.GetWidth();
-			ui32 height = _image_subview.GetHeight();
-			DmsPoint point;
 			for (ui32 y = 0; y < height; y++)
-			{
 				for (ui32 x = 0; x < width; x++)
-				{
-					point = {x, y};
-					if (visited.count(point) || GetIsovalue(point, channel) >= isothreshold)
-						continue;
-
-					// extract edge points
-					edge_points.clear();
-					payload.point = point;
-					extract_edge_points_flood.Fill(payload);
-
-					// gather segments from edge points
-					for (const DmsPoint& edge_point : edge_points)
-						GetLineSegments(segments, isothreshold, channel, edge_point);
-				}
-			}
+					flood.FillSpans({x, y}, true, visited, is_under_isothreshold, gather_line_segments);
 
 			return segments;
 		}
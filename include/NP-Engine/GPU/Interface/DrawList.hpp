@@ -0,0 +1,151 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#ifndef NP_ENGINE_GPU_INTERFACE_DRAW_LIST_HPP
+#define NP_ENGINE_GPU_INTERFACE_DRAW_LIST_HPP
+
+#include "NP-Engine/Foundation/Foundation.hpp"
+#include "NP-Engine/Primitive/Primitive.hpp"
+#include "NP-Engine/Container/Container.hpp"
+#include "NP-Engine/Geometry/Geometry.hpp"
+
+#include "Color.hpp"
+#include "ImageSubview.hpp"
+
+namespace np::alg
+{
+	/*
+		records draws and fills as plain commands for DrawableImage::Draw(const DrawList&) to play back in one pass
+		Clear keeps capacity, so a list rebuilt every frame stops allocating once it has seen its largest frame
+	*/
+	class DrawList
+	{
+	public:
+		using Point = ImageSubview::Point;
+		using Line = geom::Line2D<Point::value_type>;
+		using Polygon = geom::Polygon2D<Point::value_type>;
+		using Circle = geom::Circle<Point::value_type>;
+
+		enum class CommandType : ui32
+		{
+			Line,
+			Polygon,
+			FilledPolygon,
+			Circle,
+			FilledCircle
+		};
+
+		/*
+			begin is a line's begin or a circle's center, and polygons are the range [pointsBegin, pointsBegin + pointCount)
+			of GetPoints
+		*/
+		struct Command
+		{
+			CommandType type = CommandType::Line;
+			gpu::Color color{};
+			Point begin{};
+			Point end{};
+			Point::value_type radius = 0;
+			siz pointsBegin = 0;
+			siz pointCount = 0;
+		};
+
+	private:
+		con::vector<Command> _commands;
+		con::vector<Point> _points;
+
+		void AddPolygon(CommandType type, const Point points[], siz point_count, gpu::Color color)
+		{
+			Command command{};
+			command.type = type;
+			command.color = color;
+			command.pointsBegin = _points.size();
+			command.pointCount = point_count;
+			_points.insert(_points.end(), points, points + point_count);
+			_commands.emplace_back(command);
+		}
+
+		void AddCircle(CommandType type, const Circle& circle, gpu::Color color)
+		{
+			Command command{};
+			command.type = type;
+			command.color = color;
+			command.begin = circle.Center;
+			command.radius = circle.Radius;
+			_commands.emplace_back(command);
+		}
+
+	public:
+		void Reserve(siz command_count, siz point_count)
+		{
+			_commands.reserve(command_count);
+			_points.reserve(point_count);
+		}
+
+		void Clear()
+		{
+			_commands.clear();
+			_points.clear();
+		}
+
+		bl IsEmpty() const
+		{
+			return _commands.empty();
+		}
+
+		const con::vector<Command>& GetCommands() const
+		{
+			return _commands;
+		}
+
+		const con::vector<Point>& GetPoints() const
+		{
+			return _points;
+		}
+
+		void Draw(const Line& line, gpu::Color color)
+		{
+			Command command{};
+			command.type = CommandType::Line;
+			command.color = color;
+			command.begin = line.Begin;
+			command.end = line.End;
+			_commands.emplace_back(command);
+		}
+
+		void Draw(const Polygon& polygon, gpu::Color color)
+		{
+			AddPolygon(CommandType::Polygon, polygon.Points.data(), polygon.Points.size(), color);
+		}
+
+		void Draw(const Point points[], siz point_count, gpu::Color color)
+		{
+			AddPolygon(CommandType::Polygon, points, point_count, color);
+		}
+
+		void Draw(const Circle& circle, gpu::Color color)
+		{
+			AddCircle(CommandType::Circle, circle, color);
+		}
+
+		void Fill(const Polygon& polygon, gpu::Color color)
+		{
+			AddPolygon(CommandType::FilledPolygon, polygon.Points.data(), polygon.Points.size(), color);
+		}
+
+		void Fill(const Point points[], siz point_count, gpu::Color color)
+		{
+			AddPolygon(CommandType::FilledPolygon, points, point_count, color);
+		}
+
+		void Fill(const Circle& circle, gpu::Color color)
+		{
+			AddCircle(CommandType::FilledCircle, circle, color);
+		}
+	};
+} // namespace np::alg
+
+#endif /* NP_ENGINE_GPU_INTERFACE_DRAW_LIST_HPP */
@@ -7,6 +7,8 @@
 #ifndef NP_ENGINE_GPU_INTERFACE_DRAWABLE_IMAGE_HPP
 #define NP_ENGINE_GPU_INTERFACE_DRAWABLE_IMAGE_HPP
 
+#include <algorithm>
+#include <cmath>
 #include <utility>
 
 #include "NP-Engine/Primitive/Primitive.hpp"
@@ -16,6 +18,7 @@
 #include "NP-Engine/Geometry/Geometry.hpp"
 
 #include "Color.hpp"
+#include "DrawList.hpp"
 #include "Image.hpp"
 #include "ImageSubview.hpp"
 #include "FloodFillImage.hpp"
@@ -33,65 +36,411 @@ namespace np::alg
 		using Polygon = geom::Polygon2D<Point::value_type>;
 		using Circle = geom::Circle<Point::value_type>;
 
-		struct Payload : public FloodFillImage::Payload
+	private:
+		struct IsColor
 		{
-			gpu::Color oldColor;
-			gpu::Color newColor;
-			con::uset<OutsidePoint>* outsideEdgePoints = nullptr;
-			con::uset<Point>* edgePoints = nullptr;
+			const ImageSubview& imageSubview;
+			gpu::Color color;
+
+			bl operator()(const Point& point) const
+			{
+				return imageSubview.Get(point) == color;
+			}
+		};
+
+		struct SetColor
+		{
+			ImageSubview& imageSubview;
+			gpu::Color color;
+			con::vector<FloodFillImage::Span>* spans = nullptr;
+
+			void operator()(ui32 y, ui32 begin_x, ui32 end_x)
+			{
+				for (ui32 x = begin_x; x < end_x; x++)
+					imageSubview.Set({x, y}, color);
+
+				if (spans)
+					spans->push_back({y, begin_x, end_x});
+			}
+		};
+
+		/*
+			the subview's pixels clipped to the image -- everything written through here has been clipped to width and
+			height, so no write needs a bounds check or a subview translation
+		*/
+		struct Target
+		{
+			ui32* pixels = nullptr;
+			siz stride = 0;
+			i64 width = 0;
+			i64 height = 0;
+			ui32 value = 0;
+
+			bl IsEmpty() const
+			{
+				return width <= 0 || height <= 0;
+			}
+
+			bl Contains(i64 x, i64 y) const
+			{
+				return x >= 0 && y >= 0 && x < width && y < height;
+			}
+
+			void Write(i64 x, i64 y) const
+			{
+				if (Contains(x, y))
+					pixels[(siz)y * stride + (siz)x] = value;
+			}
+
+			/*
+				writes [begin_x, end_x) of row y, clamped to our width
+			*/
+			void WriteSpan(i64 y, i64 begin_x, i64 end_x) const
+			{
+				begin_x = ::std::max(begin_x, (i64)0);
+				end_x = ::std::min(end_x, width);
+				if (y >= 0 && y < height && begin_x < end_x)
+					::std::fill_n(pixels + (siz)y * stride + (siz)begin_x, (siz)(end_x - begin_x), value);
+			}
+		};
+
+		/*
+			a non-horizontal polygon edge with begin being its top, covering rows [beginRow, endRow)
+		*/
+		struct PolygonEdge
+		{
+			dbl beginX;
+			dbl beginY;
+			dbl deltaX;
+			dbl deltaY;
+			i64 beginRow;
+			i64 endRow;
 		};
 
-	private:
 		ImageSubview _image_subview;
+		con::vector<PolygonEdge> _edges;
+		con::vector<siz> _active_edges;
+		con::vector<dbl> _crossings;
 
-		static bl IsOldColor(mem::delegate_bl& d)
+		Target GetTarget(gpu::Color color)
 		{
-			using Relation = FloodFillImage::PointRelation;
-			Payload& payload = *((Payload*)d.GetPayload());
-			Point point = payload.point;
+			Target target{};
+			target.value = color;
 
-			if (payload.relation.Contains(Relation::Upper))
-				point.y++;
-			if (payload.relation.Contains(Relation::Lower))
-				point.y--;
-			if (payload.relation.Contains(Relation::Right))
-				point.x++;
-			if (payload.relation.Contains(Relation::Left))
-				point.x--;
+			gpu::Image& image = _image_subview.GetImage();
+			const Subview subview = _image_subview.GetSubview();
+			if (subview.origin.x < image.GetWidth() && subview.origin.y < image.GetHeight())
+			{
+				target.stride = image.GetWidth();
+				target.width = ::std::min((i64)_image_subview.GetWidth(), (i64)image.GetWidth() - (i64)subview.origin.x);
+				target.height = ::std::min((i64)_image_subview.GetHeight(), (i64)image.GetHeight() - (i64)subview.origin.y);
+				target.pixels = (ui32*)image.Data() + (siz)subview.origin.y * target.stride + (siz)subview.origin.x;
+			}
 
-			return payload.imageSubview->Get(point) == payload.oldColor;
+			return target;
 		}
 
-		static void SetToNewColor(mem::delegate_void& d)
+		/*
+			writes the same pixels as GetBresenhamLinePoints, but only walks the part of the line ClipLine leaves inside
+			the target -- the walk starts mid-line by solving for the error term there, and each run of a shallow line is
+			written as one span
+		*/
+		static void RasterizeLine(const Target& target, OutsidePoint begin, OutsidePoint end)
 		{
-			Payload& payload = *((Payload*)d.GetPayload());
-			payload.imageSubview->Set(payload.point, payload.newColor);
+			if (target.IsEmpty())
+				return;
+
+			// pixel centers inside the target lie within half a pixel of its edges
+			::glm::dvec2 p{(dbl)begin.x, (dbl)begin.y};
+			::glm::dvec2 q{(dbl)end.x, (dbl)end.y};
+			if (!ClipLine<dbl>(p, q, target.height - 0.5, target.width - 0.5, -0.5, -0.5).visible)
+				return;
+
+			if (begin == end)
+			{
+				target.Write(begin.x, begin.y);
+				return;
+			}
+
+			const bl is_low_sloped = ::std::abs(end.y - begin.y) < ::std::abs(end.x - begin.x);
+			if (!is_low_sloped)
+			{
+				// walk rows instead of columns
+				::std::swap(begin.x, begin.y);
+				::std::swap(end.x, end.y);
+				::std::swap(p.x, p.y);
+				::std::swap(q.x, q.y);
+			}
+
+			if (begin.x > end.x)
+				::std::swap(begin, end);
+
+			const i64 major_size = is_low_sloped ? target.width : target.height;
+			const i64 dx = end.x - begin.x;
+			const i64 dy = ::std::abs(end.y - begin.y);
+			const i64 yi = end.y < begin.y ? -1 : 1;
+
+			// widened by a pixel so rounding in the clip never drops a pixel -- the minor axis is checked per write
+			const i64 first = ::std::max({begin.x, (i64)0, (i64)::std::floor(::std::min(p.x, q.x)) - 1});
+			const i64 last = ::std::min({end.x, major_size - 1, (i64)::std::ceil(::std::max(p.x, q.x)) + 1});
+			if (first > last)
+				return;
+
+			// the line steps its minor axis ceil((2dy * k - dx) / 2dx) times in its first k pixels
+			const i64 k = first - begin.x;
+			const i64 steps = (2 * dy * k + dx - 1) / (2 * dx);
+			i64 y = begin.y + yi * steps;
+			i64 D = 2 * dy * (k + 1) - dx - 2 * dx * steps;
+
+			if (is_low_sloped)
+			{
+				i64 span_begin = first;
+				for (i64 x = first; x <= last; x++)
+				{
+					if (D > 0)
+					{
+						target.WriteSpan(y, span_begin, x + 1);
+						span_begin = x + 1;
+						y += yi;
+						D -= 2 * dx;
+					}
+
+					D += 2 * dy;
+				}
+
+				target.WriteSpan(y, span_begin, last + 1);
+			}
+			else
+			{
+				for (i64 x = first; x <= last; x++)
+				{
+					target.Write(y, x);
+
+					if (D > 0)
+					{
+						y += yi;
+						D -= 2 * dx;
+					}
+
+					D += 2 * dy;
+				}
+			}
+		}
+
+		static void RasterizePolygon(const Target& target, const Point points[], siz point_count)
+		{
+			for (siz i = 0; i < point_count; i++)
+			{
+				const Point& begin = points[i];
+				const Point& end = points[(i + 1) % point_count];
+				RasterizeLine(target, {begin.x, begin.y}, {end.x, end.y});
+			}
 		}
 
-		static void GetOutsideEdgePoints(mem::delegate_void& d)
+		/*
+			writes the same pixels as GetMidpointCirclePoints, or the spans between them when filling
+		*/
+		static void RasterizeCircle(const Target& target, const Point& center, Point::value_type radius, bl fill)
 		{
-			using Relation = FloodFillImage::PointRelation;
-			Payload& payload = *((Payload*)d.GetPayload());
-			OutsidePoint point = payload.point;
+			if (target.IsEmpty())
+				return;
 
-			if (payload.relation.Contains(Relation::Upper))
-				point.y++;
-			if (payload.relation.Contains(Relation::Lower))
-				point.y--;
-			if (payload.relation.Contains(Relation::Right))
-				point.x++;
-			if (payload.relation.Contains(Relation::Left))
-				point.x--;
+			const i64 cx = center.x;
+			const i64 cy = center.y;
+			i64 x = radius;
+			i64 y = 0;
 
-			payload.outsideEdgePoints->emplace(point);
+			if (fill)
+			{
+				target.WriteSpan(cy, cx - x, cx + x + 1);
+				target.WriteSpan(cy + x, cx, cx + 1);
+				target.WriteSpan(cy - x, cx, cx + 1);
+			}
+			else
+			{
+				target.Write(cx + x, cy);
+				target.Write(cx - x, cy);
+				target.Write(cx, cy + x);
+				target.Write(cx, cy - x);
+			}
+
+			i64 P = 1 - x;
+			while (x > y)
+			{
+				y++;
+
+				if (P <= 0)
+				{
+					P = P + 2 * y + 1;
+				}
+				else
+				{
+					x--;
+					P = P + 2 * y - 2 * x + 1;
+				}
+
+				if (x < y)
+					break;
+
+				if (fill)
+				{
+					target.WriteSpan(cy + y, cx - x, cx + x + 1);
+					target.WriteSpan(cy - y, cx - x, cx + x + 1);
+					target.WriteSpan(cy + x, cx - y, cx + y + 1);
+					target.WriteSpan(cy - x, cx - y, cx + y + 1);
+				}
+				else
+				{
+					target.Write(cx + x, cy + y);
+					target.Write(cx - x, cy + y);
+					target.Write(cx + x, cy - y);
+					target.Write(cx - x, cy - y);
+
+					if (x != y)
+					{
+						target.Write(cx + y, cy + x);
+						target.Write(cx - y, cy + x);
+						target.Write(cx + y, cy - x);
+						target.Write(cx - y, cy - x);
+					}
+				}
+			}
+		}
+
+		/*
+			even-odd scan conversion with an active edge list -- fills the pixels whose centers are inside the polygon,
+			with its right and bottom edges excluded so polygons sharing an edge do not overlap (Draw the polygon too to
+			include them)
+		*/
+		void RasterizeFilledPolygon(const Target& target, const Point points[], siz point_count)
+		{
+			if (target.IsEmpty() || point_count < 3)
+				return;
+
+			_edges.clear();
+			i64 end_row = 0;
+			for (siz i = 0; i < point_count; i++)
+			{
+				Point begin = points[i];
+				Point end = points[(i + 1) % point_count];
+				if (begin.y == end.y)
+					continue;
+
+				if (begin.y > end.y)
+					::std::swap(begin, end);
+
+				_edges.push_back({(dbl)begin.x, (dbl)begin.y, (dbl)end.x - (dbl)begin.x, (dbl)end.y - (dbl)begin.y,
+								  (i64)begin.y, (i64)end.y});
+				end_row = ::std::max(end_row, (i64)end.y);
+			}
+
+			if (_edges.empty())
+				return;
+
+			::std::sort(_edges.begin(), _edges.end(),
+						[](const PolygonEdge& a, const PolygonEdge& b)
+						{
+							return a.beginRow < b.beginRow;
+						});
+
+			end_row = ::std::min(end_row, target.height);
+			siz next_edge = 0;
+			_active_edges.clear();
+
+			for (i64 row = _edges.front().beginRow; row < end_row; row++)
+			{
+				for (; next_edge < _edges.size() && _edges[next_edge].beginRow <= row; next_edge++)
+					_active_edges.emplace_back(next_edge);
+
+				_crossings.clear();
+				for (siz i = 0; i < _active_edges.size();)
+				{
+					const PolygonEdge& edge = _edges[_active_edges[i]];
+					if (edge.endRow <= row)
+					{
+						_active_edges[i] = _active_edges.back();
+						_active_edges.pop_back();
+					}
+					else
+					{
+						_crossings.emplace_back(edge.beginX + ((dbl)row - edge.beginY) * edge.deltaX / edge.deltaY);
+						i++;
+					}
+				}
+
+				::std::sort(_crossings.begin(), _crossings.end());
+				for (siz i = 0; i + 1 < _crossings.size(); i += 2)
+					target.WriteSpan(row, (i64)::std::ceil(_crossings[i]), (i64)::std::ceil(_crossings[i + 1]));
+			}
 		}
 
-		static void GetEdgePoints(mem::delegate_void& d)
+		/*
+			fills and gets the spans that were filled, with visited holding every filled point
+		*/
+		con::vector<FloodFillImage::Span> FloodFillSpans(FloodFillImage& flood, const Point& point, gpu::Color old_color,
+														  gpu::Color new_color, bl enable_diagonal)
 		{
-			Payload& payload = *((Payload*)d.GetPayload());
-			payload.edgePoints->emplace(payload.point);
+			con::vector<FloodFillImage::Span> spans;
+			IsColor is_old_color{_image_subview, old_color};
+			SetColor set_new_color{_image_subview, new_color, mem::address_of(spans)};
+			flood.FillSpans(point, enable_diagonal, is_old_color, set_new_color);
+			return spans;
 		}
 
+		/*
+			calls found(const Point& point, const OutsidePoint& neighbor) for every neighbor of a filled point that
+			was not filled, including those outside the image
+		*/
+		template <typename Found>
+		void ForEachUnfilledNeighbor(const FloodFillImage& flood, const con::vector<FloodFillImage::Span>& spans,
+									 bl enable_diagonal, Found& found) const
+		{
+			const i64 width = _image_subview.GetWidth();
+			const i64 height = _image_subview.GetHeight();
+			const Bitset& visited = flood.GetVisited();
+
+			for (const FloodFillImage::Span& span : spans)
+			{
+				for (ui32 x = span.beginX; x < span.endX; x++)
+				{
+					const Point point{x, span.y};
+					for (i64 dy = -1; dy <= 1; dy++)
+					{
+						for (i64 dx = -1; dx <= 1; dx++)
+						{
+							if ((dx == 0 && dy == 0) || (!enable_diagonal && dx != 0 && dy != 0))
+								continue;
+
+							const OutsidePoint neighbor{(i64)x + dx, (i64)span.y + dy};
+							if (neighbor.x < 0 || neighbor.y < 0 || neighbor.x >= width || neighbor.y >= height ||
+								!visited.Contains((siz)(neighbor.y * width + neighbor.x)))
+								found(point, neighbor);
+						}
+					}
+				}
+			}
+		}
+
+		struct AddOutsideEdgePoint
+		{
+			con::uset<OutsidePoint>& outsideEdgePoints;
+
+			void operator()(const Point& point, const OutsidePoint& neighbor)
+			{
+				outsideEdgePoints.emplace(neighbor);
+			}
+		};
+
+		struct AddEdgePoint
+		{
+			con::uset<Point>& edgePoints;
+
+			void operator()(const Point& point, const OutsidePoint& neighbor)
+			{
+				edgePoints.emplace(point);
+			}
+		};
+
 	public:
 		DrawableImage(const ImageSubview& image_subview): _image_subview(image_subview) {}
 
@@ -115,92 +464,120 @@ namespace np::alg
 
 		void Draw(const Line& line, gpu::Color color)
 		{
-			con::vector<Point> points = ::np::alg::GetBresenhamLinePoints<Point::value_type>(line.Begin, line.End);
-			for (Point& point : points)
-				_image_subview.Set(point, color);
+			RasterizeLine(GetTarget(color), {line.Begin.x, line.Begin.y}, {line.End.x, line.End.y});
 		}
 
 		void Draw(const Polygon& polygon, gpu::Color color)
 		{
-			con::vector<Point> line;
+			RasterizePolygon(GetTarget(color), polygon.Points.data(), polygon.Points.size());
+		}
+
+		/*
+			draws the closed outline of the given points
+		*/
+		void Draw(const Point points[], siz point_count, gpu::Color color)
+		{
+			RasterizePolygon(GetTarget(color), points, point_count);
+		}
 
-			for (siz i = 0; i < polygon.Points.size() - 1; i++)
+		void Draw(const Circle& circle, gpu::Color color)
+		{
+			RasterizeCircle(GetTarget(color), circle.Center, circle.Radius, false);
+		}
+
+		/*
+			plays back the commands in order, in one pass with no allocation once our scratch has grown
+		*/
+		void Draw(const DrawList& draw_list)
+		{
+			Target target = GetTarget({});
+			const con::vector<Point>& points = draw_list.GetPoints();
+
+			for (const DrawList::Command& command : draw_list.GetCommands())
 			{
-				const Point& begin = polygon.Points[i];
-				const Point& end = polygon.Points[i + 1];
-				line = ::np::alg::GetBresenhamLinePoints<Point::value_type>(begin, end);
+				target.value = command.color;
+
+				switch (command.type)
+				{
+				case DrawList::CommandType::Line:
+					RasterizeLine(target, {command.begin.x, command.begin.y}, {command.end.x, command.end.y});
+					break;
 
-				for (Point& point : line)
-					_image_subview.Set(point, color);
+				case DrawList::CommandType::Polygon:
+					RasterizePolygon(target, points.data() + command.pointsBegin, command.pointCount);
+					break;
+
+				case DrawList::CommandType::FilledPolygon:
+					RasterizeFilledPolygon(target, points.data() + command.pointsBegin, command.pointCount);
+					break;
+
+				case DrawList::CommandType::Circle:
+					RasterizeCircle(target, command.begin, command.radius, false);
+					break;
+
+				case DrawList::CommandType::FilledCircle:
+					RasterizeCircle(target, command.begin, command.radius, true);
+					break;
+
+				default:
+					break;
+				}
 			}
+		}
 
-			line = ::np::alg::GetBresenhamLinePoints<Point::value_type>(polygon.Points.back(), polygon.Points.front());
-			for (Point& point : line)
-				_image_subview.Set(point, color);
+		void Fill(const Polygon& polygon, gpu::Color color)
+		{
+			RasterizeFilledPolygon(GetTarget(color), polygon.Points.data(), polygon.Points.size());
 		}
 
-		void Draw(const Circle& circle, gpu::Color color)
+		/*
+			fills the inside of the closed outline of the given points
+		*/
+		void Fill(const Point points[], siz point_count, gpu::Color color)
 		{
-			con::vector<Point> points = ::np::alg::GetMidpointCirclePoints<Point::value_type>(circle.Radius);
+			RasterizeFilledPolygon(GetTarget(color), points, point_count);
+		}
 
-			for (Point& point : points)
-				_image_subview.Set(point + circle.Center, color);
+		void Fill(const Circle& circle, gpu::Color color)
+		{
+			RasterizeCircle(GetTarget(color), circle.Center, circle.Radius, true);
 		}
 
 		void FloodFill(const Point& point, gpu::Color old_color, gpu::Color new_color, bl enable_diagonal = false)
 		{
-			Payload payload{};
-			payload.oldColor = old_color;
-			payload.newColor = new_color;
-			payload.point = point;
-			payload.enableDiagonal = enable_diagonal;
-
 			FloodFillImage flood(_image_subview);
-			flood.GetIsApprovedDelegate().SetCallback(IsOldColor);
-			flood.GetApprovedActionDelegate().SetCallback(SetToNewColor);
-			flood.GetRejectedActionDelegate().SetCallback(nullptr);
-			flood.Fill(payload);
+			IsColor is_old_color{_image_subview, old_color};
+			SetColor set_new_color{_image_subview, new_color};
+			flood.FillSpans(point, enable_diagonal, is_old_color, set_new_color);
 		}
 
+		/*
+			gets the points next to the fill that were not filled, including those outside the image
+		*/
 		con::uset<OutsidePoint> FloodFillGetOutsideEdgePoints(const Point& point, gpu::Color old_color, gpu::Color new_color,
 															  bl enable_diagonal = false)
 		{
 			con::uset<OutsidePoint> outside_edge_points;
-
-			Payload payload{};
-			payload.oldColor = old_color;
-			payload.newColor = new_color;
-			payload.point = point;
-			payload.enableDiagonal = enable_diagonal;
-			payload.outsideEdgePoints = &outside_edge_points;
-
 			FloodFillImage flood(_image_subview);
-			flood.GetIsApprovedDelegate().SetCallback(IsOldColor);
-			flood.GetApprovedActionDelegate().SetCallback(SetToNewColor);
-			flood.GetRejectedActionDelegate().SetCallback(GetOutsideEdgePoints);
-			flood.Fill(payload);
+			con::vector<FloodFillImage::Span> spans = FloodFillSpans(flood, point, old_color, new_color, enable_diagonal);
 
+			AddOutsideEdgePoint add_outside_edge_point{outside_edge_points};
+			ForEachUnfilledNeighbor(flood, spans, enable_diagonal, add_outside_edge_point);
 			return outside_edge_points;
 		}
 
+		/*
+			gets the filled points next to a point that was not filled, or next to the image's edge
+		*/
 		con::uset<Point> FloodFillGetEdgePoints(const Point& point, gpu::Color old_color, gpu::Color new_color,
 												bl enable_diagonal = false)
 		{
 			con::uset<Point> edge_points;
-
-			Payload payload{};
-			payload.oldColor = old_color;
-			payload.newColor = new_color;
-			payload.point = point;
-			payload.enableDiagonal = enable_diagonal;
-			payload.edgePoints = &edge_points;
-
 			FloodFillImage flood(_image_subview);
-			flood.GetIsApprovedDelegate().SetCallback(IsOldColor);
-			flood.GetApprovedActionDelegate().SetCallback(SetToNewColor);
-			flood.GetRejectedActionDelegate().SetCallback(GetEdgePoints);
-			flood.Fill(payload);
+			con::vector<FloodFillImage::Span> spans = FloodFillSpans(flood, point, old_color, new_color, enable_diagonal);
 
+			AddEdgePoint add_edge_point{edge_points};
+			ForEachUnfilledNeighbor(flood, spans, enable_diagonal, add_edge_point);
 			return edge_points;
 		}
 	};
@@ -9,6 +9,8 @@
 
 #include "NP-Engine/Primitive/Primitive.hpp"
 #include "NP-Engine/Memory/Memory.hpp"
+#include "NP-Engine/Container/Container.hpp"
+#include "NP-Engine/Algorithms/Algorithms.hpp"
 
 #include "ImageSubview.hpp"
 
@@ -42,11 +44,63 @@ namespace np::alg
 			bl enableDiagonal = false;
 		};
 
+		/*
+			pixels [beginX, endX) of row y
+		*/
+		struct Span
+		{
+			ui32 y;
+			ui32 beginX;
+			ui32 endX;
+		};
+
 	private:
+		/*
+			calls a per point action for every point of a span
+		*/
+		template <typename Action>
+		struct PointAction
+		{
+			Action& action;
+
+			void operator()(ui32 y, ui32 begin_x, ui32 end_x)
+			{
+				for (ui32 x = begin_x; x < end_x; x++)
+					action(Point{x, y});
+			}
+		};
+
 		ImageSubview _image_subview;
 		mem::delegate_bl _is_approved;
 		mem::delegate_void _approved_action;
 		mem::delegate_void _rejected_action;
+		Bitset _visited;
+		con::vector<Point> _seeds;
+
+		/*
+			pushes the first point of every run of unvisited approved points on row y within [begin_x, end_x)
+		*/
+		template <typename Predicate>
+		void PushSeeds(ui32 y, ui32 begin_x, ui32 end_x, Bitset& visited, Predicate& is_approved)
+		{
+			const siz row = (siz)y * _image_subview.GetWidth();
+			bl is_in_run = false;
+
+			for (ui32 x = begin_x; x < end_x; x++)
+			{
+				if (!visited.Contains(row + x) && is_approved(Point{x, y}))
+				{
+					if (!is_in_run)
+						_seeds.emplace_back(x, y);
+
+					is_in_run = true;
+				}
+				else
+				{
+					is_in_run = false;
+				}
+			}
+		}
 
 	public:
 		FloodFillImage(const ImageSubview& image_subview): _image_subview(image_subview) {}
@@ -59,6 +113,94 @@ namespace np::alg
 
 		virtual ~FloodFillImage() = default;
 
+		/*
+			visited points of the last fill that did not take a visited bitset
+		*/
+		const Bitset& GetVisited() const
+		{
+			return _visited;
+		}
+
+		/*
+			scanline fill from seed -- is_approved(const Point&) decides what joins the fill and
+			span_action(ui32 y, ui32 begin_x, ui32 end_x) gets every filled run of pixels once
+			- visited holds one bit per pixel, row by row, and is what keeps points from being filled twice, so the
+			predicate does not need to reject filled points -- pass the same bitset to many fills to keep them apart
+			- is_approved is only asked about points that are not visited, and may be asked more than once
+			- span_action is called before the rows next to its span are scanned, so it may change the image
+		*/
+		template <typename Predicate, typename SpanAction>
+		void FillSpans(const Point& seed, bl enable_diagonal, Bitset& visited, Predicate& is_approved,
+					   SpanAction& span_action)
+		{
+			const ui32 width = _image_subview.GetWidth();
+			const ui32 height = _image_subview.GetHeight();
+			NP_ENGINE_ASSERT(visited.GetSize() == (siz)width * height, "visited needs one bit per pixel");
+
+			if (seed.x >= width || seed.y >= height || visited.Contains((siz)seed.y * width + seed.x) ||
+				!is_approved(seed))
+				return;
+
+			_seeds.clear();
+			_seeds.emplace_back(seed);
+
+			while (!_seeds.empty())
+			{
+				const Point point = _seeds.back();
+				_seeds.pop_back();
+
+				const siz row = (siz)point.y * width;
+				if (visited.Contains(row + point.x))
+					continue;
+
+				ui32 begin_x = point.x;
+				while (begin_x > 0 && !visited.Contains(row + begin_x - 1) && is_approved(Point{begin_x - 1, point.y}))
+					begin_x--;
+
+				ui32 end_x = point.x + 1;
+				while (end_x < width && !visited.Contains(row + end_x) && is_approved(Point{end_x, point.y}))
+					end_x++;
+
+				for (ui32 x = begin_x; x < end_x; x++)
+					visited.Insert(row + x);
+
+				span_action(point.y, begin_x, end_x);
+
+				const ui32 scan_begin_x = enable_diagonal && begin_x > 0 ? begin_x - 1 : begin_x;
+				const ui32 scan_end_x = enable_diagonal && end_x < width ? end_x + 1 : end_x;
+
+				if (point.y > 0)
+					PushSeeds(point.y - 1, scan_begin_x, scan_end_x, visited, is_approved);
+
+				if (point.y + 1 < height)
+					PushSeeds(point.y + 1, scan_begin_x, scan_end_x, visited, is_approved);
+			}
+		}
+
+		template <typename Predicate, typename SpanAction>
+		void FillSpans(const Point& seed, bl enable_diagonal, Predicate& is_approved, SpanAction& span_action)
+		{
+			_visited.Resize((siz)_image_subview.GetWidth() * _image_subview.GetHeight());
+			FillSpans(seed, enable_diagonal, _visited, is_approved, span_action);
+		}
+
+		/*
+			same as FillSpans, with action(const Point&) called for every filled point
+		*/
+		template <typename Predicate, typename Action>
+		void Fill(const Point& seed, bl enable_diagonal, Bitset& visited, Predicate& is_approved, Action& action)
+		{
+			PointAction<Action> point_action{action};
+			FillSpans(seed, enable_diagonal, visited, is_approved, point_action);
+		}
+
+		template <typename Predicate, typename Action>
+		void Fill(const Point& seed, bl enable_diagonal, Predicate& is_approved, Action& action)
+		{
+			PointAction<Action> point_action{action};
+			FillSpans(seed, enable_diagonal, is_approved, point_action);
+		}
+
 		mem::delegate_bl& GetIsApprovedDelegate()
 		{
 			return _is_approved;
@@ -89,6 +231,11 @@ namespace np::alg
 			return _rejected_action;
 		}
 
+		/*
+			per point fill through the delegates, calling rejected action for every neighbor that is not approved
+			the approval delegate must reject points already filled -- prefer the FillSpans and Fill templates when
+			rejections are not needed
+		*/
 		void Fill(Payload& payload)
 		{
 			ImageSubview* prev_image_subview = payload.imageSubview;
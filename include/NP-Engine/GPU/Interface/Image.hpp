@@ -139,6 +139,11 @@ namespace np::gpu
 			return _pixels.size();
 		}
 
+		ui8* Data()
+		{
+			return _pixels.data();
+		}
+
 		const ui8* Data() const
 		{
 			return _pixels.data();
@@ -155,7 +160,7 @@ namespace np::gpu
 
 			if (x < _width && y < _height)
 			{
-				const ui8* pixel_data = mem::address_of(_pixels[(siz)x + (siz)y * (siz)_width * sizeof(Color)]);
+				const ui8* pixel_data = mem::address_of(_pixels[((siz)x + (siz)y * (siz)_width) * sizeof(Color)]);
 				// TODO: ^ I feel like there are cleaner way of doing this
 				pixel = *((ui32*)pixel_data);
 				// TODO: ^ I feel like there are cleaner way of doing this -- mem::copy_bytes(mem::address_of(pixel), pixel_data,
@@ -174,7 +179,7 @@ namespace np::gpu
 		{
 			if (x < _width && y < _height)
 			{
-				ui8* pixel_data = mem::address_of(_pixels[(siz)x + (siz)y * (siz)_width * sizeof(Color)]);
+				ui8* pixel_data = mem::address_of(_pixels[((siz)x + (siz)y * (siz)_width) * sizeof(Color)]);
 				// TODO: ^ I feel like there are cleaner way of doing this
 				*((ui32*)pixel_data) = color;
 				// TODO: ^ I feel like there are cleaner way of doing this -- mem::copy_bytes(mem::address_of(pixel), pixel_data,
@@ -43,6 +43,16 @@ namespace np::alg
 
 		virtual ~ImageSubview() = default;
 
+		Image& GetImage()
+		{
+			return _image;
+		}
+
+		const Image& GetImage() const
+		{
+			return _image;
+		}
+
 		void SetSubview(Subview subview)
 		{
 			NP_ENGINE_ASSERT(subview.origin.x <= _image.GetWidth(), "subview origin needs to be within image width");
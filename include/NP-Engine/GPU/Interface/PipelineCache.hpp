@@ -9,23 +9,42 @@
 
 #include "NP-Engine/Container/Container.hpp"
 #include "NP-Engine/Primitive/Primitive.hpp"
+#include "NP-Engine/String/String.hpp"
 #include "NP-Engine/Memory/Memory.hpp"
 
 namespace np::gpu
 {
+	/*
+		GetBytes serializes the cache behind a header naming the device and driver it was built for, and a detail only
+		accepts bytes with a matching header -- so a file saved by another gpu or driver just starts an empty cache
+		a cache may be shared by pipeline creation on any number of threads
+	*/
 	struct PipelineCache
 	{
-		//static mem::sptr<PipelineCache> Create(con::vector<ui8> initial_data); //TODO: how can we read/write from/to file
-		//AND/OR get from our pipelines?
+	private:
+		mutable atm_ui64 _saved_hash{0};
 
-		virtual ~PipelineCache() = default;
+	public:
+		/*
+			returns the bytes of the given file, or none if it cannot be read
+		*/
+		static con::vector<ui8> Load(str filename);
 
-		//virtual bl SetBytes(const con::vector<ui8>& bytes) = 0; //TODO: how do we set this?
+		virtual ~PipelineCache() = default;
 
 		virtual con::vector<ui8> GetBytes() const = 0;
 
-		virtual bl Absorb(mem::sptr<PipelineCache> cache) = 0; //TODO: should we put this in Device? I feel like it's fine here?
+		/*
+			merges the given cache into this one
+		*/
+		virtual bl Absorb(mem::sptr<PipelineCache> cache) = 0;
+
+		/*
+			writes GetBytes to a temp file and renames it over the given file, so a crash mid-save never leaves a torn cache
+			skips the write when nothing changed since our last save, so it is cheap to call periodically
+		*/
+		bl Save(str filename) const;
 	};
 } //namespace np::gpu
 
-#endif /* NP_ENGINE_GPU_INTERFACE_PIPELINE_CACHE_HPP */
\ No newline at end of file
+#endif /* NP_ENGINE_GPU_INTERFACE_PIPELINE_CACHE_HPP */
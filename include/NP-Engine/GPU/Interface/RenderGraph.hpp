@@ -0,0 +1,768 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#ifndef NP_ENGINE_GPU_INTERFACE_RENDER_GRAPH_HPP
+#define NP_ENGINE_GPU_INTERFACE_RENDER_GRAPH_HPP
+
+#include <algorithm>
+
+#include "NP-Engine/Primitive/Primitive.hpp"
+#include "NP-Engine/String/String.hpp"
+#include "NP-Engine/Memory/Memory.hpp"
+#include "NP-Engine/Container/Container.hpp"
+
+#include "Access.hpp"
+#include "BufferResource.hpp"
+#include "CommandBuffer.hpp"
+#include "Commands.hpp"
+#include "Device.hpp"
+#include "Format.hpp"
+#include "ImageResource.hpp"
+#include "Stage.hpp"
+
+namespace np::gpu
+{
+	/*
+		transient images are made by the graph itself and may share memory with any transient image whose lifetime they
+		do not overlap
+	*/
+	struct RenderGraphImageDescription
+	{
+		ImageResourceUsage usage = ImageResourceUsage::None;
+		Format format = Format::None;
+		siz width = 0;
+		siz height = 0;
+		siz depth = 1;
+		siz mipCount = 1;
+		siz layerCount = 1;
+		siz sampleCount = 1;
+	};
+
+	/*
+		typeBits only lets resources with equal bits share a heap
+	*/
+	struct RenderGraphMemoryRequirements
+	{
+		siz size = 0;
+		siz alignment = 1;
+		ui32 typeBits = UI32_MAX;
+	};
+
+	struct RenderGraphBarrier
+	{
+		siz resource = SIZ_MAX;
+		Access srcAccess = Access::None;
+		Access dstAccess = Access::None;
+		ImageResourceUsage srcUsage = ImageResourceUsage::None; // None is an undefined layout
+		ImageResourceUsage dstUsage = ImageResourceUsage::None;
+	};
+
+	/*
+		everything one pass waits on, recorded as a single barrier before it
+	*/
+	struct RenderGraphBarriers
+	{
+		Stage srcStage = Stage::None;
+		Stage dstStage = Stage::None;
+		con::vector<RenderGraphBarrier> barriers{};
+
+		bl IsEmpty() const
+		{
+			return barriers.empty();
+		}
+	};
+
+	struct RenderGraphPlacement
+	{
+		siz heap = SIZ_MAX;
+		siz offset = 0;
+
+		bl IsValid() const
+		{
+			return heap != SIZ_MAX;
+		}
+	};
+
+	/*
+		a frame's passes, declared in submission order with the buffers and images each one reads and writes
+		Compile is cpu only -- it culls passes nothing observes, derives the barriers and layout transitions between the
+		rest, and places transient images into shared heaps by lifetime -- so it can be checked without a device
+		Realize makes the transient images on a device, and Execute records barriers and passes into a command buffer
+
+		usage per frame:
+			ImportBuffer, ImportImage, or CreateImage for each resource, then AddPass with Read/Write for each pass
+			Realize(device, queue_families) -- compiles, then allocates and binds the transient images
+			GetImage for any transient image a pass needs a view or framebuffer of
+			Execute(command_buffer)
+	*/
+	class RenderGraph
+	{
+	public:
+		using PassCallback = void (*)(void* caller, mem::sptr<CommandBuffer> command_buffer);
+
+	protected:
+		enum class ResourceKind : ui32
+		{
+			Buffer,
+			Image,
+			TransientImage
+		};
+
+		struct Resource
+		{
+			str name{};
+			ResourceKind kind = ResourceKind::Buffer;
+			mem::sptr<BufferResource> buffer = nullptr;
+			mem::sptr<ImageResource> image = nullptr;
+			RenderGraphImageDescription description{};
+			Access initialAccess = Access::None;
+			Stage initialStage = Stage::None;
+			ImageResourceUsage initialUsage = ImageResourceUsage::None;
+			ImageResourceUsage finalUsage = ImageResourceUsage::None;
+			RenderGraphMemoryRequirements requirements{};
+
+			// compiled
+			bl isNeeded = false;
+			siz firstPass = SIZ_MAX; // indices into _live_passes
+			siz lastPass = 0;
+			RenderGraphPlacement placement{};
+			con::vector<siz> aliases{}; // transient images that used our memory before us
+		};
+
+		struct PassAccess
+		{
+			siz resource = SIZ_MAX;
+			Access access = Access::None;
+			Stage stage = Stage::None;
+			ImageResourceUsage usage = ImageResourceUsage::None;
+		};
+
+		struct Pass
+		{
+			str name{};
+			con::vector<PassAccess> accesses{};
+			void* caller = nullptr;
+			PassCallback callback = nullptr;
+			bl hasSideEffects = false;
+			bl isLive = false;
+			RenderGraphBarriers barriers{};
+		};
+
+		/*
+			what a resource must wait on before its next use
+		*/
+		struct ResourceState
+		{
+			Access writeAccess = Access::None;
+			Stage writeStage = Stage::None;
+			Stage readStage = Stage::None;
+			Stage visibleStage = Stage::None; // stages that have already waited on the last write
+			ImageResourceUsage usage = ImageResourceUsage::None;
+			bl isUsed = false;
+		};
+
+		con::vector<Resource> _resources;
+		con::vector<Pass> _passes;
+		con::vector<siz> _live_passes;
+		con::vector<siz> _heap_sizes;
+		con::vector<siz> _heap_alignments;
+		con::vector<ui32> _heap_type_bits;
+		RenderGraphBarriers _final_barriers;
+		bl _is_compiled;
+
+		siz AddResource(Resource&& resource)
+		{
+			_is_compiled = false;
+			_resources.emplace_back(::std::move(resource));
+			return _resources.size() - 1;
+		}
+
+		void AddAccess(siz pass_index, siz resource_index, Access access, Stage stage, ImageResourceUsage usage)
+		{
+			NP_ENGINE_ASSERT(pass_index < _passes.size() && resource_index < _resources.size(), "unknown pass or resource");
+			_is_compiled = false;
+
+			// several uses of one resource in one pass merge into one, since nothing can wait between them
+			con::vector<PassAccess>& accesses = _passes[pass_index].accesses;
+			for (PassAccess& other : accesses)
+			{
+				if (other.resource == resource_index)
+				{
+					other.access |= access;
+					other.stage |= stage;
+					if (other.usage == ImageResourceUsage::None)
+						other.usage = usage;
+					else if (usage != ImageResourceUsage::None && usage != other.usage)
+						other.usage = ImageResourceUsage::General;
+					return;
+				}
+			}
+
+			accesses.push_back({resource_index, access, stage, usage});
+		}
+
+		static bl IsWrite(Access access)
+		{
+			return access.ContainsAny(Access::Write);
+		}
+
+		/*
+			a pass lives when it has side effects or writes what a live pass later reads, working back from the imported
+			resources since they outlive the graph
+		*/
+		void Cull()
+		{
+			for (Resource& resource : _resources)
+				resource.isNeeded = resource.kind != ResourceKind::TransientImage;
+
+			for (siz i = _passes.size(); i > 0; i--)
+			{
+				Pass& pass = _passes[i - 1];
+				pass.isLive = pass.hasSideEffects;
+				for (siz j = 0; !pass.isLive && j < pass.accesses.size(); j++)
+					pass.isLive = IsWrite(pass.accesses[j].access) && _resources[pass.accesses[j].resource].isNeeded;
+
+				if (pass.isLive)
+					for (const PassAccess& access : pass.accesses)
+						if (!IsWrite(access.access) || access.access.ContainsAny(Access::Read))
+							_resources[access.resource].isNeeded = true;
+			}
+
+			_live_passes.clear();
+			for (siz i = 0; i < _passes.size(); i++)
+				if (_passes[i].isLive)
+					_live_passes.emplace_back(i);
+		}
+
+		void ComputeLifetimes()
+		{
+			for (Resource& resource : _resources)
+			{
+				resource.firstPass = SIZ_MAX;
+				resource.lastPass = 0;
+			}
+
+			for (siz i = 0; i < _live_passes.size(); i++)
+			{
+				for (const PassAccess& access : _passes[_live_passes[i]].accesses)
+				{
+					Resource& resource = _resources[access.resource];
+					resource.firstPass = ::std::min(resource.firstPass, i);
+					resource.lastPass = ::std::max(resource.lastPass, i);
+				}
+			}
+		}
+
+		static bl IsLifetimeOverlapping(const Resource& a, const Resource& b)
+		{
+			return a.firstPass <= b.lastPass && b.firstPass <= a.lastPass;
+		}
+
+		static bl IsMemoryOverlapping(const Resource& a, const Resource& b)
+		{
+			return a.placement.offset < b.placement.offset + b.requirements.size &&
+				b.placement.offset < a.placement.offset + a.requirements.size;
+		}
+
+		siz GetHeap(ui32 type_bits)
+		{
+			for (siz i = 0; i < _heap_type_bits.size(); i++)
+				if (_heap_type_bits[i] == type_bits)
+					return i;
+
+			_heap_type_bits.emplace_back(type_bits);
+			_heap_sizes.emplace_back(0);
+			_heap_alignments.emplace_back(1);
+			return _heap_type_bits.size() - 1;
+		}
+
+		/*
+			largest first, each transient image takes the lowest offset in its heap that no image alive at the same time
+			uses -- images without requirements are left unplaced
+		*/
+		void PlaceTransientImages()
+		{
+			_heap_sizes.clear();
+			_heap_alignments.clear();
+			_heap_type_bits.clear();
+
+			con::vector<siz> order;
+			for (siz i = 0; i < _resources.size(); i++)
+			{
+				Resource& resource = _resources[i];
+				resource.placement = {};
+				resource.aliases.clear();
+				if (resource.kind == ResourceKind::TransientImage && resource.firstPass != SIZ_MAX &&
+					resource.requirements.size > 0)
+					order.emplace_back(i);
+			}
+
+			::std::sort(order.begin(), order.end(),
+						[this](siz a, siz b)
+						{
+							return _resources[a].requirements.size != _resources[b].requirements.size
+								? _resources[a].requirements.size > _resources[b].requirements.size
+								: a < b;
+						});
+
+			for (siz i = 0; i < order.size(); i++)
+			{
+				Resource& resource = _resources[order[i]];
+				const siz alignment = ::std::max(resource.requirements.alignment, (siz)1);
+				resource.placement.heap = GetHeap(resource.requirements.typeBits);
+
+				// the lowest fit is at zero or right after one of the images we cannot share with
+				con::vector<siz> candidates{0};
+				for (siz j = 0; j < i; j++)
+				{
+					const Resource& other = _resources[order[j]];
+					if (other.placement.heap == resource.placement.heap && IsLifetimeOverlapping(resource, other))
+						candidates.emplace_back(other.placement.offset + other.requirements.size);
+				}
+
+				resource.placement.offset = SIZ_MAX;
+				for (siz candidate : candidates)
+				{
+					const siz offset = mem::calc_aligned_value(candidate, alignment);
+					if (offset >= resource.placement.offset)
+						continue;
+
+					bl fits = true;
+					for (siz j = 0; fits && j < i; j++)
+					{
+						const Resource& other = _resources[order[j]];
+						fits = other.placement.heap != resource.placement.heap || !IsLifetimeOverlapping(resource, other) ||
+							offset >= other.placement.offset + other.requirements.size ||
+							other.placement.offset >= offset + resource.requirements.size;
+					}
+
+					if (fits)
+						resource.placement.offset = offset;
+				}
+
+				siz& heap_size = _heap_sizes[resource.placement.heap];
+				siz& heap_alignment = _heap_alignments[resource.placement.heap];
+				heap_size = ::std::max(heap_size, resource.placement.offset + resource.requirements.size);
+				heap_alignment = ::std::max(heap_alignment, alignment);
+			}
+
+			for (siz i = 0; i < order.size(); i++)
+			{
+				Resource& resource = _resources[order[i]];
+				for (siz j = 0; j < order.size(); j++)
+				{
+					const Resource& other = _resources[order[j]];
+					if (i != j && other.placement.heap == resource.placement.heap && other.lastPass < resource.firstPass &&
+						IsMemoryOverlapping(resource, other))
+						resource.aliases.emplace_back(order[j]);
+				}
+			}
+		}
+
+		static void AddBarrier(RenderGraphBarriers& barriers, siz resource, Stage src_stage, Access src_access,
+							   ImageResourceUsage src_usage, Stage dst_stage, Access dst_access, ImageResourceUsage dst_usage)
+		{
+			barriers.srcStage |= src_stage == Stage::None ? Stage::Top : (ui32)src_stage;
+			barriers.dstStage |= dst_stage == Stage::None ? Stage::Bottom : (ui32)dst_stage;
+			barriers.barriers.push_back({resource, src_access, dst_access, src_usage, dst_usage});
+		}
+
+		/*
+			walks the live passes in order, emitting a barrier only where a use must wait: anything after a write, a
+			write after reads, and every layout change -- reads after a write that an earlier barrier already made
+			visible to their stage wait on nothing
+		*/
+		void DeriveBarriers()
+		{
+			con::vector<ResourceState> states(_resources.size());
+			for (siz i = 0; i < _resources.size(); i++)
+			{
+				const Resource& resource = _resources[i];
+				if (resource.kind != ResourceKind::TransientImage)
+				{
+					states[i].writeAccess = resource.initialAccess;
+					states[i].writeStage = resource.initialStage;
+					states[i].usage = resource.initialUsage;
+				}
+			}
+
+			for (siz pass_index : _live_passes)
+			{
+				Pass& pass = _passes[pass_index];
+				pass.barriers = {};
+				for (const PassAccess& access : pass.accesses)
+				{
+					const Resource& resource = _resources[access.resource];
+					ResourceState& state = states[access.resource];
+					const bl is_write = IsWrite(access.access);
+					const bl is_image = resource.kind != ResourceKind::Buffer;
+					const ImageResourceUsage usage =
+						is_image && access.usage != ImageResourceUsage::None ? access.usage : state.usage;
+
+					if (resource.kind == ResourceKind::TransientImage && !state.isUsed)
+					{
+						// whatever used our memory before us must be done with it, and what we held is undefined
+						Stage src_stage = Stage::None;
+						Access src_access = Access::None;
+						for (siz alias : resource.aliases)
+						{
+							src_stage |= states[alias].writeStage | states[alias].readStage;
+							src_access |= states[alias].writeAccess;
+						}
+
+						AddBarrier(pass.barriers, access.resource, src_stage, src_access, ImageResourceUsage::None,
+								   access.stage, access.access, usage);
+						state.writeAccess = is_write ? (ui32)access.access : Access::None;
+						state.writeStage = access.stage;
+						state.readStage = is_write ? Stage::None : (ui32)access.stage;
+						state.visibleStage = is_write ? Stage::None : (ui32)access.stage;
+					}
+					else if ((is_image && usage != state.usage) || is_write)
+					{
+						const Stage src_stage = state.writeStage | state.readStage;
+						if (src_stage != Stage::None || usage != state.usage)
+							AddBarrier(pass.barriers, access.resource, src_stage, state.writeAccess, state.usage,
+									   access.stage, access.access, usage);
+
+						// a layout change is a write of its own, that later stages must wait on
+						state.writeAccess = is_write ? (ui32)access.access : Access::None;
+						state.writeStage = access.stage;
+						state.readStage = is_write ? Stage::None : (ui32)access.stage;
+						state.visibleStage = is_write ? Stage::None : (ui32)access.stage;
+					}
+					else
+					{
+						const ui32 unsynchronized_stage = access.stage & ~(ui32)state.visibleStage;
+						if (state.writeStage != Stage::None && unsynchronized_stage != Stage::None)
+						{
+							AddBarrier(pass.barriers, access.resource, state.writeStage, state.writeAccess, state.usage,
+									   access.stage, access.access, usage);
+							state.visibleStage |= access.stage;
+						}
+
+						state.readStage |= access.stage;
+					}
+
+					state.usage = usage;
+					state.isUsed = true;
+				}
+			}
+
+			_final_barriers = {};
+			for (siz i = 0; i < _resources.size(); i++)
+			{
+				const Resource& resource = _resources[i];
+				const ResourceState& state = states[i];
+				if (resource.kind == ResourceKind::Image && resource.finalUsage != ImageResourceUsage::None &&
+					resource.finalUsage != state.usage)
+					AddBarrier(_final_barriers, i, state.writeStage | state.readStage, state.writeAccess, state.usage,
+							   Stage::Bottom, Access::None, resource.finalUsage);
+			}
+		}
+
+		void RecordBarriers(mem::sptr<CommandBuffer> command_buffer, const RenderGraphBarriers& barriers) const
+		{
+			if (barriers.IsEmpty())
+				return;
+
+			mem::sptr<BarrierCommand> command =
+				Command::Create(command_buffer->GetDetailType(), command_buffer->GetServices(), CommandType::Barrier);
+			command->srcStage = barriers.srcStage;
+			command->dstStage = barriers.dstStage;
+
+			for (const RenderGraphBarrier& barrier : barriers.barriers)
+			{
+				const Resource& resource = _resources[barrier.resource];
+				if (resource.kind == ResourceKind::Buffer)
+				{
+					BufferBarrier buffer_barrier{};
+					buffer_barrier.srcAccess = barrier.srcAccess;
+					buffer_barrier.dstAccess = barrier.dstAccess;
+					buffer_barrier.buffer = resource.buffer;
+					buffer_barrier.size = resource.buffer->GetSize();
+					command->bufferBarriers.emplace_back(buffer_barrier);
+				}
+				else
+				{
+					const Format format = resource.image->GetFormat();
+					ImageResourceUsage aspect = ImageResourceUsage::None;
+					if (format.Contains(Format::Depth))
+						aspect |= ImageResourceUsage::Depth;
+					if (format.Contains(Format::Stencil))
+						aspect |= ImageResourceUsage::Stencil;
+					if (aspect == ImageResourceUsage::None)
+						aspect = ImageResourceUsage::Color;
+
+					ImageBarrier image_barrier{};
+					image_barrier.srcAccess = barrier.srcAccess;
+					image_barrier.dstAccess = barrier.dstAccess;
+					image_barrier.image = resource.image;
+					image_barrier.srcImageResourceUsage = barrier.srcUsage;
+					image_barrier.dstImageResourceUsage = barrier.dstUsage;
+					image_barrier.range = {aspect, resource.image->GetMipCount(), 0, resource.image->GetLayerCount(), 0};
+					command->imageBarriers.emplace_back(image_barrier);
+				}
+			}
+
+			command_buffer->Add(command);
+		}
+
+	public:
+		RenderGraph(): _is_compiled(false) {}
+
+		void Clear()
+		{
+			_resources.clear();
+			_passes.clear();
+			_live_passes.clear();
+			_heap_sizes.clear();
+			_heap_alignments.clear();
+			_heap_type_bits.clear();
+			_final_barriers = {};
+			_is_compiled = false;
+		}
+
+		/*
+			the given access and stage are the last ones made outside the graph, which our first use waits on
+		*/
+		siz ImportBuffer(str name, mem::sptr<BufferResource> buffer, Access access = Access::None, Stage stage = Stage::None)
+		{
+			Resource resource{};
+			resource.name = ::std::move(name);
+			resource.kind = ResourceKind::Buffer;
+			resource.buffer = buffer;
+			resource.initialAccess = access;
+			resource.initialStage = stage;
+			return AddResource(::std::move(resource));
+		}
+
+		/*
+			the given usage is the image's layout as we receive it, and it is left in final_usage unless that is None
+		*/
+		siz ImportImage(str name, mem::sptr<ImageResource> image, ImageResourceUsage usage,
+						ImageResourceUsage final_usage = ImageResourceUsage::None, Access access = Access::None,
+						Stage stage = Stage::None)
+		{
+			Resource resource{};
+			resource.name = ::std::move(name);
+			resource.kind = ResourceKind::Image;
+			resource.image = image;
+			resource.initialUsage = usage;
+			resource.finalUsage = final_usage;
+			resource.initialAccess = access;
+			resource.initialStage = stage;
+			return AddResource(::std::move(resource));
+		}
+
+		siz CreateImage(str name, const RenderGraphImageDescription& description)
+		{
+			Resource resource{};
+			resource.name = ::std::move(name);
+			resource.kind = ResourceKind::TransientImage;
+			resource.description = description;
+			return AddResource(::std::move(resource));
+		}
+
+		/*
+			passes run in the order they are added -- a pass with side effects is never culled
+		*/
+		siz AddPass(str name, void* caller, PassCallback callback, bl has_side_effects = false)
+		{
+			_is_compiled = false;
+			Pass pass{};
+			pass.name = ::std::move(name);
+			pass.caller = caller;
+			pass.callback = callback;
+			pass.hasSideEffects = has_side_effects;
+			_passes.emplace_back(::std::move(pass));
+			return _passes.size() - 1;
+		}
+
+		/*
+			usage is the layout the pass needs an image in, and is ignored for buffers
+		*/
+		void Read(siz pass, siz resource, Access access, Stage stage, ImageResourceUsage usage = ImageResourceUsage::None)
+		{
+			AddAccess(pass, resource, access | Access::Read, stage, usage);
+		}
+
+		void Write(siz pass, siz resource, Access access, Stage stage, ImageResourceUsage usage = ImageResourceUsage::None)
+		{
+			AddAccess(pass, resource, access | Access::Write, stage, usage);
+		}
+
+		/*
+			Realize sets these from the device before it compiles, tests may set their own
+		*/
+		void SetMemoryRequirements(siz resource, const RenderGraphMemoryRequirements& requirements)
+		{
+			_is_compiled = false;
+			_resources[resource].requirements = requirements;
+		}
+
+		void Compile()
+		{
+			Cull();
+			ComputeLifetimes();
+			PlaceTransientImages();
+			DeriveBarriers();
+			_is_compiled = true;
+		}
+
+		bl IsCompiled() const
+		{
+			return _is_compiled;
+		}
+
+		/*
+			compiles, then makes every live transient image in memory shared by lifetime
+		*/
+		bl Realize(mem::sptr<Device> device, const con::vector<DeviceQueueFamily>& queue_families);
+
+		/*
+			records each live pass after its barriers, then the final layout transitions of imported images
+		*/
+		bl Execute(mem::sptr<CommandBuffer> command_buffer) const
+		{
+			if (!_is_compiled || !command_buffer)
+				return false;
+
+			for (siz i = 0; i < _resources.size(); i++)
+				if (_resources[i].kind == ResourceKind::TransientImage && _resources[i].firstPass != SIZ_MAX &&
+					!_resources[i].image)
+					return false;
+
+			for (siz pass_index : _live_passes)
+			{
+				const Pass& pass = _passes[pass_index];
+				RecordBarriers(command_buffer, pass.barriers);
+				if (pass.callback)
+					pass.callback(pass.caller, command_buffer);
+			}
+
+			RecordBarriers(command_buffer, _final_barriers);
+			return true;
+		}
+
+		siz GetResourceCount() const
+		{
+			return _resources.size();
+		}
+
+		const str& GetResourceName(siz resource) const
+		{
+			return _resources[resource].name;
+		}
+
+		bl IsTransient(siz resource) const
+		{
+			return _resources[resource].kind == ResourceKind::TransientImage;
+		}
+
+		const RenderGraphImageDescription& GetImageDescription(siz resource) const
+		{
+			return _resources[resource].description;
+		}
+
+		/*
+			transient images are only set by Realize, and only when some live pass uses them
+		*/
+		mem::sptr<ImageResource> GetImage(siz resource) const
+		{
+			return _resources[resource].image;
+		}
+
+		void SetImage(siz resource, mem::sptr<ImageResource> image)
+		{
+			_resources[resource].image = image;
+		}
+
+		mem::sptr<BufferResource> GetBuffer(siz resource) const
+		{
+			return _resources[resource].buffer;
+		}
+
+		siz GetPassCount() const
+		{
+			return _passes.size();
+		}
+
+		const str& GetPassName(siz pass) const
+		{
+			return _passes[pass].name;
+		}
+
+		bl IsLive(siz pass) const
+		{
+			return _passes[pass].isLive;
+		}
+
+		/*
+			indices of the passes that survived culling, in execution order
+		*/
+		const con::vector<siz>& GetLivePasses() const
+		{
+			return _live_passes;
+		}
+
+		const RenderGraphBarriers& GetBarriers(siz pass) const
+		{
+			return _passes[pass].barriers;
+		}
+
+		const RenderGraphBarriers& GetFinalBarriers() const
+		{
+			return _final_barriers;
+		}
+
+		/*
+			live transient images only, in live pass indices -- SIZ_MAX when no live pass uses it
+		*/
+		siz GetFirstUse(siz resource) const
+		{
+			return _resources[resource].firstPass;
+		}
+
+		siz GetLastUse(siz resource) const
+		{
+			return _resources[resource].lastPass;
+		}
+
+		RenderGraphPlacement GetPlacement(siz resource) const
+		{
+			return _resources[resource].placement;
+		}
+
+		const RenderGraphMemoryRequirements& GetMemoryRequirements(siz resource) const
+		{
+			return _resources[resource].requirements;
+		}
+
+		siz GetHeapCount() const
+		{
+			return _heap_sizes.size();
+		}
+
+		RenderGraphMemoryRequirements GetHeapRequirements(siz heap) const
+		{
+			return {_heap_sizes[heap], _heap_alignments[heap], _heap_type_bits[heap]};
+		}
+
+		/*
+			bytes the transient images would need without aliasing, to compare against the heap sizes
+		*/
+		siz GetUnaliasedSize() const
+		{
+			siz size = 0;
+			for (const Resource& resource : _resources)
+				if (resource.placement.IsValid())
+					size += resource.requirements.size;
+			return size;
+		}
+	};
+} // namespace np::gpu
+
+#endif /* NP_ENGINE_GPU_INTERFACE_RENDER_GRAPH_HPP */
@@ -76,9 +76,16 @@ namespace np::gpu
 		//con::vector<mem::sptr<Sampler>> samplers{};
 		//TODO: ^ add sampler support -- pretty sure length MUST equal count value or be empty
 
+		/*
+			indexed descriptions are large arrays that shaders index into -- elements may be left unassigned, and
+			assignments may write any part of the array, even while groups using it are bound, where the device allows
+		*/
+		bl isIndexed = false;
+
 		bl IsCompatible(const ResourceDescription& other) const
 		{
-			return type == other.type && usage == other.usage && count == other.count && stage == other.stage;
+			return type == other.type && usage == other.usage && count == other.count && stage == other.stage &&
+				isIndexed == other.isIndexed;
 		}
 	};
 
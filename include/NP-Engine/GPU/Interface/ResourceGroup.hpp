@@ -38,14 +38,22 @@ namespace np::gpu
 		siz range = 0;
 	};
 
+	/*
+		contexts are written from arrayIndex on -- only indexed descriptions may be written in part
+	*/
 	struct ImageResourceAssignment : public ResourceAssignment
 	{
 		con::vector<ImageResourceAssignmentContext> contexts{};
+		siz arrayIndex = 0;
 	};
 
+	/*
+		contexts are written from arrayIndex on -- only indexed descriptions may be written in part
+	*/
 	struct BufferResourceAssignment : public ResourceAssignment
 	{
 		con::vector<BufferResourceAssignmentContext> contexts{};
+		siz arrayIndex = 0;
 	};
 
 	struct CopyResourceAssignment
@@ -94,6 +102,9 @@ namespace np::gpu
 
 		virtual mem::sptr<Device> GetDevice() const = 0;
 
+		/*
+			sets the first pool holds -- the pool grows whenever it runs out, so this is not a limit
+		*/
 		virtual siz GetSize() const = 0;
 
 		/*
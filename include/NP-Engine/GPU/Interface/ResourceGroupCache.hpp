@@ -0,0 +1,255 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#ifndef NP_ENGINE_GPU_INTERFACE_RESOURCE_GROUP_CACHE_HPP
+#define NP_ENGINE_GPU_INTERFACE_RESOURCE_GROUP_CACHE_HPP
+
+#include "NP-Engine/Primitive/Primitive.hpp"
+#include "NP-Engine/Memory/Memory.hpp"
+#include "NP-Engine/Container/Container.hpp"
+#include "NP-Engine/Math/Math.hpp"
+
+#include "Resource.hpp"
+#include "ResourceGroup.hpp"
+#include "Result.hpp"
+
+namespace np::gpu
+{
+	/*
+		counts since the last BeginFrame, except entryCount and retiredCount
+		updateCount is how many groups were written, which in steady state should be zero
+	*/
+	struct ResourceGroupCacheStats
+	{
+		siz hitCount = 0;
+		siz missCount = 0;
+		siz updateCount = 0;
+		siz allocationCount = 0;
+		siz evictionCount = 0;
+		siz entryCount = 0;
+		siz retiredCount = 0;
+	};
+
+	/*
+		hands out resource groups by layout and assigned resources, so frames that bind the same resources reuse the same
+		written group instead of writing one again
+		groups unused for more than frame_count frames are retired, and retired groups are rewritten for later misses on
+		the same layout before the pool is asked for more
+		the cache keeps the assigned resources alive while their group is cached, so their addresses are never reused
+		by other resources under the same key
+
+		copy assignments depend on another group's contents so they are never cached, and indexed descriptions that are
+		written a few elements at a time belong in a group of their own from the pool
+		not thread safe -- keep one per recording thread
+
+		usage per frame:
+			BeginFrame() -- after waiting on the fence of the frame about to be recorded
+			Acquire(layout, assignments) for each group to bind
+	*/
+	class ResourceGroupCache
+	{
+	protected:
+		struct Entry
+		{
+			con::vector<ui64> key{};
+			ResourceAssignments assignments{};
+			mem::sptr<ResourceGroup> group = nullptr;
+			siz lastUsedFrame = 0;
+		};
+
+		mem::sptr<ResourceGroupPool> _pool;
+		siz _frame_count;
+		siz _frame;
+		con::umap<ui64, con::vector<Entry>> _entries; // buckets by key hash
+		con::umap<ResourceLayout*, con::vector<mem::sptr<ResourceGroup>>> _retired;
+		con::vector<ui64> _key;
+		ResourceGroupCacheStats _stats;
+
+		template <typename T>
+		static ui64 GetKeyWord(const mem::sptr<T>& ptr)
+		{
+			return ptr ? (ui64)(siz)mem::address_of(*ptr) : 0;
+		}
+
+		/*
+			assignments given in another order make another key -- callers build them the same way every frame
+		*/
+		void BuildKey(mem::sptr<ResourceLayout> layout, const ResourceAssignments& assignments)
+		{
+			_key.clear();
+			_key.emplace_back(GetKeyWord(layout));
+
+			_key.emplace_back(assignments.imageAssignments.size());
+			for (const ImageResourceAssignment& assignment : assignments.imageAssignments)
+			{
+				_key.emplace_back(assignment.resourceDescriptionIndex);
+				_key.emplace_back(assignment.arrayIndex);
+				_key.emplace_back(assignment.contexts.size());
+				for (const ImageResourceAssignmentContext& context : assignment.contexts)
+				{
+					_key.emplace_back(GetKeyWord(context.view));
+					_key.emplace_back(GetKeyWord(context.sampler));
+					_key.emplace_back((ui32)context.usage);
+				}
+			}
+
+			_key.emplace_back(assignments.bufferAssignments.size());
+			for (const BufferResourceAssignment& assignment : assignments.bufferAssignments)
+			{
+				_key.emplace_back(assignment.resourceDescriptionIndex);
+				_key.emplace_back(assignment.arrayIndex);
+				_key.emplace_back(assignment.contexts.size());
+				for (const BufferResourceAssignmentContext& context : assignment.contexts)
+				{
+					_key.emplace_back(GetKeyWord(context.buffer));
+					_key.emplace_back(context.offset);
+					_key.emplace_back(context.range);
+				}
+			}
+		}
+
+		void Retire(mem::sptr<ResourceGroup> group)
+		{
+			mem::sptr<ResourceLayout> layout = group->GetResourceLayout();
+			_retired[mem::address_of(*layout)].emplace_back(group);
+			_stats.retiredCount++;
+		}
+
+		mem::sptr<ResourceGroup> TakeRetired(mem::sptr<ResourceLayout> layout)
+		{
+			mem::sptr<ResourceGroup> group = nullptr;
+			auto it = _retired.find(mem::address_of(*layout));
+			if (it != _retired.end() && !it->second.empty())
+			{
+				group = it->second.back();
+				it->second.pop_back();
+				_stats.retiredCount--;
+			}
+			return group;
+		}
+
+	public:
+		ResourceGroupCache(mem::sptr<ResourceGroupPool> pool, siz frame_count):
+			_pool(pool),
+			_frame_count(frame_count),
+			_frame(0)
+		{}
+
+		/*
+			retires the groups no frame still in flight can be using
+		*/
+		void BeginFrame()
+		{
+			_frame++;
+			_stats.hitCount = 0;
+			_stats.missCount = 0;
+			_stats.updateCount = 0;
+			_stats.allocationCount = 0;
+			_stats.evictionCount = 0;
+
+			for (auto bucket = _entries.begin(); bucket != _entries.end();)
+			{
+				con::vector<Entry>& entries = bucket->second;
+				for (siz i = 0; i < entries.size();)
+				{
+					if (_frame - entries[i].lastUsedFrame > _frame_count)
+					{
+						Retire(entries[i].group);
+						entries[i] = ::std::move(entries.back());
+						entries.pop_back();
+						_stats.entryCount--;
+						_stats.evictionCount++;
+					}
+					else
+					{
+						i++;
+					}
+				}
+
+				bucket = entries.empty() ? _entries.erase(bucket) : ::std::next(bucket);
+			}
+		}
+
+		/*
+			returns the group written with these assignments, writing one only when no cached group matches
+			returns nullptr for copy assignments, or when the group could not be made or written
+			the returned group must not be assigned to by the caller
+		*/
+		mem::sptr<ResourceGroup> Acquire(mem::sptr<ResourceLayout> layout, const ResourceAssignments& assignments)
+		{
+			if (!layout || !assignments.copyAssignments.empty())
+				return nullptr;
+
+			BuildKey(layout, assignments);
+			const ui64 hash = mat::hash_fnv1a_ui64(_key.data(), _key.size() * sizeof(ui64));
+
+			con::vector<Entry>& entries = _entries[hash];
+			for (Entry& entry : entries)
+			{
+				if (entry.key == _key)
+				{
+					entry.lastUsedFrame = _frame;
+					_stats.hitCount++;
+					return entry.group;
+				}
+			}
+
+			_stats.missCount++;
+			mem::sptr<ResourceGroup> group = TakeRetired(layout);
+			if (!group)
+			{
+				group = _pool->CreateResourceGroup(layout);
+				if (!group)
+					return nullptr;
+
+				_stats.allocationCount++;
+			}
+
+			_stats.updateCount++;
+			if (!group->ApplyResourceAssignments(assignments).Contains(Result::Success))
+			{
+				Retire(group);
+				return nullptr;
+			}
+
+			Entry entry{};
+			entry.key = _key;
+			entry.assignments = assignments;
+			entry.group = group;
+			entry.lastUsedFrame = _frame;
+			entries.emplace_back(::std::move(entry));
+			_stats.entryCount++;
+			return group;
+		}
+
+		/*
+			drops every cached and retired group back to the pool -- only once no frame in flight uses them
+		*/
+		void Clear()
+		{
+			_entries.clear();
+			_retired.clear();
+			_stats = {};
+		}
+
+		mem::sptr<ResourceGroupPool> GetPool() const
+		{
+			return _pool;
+		}
+
+		siz GetFrameCount() const
+		{
+			return _frame_count;
+		}
+
+		const ResourceGroupCacheStats& GetStats() const
+		{
+			return _stats;
+		}
+	};
+} // namespace np::gpu
+
+#endif /* NP_ENGINE_GPU_INTERFACE_RESOURCE_GROUP_CACHE_HPP */
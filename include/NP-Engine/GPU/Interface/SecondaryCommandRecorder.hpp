@@ -0,0 +1,211 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#ifndef NP_ENGINE_GPU_INTERFACE_SECONDARY_COMMAND_RECORDER_HPP
+#define NP_ENGINE_GPU_INTERFACE_SECONDARY_COMMAND_RECORDER_HPP
+
+#include <algorithm>
+
+#include "NP-Engine/Primitive/Primitive.hpp"
+#include "NP-Engine/Memory/Memory.hpp"
+#include "NP-Engine/Container/Container.hpp"
+#include "NP-Engine/Thread/Thread.hpp"
+#include "NP-Engine/JobSystem/JobSystem.hpp"
+
+#include "CommandBuffer.hpp"
+#include "CommandBufferPool.hpp"
+#include "CommandStream.hpp"
+#include "Framebuffer.hpp"
+#include "Queue.hpp"
+#include "Fence.hpp"
+
+namespace np::gpu
+{
+	/*
+		records batches of commands into secondary command buffers across the job workers and this thread, then stitches
+		them into a primary stream in batch order -- so the result never depends on which worker recorded what
+		a command buffer pool is not thread safe, so every participant of every frame gets its own, and a frame's pools are
+		reset together once the fence submitted with that frame has signaled
+
+		usage per frame:
+			BeginFrame(frame_index) -- before resetting that frame's fence
+			build one CommandStream per batch, each binding its own pipeline, viewports, and scissors
+			begin a render pass on the primary stream with SubpassUsage::HasSecondary, then Record the batches into it
+			EndFrame(fence) -- with the fence given to Queue::Submit for that frame
+	*/
+	class SecondaryCommandRecorder
+	{
+	protected:
+		struct Participant
+		{
+			mem::sptr<CommandBufferPool> pool = nullptr;
+			con::vector<mem::sptr<CommandBuffer>> commandBuffers{};
+			siz usedCount = 0;
+		};
+
+		struct Frame
+		{
+			con::vector<Participant> participants{};
+			mem::sptr<Fence> fence = nullptr;
+		};
+
+		/*
+			one per Record call, given to its ParallelFor
+		*/
+		struct RecordState
+		{
+			Frame* frame;
+			const CommandStream* batches;
+			CommandBuffer** recorded;
+			mem::sptr<Framebuffer> framebuffer;
+			ui32 subpassIndex;
+			atm_bl failed;
+		};
+
+		jsys::JobSystem* _job_system;
+		con::vector<Frame> _frames;
+		siz _index;
+		con::vector<CommandBuffer*> _recorded;
+
+		static mem::sptr<CommandBuffer> AcquireCommandBuffer(Participant& participant)
+		{
+			if (participant.usedCount == participant.commandBuffers.size())
+			{
+				mem::sptr<CommandBuffer> command_buffer = participant.pool->CreateSecondaryCommandBuffer();
+				if (!command_buffer)
+					return nullptr;
+
+				participant.commandBuffers.emplace_back(command_buffer);
+			}
+
+			return participant.commandBuffers[participant.usedCount++];
+		}
+
+		/*
+			participants only take a pool once they claim a batch, so late jobs never touch this frame's pools
+		*/
+		static void RecordBatch(void* payload, siz participant_index, siz batch_index)
+		{
+			RecordState& state = *(RecordState*)payload;
+			Participant& participant = state.frame->participants[participant_index];
+			mem::sptr<CommandBuffer> command_buffer = AcquireCommandBuffer(participant);
+			bl recorded = command_buffer &&
+				participant.pool->BeginSecondary(command_buffer, CommandBufferUsage::SingleUse, state.framebuffer,
+												 state.subpassIndex);
+
+			if (recorded)
+			{
+				recorded = command_buffer->Record(state.batches[batch_index]);
+				recorded &= participant.pool->End(command_buffer, CommandBufferUsage::None);
+			}
+
+			state.recorded[batch_index] = recorded ? mem::address_of(*command_buffer) : nullptr;
+			if (!recorded)
+				state.failed.store(true, mo_relaxed);
+		}
+
+	public:
+		/*
+			give the same job system to every Record, its worker count sets how many pools each frame keeps
+		*/
+		SecondaryCommandRecorder(mem::sptr<Queue> queue, siz frame_count, jsys::JobSystem* job_system = nullptr):
+			_job_system(job_system),
+			_frames(::std::max(frame_count, (siz)1)),
+			_index(0)
+		{
+			const siz participant_count = 1 + (_job_system ? _job_system->GetJobWokerCount() : 0);
+			for (Frame& frame : _frames)
+			{
+				frame.participants.resize(participant_count);
+				for (Participant& participant : frame.participants)
+					participant.pool = queue->CreateCommandBufferPool(CommandBufferPoolUsage::Transient);
+			}
+		}
+
+		/*
+			blocks until the gpu is done with what was recorded the last time this frame index was used, then recycles it
+		*/
+		void BeginFrame(siz frame_index)
+		{
+			_index = frame_index % _frames.size();
+			Frame& frame = _frames[_index];
+			if (frame.fence)
+			{
+				frame.fence->Wait();
+				frame.fence.reset();
+			}
+
+			for (Participant& participant : frame.participants)
+			{
+				if (participant.usedCount > 0)
+					participant.pool->ResetAll();
+				participant.usedCount = 0;
+			}
+		}
+
+		void EndFrame(mem::sptr<Fence> fence)
+		{
+			_frames[_index].fence = fence;
+		}
+
+		/*
+			records each given batch into its own secondary command buffer, in parallel, continuing the given subpass of
+			the given framebuffer, then appends one ExecuteCommands of them all in batch order to the given stream
+			returns false if any batch failed to record, in which case nothing is appended
+			the batches must stay untouched until this returns
+		*/
+		bl Record(CommandStream& stream, mem::sptr<Framebuffer> framebuffer, ui32 subpass_index,
+				  const con::vector<CommandStream>& batches)
+		{
+			if (batches.empty())
+				return true;
+
+			_recorded.assign(batches.size(), nullptr);
+
+			RecordState state{};
+			state.frame = mem::address_of(_frames[_index]);
+			state.batches = batches.data();
+			state.recorded = _recorded.data();
+			state.framebuffer = framebuffer;
+			state.subpassIndex = subpass_index;
+			state.failed.store(false, mo_relaxed);
+
+			if (_job_system)
+			{
+				// every job takes a participant, so we allow one less job than our participants
+				_job_system->ParallelFor(batches.size(), RecordBatch, mem::address_of(state), jsys::JobPriority::Higher,
+										 state.frame->participants.size() - 1);
+			}
+			else
+			{
+				for (siz i = 0; i < batches.size(); i++)
+					RecordBatch(mem::address_of(state), 0, i);
+			}
+
+			const bl recorded = !state.failed.load(mo_relaxed);
+
+			if (recorded)
+				stream.ExecuteCommands(_recorded.data(), _recorded.size());
+
+			return recorded;
+		}
+
+		siz GetFrameCount() const
+		{
+			return _frames.size();
+		}
+
+		/*
+			pools per frame, one for this thread and one for each job worker
+		*/
+		siz GetParticipantCount() const
+		{
+			return _frames[_index].participants.size();
+		}
+	};
+} // namespace np::gpu
+
+#endif /* NP_ENGINE_GPU_INTERFACE_SECONDARY_COMMAND_RECORDER_HPP */
@@ -10,6 +10,8 @@
 #include "NP-Engine/Primitive/Primitive.hpp"
 #include "NP-Engine/String/String.hpp"
 #include "NP-Engine/Memory/Memory.hpp"
+#include "NP-Engine/Container/Container.hpp"
+#include "NP-Engine/JobSystem/JobSystem.hpp"
 
 #include "Detail.hpp"
 #include "Device.hpp"
@@ -17,10 +19,28 @@
 
 namespace np::gpu
 {
+	struct ShaderSource
+	{
+		Stage stage;
+		str filename;
+	};
+
 	struct Shader : public DetailObject
 	{
 		static mem::sptr<Shader> Create(mem::sptr<Device> device, Stage stage, str filename, str entrypoint);
 
+		/*
+			compiles whichever of the given sources are not already cached, in parallel when given a job system, so the
+			shaders created from them afterwards only load
+		*/
+		static void Prepare(DetailType detail_type, const con::vector<ShaderSource>& sources,
+							jsys::JobSystem* job_system = nullptr);
+
+		/*
+			removes every cached compile, so the next load or Prepare compiles from scratch
+		*/
+		static void ClearCache(DetailType detail_type);
+
 		virtual ~Shader() = default;
 
 		virtual mem::sptr<Device> GetDevice() const = 0;
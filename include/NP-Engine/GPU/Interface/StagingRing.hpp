@@ -0,0 +1,157 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#ifndef NP_ENGINE_GPU_INTERFACE_STAGING_RING_HPP
+#define NP_ENGINE_GPU_INTERFACE_STAGING_RING_HPP
+
+#include "NP-Engine/Primitive/Primitive.hpp"
+#include "NP-Engine/Memory/Memory.hpp"
+#include "NP-Engine/Container/Container.hpp"
+
+#include "BufferResource.hpp"
+#include "FrameContext.hpp"
+#include "Fence.hpp"
+
+namespace np::gpu
+{
+	struct StagingAllocation
+	{
+		mem::sptr<BufferResource> buffer = nullptr;
+		siz offset = 0;
+		siz size = 0;
+		void* data = nullptr; // persistently mapped, write straight into this
+
+		operator bl() const
+		{
+			return IsValid();
+		}
+
+		bl IsValid() const
+		{
+			return buffer && data && size != 0;
+		}
+	};
+
+	/*
+		one persistently mapped buffer split into a segment per frame of the given frame context
+		each frame linearly sub-allocates from its segment, and the segment is reclaimed once the fence submitted with
+		that frame has signaled -- so nothing staged is overwritten while the gpu may still read it
+
+		usage per frame:
+			BeginFrame(frame_index) -- before resetting that frame's fence
+			Allocate/Write as much as needed, then record copies/binds using the returned buffer and offset
+			EndFrame(fence) -- with the fence given to Queue::Submit for that frame
+	*/
+	class StagingRing
+	{
+	protected:
+		struct Segment
+		{
+			siz begin = 0;
+			siz cursor = 0;
+			mem::sptr<Fence> fence = nullptr;
+		};
+
+		mem::sptr<BufferResource> _buffer;
+		siz _bytes_per_frame;
+		con::vector<Segment> _segments;
+		siz _index;
+		ui8* _mapping;
+
+	public:
+		StagingRing(mem::sptr<FrameContext> frame_context, siz bytes_per_frame,
+					BufferResourceUsage usage = BufferResourceUsage::Transfer | BufferResourceUsage::Read):
+			_buffer(nullptr),
+			_bytes_per_frame(mem::calc_aligned_size(bytes_per_frame, mem::DEFAULT_ALIGNMENT)),
+			_segments(::std::max(frame_context->GetFrames().size(), (siz)1)),
+			_index(0),
+			_mapping(nullptr)
+		{
+			_buffer = BufferResource::Create(frame_context->GetDevice(),
+											 usage | BufferResourceUsage::HostAccessible | BufferResourceUsage::AutoClearCache,
+											 _bytes_per_frame * _segments.size(), frame_context->GetDeviceQueueFamilies());
+
+			if (_buffer)
+				_mapping = static_cast<ui8*>(_buffer->GetMapping());
+
+			NP_ENGINE_ASSERT(_mapping, "StagingRing requires host accessible memory");
+
+			for (siz i = 0; i < _segments.size(); i++)
+				_segments[i].begin = i * _bytes_per_frame;
+		}
+
+		/*
+			blocks until the gpu is done with what was staged the last time this frame index was used
+		*/
+		void BeginFrame(siz frame_index)
+		{
+			_index = frame_index % _segments.size();
+			Segment& segment = _segments[_index];
+			if (segment.fence)
+			{
+				segment.fence->Wait();
+				segment.fence.reset();
+			}
+			segment.cursor = 0;
+		}
+
+		void EndFrame(mem::sptr<Fence> fence)
+		{
+			_segments[_index].fence = fence;
+		}
+
+		/*
+			returns an invalid allocation when this frame's segment is out of room
+		*/
+		StagingAllocation Allocate(siz size, siz alignment = mem::DEFAULT_ALIGNMENT)
+		{
+			StagingAllocation allocation{};
+			Segment& segment = _segments[_index];
+			const siz offset = mem::calc_aligned_value(segment.begin + segment.cursor, mem::sanitize_alignment(alignment));
+
+			if (_mapping && size != 0 && offset + size <= segment.begin + _bytes_per_frame)
+			{
+				segment.cursor = offset + size - segment.begin;
+				allocation.buffer = _buffer;
+				allocation.offset = offset;
+				allocation.size = size;
+				allocation.data = _mapping + offset;
+			}
+
+			return allocation;
+		}
+
+		StagingAllocation Write(const void* src, siz size, siz alignment = mem::DEFAULT_ALIGNMENT)
+		{
+			StagingAllocation allocation = Allocate(size, alignment);
+			if (allocation)
+				mem::copy_bytes(allocation.data, src, size);
+			return allocation;
+		}
+
+		mem::sptr<BufferResource> GetBufferResource() const
+		{
+			return _buffer;
+		}
+
+		siz GetFrameCount() const
+		{
+			return _segments.size();
+		}
+
+		siz GetBytesPerFrame() const
+		{
+			return _bytes_per_frame;
+		}
+
+		siz GetUsedBytes() const
+		{
+			return _segments[_index].cursor;
+		}
+	};
+} // namespace np::gpu
+
+#endif /* NP_ENGINE_GPU_INTERFACE_STAGING_RING_HPP */
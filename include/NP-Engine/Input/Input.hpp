@@ -14,6 +14,9 @@
 #include "MouseCode.hpp"
 #include "MousePosition.hpp"
 #include "ControllerCode.hpp"
+#include "InputRecord.hpp"
+#include "InputRing.hpp"
+#include "InputRecording.hpp"
 #include "InputQueue.hpp"
 #include "InputSource.hpp"
 #include "InputListener.hpp"
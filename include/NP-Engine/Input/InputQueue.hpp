@@ -9,53 +9,132 @@
 
 #include "NP-Engine/Primitive/Primitive.hpp"
 #include "NP-Engine/Container/Container.hpp"
+#include "NP-Engine/Time/Time.hpp"
 
 #include "InputListener.hpp"
+#include "InputRecord.hpp"
+#include "InputRing.hpp"
+#include "InputRecording.hpp"
 
 namespace np::nput
 {
+	/*
+		submissions from any thread go into one lock-free ring of timestamped records, in the order they were submitted
+		ApplySubmissions takes them out on the thread that reads our states, keeping the frame's records in order and
+		counting every activation and deactivation, so a press and release within one frame is never lost
+		a full ring drops the newest submissions, see GetDroppedCount
+	*/
 	class InputQueue : public InputListener
 	{
 	protected:
-		using KeyCodeStateSubmissions = mutexed_wrapper<con::queue<KeyCodeState>>;
-		using MouseCodeStateSubmissions = mutexed_wrapper<con::queue<MouseCodeState>>;
-		using MousePositionSubmissions = mutexed_wrapper<MousePosition>;
-		using ControllerCodeStateSubmissions = mutexed_wrapper<con::queue<ControllerCodeState>>;
+		template <siz SIZE>
+		using TransitionCounts = con::array<ui32, SIZE>;
 
-		atm_bl _flag;
+		InputRing _ring;
+		atm_siz _dropped_count;
+		con::vector<InputRecord> _frame_records;
+		InputRecording* _recording;
 
 		KeyCodeStates _key_states;
 		MouseCodeStates _mouse_states;
 		MousePosition _mouse_position;
 		ControllerCodeStates _controller_states;
 
-		con::array<KeyCodeStateSubmissions, 2> _key_submissions;
-		con::array<MouseCodeStateSubmissions, 2> _mouse_submissions;
-		con::array<MousePositionSubmissions, 2> _mouse_position_submissions;
-		con::array<ControllerCodeStateSubmissions, 2> _controller_submissions;
+		TransitionCounts<(siz)KeyCode::Max> _key_activations;
+		TransitionCounts<(siz)KeyCode::Max> _key_deactivations;
+		TransitionCounts<(siz)MouseCode::Max> _mouse_activations;
+		TransitionCounts<(siz)MouseCode::Max> _mouse_deactivations;
+		TransitionCounts<(siz)ControllerCode::Max> _controller_activations;
+		TransitionCounts<(siz)ControllerCode::Max> _controller_deactivations;
 
-		KeyCodeStateSubmissions& GetKeyCodeSubmissions(bl flag)
+		template <typename InputCode, siz SIZE>
+		static void ApplyState(InputStates<InputCode, SIZE>& states, TransitionCounts<SIZE>& activations,
+							   TransitionCounts<SIZE>& deactivations, const InputRecord& record)
 		{
-			return flag ? _key_submissions.front() : _key_submissions.back();
+			if (record.code < SIZE)
+			{
+				InputState<InputCode>& state = states[record.code];
+				if (record.isActive != state.IsActive())
+				{
+					if (record.isActive)
+						activations[record.code]++;
+					else
+						deactivations[record.code]++;
+				}
+				state = record.GetState<InputState<InputCode>>();
+			}
 		}
 
-		MouseCodeStateSubmissions& GetMouseCodeSubmissions(bl flag)
+		template <siz SIZE>
+		static void ResetCounts(TransitionCounts<SIZE>& activations, TransitionCounts<SIZE>& deactivations, ui32 code)
 		{
-			return flag ? _mouse_submissions.front() : _mouse_submissions.back();
+			if (code < SIZE)
+				activations[code] = deactivations[code] = 0;
 		}
 
-		MousePositionSubmissions& GetMousePositionSubmissions(bl flag)
+		/*
+			only the codes touched last frame can have counts, so we reset just those
+		*/
+		void ResetTransitionCounts()
 		{
-			return flag ? _mouse_position_submissions.front() : _mouse_position_submissions.back();
+			for (const InputRecord& record : _frame_records)
+			{
+				switch (record.type)
+				{
+				case InputRecordType::Key:
+					ResetCounts(_key_activations, _key_deactivations, record.code);
+					break;
+
+				case InputRecordType::Mouse:
+					ResetCounts(_mouse_activations, _mouse_deactivations, record.code);
+					break;
+
+				case InputRecordType::Controller:
+					ResetCounts(_controller_activations, _controller_deactivations, record.code);
+					break;
+
+				default:
+					break;
+				}
+			}
 		}
 
-		ControllerCodeStateSubmissions& GetControllerCodeSubmissions(bl flag)
+		void Apply(const InputRecord& record)
 		{
-			return flag ? _controller_submissions.front() : _controller_submissions.back();
+			switch (record.type)
+			{
+			case InputRecordType::Key:
+				ApplyState(_key_states, _key_activations, _key_deactivations, record);
+				break;
+
+			case InputRecordType::Mouse:
+				ApplyState(_mouse_states, _mouse_activations, _mouse_deactivations, record);
+				break;
+
+			case InputRecordType::MousePosition:
+				_mouse_position = record.GetMousePosition();
+				break;
+
+			case InputRecordType::Controller:
+				ApplyState(_controller_states, _controller_activations, _controller_deactivations, record);
+				break;
+
+			default:
+				break;
+			}
 		}
 
 	public:
-		InputQueue(): _flag(true)
+		InputQueue(siz capacity = NP_ENGINE_INPUT_RING_CAPACITY):
+			_ring(capacity),
+			_dropped_count(0),
+			_recording(nullptr),
+			_key_activations{},
+			_key_deactivations{},
+			_mouse_activations{},
+			_mouse_deactivations{},
+			_controller_activations{},
+			_controller_deactivations{}
 		{
 			for (siz i = 0; i < (siz)KeyCode::Max; i++)
 				_key_states[i].SetCode(i);
@@ -65,70 +144,90 @@ namespace np::nput
 
 			for (siz i = 0; i < (siz)ControllerCode::Max; i++)
 				_controller_states[i].SetCode(i);
+
+			_frame_records.reserve(_ring.capacity());
 		}
 
+		/*
+			applies what was submitted before this call, in submission order -- submissions racing this call wait for the
+			next one
+		*/
 		void ApplySubmissions()
 		{
-			bl flag = _flag.load(mo_acquire);
-			while (!_flag.compare_exchange_weak(flag, !flag, mo_release, mo_relaxed))
-				;
+			ResetTransitionCounts();
+			_frame_records.clear();
 
+			InputRecord record{};
+			for (siz count = _ring.size(); count > 0 && _ring.try_pop(record); count--)
 			{
-				KeyCodeState state;
-				auto submissions = GetKeyCodeSubmissions(flag).get_access();
-				while (!submissions->empty())
-				{
-					state = submissions->front();
-					submissions->pop();
-					_key_states[state.GetCode()] = state;
-				}
-			}
-			{
-				MouseCodeState state;
-				auto submissions = GetMouseCodeSubmissions(flag).get_access();
-				while (!submissions->empty())
-				{
-					state = submissions->front();
-					submissions->pop();
-					_mouse_states[state.GetCode()] = state;
-				}
+				Apply(record);
+				_frame_records.emplace_back(record);
 			}
+
+			if (_recording)
 			{
-				MousePosition position;
-				auto submission = GetMousePositionSubmissions(flag).get_access();
-				_mouse_position = *submission;
-				*GetMousePositionSubmissions(!flag).get_access() = _mouse_position;
-			}
-			{
-				ControllerCodeState state;
-				auto submissions = GetControllerCodeSubmissions(flag).get_access();
-				while (!submissions->empty())
-				{
-					state = submissions->front();
-					submissions->pop();
-					_controller_states[state.GetCode()] = state;
-				}
+				_recording->Add(_frame_records.data(), _frame_records.size());
+				_recording->Add(InputRecord::CreateFrame(tim::steady_clock::now()));
 			}
 		}
 
+		/*
+			lock-free -- returns false when the ring is full and the record was dropped
+		*/
+		bl Submit(const InputRecord& record)
+		{
+			const bl pushed = _ring.try_push(record);
+			if (!pushed)
+				_dropped_count.fetch_add(1, mo_relaxed);
+
+			return pushed;
+		}
+
 		void Submit(const KeyCodeState& key_code_state) override
 		{
-			GetKeyCodeSubmissions(_flag.load(mo_acquire)).get_access()->emplace(key_code_state);
+			Submit(InputRecord::Create(key_code_state));
 		}
 
 		void Submit(const MouseCodeState& mouse_code_state) override
 		{
-			GetMouseCodeSubmissions(_flag.load(mo_acquire)).get_access()->emplace(mouse_code_state);
+			Submit(InputRecord::Create(mouse_code_state));
 		}
 
 		void Submit(const MousePosition& mouse_position) override
 		{
-			*GetMousePositionSubmissions(_flag.load(mo_acquire)).get_access() = mouse_position;
+			Submit(InputRecord::Create(mouse_position));
 		}
 
 		void Submit(const ControllerCodeState& controller_code_state) override
 		{
-			GetControllerCodeSubmissions(_flag.load(mo_acquire)).get_access()->emplace(controller_code_state);
+			Submit(InputRecord::Create(controller_code_state));
+		}
+
+		/*
+			every ApplySubmissions appends its records and a Frame record to the given recording until this is given
+			nullptr -- only call this from the thread that calls ApplySubmissions
+		*/
+		void SetRecording(InputRecording* recording)
+		{
+			_recording = recording;
+		}
+
+		InputRecording* GetRecording() const
+		{
+			return _recording;
+		}
+
+		/*
+			the records the last ApplySubmissions applied, in submission order
+		*/
+		const con::vector<InputRecord>& GetFrameRecords() const
+		{
+			return _frame_records;
+		}
+
+		siz GetDroppedCount() const
+		{
+			return _dropped_count.load(mo_relaxed);
 		}
 
 		const KeyCodeStates& GetKeyCodeStates() const
@@ -150,7 +249,58 @@ namespace np::nput
 		{
 			return _controller_states;
 		}
+
+		/*
+			how many times the code turned active during the last ApplySubmissions
+		*/
+		ui32 GetActivationCount(KeyCode code) const
+		{
+			return _key_activations[(siz)code];
+		}
+
+		ui32 GetActivationCount(MouseCode code) const
+		{
+			return _mouse_activations[(siz)code];
+		}
+
+		ui32 GetActivationCount(ControllerCode code) const
+		{
+			return _controller_activations[(siz)code];
+		}
+
+		/*
+			how many times the code turned inactive during the last ApplySubmissions
+		*/
+		ui32 GetDeactivationCount(KeyCode code) const
+		{
+			return _key_deactivations[(siz)code];
+		}
+
+		ui32 GetDeactivationCount(MouseCode code) const
+		{
+			return _mouse_deactivations[(siz)code];
+		}
+
+		ui32 GetDeactivationCount(ControllerCode code) const
+		{
+			return _controller_deactivations[(siz)code];
+		}
+
+		/*
+			true if the code turned active during the last ApplySubmissions, even if it is inactive again
+		*/
+		template <typename InputCode>
+		bl WasActivated(InputCode code) const
+		{
+			return GetActivationCount(code) > 0;
+		}
+
+		template <typename InputCode>
+		bl WasDeactivated(InputCode code) const
+		{
+			return GetDeactivationCount(code) > 0;
+		}
 	};
 } // namespace np::nput
 
-#endif /* NP_ENGINE_INPUT_QUEUE_HPP */
\ No newline at end of file
+#endif /* NP_ENGINE_INPUT_QUEUE_HPP */
@@ -0,0 +1,152 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#ifndef NP_ENGINE_INPUT_RECORD_HPP
+#define NP_ENGINE_INPUT_RECORD_HPP
+
+#include <type_traits>
+
+#include "NP-Engine/Primitive/Primitive.hpp"
+#include "NP-Engine/Time/Time.hpp"
+
+#include "NP-Engine/Vendor/GlmInclude.hpp"
+
+#include "KeyCode.hpp"
+#include "MouseCode.hpp"
+#include "MousePosition.hpp"
+#include "ControllerCode.hpp"
+
+namespace np::nput
+{
+	enum class InputRecordType : ui32
+	{
+		None = 0,
+		Key,
+		Mouse,
+		MousePosition,
+		Controller,
+		Frame // marks where InputQueue::ApplySubmissions split a recording into frames
+	};
+
+	/*
+		one input as it happened -- trivially copyable so rings and recordings can move it around as bytes
+		timestamps are steady clock nanoseconds, so only their differences mean anything across sessions
+	*/
+	struct InputRecord
+	{
+		InputRecordType type = InputRecordType::None;
+		ui32 code = 0;
+		flt activityLevel = 0.f;
+		bl isActive = false;
+		bl isOverSurface = false;
+		::glm::vec2 position{0};
+		i64 timestampNs = 0;
+
+		static i64 GetTimestampNs(tim::steady_timestamp timestamp)
+		{
+			return (i64)tim::nanoseconds(timestamp.time_since_epoch()).count();
+		}
+
+		/*
+			unset timestamps become now, so every record is ordered in time
+		*/
+		static i64 GetTimestampNsOrNow(tim::steady_timestamp timestamp)
+		{
+			return timestamp == tim::steady_timestamp{} ? GetTimestampNs(tim::steady_clock::now())
+														: GetTimestampNs(timestamp);
+		}
+
+		template <typename InputCode>
+		static InputRecord Create(InputRecordType type, const InputState<InputCode>& state)
+		{
+			InputRecord record{};
+			record.type = type;
+			record.code = (ui32)state.GetCode();
+			record.activityLevel = state.GetActivityLevel();
+			record.isActive = state.IsActive();
+			record.timestampNs = GetTimestampNsOrNow(state.GetTimestamp());
+			return record;
+		}
+
+		static InputRecord Create(const KeyCodeState& state)
+		{
+			return Create(InputRecordType::Key, state);
+		}
+
+		static InputRecord Create(const MouseCodeState& state)
+		{
+			return Create(InputRecordType::Mouse, state);
+		}
+
+		static InputRecord Create(const ControllerCodeState& state)
+		{
+			return Create(InputRecordType::Controller, state);
+		}
+
+		static InputRecord Create(const MousePosition& mouse_position)
+		{
+			InputRecord record{};
+			record.type = InputRecordType::MousePosition;
+			record.isOverSurface = mouse_position.IsOverSurface();
+			record.position = mouse_position.GetPosition();
+			record.timestampNs = GetTimestampNsOrNow(mouse_position.GetTimestamp());
+			return record;
+		}
+
+		static InputRecord CreateFrame(tim::steady_timestamp timestamp)
+		{
+			InputRecord record{};
+			record.type = InputRecordType::Frame;
+			record.timestampNs = GetTimestampNs(timestamp);
+			return record;
+		}
+
+		tim::steady_timestamp GetTimestamp() const
+		{
+			return tim::steady_timestamp(::std::chrono::duration_cast<tim::steady_clock::duration>(
+				::std::chrono::nanoseconds(timestampNs)));
+		}
+
+		template <typename T>
+		T GetState() const
+		{
+			T state;
+			state.SetCode((siz)code);
+			state.SetActivityLevel(activityLevel);
+			state.SetIsActive(isActive);
+			state.SetTimestamp(GetTimestamp());
+			return state;
+		}
+
+		KeyCodeState GetKeyCodeState() const
+		{
+			return GetState<KeyCodeState>();
+		}
+
+		MouseCodeState GetMouseCodeState() const
+		{
+			return GetState<MouseCodeState>();
+		}
+
+		ControllerCodeState GetControllerCodeState() const
+		{
+			return GetState<ControllerCodeState>();
+		}
+
+		MousePosition GetMousePosition() const
+		{
+			MousePosition mouse_position;
+			mouse_position.SetIsOverSurface(isOverSurface);
+			mouse_position.SetPosition(position);
+			mouse_position.SetTimestamp(GetTimestamp());
+			return mouse_position;
+		}
+	};
+
+	NP_ENGINE_STATIC_ASSERT(::std::is_trivially_copyable_v<InputRecord>, "InputRecord must stay trivially copyable");
+} // namespace np::nput
+
+#endif /* NP_ENGINE_INPUT_RECORD_HPP */
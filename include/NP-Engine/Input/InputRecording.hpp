@@ -0,0 +1,205 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#ifndef NP_ENGINE_INPUT_RECORDING_HPP
+#define NP_ENGINE_INPUT_RECORDING_HPP
+
+#include <fstream>
+
+#include "NP-Engine/Primitive/Primitive.hpp"
+#include "NP-Engine/Container/Container.hpp"
+#include "NP-Engine/String/String.hpp"
+#include "NP-Engine/FileSystem/FileSystem.hpp"
+
+#include "InputRecord.hpp"
+#include "InputListener.hpp"
+
+namespace np::nput
+{
+	/*
+		starts every saved recording, followed by recordCount InputRecords as they are laid out in memory
+		recordSize guards against loading records written by a build with another layout
+	*/
+	struct InputRecordingHeader
+	{
+		ui32 magic = 0;
+		ui32 version = 0;
+		ui32 recordSize = 0;
+		ui32 reserved = 0;
+		ui64 recordCount = 0;
+	};
+
+	/*
+		input records in the order they were applied, with a Frame record after each ApplySubmissions
+		see InputQueue::SetRecording and InputReplay
+	*/
+	class InputRecording
+	{
+	protected:
+		con::vector<InputRecord> _records;
+
+	public:
+		constexpr static ui32 MAGIC = 0x5249504E; // "NPIR"
+		constexpr static ui32 VERSION = 1;
+
+		void Clear()
+		{
+			_records.clear();
+		}
+
+		void Add(const InputRecord& record)
+		{
+			_records.emplace_back(record);
+		}
+
+		void Add(const InputRecord* records, siz count)
+		{
+			_records.insert(_records.end(), records, records + count);
+		}
+
+		const con::vector<InputRecord>& GetRecords() const
+		{
+			return _records;
+		}
+
+		siz GetFrameCount() const
+		{
+			siz count = 0;
+			for (const InputRecord& record : _records)
+				if (record.type == InputRecordType::Frame)
+					count++;
+
+			return count;
+		}
+
+		bl Save(str filename) const
+		{
+			InputRecordingHeader header{};
+			header.magic = MAGIC;
+			header.version = VERSION;
+			header.recordSize = (ui32)sizeof(InputRecord);
+			header.recordCount = _records.size();
+
+			const str filename_tmp = filename + ".tmp";
+			bl saved = false;
+			{
+				::std::ofstream ofile(filename_tmp, ::std::ios::binary | ::std::ios::trunc);
+				if (ofile.is_open())
+				{
+					ofile.write((const chr*)&header, sizeof(InputRecordingHeader));
+					ofile.write((const chr*)_records.data(), _records.size() * sizeof(InputRecord));
+					saved = ofile.good();
+				}
+			}
+
+			saved = saved && fsys::rename(filename_tmp, filename);
+			if (!saved)
+				fsys::remove_all(filename_tmp);
+
+			return saved;
+		}
+
+		/*
+			replaces our records with the file's, leaving us empty if it is missing, truncated, padded, or from another layout
+		*/
+		bl Load(str filename)
+		{
+			_records.clear();
+
+			InputRecordingHeader header{};
+			::std::ifstream ifile(filename, ::std::ios::binary);
+			if (!ifile.is_open())
+				return false;
+
+			ifile.read((chr*)&header, sizeof(InputRecordingHeader));
+			if (!ifile.good() || header.magic != MAGIC || header.version != VERSION ||
+				header.recordSize != (ui32)sizeof(InputRecord))
+				return false;
+
+			//the header's count must match what follows it exactly, so a bad count cannot size our records
+			const ::std::streampos records_begin = ifile.tellg();
+			ifile.seekg(0, ::std::ios::end);
+			const ::std::streamoff records_size = ifile.tellg() - records_begin;
+			ifile.seekg(records_begin);
+			if (!ifile.good() || records_size < 0 || (ui64)records_size % sizeof(InputRecord) != 0 ||
+				(ui64)records_size / sizeof(InputRecord) != header.recordCount)
+				return false;
+
+			_records.resize((siz)header.recordCount);
+			ifile.read((chr*)_records.data(), _records.size() * sizeof(InputRecord));
+			if (!ifile.good())
+				_records.clear();
+
+			return ifile.good();
+		}
+	};
+
+	/*
+		submits a recording to a listener one recorded frame at a time, so an InputQueue applies the same records in the
+		same frames every run -- recorded timestamps are kept
+	*/
+	class InputReplay
+	{
+	protected:
+		const InputRecording& _recording;
+		siz _index;
+
+	public:
+		InputReplay(const InputRecording& recording): _recording(recording), _index(0) {}
+
+		/*
+			submits the records up to the next Frame record, returns how many were submitted
+		*/
+		siz SubmitFrame(InputListener& listener)
+		{
+			const con::vector<InputRecord>& records = _recording.GetRecords();
+			siz count = 0;
+
+			for (; _index < records.size() && records[_index].type != InputRecordType::Frame; _index++, count++)
+			{
+				const InputRecord& record = records[_index];
+				switch (record.type)
+				{
+				case InputRecordType::Key:
+					listener.Submit(record.GetKeyCodeState());
+					break;
+
+				case InputRecordType::Mouse:
+					listener.Submit(record.GetMouseCodeState());
+					break;
+
+				case InputRecordType::MousePosition:
+					listener.Submit(record.GetMousePosition());
+					break;
+
+				case InputRecordType::Controller:
+					listener.Submit(record.GetControllerCodeState());
+					break;
+
+				default:
+					break;
+				}
+			}
+
+			if (_index < records.size())
+				_index++; // the Frame record
+
+			return count;
+		}
+
+		bl IsDone() const
+		{
+			return _index >= _recording.GetRecords().size();
+		}
+
+		void Reset()
+		{
+			_index = 0;
+		}
+	};
+} // namespace np::nput
+
+#endif /* NP_ENGINE_INPUT_RECORDING_HPP */
@@ -0,0 +1,24 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#ifndef NP_ENGINE_INPUT_RING_HPP
+#define NP_ENGINE_INPUT_RING_HPP
+
+// number of input records our ring can hold between frames, rounded up to a power of 2
+#ifndef NP_ENGINE_INPUT_RING_CAPACITY
+	#define NP_ENGINE_INPUT_RING_CAPACITY 4096
+#endif
+
+#include "NP-Engine/Container/MpmcRing.hpp"
+
+#include "InputRecord.hpp"
+
+namespace np::nput
+{
+	using InputRing = con::mpmc_ring<InputRecord>;
+} // namespace np::nput
+
+#endif /* NP_ENGINE_INPUT_RING_HPP */
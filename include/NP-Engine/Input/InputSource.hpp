@@ -20,25 +20,25 @@ namespace np::nput
 	class InputSource
 	{
 	protected:
-		mutexed_wrapper<con::uset<KeyCallback>> _key_callbacks;
-		mutexed_wrapper<con::uset<MouseCallback>> _mouse_callbacks;
-		mutexed_wrapper<con::uset<MousePositionCallback>> _mouse_position_callbacks;
-		mutexed_wrapper<con::uset<ControllerCallback>> _controller_callbacks;
+		shared_mutexed_wrapper<con::uset<KeyCallback>> _key_callbacks;
+		shared_mutexed_wrapper<con::uset<MouseCallback>> _mouse_callbacks;
+		shared_mutexed_wrapper<con::uset<MousePositionCallback>> _mouse_position_callbacks;
+		shared_mutexed_wrapper<con::uset<ControllerCallback>> _controller_callbacks;
 
-		mutexed_wrapper<con::umap<void*, KeyCallback>> _key_caller_callbacks;
-		mutexed_wrapper<con::umap<void*, MouseCallback>> _mouse_caller_callbacks;
-		mutexed_wrapper<con::umap<void*, MousePositionCallback>> _mouse_position_caller_callbacks;
-		mutexed_wrapper<con::umap<void*, ControllerCallback>> _controller_caller_callbacks;
+		shared_mutexed_wrapper<con::umap<void*, KeyCallback>> _key_caller_callbacks;
+		shared_mutexed_wrapper<con::umap<void*, MouseCallback>> _mouse_caller_callbacks;
+		shared_mutexed_wrapper<con::umap<void*, MousePositionCallback>> _mouse_position_caller_callbacks;
+		shared_mutexed_wrapper<con::umap<void*, ControllerCallback>> _controller_caller_callbacks;
 
 		virtual void InvokeKeyCallbacks(const KeyCodeState& state)
 		{
 			{
-				auto callbacks = _key_callbacks.get_access();
+				auto callbacks = _key_callbacks.get_shared_access();
 				for (auto it = callbacks->begin(); it != callbacks->end(); it++)
 					(*it)(nullptr, state);
 			}
 			{
-				auto callbacks = _key_caller_callbacks.get_access();
+				auto callbacks = _key_caller_callbacks.get_shared_access();
 				for (auto it = callbacks->begin(); it != callbacks->end(); it++)
 					it->second(it->first, state);
 			}
@@ -47,12 +47,12 @@ namespace np::nput
 		virtual void InvokeMouseCallbacks(const MouseCodeState& state)
 		{
 			{
-				auto callbacks = _mouse_callbacks.get_access();
+				auto callbacks = _mouse_callbacks.get_shared_access();
 				for (auto it = callbacks->begin(); it != callbacks->end(); it++)
 					(*it)(nullptr, state);
 			}
 			{
-				auto callbacks = _mouse_caller_callbacks.get_access();
+				auto callbacks = _mouse_caller_callbacks.get_shared_access();
 				for (auto it = callbacks->begin(); it != callbacks->end(); it++)
 					it->second(it->first, state);
 			}
@@ -61,12 +61,12 @@ namespace np::nput
 		virtual void InvokeMousePositionCallbacks(const MousePosition& position)
 		{
 			{
-				auto callbacks = _mouse_position_callbacks.get_access();
+				auto callbacks = _mouse_position_callbacks.get_shared_access();
 				for (auto it = callbacks->begin(); it != callbacks->end(); it++)
 					(*it)(nullptr, position);
 			}
 			{
-				auto callbacks = _mouse_position_caller_callbacks.get_access();
+				auto callbacks = _mouse_position_caller_callbacks.get_shared_access();
 				for (auto it = callbacks->begin(); it != callbacks->end(); it++)
 					it->second(it->first, position);
 			}
@@ -75,12 +75,12 @@ namespace np::nput
 		virtual void InvokeControllerCallbacks(const ControllerCodeState& state)
 		{
 			{
-				auto callbacks = _controller_callbacks.get_access();
+				auto callbacks = _controller_callbacks.get_shared_access();
 				for (auto it = callbacks->begin(); it != callbacks->end(); it++)
 					(*it)(nullptr, state);
 			}
 			{
-				auto callbacks = _controller_caller_callbacks.get_access();
+				auto callbacks = _controller_caller_callbacks.get_shared_access();
 				for (auto it = callbacks->begin(); it != callbacks->end(); it++)
 					it->second(it->first, state);
 			}
@@ -10,6 +10,7 @@
 #include "NP-Engine/Primitive/Primitive.hpp"
 #include "NP-Engine/Container/Container.hpp"
 #include "NP-Engine/Math/Math.hpp"
+#include "NP-Engine/Time/Time.hpp"
 
 namespace np::nput
 {
@@ -20,6 +21,7 @@ namespace np::nput
 		InputCode _code = InputCode::Unkown;
 		bl _is_active = false;
 		flt _activity_level = 1.f;
+		tim::steady_timestamp _timestamp{};
 
 	public:
 		flt GetActivityLevel() const
@@ -37,6 +39,14 @@ namespace np::nput
 			return _code;
 		}
 
+		/*
+			when the input happened, as close to the os telling us as we can get
+		*/
+		tim::steady_timestamp GetTimestamp() const
+		{
+			return _timestamp;
+		}
+
 		void SetActivityLevel(flt activity_level)
 		{
 			_activity_level = ::std::clamp(activity_level, 0.f, 1.f);
@@ -66,6 +76,11 @@ namespace np::nput
 		{
 			_code = (InputCode)code;
 		}
+
+		void SetTimestamp(tim::steady_timestamp timestamp)
+		{
+			_timestamp = timestamp;
+		}
 	};
 
 	template <typename InputCode, siz SIZE>
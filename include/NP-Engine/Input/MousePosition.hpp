@@ -8,6 +8,7 @@
 #define NP_ENGINE_MOUSE_POSITION_HPP
 
 #include "NP-Engine/Primitive/Primitive.hpp"
+#include "NP-Engine/Time/Time.hpp"
 
 #include "NP-Engine/Vendor/GlmInclude.hpp"
 
@@ -18,6 +19,7 @@ namespace np::nput
 	private:
 		bl _is_over_surface = true;
 		::glm::vec2 _position{0};
+		tim::steady_timestamp _timestamp{};
 
 	public:
 		bl IsOverSurface() const
@@ -30,6 +32,11 @@ namespace np::nput
 			return IsOverSurface() ? _position : ::glm::vec2{};
 		}
 
+		tim::steady_timestamp GetTimestamp() const
+		{
+			return _timestamp;
+		}
+
 		void SetIsOverSurface(bl is_over_screen)
 		{
 			_is_over_surface = is_over_screen;
@@ -39,6 +46,11 @@ namespace np::nput
 		{
 			_position = position;
 		}
+
+		void SetTimestamp(tim::steady_timestamp timestamp)
+		{
+			_timestamp = timestamp;
+		}
 	};
 
 	using MousePositionCallback = void (*)(void* caller, const nput::MousePosition& mouse_potition);
@@ -0,0 +1,421 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#ifndef NP_ENGINE_NSIT_ASYNC_LOG_HPP
+#define NP_ENGINE_NSIT_ASYNC_LOG_HPP
+
+#ifndef NP_ENGINE_LOG_ASYNC_ENABLE
+	#define NP_ENGINE_LOG_ASYNC_ENABLE true
+#endif
+
+// number of log records our queue can hold, rounded up to a power of 2
+#ifndef NP_ENGINE_LOG_ASYNC_CAPACITY
+	#define NP_ENGINE_LOG_ASYNC_CAPACITY 8192
+#endif
+
+// milliseconds
+#ifndef NP_ENGINE_LOG_FLUSH_INTERVAL
+	#define NP_ENGINE_LOG_FLUSH_INTERVAL 1000
+#endif
+
+// milliseconds the writer sleeps when it has nothing to write and nobody woke it
+#ifndef NP_ENGINE_LOG_ASYNC_POLL_INTERVAL
+	#define NP_ENGINE_LOG_ASYNC_POLL_INTERVAL 10
+#endif
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <algorithm>
+
+#include "NP-Engine/Foundation/Foundation.hpp"
+#include "NP-Engine/Primitive/Primitive.hpp"
+#include "NP-Engine/Container/Container.hpp"
+#include "NP-Engine/Container/MpmcRing.hpp"
+#include "NP-Engine/Time/Time.hpp"
+#include "NP-Engine/Thread/Thread.hpp"
+
+#include "NP-Engine/Vendor/SpdlogInclude.hpp"
+
+namespace np::nsit
+{
+	/*
+		what a logging thread does when the async queue is full
+	*/
+	enum class log_overflow : ui32
+	{
+		block = 0, // wait for the writer to make room, nothing is lost
+		drop_oldest, // make room by discarding the oldest queued record
+		drop_newest // discard the record being logged
+	};
+
+	struct log_settings
+	{
+		bl async = NP_ENGINE_LOG_ASYNC_ENABLE;
+		siz capacity = NP_ENGINE_LOG_ASYNC_CAPACITY;
+		log_overflow overflow = log_overflow::block;
+		tim::milliseconds flush_interval = tim::milliseconds(NP_ENGINE_LOG_FLUSH_INTERVAL);
+		::spdlog::level::level_enum flush_level = ::spdlog::level::err; // records at or above this flush right away
+	};
+
+	struct async_log_stats
+	{
+		ui64 enqueued = 0;
+		ui64 written = 0;
+		ui64 dropped = 0;
+		ui64 flushed = 0;
+		ui64 blocked = 0; // times a logging thread had to wait on a full queue
+		tim::nanoseconds total_enqueue_latency{0};
+		tim::nanoseconds max_enqueue_latency{0};
+
+		/*
+			average time a logging thread spent handing a record to us
+		*/
+		tim::nanoseconds get_mean_enqueue_latency() const
+		{
+			return enqueued == 0 ? tim::nanoseconds{0} : total_enqueue_latency / (dbl)enqueued;
+		}
+	};
+
+	namespace __detail
+	{
+		/*
+			what a logging thread pushes -- the writer's queue copies it into a slot's record
+		*/
+		struct async_log_message
+		{
+			const ::spdlog::details::log_msg& msg;
+			ui32 targets;
+		};
+
+		/*
+			everything needed to rebuild a ::spdlog::details::log_msg on the writer thread
+			the logger name and source location point at strings that outlive our records
+		*/
+		struct async_log_record
+		{
+			::spdlog::string_view_t logger_name{};
+			::spdlog::level::level_enum level = ::spdlog::level::off;
+			::spdlog::log_clock::time_point time{};
+			siz thread_id = 0;
+			::spdlog::source_loc source{};
+			ui32 targets = 0; // bitmask of the writer's sinks
+			::std::string payload = ""; // capacity is kept when slots are reused, so steady state logging does not allocate
+
+			/*
+				copies the message into us, reusing our payload's capacity
+			*/
+			async_log_record& operator=(const async_log_message& message)
+			{
+				logger_name = message.msg.logger_name;
+				level = message.msg.level;
+				time = message.msg.time;
+				thread_id = message.msg.thread_id;
+				source = message.msg.source;
+				targets = message.targets;
+				payload.assign(message.msg.payload.data(), message.msg.payload.size());
+				return *this;
+			}
+		};
+
+		using async_log_queue = con::mpmc_ring<async_log_record>;
+	} // namespace __detail
+
+	/*
+		owns the background thread that formats and writes records to the real sinks
+		logging threads only copy their message into our queue
+	*/
+	class async_log_writer
+	{
+	protected:
+		const log_settings _settings;
+		const con::vector<::std::shared_ptr<::spdlog::sinks::sink>> _sinks;
+		__detail::async_log_queue _queue;
+		mutex _sinks_mutex; // only taken by the writer thread, or by loggers once we are stopped
+		mutex _wait_mutex;
+		condition _wait_condition;
+		thr::thread _thread;
+		atm_bl _running;
+		atm_bl _flush_requested;
+		atm_siz _producer_count; // loggers between their is_running check and their enqueue, stop waits on these
+
+		atm<ui64> _enqueued;
+		atm<ui64> _written;
+		atm<ui64> _dropped;
+		atm<ui64> _flushed;
+		atm<ui64> _blocked;
+		atm<i64> _total_enqueue_ns;
+		atm<i64> _max_enqueue_ns;
+
+		static void writer_procedure(async_log_writer* writer)
+		{
+			writer->run();
+		}
+
+		void write(const __detail::async_log_record& record)
+		{
+			::spdlog::details::log_msg msg(record.time, record.source, record.logger_name, record.level,
+										   ::spdlog::string_view_t(record.payload.data(), record.payload.size()));
+			msg.thread_id = record.thread_id;
+
+			for (siz i = 0; i < _sinks.size(); i++)
+				if ((record.targets & BIT(i)) && _sinks[i]->should_log(record.level))
+					_sinks[i]->log(msg);
+		}
+
+		void flush_sinks()
+		{
+			for (const ::std::shared_ptr<::spdlog::sinks::sink>& sink : _sinks)
+				sink->flush();
+			_flushed.fetch_add(1, mo_relaxed);
+		}
+
+		void run()
+		{
+			__detail::async_log_record record{};
+			tim::steady_timestamp last_flush = tim::steady_clock::now();
+			bl unflushed = false;
+			bl running = true;
+
+			while (running)
+			{
+				running = _running.load(mo_acquire);
+				bl flush = !running; //always flush at shutdown
+
+				{
+					general_lock lock(_sinks_mutex);
+
+					//taken before we drain, so everything logged before the request goes out with this flush
+					flush |= _flush_requested.exchange(false, mo_acq_rel);
+
+					while (_queue.try_pop(record))
+					{
+						write(record);
+						_written.fetch_add(1, mo_relaxed);
+						unflushed = true;
+						flush |= record.level >= _settings.flush_level;
+					}
+
+					const tim::steady_timestamp now = tim::steady_clock::now();
+					flush |= unflushed && tim::milliseconds(now - last_flush) >= _settings.flush_interval;
+
+					if (flush)
+					{
+						flush_sinks();
+						last_flush = now;
+						unflushed = false;
+					}
+				}
+
+				if (running && !_flush_requested.load(mo_acquire))
+				{
+					general_lock lock(_wait_mutex);
+					_wait_condition.wait_for(lock, tim::milliseconds(NP_ENGINE_LOG_ASYNC_POLL_INTERVAL));
+				}
+			}
+		}
+
+		void wake()
+		{
+			_wait_condition.notify_one();
+		}
+
+		void record_latency(tim::steady_timestamp start)
+		{
+			const i64 ns = (i64)tim::duration_cast<tim::nanoseconds>(tim::steady_clock::now() - start).count();
+			_total_enqueue_ns.fetch_add(ns, mo_relaxed);
+
+			i64 max = _max_enqueue_ns.load(mo_relaxed);
+			while (ns > max && !_max_enqueue_ns.compare_exchange_weak(max, ns, mo_relaxed))
+			{}
+		}
+
+	public:
+		async_log_writer(const log_settings& settings, const con::vector<::std::shared_ptr<::spdlog::sinks::sink>>& sinks):
+			_settings(settings),
+			_sinks(sinks),
+			_queue(settings.capacity),
+			_running(true),
+			_flush_requested(false),
+			_producer_count(0),
+			_enqueued(0),
+			_written(0),
+			_dropped(0),
+			_flushed(0),
+			_blocked(0),
+			_total_enqueue_ns(0),
+			_max_enqueue_ns(0)
+		{
+			NP_ENGINE_ASSERT(_sinks.size() <= BIT_COUNT(ui32), "async_log_writer supports up to 32 sinks");
+			_thread.run(writer_procedure, this);
+		}
+
+		~async_log_writer()
+		{
+			stop();
+		}
+
+		/*
+			drains and flushes everything queued, then joins our thread
+			records logged after this are written synchronously
+		*/
+		void stop()
+		{
+			bl expected = true;
+			if (_running.compare_exchange_strong(expected, false, mo_seq_cst, mo_relaxed))
+			{
+				wake();
+				_thread.join();
+
+				//loggers that saw us running may still be enqueuing -- new ones see us stopped and write synchronously
+				while (_producer_count.load(mo_seq_cst) > 0)
+					thr::this_thread::yield();
+
+				//catch anything that was enqueued while our thread was finishing up
+				general_lock lock(_sinks_mutex);
+				__detail::async_log_record record{};
+				while (_queue.try_pop(record))
+				{
+					write(record);
+					_written.fetch_add(1, mo_relaxed);
+				}
+				flush_sinks();
+			}
+		}
+
+		bl is_running() const
+		{
+			return _running.load(mo_acquire);
+		}
+
+		void enqueue(const ::spdlog::details::log_msg& msg, ui32 targets)
+		{
+			const tim::steady_timestamp start = tim::steady_clock::now();
+			bl enqueued = false;
+
+			//counted before we check is_running, so stop cannot take its last drain while we are enqueuing
+			_producer_count.fetch_add(1, mo_seq_cst);
+			while (!enqueued && _running.load(mo_seq_cst))
+			{
+				enqueued = _queue.try_push(__detail::async_log_message{msg, targets});
+				if (!enqueued)
+				{
+					if (_settings.overflow == log_overflow::drop_newest)
+					{
+						break;
+					}
+					else if (_settings.overflow == log_overflow::drop_oldest)
+					{
+						__detail::async_log_record discarded{};
+						if (_queue.try_pop(discarded))
+							_dropped.fetch_add(1, mo_relaxed);
+					}
+					else
+					{
+						_blocked.fetch_add(1, mo_relaxed);
+						wake();
+						thr::this_thread::yield();
+					}
+				}
+			}
+			_producer_count.fetch_sub(1, mo_release);
+
+			if (enqueued)
+			{
+				_enqueued.fetch_add(1, mo_relaxed);
+				record_latency(start);
+
+				//the writer polls on its own, so we only wake it when something needs to go out now
+				if (msg.level >= _settings.flush_level || _queue.size() > _queue.capacity() / 2)
+					wake();
+			}
+			else if (!is_running())
+			{
+				general_lock lock(_sinks_mutex);
+				for (siz i = 0; i < _sinks.size(); i++)
+					if ((targets & BIT(i)) && _sinks[i]->should_log(msg.level))
+					{
+						_sinks[i]->log(msg);
+						if (msg.level >= _settings.flush_level)
+							_sinks[i]->flush();
+					}
+			}
+			else
+			{
+				_dropped.fetch_add(1, mo_relaxed);
+			}
+		}
+
+		/*
+			asks the writer to flush everything logged before this call
+			when waiting, we return once the writer has taken our request and flushed, or once we are stopped
+		*/
+		void request_flush(bl wait = false)
+		{
+			_flush_requested.store(true, mo_release);
+			wake();
+
+			//the writer takes the request, drains, and flushes under the sinks mutex, so seeing it taken there means done
+			while (wait && is_running())
+			{
+				{
+					general_lock lock(_sinks_mutex);
+					if (!_flush_requested.load(mo_acquire))
+						break;
+				}
+				thr::this_thread::yield();
+			}
+		}
+
+		async_log_stats get_stats() const
+		{
+			async_log_stats stats{};
+			stats.enqueued = _enqueued.load(mo_relaxed);
+			stats.written = _written.load(mo_relaxed);
+			stats.dropped = _dropped.load(mo_relaxed);
+			stats.flushed = _flushed.load(mo_relaxed);
+			stats.blocked = _blocked.load(mo_relaxed);
+			stats.total_enqueue_latency = tim::nanoseconds((dbl)_total_enqueue_ns.load(mo_relaxed));
+			stats.max_enqueue_latency = tim::nanoseconds((dbl)_max_enqueue_ns.load(mo_relaxed));
+			return stats;
+		}
+
+		const log_settings& get_settings() const
+		{
+			return _settings;
+		}
+	};
+
+	/*
+		the sink our loggers see in async mode -- it forwards to the writer's sinks chosen by targets
+		formatting happens on the writer thread with the real sinks' own patterns
+	*/
+	class async_log_sink : public ::spdlog::sinks::sink
+	{
+	protected:
+		::std::shared_ptr<async_log_writer> _writer;
+		ui32 _targets;
+
+	public:
+		async_log_sink(::std::shared_ptr<async_log_writer> writer, ui32 targets): _writer(writer), _targets(targets) {}
+
+		void log(const ::spdlog::details::log_msg& msg) override
+		{
+			_writer->enqueue(msg, _targets);
+		}
+
+		void flush() override
+		{
+			_writer->request_flush(true);
+		}
+
+		void set_pattern(const ::std::string& pattern) override {}
+
+		void set_formatter(::std::unique_ptr<::spdlog::formatter> sink_formatter) override {}
+	};
+} // namespace np::nsit
+
+#endif /* NP_ENGINE_NSIT_ASYNC_LOG_HPP */
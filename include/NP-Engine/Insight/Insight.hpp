@@ -8,25 +8,45 @@
 #define NP_ENGINE_NSIT_INSIGHT_HPP
 
 #include "NP-Engine/Foundation/Foundation.hpp"
+#include "AsyncLog.hpp"
 #include "Log.hpp"
 #include "Instrumentor.hpp"
 #include "ScopedTimer.hpp"
 #include "Timer.hpp"
 #include "InstrumentorTimer.hpp"
+#include "Metrics.hpp"
+#include "ProfileScope.hpp"
+#include "SamplingProfiler.hpp"
 #include "TraceEvent.hpp"
 
 #ifndef NP_ENGINE_PROFILE_ENABLE
 	#define NP_ENGINE_PROFILE_ENABLE false
 #endif
 
+/*
+	name must have static storage, like a string literal -- it is registered once and never copied
+	use NP_ENGINE_PROFILE_SCOPE_ARG for dynamic details (ids, counts) instead of building a name at runtime
+*/
 #if NP_ENGINE_PROFILE_ENABLE
-	#define NP_ENGINE_PROFILE_SCOPE(name) ::np::nsit::instrumentor_timer NP_ENGINE_CONCATENATE(timer, __LINE__)(name)
+	#define NP_ENGINE_PROFILE_SITE_ID(name) \
+		static const ::np::ui32 NP_ENGINE_CONCATENATE(profile_site_id, __LINE__) = \
+			::np::nsit::instrumentor::register_site(::np::nsit::profile_site{name, __FILE__, __LINE__})
+	#define NP_ENGINE_PROFILE_SCOPE(name) \
+		NP_ENGINE_PROFILE_SITE_ID(name); \
+		::np::nsit::profile_scope NP_ENGINE_CONCATENATE(profile_scope, __LINE__)(NP_ENGINE_CONCATENATE(profile_site_id, __LINE__))
+	#define NP_ENGINE_PROFILE_SCOPE_ARG(name, arg) \
+		NP_ENGINE_PROFILE_SITE_ID(name); \
+		::np::nsit::profile_scope NP_ENGINE_CONCATENATE(profile_scope, __LINE__)(NP_ENGINE_CONCATENATE(profile_site_id, __LINE__), \
+																				 (::np::i64)(arg))
 	#define NP_ENGINE_PROFILE_FUNCTION() NP_ENGINE_PROFILE_SCOPE(NP_ENGINE_FUNCTION)
+	#define NP_ENGINE_PROFILE_THREAD_NAME(name) ::np::nsit::instrumentor::set_thread_name(name)
 	#define NP_ENGINE_PROFILE_SAVE() ::np::nsit::instrumentor::save()
 	#define NP_ENGINE_PROFILE_RESET() ::np::nsit::instrumentor::reset()
 #else
 	#define NP_ENGINE_PROFILE_SCOPE(name)
+	#define NP_ENGINE_PROFILE_SCOPE_ARG(name, arg)
 	#define NP_ENGINE_PROFILE_FUNCTION()
+	#define NP_ENGINE_PROFILE_THREAD_NAME(name)
 	#define NP_ENGINE_PROFILE_SAVE()
 	#define NP_ENGINE_PROFILE_RESET()
 #endif
@@ -7,17 +7,24 @@
 #ifndef NP_ENGINE_NSIT_INSTRUMENTOR_HPP
 #define NP_ENGINE_NSIT_INSTRUMENTOR_HPP
 
+// number of profile records each thread allocates at a time
+#ifndef NP_ENGINE_PROFILE_CHUNK_SIZE
+	#define NP_ENGINE_PROFILE_CHUNK_SIZE 1024
+#endif
+
 #include <memory>
 #include <fstream>
 #include <thread>
 #include <sstream>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "NP-Engine/Foundation/Foundation.hpp"
 #include "NP-Engine/Primitive/Primitive.hpp"
 #include "NP-Engine/Time/Time.hpp"
 #include "NP-Engine/FileSystem/FileSystem.hpp"
+#include "NP-Engine/Memory/Memory.hpp"
 
 #include "NP-Engine/Vendor/RapidJsonInclude.hpp"
 
@@ -27,6 +34,49 @@
 
 namespace np::nsit
 {
+	namespace __detail
+	{
+		struct profile_chunk
+		{
+			constexpr static siz SIZE = NP_ENGINE_PROFILE_CHUNK_SIZE;
+
+			atm_siz count{0}; // published by the owning thread after each record is written
+			atm<profile_chunk*> next{nullptr};
+			profile_record records[SIZE];
+		};
+
+		/*
+			single producer chunk list -- the owning thread only ever appends to tail, and the instrumentor only reads
+			from head, so recording a scope takes no lock
+		*/
+		struct profile_thread_buffer
+		{
+			::std::string thread_id = "";
+			::std::string thread_name = ""; // guarded by the instrumentor's properties
+			bl is_thread_name_emitted = false;
+			profile_chunk* head = nullptr; // guarded by the instrumentor's properties
+			siz head_index = 0;
+			profile_chunk* tail = nullptr; // only touched by the owning thread
+
+			profile_thread_buffer()
+			{
+				mem::c_allocator a{};
+				head = tail = mem::create<profile_chunk>(a);
+			}
+
+			~profile_thread_buffer()
+			{
+				mem::c_allocator a{};
+				while (head)
+				{
+					profile_chunk* next = head->next.load(mo_acquire);
+					mem::destroy<profile_chunk>(a, head);
+					head = next;
+				}
+			}
+		};
+	} // namespace __detail
+
 	class instrumentor
 	{
 	public:
@@ -37,10 +87,125 @@ namespace np::nsit
 			::std::string filepath = "";
 			bl enable_save_on_trace = false;
 			bl enable_trace = true;
+			::std::vector<profile_site> sites{};
+			::std::vector<::std::shared_ptr<__detail::profile_thread_buffer>> thread_buffers{};
 		};
 
 	private:
 		static mutexed_wrapper<properties> _properties;
+		static atm_bl _is_tracing; // mirrors enable_trace so the hot path does not lock
+		static atm_bl _is_saving_on_trace;
+
+		static __detail::profile_thread_buffer& get_thread_buffer()
+		{
+			thread_local __detail::profile_thread_buffer* buffer = nullptr;
+			if (!buffer)
+			{
+				::std::shared_ptr<__detail::profile_thread_buffer> created = ::std::make_shared<__detail::profile_thread_buffer>();
+				::std::stringstream ss;
+				ss << ::std::this_thread::get_id();
+				created->thread_id = ss.str();
+
+				_properties.get_access()->thread_buffers.emplace_back(created);
+				buffer = created.get();
+			}
+			return *buffer;
+		}
+
+		static void add_profile_record_event(properties& p, const __detail::profile_thread_buffer& buffer,
+											 const profile_record& r)
+		{
+			const profile_site site = r.site_id < p.sites.size() ? p.sites[r.site_id] : profile_site{};
+			::rapidjson::MemoryPoolAllocator<::rapidjson::CrtAllocator>& allocator = p.report->GetAllocator();
+			::rapidjson::Value name(::rapidjson::StringRef(site.name ? site.name : "")); //sites are static, no copy
+			::rapidjson::Value tid(buffer.thread_id.c_str(), buffer.thread_id.size(), allocator);
+			::rapidjson::Value trace;
+
+			trace.SetObject();
+			trace.AddMember("cat", "function", allocator);
+			trace.AddMember("dur", tim::microseconds(r.end_timestamp - r.start_timestamp).count(), allocator);
+			trace.AddMember("name", name, allocator);
+			trace.AddMember("ph", "X", allocator);
+			trace.AddMember("pid", "0", allocator);
+			trace.AddMember("tid", tid, allocator);
+			trace.AddMember("ts", tim::microseconds(r.start_timestamp.time_since_epoch()).count(), allocator);
+
+			if (r.has_arg)
+			{
+				::rapidjson::Value args;
+				args.SetObject();
+				args.AddMember("arg", r.arg, allocator);
+				trace.AddMember("args", args, allocator);
+			}
+
+			(*p.report)["traceEvents"].PushBack(::std::move(trace), allocator);
+		}
+
+		/*
+			names a thread's lane in the report with chrome's thread_name metadata event
+		*/
+		static void add_thread_name_event(properties& p, const __detail::profile_thread_buffer& buffer)
+		{
+			::rapidjson::MemoryPoolAllocator<::rapidjson::CrtAllocator>& allocator = p.report->GetAllocator();
+			::rapidjson::Value tid(buffer.thread_id.c_str(), buffer.thread_id.size(), allocator);
+			::rapidjson::Value thread_name(buffer.thread_name.c_str(), buffer.thread_name.size(), allocator);
+			::rapidjson::Value args;
+			::rapidjson::Value trace;
+
+			args.SetObject();
+			args.AddMember("name", thread_name, allocator);
+
+			trace.SetObject();
+			trace.AddMember("name", "thread_name", allocator);
+			trace.AddMember("ph", "M", allocator);
+			trace.AddMember("pid", "0", allocator);
+			trace.AddMember("tid", tid, allocator);
+			trace.AddMember("args", args, allocator);
+
+			(*p.report)["traceEvents"].PushBack(::std::move(trace), allocator);
+		}
+
+		/*
+			moves every published profile record into our report, or discards them when not emitting
+			chunks the owning thread has moved past are freed, the tail chunk is always kept
+		*/
+		static void drain_profile_records(properties& p, bl emit)
+		{
+			mem::c_allocator a{};
+			for (const ::std::shared_ptr<__detail::profile_thread_buffer>& buffer : p.thread_buffers)
+			{
+				__detail::profile_chunk* chunk = buffer->head;
+				siz index = buffer->head_index;
+
+				if (emit && !buffer->is_thread_name_emitted && !buffer->thread_name.empty())
+				{
+					add_thread_name_event(p, *buffer);
+					buffer->is_thread_name_emitted = true;
+				}
+
+				while (chunk)
+				{
+					//once next is published the owning thread is done with this chunk, so count is final
+					__detail::profile_chunk* next = chunk->next.load(mo_acquire);
+					const siz count = chunk->count.load(mo_acquire);
+
+					if (emit)
+						for (; index < count; index++)
+							add_profile_record_event(p, *buffer, chunk->records[index]);
+
+					if (!next)
+					{
+						buffer->head = chunk;
+						buffer->head_index = count;
+						break;
+					}
+
+					mem::destroy<__detail::profile_chunk>(a, chunk);
+					chunk = next;
+					index = 0;
+				}
+			}
+		}
 
 		static void save_report(properties& p)
 		{
@@ -73,6 +238,8 @@ namespace np::nsit
 				p.is_initialized = true;
 				p.enable_trace = true;
 				p.enable_save_on_trace = false;
+				_is_tracing.store(true, mo_release);
+				_is_saving_on_trace.store(false, mo_release);
 				p.filepath = fsys::append(fsys::get_current_path(), "profile_report.json");
 
 				p.report = ::std::make_shared<::rapidjson::Document>();
@@ -93,6 +260,10 @@ namespace np::nsit
 		{
 			auto p = _properties.get_access();
 			init(*p);
+			drain_profile_records(*p, false);
+			for (const ::std::shared_ptr<__detail::profile_thread_buffer>& buffer : p->thread_buffers)
+				buffer->is_thread_name_emitted = false;
+
 			p->report.reset();
 			p->is_initialized = false;
 		}
@@ -105,6 +276,7 @@ namespace np::nsit
 			if (filepath.size() > 0)
 				p->filepath = filepath;
 
+			drain_profile_records(*p, true);
 			save_report(*p);
 		}
 
@@ -127,6 +299,7 @@ namespace np::nsit
 			auto p = _properties.get_access();
 			init(*p);
 			p->enable_save_on_trace = enable;
+			_is_saving_on_trace.store(enable, mo_release);
 		}
 
 		static void enable_trace_add(bl enable = true)
@@ -134,6 +307,59 @@ namespace np::nsit
 			auto p = _properties.get_access();
 			init(*p);
 			p->enable_trace = enable;
+			_is_tracing.store(enable, mo_release);
+		}
+
+		/*
+			registers a profiled scope once, returning the id its records use
+			NP_ENGINE_PROFILE_SCOPE keeps this in a function-local static, so this only runs on first use
+		*/
+		static ui32 register_site(profile_site site)
+		{
+			auto p = _properties.get_access();
+			p->sites.emplace_back(site);
+			return (ui32)(p->sites.size() - 1);
+		}
+
+		/*
+			gives the calling thread's lane a name in saved reports, instead of only its id
+		*/
+		static void set_thread_name(const ::std::string& name)
+		{
+			__detail::profile_thread_buffer& buffer = get_thread_buffer();
+			auto p = _properties.get_access();
+			buffer.thread_name = name;
+			buffer.is_thread_name_emitted = false;
+		}
+
+		static bl is_tracing()
+		{
+			return _is_tracing.load(mo_acquire);
+		}
+
+		/*
+			lock-free and allocation-free, except for one new chunk every NP_ENGINE_PROFILE_CHUNK_SIZE records
+		*/
+		static void add_profile_record(const profile_record& r)
+		{
+			__detail::profile_thread_buffer& buffer = get_thread_buffer();
+			__detail::profile_chunk* chunk = buffer.tail;
+			siz count = chunk->count.load(mo_relaxed);
+
+			if (count == __detail::profile_chunk::SIZE)
+			{
+				mem::c_allocator a{};
+				__detail::profile_chunk* next = mem::create<__detail::profile_chunk>(a);
+				chunk->next.store(next, mo_release);
+				buffer.tail = chunk = next;
+				count = 0;
+			}
+
+			chunk->records[count] = r;
+			chunk->count.store(count + 1, mo_release);
+
+			if (_is_saving_on_trace.load(mo_acquire))
+				save();
 		}
 
 		static void add_trace_event(trace_event& e)
@@ -9,6 +9,8 @@
 
 #include <memory>
 #include <string>
+#include <cmath>
+#include <algorithm>
 
 #include "NP-Engine/Foundation/Foundation.hpp"
 #include "NP-Engine/Primitive/Primitive.hpp"
@@ -16,6 +18,8 @@
 
 #include "NP-Engine/Vendor/SpdlogInclude.hpp"
 
+#include "AsyncLog.hpp"
+
 namespace np::nsit
 {
 	class log
@@ -27,9 +31,15 @@ namespace np::nsit
 		static ::std::shared_ptr<::spdlog::logger> _logger;
 		static ::std::shared_ptr<::spdlog::sinks::sink> _stdout_sink;
 		static ::std::shared_ptr<::spdlog::sinks::sink> _file_sink;
+		static ::std::shared_ptr<async_log_writer> _async_writer;
 
 	public:
-		static inline void init()
+		/*
+			our loggers are created on first use with default settings, so call this before logging to customize them
+			in async mode logging threads only copy their message into a queue, and a writer thread formats and writes
+			in sync mode logging threads write themselves, but still only flush per the settings
+		*/
+		static inline void init(const log_settings& settings = log_settings{})
 		{
 			bl expected = false;
 			if (_initialized.compare_exchange_strong(expected, true, mo_release, mo_relaxed))
@@ -44,24 +54,64 @@ namespace np::nsit
 				_file_sink->set_pattern(pattern);
 
 				_logger = ::std::make_shared<spdlog::logger>("NP_ENGINE_LOG");
-				_logger->sinks().push_back(_stdout_sink);
-				_logger->sinks().push_back(_file_sink);
-				spdlog::register_logger(_logger);
-				_logger->set_level(spdlog::level::trace);
-				_logger->flush_on(spdlog::level::trace);
-
-				_file_logger = ::std::make_shared<spdlog::logger>("NP_ENGINE_FILE", _file_sink);
-				spdlog::register_logger(_file_logger);
-				_file_logger->set_level(spdlog::level::trace);
-				_file_logger->flush_on(spdlog::level::trace);
-
-				_stdout_logger = ::std::make_shared<spdlog::logger>("NP_ENGINE_STDOUT", _stdout_sink);
-				spdlog::register_logger(_stdout_logger);
-				_stdout_logger->set_level(spdlog::level::trace);
-				_stdout_logger->flush_on(spdlog::level::trace);
+				if (settings.async)
+				{
+					//writer sink index 0 is stdout, 1 is file
+					_async_writer = ::std::make_shared<async_log_writer>(
+						settings, con::vector<::std::shared_ptr<::spdlog::sinks::sink>>{_stdout_sink, _file_sink});
+					_logger->sinks().push_back(::std::make_shared<async_log_sink>(_async_writer, (ui32)(BIT(0) | BIT(1))));
+					_file_logger = ::std::make_shared<spdlog::logger>(
+						"NP_ENGINE_FILE", ::std::make_shared<async_log_sink>(_async_writer, (ui32)BIT(1)));
+					_stdout_logger = ::std::make_shared<spdlog::logger>(
+						"NP_ENGINE_STDOUT", ::std::make_shared<async_log_sink>(_async_writer, (ui32)BIT(0)));
+				}
+				else
+				{
+					_logger->sinks().push_back(_stdout_sink);
+					_logger->sinks().push_back(_file_sink);
+					_file_logger = ::std::make_shared<spdlog::logger>("NP_ENGINE_FILE", _file_sink);
+					_stdout_logger = ::std::make_shared<spdlog::logger>("NP_ENGINE_STDOUT", _stdout_sink);
+					::spdlog::flush_every(::std::chrono::seconds(
+						::std::max((i64)1, (i64)::std::ceil(tim::seconds(settings.flush_interval).count()))));
+				}
+
+				for (::std::shared_ptr<spdlog::logger> logger : {_logger, _file_logger, _stdout_logger})
+				{
+					spdlog::register_logger(logger);
+					logger->set_level(spdlog::level::trace);
+					logger->flush_on(settings.flush_level);
+				}
 			}
 		}
 
+		/*
+			writes and flushes everything still queued -- logging after this is synchronous
+		*/
+		static inline void shutdown()
+		{
+			if (_initialized.load(mo_acquire))
+			{
+				if (_async_writer)
+				{
+					_async_writer->stop();
+				}
+				else
+				{
+					_logger->flush();
+					_file_logger->flush();
+					_stdout_logger->flush();
+				}
+			}
+		}
+
+		/*
+			all zeros in sync mode
+		*/
+		static inline async_log_stats get_async_stats()
+		{
+			return _async_writer ? _async_writer->get_stats() : async_log_stats{};
+		}
+
 		static inline ::std::string get_file_logger_file_path()
 		{
 			return fsys::append(fsys::get_current_path(), "NP-Engine-Log.log");
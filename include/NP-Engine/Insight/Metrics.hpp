@@ -0,0 +1,378 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+/*
+	Reference:
+		- <http://hdrhistogram.org/>
+		- <https://prometheus.io/docs/instrumenting/exposition_formats/>
+*/
+
+#ifndef NP_ENGINE_NSIT_METRICS_HPP
+#define NP_ENGINE_NSIT_METRICS_HPP
+
+#ifndef NP_ENGINE_METRICS_CACHE_LINE_SIZE
+	#define NP_ENGINE_METRICS_CACHE_LINE_SIZE 64
+#endif
+
+// number of cells a counter is split into, so hot counters are not one contended cache line
+#ifndef NP_ENGINE_METRICS_SHARD_COUNT
+	#define NP_ENGINE_METRICS_SHARD_COUNT 16
+#endif
+
+#ifndef NP_ENGINE_METRICS_HISTOGRAM_SHARD_COUNT
+	#define NP_ENGINE_METRICS_HISTOGRAM_SHARD_COUNT 4
+#endif
+
+// 2^bit sub-buckets per power of two, so recorded values are within 1/2^bit of their bucket
+#ifndef NP_ENGINE_METRICS_HISTOGRAM_SUB_BUCKET_BIT
+	#define NP_ENGINE_METRICS_HISTOGRAM_SUB_BUCKET_BIT 5
+#endif
+
+// values at or above 2^bit are clamped -- 2^48ns is a little over three days
+#ifndef NP_ENGINE_METRICS_HISTOGRAM_MAX_VALUE_BIT
+	#define NP_ENGINE_METRICS_HISTOGRAM_MAX_VALUE_BIT 48
+#endif
+
+#ifndef NP_ENGINE_METRICS_SNAPSHOT_INTERVAL
+	#define NP_ENGINE_METRICS_SNAPSHOT_INTERVAL 1000
+#endif
+
+#include <algorithm>
+#if __has_include(<bit>)
+	#include <bit>
+#endif
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "NP-Engine/Foundation/Foundation.hpp"
+#include "NP-Engine/Primitive/Primitive.hpp"
+#include "NP-Engine/Time/Time.hpp"
+
+/*
+	Memory, Container, String, and Thread are instrumented with this file, so it must only lean on std and headers
+	that do not include them
+*/
+
+namespace np::nsit
+{
+	namespace __detail
+	{
+		/*
+			index of the highest set bit, value must not be zero
+			we build as C++17, so std::bit_width is only used where the standard library already provides it
+		*/
+		inline ui32 find_last_set(ui64 value)
+		{
+#if defined(__cpp_lib_int_pow2) && __cpp_lib_int_pow2 >= 202002L
+			return (ui32)::std::bit_width(value) - 1;
+#else
+			ui32 index = 0;
+			for (ui32 shift = 32; shift > 0; shift >>= 1)
+				if (value >> shift)
+				{
+					value >>= shift;
+					index += shift;
+				}
+			return index;
+#endif
+		}
+
+		/*
+			threads are dealt shards round robin the first time they touch a metric
+		*/
+		inline siz get_metrics_shard_index()
+		{
+			static atm_siz next_index{0};
+			thread_local siz index = next_index.fetch_add(1, mo_relaxed);
+			return index;
+		}
+
+		template <typename T>
+		struct alignas(NP_ENGINE_METRICS_CACHE_LINE_SIZE) metrics_cell
+		{
+			atm<T> value{0};
+		};
+	} // namespace __detail
+
+	/*
+		monotonic -- increments land in this thread's cell, and get sums the cells
+	*/
+	class metric_counter
+	{
+	private:
+		__detail::metrics_cell<ui64> _cells[NP_ENGINE_METRICS_SHARD_COUNT];
+
+	public:
+		void add(ui64 n)
+		{
+			_cells[__detail::get_metrics_shard_index() % NP_ENGINE_METRICS_SHARD_COUNT].value.fetch_add(n, mo_relaxed);
+		}
+
+		void increment()
+		{
+			add(1);
+		}
+
+		ui64 get() const
+		{
+			ui64 sum = 0;
+			for (siz i = 0; i < NP_ENGINE_METRICS_SHARD_COUNT; i++)
+				sum += _cells[i].value.load(mo_relaxed);
+			return sum;
+		}
+
+		void reset()
+		{
+			for (siz i = 0; i < NP_ENGINE_METRICS_SHARD_COUNT; i++)
+				_cells[i].value.store(0, mo_relaxed);
+		}
+	};
+
+	/*
+		a value that goes up and down -- queue depths, open sockets, bytes in use
+	*/
+	class metric_gauge
+	{
+	private:
+		__detail::metrics_cell<i64> _cell;
+
+	public:
+		void set(i64 value)
+		{
+			_cell.value.store(value, mo_relaxed);
+		}
+
+		void add(i64 n)
+		{
+			_cell.value.fetch_add(n, mo_relaxed);
+		}
+
+		void sub(i64 n)
+		{
+			_cell.value.fetch_sub(n, mo_relaxed);
+		}
+
+		void increment()
+		{
+			add(1);
+		}
+
+		void decrement()
+		{
+			sub(1);
+		}
+
+		i64 get() const
+		{
+			return _cell.value.load(mo_relaxed);
+		}
+	};
+
+	struct histogram_snapshot
+	{
+		ui64 count = 0;
+		ui64 sum = 0;
+		ui64 min = 0;
+		ui64 max = 0;
+		::std::vector<ui64> buckets;
+
+		dbl get_mean() const
+		{
+			return count == 0 ? 0.0 : (dbl)sum / (dbl)count;
+		}
+
+		/*
+			returns the highest value equivalent to the bucket the quantile lands in, clamped to [min, max]
+		*/
+		ui64 get_value_at_quantile(dbl quantile) const;
+	};
+
+	/*
+		log-linear buckets like HdrHistogram: exact below 2^sub_bit, then 2^sub_bit buckets per power of two
+		recording is one relaxed add into this thread's shard, merging happens in get_snapshot
+	*/
+	class metric_histogram
+	{
+	public:
+		constexpr static ui32 SUB_BUCKET_BIT = NP_ENGINE_METRICS_HISTOGRAM_SUB_BUCKET_BIT;
+		constexpr static ui64 SUB_BUCKET_COUNT = BIT(SUB_BUCKET_BIT);
+		constexpr static ui32 MAX_VALUE_BIT = NP_ENGINE_METRICS_HISTOGRAM_MAX_VALUE_BIT;
+		constexpr static ui64 MAX_VALUE = BIT(MAX_VALUE_BIT) - 1;
+		constexpr static siz BUCKET_COUNT = SUB_BUCKET_COUNT * (MAX_VALUE_BIT - SUB_BUCKET_BIT + 1);
+
+		NP_ENGINE_STATIC_ASSERT(SUB_BUCKET_BIT < MAX_VALUE_BIT && MAX_VALUE_BIT < 64, "histogram bits are out of range");
+
+	private:
+		struct alignas(NP_ENGINE_METRICS_CACHE_LINE_SIZE) shard
+		{
+			atm_ui64 count{0};
+			atm_ui64 sum{0};
+			atm_ui64 min{UI64_MAX};
+			atm_ui64 max{0};
+			atm_ui64 buckets[BUCKET_COUNT];
+
+			shard()
+			{
+				for (siz i = 0; i < BUCKET_COUNT; i++)
+					buckets[i].store(0, mo_relaxed);
+			}
+		};
+
+		::std::unique_ptr<shard[]> _shards;
+
+	public:
+		static siz get_bucket_index(ui64 value)
+		{
+			value = ::std::min(value, MAX_VALUE);
+			if (value < SUB_BUCKET_COUNT)
+				return (siz)value;
+
+			const ui32 shift = __detail::find_last_set(value) - SUB_BUCKET_BIT;
+			return (siz)(((ui64)(shift + 1) << SUB_BUCKET_BIT) + ((value >> shift) - SUB_BUCKET_COUNT));
+		}
+
+		static ui64 get_bucket_lower_value(siz index)
+		{
+			if (index < SUB_BUCKET_COUNT)
+				return (ui64)index;
+
+			const ui32 shift = (ui32)(index >> SUB_BUCKET_BIT) - 1;
+			return (SUB_BUCKET_COUNT + (index & (SUB_BUCKET_COUNT - 1))) << shift;
+		}
+
+		static ui64 get_bucket_upper_value(siz index)
+		{
+			if (index < SUB_BUCKET_COUNT)
+				return (ui64)index;
+
+			const ui32 shift = (ui32)(index >> SUB_BUCKET_BIT) - 1;
+			return get_bucket_lower_value(index) + BIT(shift) - 1;
+		}
+
+		metric_histogram(): _shards(new shard[NP_ENGINE_METRICS_HISTOGRAM_SHARD_COUNT]) {}
+
+		void record(ui64 value)
+		{
+			shard& s = _shards[__detail::get_metrics_shard_index() % NP_ENGINE_METRICS_HISTOGRAM_SHARD_COUNT];
+			s.buckets[get_bucket_index(value)].fetch_add(1, mo_relaxed);
+			s.sum.fetch_add(value, mo_relaxed);
+
+			for (ui64 min = s.min.load(mo_relaxed); value < min && !s.min.compare_exchange_weak(min, value, mo_relaxed);)
+				;
+			for (ui64 max = s.max.load(mo_relaxed); value > max && !s.max.compare_exchange_weak(max, value, mo_relaxed);)
+				;
+
+			s.count.fetch_add(1, mo_release);
+		}
+
+		template <class R, class P>
+		void record(tim::duration<R, P> duration)
+		{
+			const dbl ns = tim::nanoseconds(duration).count();
+			record(ns > 0.0 ? (ui64)ns : 0);
+		}
+
+		histogram_snapshot get_snapshot() const
+		{
+			histogram_snapshot snapshot{};
+			snapshot.min = UI64_MAX;
+			snapshot.buckets.resize(BUCKET_COUNT, 0);
+
+			for (siz i = 0; i < NP_ENGINE_METRICS_HISTOGRAM_SHARD_COUNT; i++)
+			{
+				const shard& s = _shards[i];
+				snapshot.count += s.count.load(mo_acquire);
+				snapshot.sum += s.sum.load(mo_relaxed);
+				snapshot.min = ::std::min(snapshot.min, s.min.load(mo_relaxed));
+				snapshot.max = ::std::max(snapshot.max, s.max.load(mo_relaxed));
+
+				for (siz j = 0; j < BUCKET_COUNT; j++)
+					snapshot.buckets[j] += s.buckets[j].load(mo_relaxed);
+			}
+
+			if (snapshot.count == 0)
+				snapshot.min = 0;
+
+			return snapshot;
+		}
+
+		void reset()
+		{
+			for (siz i = 0; i < NP_ENGINE_METRICS_HISTOGRAM_SHARD_COUNT; i++)
+			{
+				shard& s = _shards[i];
+				s.count.store(0, mo_relaxed);
+				s.sum.store(0, mo_relaxed);
+				s.min.store(UI64_MAX, mo_relaxed);
+				s.max.store(0, mo_relaxed);
+				for (siz j = 0; j < BUCKET_COUNT; j++)
+					s.buckets[j].store(0, mo_relaxed);
+			}
+		}
+	};
+
+	inline ui64 histogram_snapshot::get_value_at_quantile(dbl quantile) const
+	{
+		ui64 value = 0;
+		if (count != 0)
+		{
+			quantile = ::std::clamp(quantile, 0.0, 1.0);
+			const ui64 target = ::std::max((ui64)1, (ui64)(quantile * (dbl)count + 0.5));
+
+			// shards are read one after another, so buckets may be a few records ahead of count
+			ui64 seen = 0;
+			siz index = 0;
+			for (; index < buckets.size(); index++)
+			{
+				seen += buckets[index];
+				if (seen >= target)
+					break;
+			}
+
+			value = ::std::clamp(metric_histogram::get_bucket_upper_value(::std::min(index, buckets.size() - 1)), min, max);
+		}
+		return value;
+	}
+
+	/*
+		process-wide registry of named metrics
+		get_* returns the same metric for the same name, and metrics live until exit -- so look them up once and keep
+		the reference, usually in a function local static
+		names should follow the scrape format: [a-zA-Z_:][a-zA-Z0-9_:]*
+	*/
+	class metrics
+	{
+	public:
+		static metric_counter& get_counter(const ::std::string& name, const ::std::string& help = "");
+
+		static metric_gauge& get_gauge(const ::std::string& name, const ::std::string& help = "");
+
+		static metric_histogram& get_histogram(const ::std::string& name, const ::std::string& help = "");
+
+		/*
+			every metric in the prometheus text exposition format -- histograms are written as summaries
+		*/
+		static ::std::string scrape();
+
+		/*
+			writes scrape() to a temporary file and moves it over filepath, so readers never see a partial snapshot
+		*/
+		static bl save(const ::std::string& filepath);
+
+		/*
+			saves to filepath every interval on a background thread until stop_snapshots
+		*/
+		static void start_snapshots(const ::std::string& filepath,
+									tim::milliseconds interval = tim::milliseconds(NP_ENGINE_METRICS_SNAPSHOT_INTERVAL));
+
+		static void stop_snapshots();
+
+		static bl is_snapshotting();
+	};
+} // namespace np::nsit
+
+#endif /* NP_ENGINE_NSIT_METRICS_HPP */
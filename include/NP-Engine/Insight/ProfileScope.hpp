@@ -0,0 +1,49 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#ifndef NP_ENGINE_NSIT_PROFILE_SCOPE_HPP
+#define NP_ENGINE_NSIT_PROFILE_SCOPE_HPP
+
+#include "NP-Engine/Primitive/Primitive.hpp"
+#include "NP-Engine/Time/Time.hpp"
+
+#include "TraceEvent.hpp"
+#include "Instrumentor.hpp"
+
+namespace np::nsit
+{
+	/*
+		records a registered site id plus timestamps -- no names, no strings, no locks
+		see NP_ENGINE_PROFILE_SCOPE
+	*/
+	class profile_scope
+	{
+	private:
+		profile_record _record;
+
+	public:
+		profile_scope(ui32 site_id)
+		{
+			_record.site_id = site_id;
+			_record.start_timestamp = tim::steady_clock::now();
+		}
+
+		profile_scope(ui32 site_id, i64 arg): profile_scope(site_id)
+		{
+			_record.has_arg = true;
+			_record.arg = arg;
+		}
+
+		~profile_scope()
+		{
+			_record.end_timestamp = tim::steady_clock::now();
+			if (instrumentor::is_tracing())
+				instrumentor::add_profile_record(_record);
+		}
+	};
+} // namespace np::nsit
+
+#endif /* NP_ENGINE_NSIT_PROFILE_SCOPE_HPP */
@@ -0,0 +1,131 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+/*
+	Reference:
+		- <https://www.brendangregg.com/flamegraphs.html>
+		- <https://man7.org/linux/man-pages/man2/timer_create.2.html>
+*/
+
+#ifndef NP_ENGINE_NSIT_SAMPLING_PROFILER_HPP
+#define NP_ENGINE_NSIT_SAMPLING_PROFILER_HPP
+
+// samples per second of cpu time, per thread -- an odd number keeps us from locking step with periodic work
+#ifndef NP_ENGINE_SAMPLING_PROFILER_FREQUENCY
+	#define NP_ENGINE_SAMPLING_PROFILER_FREQUENCY 99
+#endif
+
+#ifndef NP_ENGINE_SAMPLING_PROFILER_MAX_DEPTH
+	#define NP_ENGINE_SAMPLING_PROFILER_MAX_DEPTH 64
+#endif
+
+// samples each thread can hold before the collector drains them
+#ifndef NP_ENGINE_SAMPLING_PROFILER_BUFFER_SIZE
+	#define NP_ENGINE_SAMPLING_PROFILER_BUFFER_SIZE 1024
+#endif
+
+// milliseconds between collector passes
+#ifndef NP_ENGINE_SAMPLING_PROFILER_COLLECT_INTERVAL
+	#define NP_ENGINE_SAMPLING_PROFILER_COLLECT_INTERVAL 250
+#endif
+
+#include <string>
+
+#include "NP-Engine/Foundation/Foundation.hpp"
+#include "NP-Engine/Primitive/Primitive.hpp"
+
+namespace np::nsit
+{
+	struct sampling_profiler_stats
+	{
+		ui64 samples = 0;
+		ui64 dropped = 0;
+		siz threads = 0;
+	};
+
+	/*
+		opt-in statistical profiler -- each registered thread gets a SIGPROF timer on its own cpu clock, and the signal
+		handler copies the thread's stack into that thread's buffer, so nothing has to be annotated and idle threads
+		cost nothing
+		a background collector drains the buffers, and save writes folded stacks (one "thread;frame;...;frame count"
+		line per unique stack) for flamegraph.pl, speedscope, or inferno
+		job workers tag their samples with the running job's callback, so jobs show up as their own frame under the
+		worker
+
+		only linux is supported for now, everywhere else start returns false
+		symbols come from dladdr, so link with -rdynamic (and keep frame pointers) for readable stacks
+	*/
+	class sampling_profiler
+	{
+	private:
+		static inline thread_local const void* _thread_tag = nullptr;
+
+	public:
+		static bl is_supported();
+
+		/*
+			call on the thread to be sampled -- it stays registered until it exits or calls unregister_thread
+		*/
+		static void register_thread(const ::std::string& name);
+
+		static void unregister_thread();
+
+		static bl start(ui32 frequency = NP_ENGINE_SAMPLING_PROFILER_FREQUENCY);
+
+		static void stop();
+
+		static bl is_running();
+
+		/*
+			writes every sample collected so far as folded stacks
+		*/
+		static bl save(const ::std::string& filepath);
+
+		/*
+			discards collected samples
+		*/
+		static void reset();
+
+		static sampling_profiler_stats get_stats();
+
+		/*
+			tag is symbolized like a frame and inserted right under the thread name -- pass nullptr to clear it
+		*/
+		static void set_thread_tag(const void* tag)
+		{
+			_thread_tag = tag;
+			::std::atomic_signal_fence(mo_release);
+		}
+
+		static const void* get_thread_tag()
+		{
+			::std::atomic_signal_fence(mo_acquire);
+			return _thread_tag;
+		}
+	};
+
+	/*
+		tags this thread's samples for the lifetime of the scope, restoring the previous tag after
+	*/
+	class sampling_profiler_tag_scope
+	{
+	private:
+		const void* _previous_tag;
+
+	public:
+		sampling_profiler_tag_scope(const void* tag): _previous_tag(sampling_profiler::get_thread_tag())
+		{
+			sampling_profiler::set_thread_tag(tag);
+		}
+
+		~sampling_profiler_tag_scope()
+		{
+			sampling_profiler::set_thread_tag(_previous_tag);
+		}
+	};
+} // namespace np::nsit
+
+#endif /* NP_ENGINE_NSIT_SAMPLING_PROFILER_HPP */
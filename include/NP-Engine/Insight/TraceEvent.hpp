@@ -10,6 +10,7 @@
 #include <string>
 #include <thread>
 
+#include "NP-Engine/Primitive/Primitive.hpp"
 #include "NP-Engine/Time/Time.hpp"
 
 namespace np::nsit
@@ -22,6 +23,28 @@ namespace np::nsit
 		tim::milliseconds elapsed_milliseconds{};
 		::std::thread::id thread_id{};
 	};
+
+	/*
+		describes a profiled scope in source -- every pointer here must have static storage, like string literals
+	*/
+	struct profile_site
+	{
+		const chr* name = nullptr;
+		const chr* file = nullptr;
+		ui32 line = 0;
+	};
+
+	/*
+		what a profiled scope records on the hot path, the site id is resolved to a name only when we save
+	*/
+	struct profile_record
+	{
+		ui32 site_id = 0;
+		bl has_arg = false;
+		i64 arg = 0; // optional dynamic detail, like a worker id, so names never need to be built at runtime
+		tim::steady_timestamp start_timestamp{};
+		tim::steady_timestamp end_timestamp{};
+	};
 } // namespace np::nsit
 
 #endif /* NP_ENGINE_NSIT_TRACE_EVENT_HPP */
\ No newline at end of file
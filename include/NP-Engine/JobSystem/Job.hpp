@@ -13,6 +13,9 @@
 #include "NP-Engine/Primitive/Primitive.hpp"
 #include "NP-Engine/Memory/Memory.hpp"
 #include "NP-Engine/Container/Container.hpp"
+#include "NP-Engine/Time/Time.hpp"
+#include "NP-Engine/Insight/Metrics.hpp"
+#include "NP-Engine/Insight/SamplingProfiler.hpp"
 
 #include "JobPriority.hpp"
 
@@ -53,6 +56,19 @@ namespace np::jsys
 		mem::delegate _delegate;
 		bl _can_be_stolen;
 
+		static nsit::metric_counter& GetExecutedCounter()
+		{
+			static nsit::metric_counter& counter = nsit::metrics::get_counter("np_jsys_jobs_executed_total", "jobs executed");
+			return counter;
+		}
+
+		static nsit::metric_histogram& GetDurationHistogram()
+		{
+			static nsit::metric_histogram& histogram =
+				nsit::metrics::get_histogram("np_jsys_job_duration_ns", "time spent in job callbacks");
+			return histogram;
+		}
+
 	public:
 		Job(): _antecedent_count(0), _can_be_stolen(true) {}
 
@@ -108,7 +124,13 @@ namespace np::jsys
 			if (CanExecute())
 			{
 				_delegate.SetId(worker_id);
-				_delegate();
+				const tim::steady_timestamp start = tim::steady_clock::now();
+				{
+					nsit::sampling_profiler_tag_scope tag((const void*)_delegate.GetCallback());
+					_delegate();
+				}
+				GetDurationHistogram().record(tim::steady_clock::now() - start);
+				GetExecutedCounter().increment();
 
 				{
 					auto dependents = _dependents.get_access();
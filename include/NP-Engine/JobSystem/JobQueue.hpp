@@ -10,6 +10,7 @@
 #include "NP-Engine/Foundation/Foundation.hpp"
 #include "NP-Engine/Primitive/Primitive.hpp"
 #include "NP-Engine/Container/Container.hpp"
+#include "NP-Engine/Insight/Metrics.hpp"
 
 #include "JobRecord.hpp"
 #include "Job.hpp"
@@ -28,6 +29,12 @@ namespace np::jsys
 			return _jobs_queues[(siz)priority];
 		}
 
+		static nsit::metric_gauge& GetDepthGauge()
+		{
+			static nsit::metric_gauge& gauge = nsit::metrics::get_gauge("np_jsys_queued_jobs", "jobs waiting in job queues");
+			return gauge;
+		}
+
 	public:
 		void Push(JobPriority priority, mem::sptr<Job> job)
 		{
@@ -39,6 +46,7 @@ namespace np::jsys
 			NP_ENGINE_ASSERT(record.IsValid(), "attempted to add an invalid Job -- do not do that my guy");
 			NP_ENGINE_ASSERT(!record.job->IsComplete(), "the dude is complete bro - why it be");
 			GetQueueForPriority(record.priority).get_access()->emplace(record);
+			GetDepthGauge().increment();
 		}
 
 		JobRecord Pop(JobPriority priority)
@@ -49,6 +57,7 @@ namespace np::jsys
 			{
 				record = queue->front();
 				queue->pop();
+				GetDepthGauge().decrement();
 			}
 			return record;
 		}
@@ -58,6 +67,7 @@ namespace np::jsys
 			for (auto it = _jobs_queues.begin(); it != _jobs_queues.end(); it++)
 			{
 				auto queue = it->get_access();
+				GetDepthGauge().sub((i64)queue->size());
 				while (!queue->empty())
 					queue->pop();
 			}
@@ -8,25 +8,50 @@
 #define NP_ENGINE_JOB_SYSTEM_HPP
 
 #include <utility>
+#include <algorithm>
 
 #include "NP-Engine/Foundation/Foundation.hpp"
 #include "NP-Engine/Primitive/Primitive.hpp"
 #include "NP-Engine/Container/Container.hpp"
 #include "NP-Engine/Thread/Thread.hpp"
 #include "NP-Engine/Memory/Memory.hpp"
+#include "NP-Engine/Insight/Metrics.hpp"
 
 #include "JobPriority.hpp"
 #include "JobRecord.hpp"
 #include "JobWorker.hpp"
 #include "JobQueue.hpp"
+#include "ServiceThread.hpp"
 #include "Job.hpp"
 
 namespace np::jsys
 {
+	/*
+		called for one index of a ParallelFor -- participant is on [0, GetJobWokerCount()] and stays the same for every index
+		one thread or job runs, so per participant resources need no locks
+	*/
+	using ParallelForFunction = void (*)(void* payload, siz participant, siz index);
+
 	class JobSystem
 	{
 	private:
 		friend class JobWorker;
+		friend class ServiceThread;
+
+		/*
+			shared with the jobs of one ParallelFor -- jobs may start after it returns, so the last one out destroys it, and
+			nothing past next is touched once every index is claimed
+		*/
+		struct ParallelForState
+		{
+			ParallelForFunction function;
+			void* payload;
+			siz count;
+			atm_siz next;
+			atm_siz next_participant;
+			atm_siz completed;
+			atm_siz references;
+		};
 
 		atm_bl _running;
 		bl _is_offsetting_worker_thread_affinity;
@@ -36,6 +61,7 @@ namespace np::jsys
 		mem::sptr<thr::thread_pool> _thread_pool;
 		mem::accumulating_pool<Job, mem::DEFAULT_ALIGNMENT> _job_pool;
 		JobQueue _job_queue;
+		con::vector<mem::sptr<ServiceThread>> _service_threads;
 
 		JobRecord GetNextJob()
 		{
@@ -59,10 +85,67 @@ namespace np::jsys
 			return _thread_pool->create_object();
 		}
 
+		static void RunParallelFor(ParallelForState& state)
+		{
+			siz i = state.next.fetch_add(1, mo_relaxed);
+			if (i >= state.count)
+				return;
+
+			// only those that claimed an index take a participant, so there are never more than the jobs plus the caller
+			const siz participant = state.next_participant.fetch_add(1, mo_relaxed);
+			for (; i < state.count; i = state.next.fetch_add(1, mo_relaxed))
+			{
+				state.function(state.payload, participant, i);
+				state.completed.fetch_add(1, mo_release);
+			}
+		}
+
+		static void ReleaseParallelForState(ParallelForState* state)
+		{
+			if (state->references.fetch_sub(1, mo_acq_rel) == 1)
+			{
+				mem::trait_allocator allocator;
+				mem::destroy<ParallelForState>(allocator, state);
+			}
+		}
+
+		static void RunParallelForCallback(mem::delegate& d)
+		{
+			ParallelForState* state = (ParallelForState*)d.GetPayload();
+			RunParallelFor(*state);
+			ReleaseParallelForState(state);
+		}
+
+		static nsit::metric_counter& GetSubmittedCounter()
+		{
+			static nsit::metric_counter& counter = nsit::metrics::get_counter("np_jsys_jobs_submitted_total", "jobs submitted");
+			return counter;
+		}
+
+		bl IsServiceThreadCore(siz core) const
+		{
+			bl is_service_core = false;
+			for (siz i = 0; i < _service_threads.size() && !is_service_core; i++)
+				is_service_core = _service_threads[i]->HasAffinity() &&
+					_service_threads[i]->GetAffinity() % thr::thread::hardware_concurrency() == core;
+
+			return is_service_core;
+		}
+
 		siz GetThreadAffinity(siz worker_id)
 		{
 			// we add one to help prevent core 0 crowding -- assuming main thread is there
-			return (worker_id + (_is_offsetting_worker_thread_affinity ? 1 : 0)) % thr::thread::hardware_concurrency();
+			const siz core_count = thr::thread::hardware_concurrency();
+			const siz first_core = _is_offsetting_worker_thread_affinity ? 1 : 0;
+
+			// workers stay off the cores our service threads are pinned to, unless that leaves them nowhere to go
+			con::vector<siz> worker_cores;
+			for (siz core = first_core; core < core_count; core++)
+				if (!IsServiceThreadCore(core))
+					worker_cores.emplace_back(core);
+
+			return worker_cores.empty() ? (worker_id + first_core) % core_count
+										: worker_cores[worker_id % worker_cores.size()];
 		}
 
 	public:
@@ -89,6 +172,7 @@ namespace np::jsys
 		void Clear()
 		{
 			Stop();
+			_service_threads.clear();
 			_job_workers.clear();
 			_thread_pool.reset();
 			_job_queue.Clear();
@@ -146,12 +230,24 @@ namespace np::jsys
 
 			for (siz i = 0; i < _job_workers.size(); i++)
 				_job_workers[i].StartWork(*this);
+
+			for (siz i = 0; i < _service_threads.size(); i++)
+				_service_threads[i]->StartWork(_job_workers.size() + i);
 		}
 
+		/*
+			service threads are stopped first, so they may keep waiting on jobs until they return
+		*/
 		void Stop()
 		{
 			if (IsRunning())
 			{
+				for (siz i = 0; i < _service_threads.size(); i++)
+					_service_threads[i]->RequestStop();
+
+				for (siz i = 0; i < _service_threads.size(); i++)
+					_service_threads[i]->StopWork();
+
 				for (siz i = 0; i < _job_workers.size(); i++)
 					_job_workers[i].StopWork();
 
@@ -165,6 +261,55 @@ namespace np::jsys
 			return _running.load(mo_acquire);
 		}
 
+		/*
+			creates a dedicated thread outside the job worker pool that runs the given callback once, which is expected to
+			loop while its ServiceThread::KeepRunning
+			it starts now if we are running, else when we start -- give it ServiceThread::NO_AFFINITY to leave it unpinned
+			job workers avoid the cores of the service threads created before we start
+		*/
+		mem::sptr<ServiceThread> CreateServiceThread(str name, siz affinity, ServiceThread::Callback callback,
+													 void* payload = nullptr)
+		{
+			NP_ENGINE_ASSERT(callback, "a service thread requires a callback");
+
+			mem::sptr<ServiceThread> service = mem::create_sptr<ServiceThread>(_allocator, *this, name, affinity, callback, payload);
+			_service_threads.emplace_back(service);
+
+			if (IsRunning())
+				service->StartWork(_job_workers.size() + _service_threads.size() - 1);
+
+			return service;
+		}
+
+		/*
+			stops the given service thread, waiting on its callback to return, and forgets it
+		*/
+		void DestroyServiceThread(mem::sptr<ServiceThread> service)
+		{
+			for (auto it = _service_threads.begin(); it != _service_threads.end();)
+			{
+				if (*it == service)
+				{
+					(*it)->StopWork();
+					it = _service_threads.erase(it);
+				}
+				else
+				{
+					it++;
+				}
+			}
+		}
+
+		con::vector<mem::sptr<ServiceThread>>& GetServiceThreads()
+		{
+			return _service_threads;
+		}
+
+		const con::vector<mem::sptr<ServiceThread>>& GetServiceThreads() const
+		{
+			return _service_threads;
+		}
+
 		mem::sptr<Job> CreateJob()
 		{
 			return _job_pool.create_object();
@@ -175,12 +320,58 @@ namespace np::jsys
 			NP_ENGINE_ASSERT(job && !job->IsComplete(), "you must submit a valid and incomplete job");
 
 			_job_queue.Push(priority, job);
+			GetSubmittedCounter().increment();
 			for (siz i = 0; i < _job_workers.size(); i++)
 				_job_workers[i].WakeUp();
 
 			if (_job_worker_sleep_condition)
 				_job_worker_sleep_condition->notify_one();
 		}
+
+		/*
+			calls function for every index on [0, count) across up to max_job_count jobs and this thread, returning once all
+			are done -- this thread claims indices from the same counter as the jobs until none are left, then waits for the
+			indices jobs already claimed
+			this thread never runs other queued jobs, so an unrelated long job can not hold up the return -- the wait is
+			at most one index on each job that claimed one
+			payload is only used before this returns, so it may live on the caller's stack
+		*/
+		void ParallelFor(siz count, ParallelForFunction function, void* payload,
+						 JobPriority priority = JobPriority::Normal, siz max_job_count = SIZ_MAX)
+		{
+			if (count == 0)
+				return;
+
+			mem::trait_allocator allocator;
+			ParallelForState* state = mem::create<ParallelForState>(allocator);
+			state->function = function;
+			state->payload = payload;
+			state->count = count;
+			state->next.store(0, mo_relaxed);
+			state->next_participant.store(0, mo_relaxed);
+			state->completed.store(0, mo_relaxed);
+
+			siz job_count = 0;
+			if (IsRunning() && count > 1)
+				job_count = ::std::min({count - 1, GetJobWokerCount(), max_job_count});
+
+			state->references.store(job_count + 1, mo_release);
+			for (siz i = 0; i < job_count; i++)
+			{
+				mem::sptr<Job> job = CreateJob();
+				job->SetPayload(state);
+				job->SetCallback(RunParallelForCallback);
+				SubmitJob(priority, job);
+			}
+
+			RunParallelFor(*state);
+
+			// every index is claimed by now, and our jobs that have not started will find none left
+			while (state->completed.load(mo_acquire) < count)
+				thr::this_thread::yield();
+
+			ReleaseParallelForState(state);
+		}
 	};
 } // namespace np::jsys
 
@@ -51,7 +51,7 @@ namespace np::jsys
 		mem::sptr<thr::thread> _thread;
 		mem::sptr<condition> _sleep_condition;
 		mutexed_wrapper<con::queue<mem::sptr<Job>>> _immediate_jobs;
-		mutexed_wrapper<con::vector<JobWorker*>> _coworkers;
+		shared_mutexed_wrapper<con::vector<JobWorker*>> _coworkers;
 
 		static void WorkProcedure(const WorkPayload& payload);
 
@@ -124,7 +124,7 @@ namespace np::jsys
 		mem::sptr<Job> GetStolenJob()
 		{
 			mem::sptr<Job> job = nullptr;
-			auto coworkers = _coworkers.get_access();
+			auto coworkers = _coworkers.get_shared_access();
 			for (siz i = 0; i < coworkers->size() && !job; i++)
 				job = (*coworkers)[i]->GetImmediateJob(this);
 
@@ -0,0 +1,223 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#ifndef NP_ENGINE_SERVICE_THREAD_HPP
+#define NP_ENGINE_SERVICE_THREAD_HPP
+
+#include <algorithm>
+#include <utility>
+
+#include "NP-Engine/Foundation/Foundation.hpp"
+#include "NP-Engine/Primitive/Primitive.hpp"
+#include "NP-Engine/Thread/Thread.hpp"
+#include "NP-Engine/Memory/Memory.hpp"
+#include "NP-Engine/String/String.hpp"
+#include "NP-Engine/Time/Time.hpp"
+
+#include "JobPriority.hpp"
+#include "Job.hpp"
+
+namespace np::jsys
+{
+	class JobSystem;
+
+	/*
+		counts since the service thread last started
+		cpuTime / runTime is how busy the service keeps its core
+	*/
+	struct ServiceThreadStats
+	{
+		tim::nanoseconds cpuTime{};
+		tim::nanoseconds runTime{};
+		siz helpedJobCount = 0;
+	};
+
+	/*
+		a dedicated thread that runs one long-lived callback outside the job worker pool, like rendering, io polling, or
+		a network reactor -- it never takes pool jobs unless it asks to help, and no worker ever steals from it
+		service threads run while their job system runs, and job workers are kept off the cores they are pinned to
+
+		the callback is expected to loop while KeepRunning(), and may submit jobs, or help the pool with HelpJobSystem
+		and HelpUntilComplete instead of idling
+	*/
+	class ServiceThread
+	{
+	public:
+		using Callback = void (*)(ServiceThread& service);
+
+		constexpr static siz NO_AFFINITY = SIZ_MAX;
+
+	private:
+		friend class JobSystem;
+
+		JobSystem& _job_system;
+		str _name;
+		siz _affinity;
+		Callback _callback;
+		void* _payload;
+		siz _id; // given to the jobs this thread helps with, after the job worker ids
+		atm_bl _keep_running;
+		mem::trait_allocator _allocator;
+		mutable mutex _thread_mutex; // held while _thread changes, so GetStats never reads a thread being joined
+		mem::sptr<thr::thread> _thread;
+		atm_ui64 _start_ns;
+		atm_ui64 _stop_ns;
+		atm_ui64 _cpu_ns; // published by this thread when its callback returns
+		atm_siz _helped_job_count;
+
+		static void RunProcedure(ServiceThread* self);
+
+		static ui64 GetNowNanoseconds()
+		{
+			return (ui64)tim::nanoseconds(tim::steady_clock::now().time_since_epoch()).count();
+		}
+
+		void StartWork(siz id);
+
+		void StopWork()
+		{
+			RequestStop();
+			scoped_lock lock(_thread_mutex);
+			if (_thread)
+			{
+				_thread->join();
+				_thread.reset();
+				_stop_ns.store(GetNowNanoseconds(), mo_release);
+			}
+		}
+
+	public:
+		ServiceThread(JobSystem& job_system, str name, siz affinity, Callback callback, void* payload):
+			_job_system(job_system),
+			_name(name),
+			_affinity(affinity),
+			_callback(callback),
+			_payload(payload),
+			_id(0),
+			_keep_running(false),
+			_allocator(),
+			_thread_mutex(),
+			_thread(nullptr),
+			_start_ns(0),
+			_stop_ns(0),
+			_cpu_ns(0),
+			_helped_job_count(0)
+		{}
+
+		ServiceThread(const ServiceThread& other) = delete;
+
+		ServiceThread(ServiceThread&& other) = delete;
+
+		~ServiceThread()
+		{
+			StopWork();
+		}
+
+		ServiceThread& operator=(const ServiceThread& other) = delete;
+
+		ServiceThread& operator=(ServiceThread&& other) = delete;
+
+		/*
+			the callback should return soon after this turns false
+		*/
+		bl KeepRunning() const
+		{
+			return _keep_running.load(mo_acquire);
+		}
+
+		/*
+			asks the callback to return without waiting on it -- the job system joins it when it stops
+		*/
+		void RequestStop()
+		{
+			_keep_running.store(false, mo_release);
+		}
+
+		bl IsRunning() const
+		{
+			scoped_lock lock(_thread_mutex);
+			return (bl)_thread;
+		}
+
+		/*
+			runs at most one ready job from the job system's priority queues on this thread
+			returns true iff a job was found, else false
+			FOUND JOB MAY OR MAY NOT BE EXECUTED
+		*/
+		bl HelpJobSystem();
+
+		/*
+			helps the job system until the given job is complete, instead of blocking this thread
+		*/
+		void HelpUntilComplete(mem::sptr<Job> job)
+		{
+			while (job && !job->IsComplete())
+				if (!HelpJobSystem())
+					thr::this_thread::yield();
+		}
+
+		mem::sptr<Job> CreateJob();
+
+		void SubmitJob(JobPriority priority, mem::sptr<Job> job);
+
+		JobSystem& GetJobSystem()
+		{
+			return _job_system;
+		}
+
+		const JobSystem& GetJobSystem() const
+		{
+			return _job_system;
+		}
+
+		str GetName() const
+		{
+			return _name;
+		}
+
+		siz GetAffinity() const
+		{
+			return _affinity;
+		}
+
+		bl HasAffinity() const
+		{
+			return _affinity != NO_AFFINITY;
+		}
+
+		void* GetPayload() const
+		{
+			return _payload;
+		}
+
+		siz GetId() const
+		{
+			return _id;
+		}
+
+		/*
+			waits for a StopWork in progress to finish joining
+		*/
+		ServiceThreadStats GetStats() const
+		{
+			ServiceThreadStats stats{};
+			scoped_lock lock(_thread_mutex);
+			const ui64 start_ns = _start_ns.load(mo_acquire);
+			const ui64 stop_ns = _thread ? GetNowNanoseconds() : _stop_ns.load(mo_acquire);
+			const ui64 cpu_ns = _cpu_ns.load(mo_acquire);
+
+			stats.runTime = tim::nanoseconds((dbl)(stop_ns > start_ns ? stop_ns - start_ns : 0));
+			stats.cpuTime = tim::nanoseconds((dbl)cpu_ns);
+			if (_thread)
+				stats.cpuTime = ::std::max(stats.cpuTime, _thread->get_cpu_time());
+
+			stats.helpedJobCount = _helped_job_count.load(mo_acquire);
+			return stats;
+		}
+	};
+} // namespace np::jsys
+
+#endif /* NP_ENGINE_SERVICE_THREAD_HPP */
@@ -30,6 +30,7 @@
 #include "SmartPtr.hpp"
 #include "StdAllocator.hpp"
 #include "TraitAllocator.hpp"
+#include "TlsfOffsetAllocator.hpp"
 #include "AccumulatingPool.hpp"
 
 //TODO: slowly but surely removing c-style casting
@@ -0,0 +1,499 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+/*
+	Reference:
+		- <http://www.gii.upv.es/tlsf/files/papers/ecrts04_tlsf.pdf>
+		- <https://github.com/sebbbi/OffsetAllocator>
+*/
+
+#ifndef NP_ENGINE_MEM_TLSF_OFFSET_ALLOCATOR_HPP
+#define NP_ENGINE_MEM_TLSF_OFFSET_ALLOCATOR_HPP
+
+#include <vector>
+
+#if defined(_MSC_VER)
+	#include <intrin.h>
+#endif
+
+#include "NP-Engine/Foundation/Foundation.hpp"
+#include "NP-Engine/Primitive/Primitive.hpp"
+
+namespace np::mem
+{
+	namespace __detail
+	{
+		/*
+			index of the most significant set bit, value must not be zero
+		*/
+		static inline ui32 find_last_set(ui64 value)
+		{
+#if defined(_MSC_VER)
+			unsigned long index = 0;
+			_BitScanReverse64(&index, value);
+			return (ui32)index;
+#else
+			return 63 - (ui32)__builtin_clzll(value);
+#endif
+		}
+
+		/*
+			index of the least significant set bit, value must not be zero
+		*/
+		static inline ui32 find_first_set(ui64 value)
+		{
+#if defined(_MSC_VER)
+			unsigned long index = 0;
+			_BitScanForward64(&index, value);
+			return (ui32)index;
+#else
+			return (ui32)__builtin_ctzll(value);
+#endif
+		}
+	} // namespace __detail
+
+	/*
+		two-level segregated fit allocator over the offsets [0, size) -- it never touches the memory it hands out, so it
+		is meant for memory we cannot (or should not) write bookkeeping into, like gpu heaps
+		allocate and deallocate are O(1), and freed blocks are merged with their free neighbours immediately
+		this is not thread-safe, so wrap it when sharing
+	*/
+	class tlsf_offset_allocator
+	{
+	public:
+		constexpr static ui32 INVALID_NODE = UI32_MAX;
+
+		struct allocation
+		{
+			siz offset = 0;
+			siz size = 0;
+			ui32 node = INVALID_NODE; // hand this back to deallocate
+
+			bl is_valid() const
+			{
+				return node != INVALID_NODE;
+			}
+		};
+
+		struct stats
+		{
+			siz size = 0;
+			siz free_size = 0;
+			siz largest_free_size = 0;
+			siz free_block_count = 0;
+			siz allocation_count = 0;
+
+			/*
+				0 when all free space is one block, approaching 1 as free space is scattered into small blocks
+			*/
+			dbl get_fragmentation() const
+			{
+				return free_size == 0 ? 0.0 : 1.0 - ((dbl)largest_free_size / (dbl)free_size);
+			}
+		};
+
+	protected:
+		constexpr static ui32 SL_BITS = 4;
+		constexpr static ui32 SL_COUNT = BIT(SL_BITS);
+		constexpr static ui32 FL_COUNT = 64 - SL_BITS + 1;
+		constexpr static ui32 BIN_COUNT = FL_COUNT * SL_COUNT;
+
+		NP_ENGINE_STATIC_ASSERT(FL_COUNT <= 64, "our first level bitmap is one ui64");
+		NP_ENGINE_STATIC_ASSERT(SL_COUNT <= 32, "our second level bitmaps are ui32");
+
+		struct node
+		{
+			siz offset = 0;
+			siz size = 0;
+			ui32 prev_free = INVALID_NODE;
+			ui32 next_free = INVALID_NODE;
+			ui32 prev_physical = INVALID_NODE;
+			ui32 next_physical = INVALID_NODE;
+			bl used = false;
+		};
+
+		siz _size;
+		siz _free_size;
+		siz _free_block_count;
+		siz _allocation_count;
+		ui64 _fl_bitmap;
+		ui32 _sl_bitmaps[FL_COUNT];
+		ui32 _bins[BIN_COUNT]; // head of each free list
+		::std::vector<node> _nodes;
+		::std::vector<ui32> _unused_nodes;
+
+		/*
+			sizes under SL_COUNT get an exact bin, larger sizes are split into SL_COUNT linear steps per power of two
+		*/
+		static void map_bin(siz size, ui32& fl, ui32& sl)
+		{
+			if (size < SL_COUNT)
+			{
+				fl = 0;
+				sl = (ui32)size;
+			}
+			else
+			{
+				const ui32 msb = __detail::find_last_set(size);
+				fl = msb - SL_BITS + 1;
+				sl = (ui32)(size >> (msb - SL_BITS)) - SL_COUNT;
+			}
+		}
+
+		/*
+			rounds size up to the next bin boundary so every block in the found bin is guaranteed to fit
+		*/
+		static void map_search_bin(siz size, ui32& fl, ui32& sl)
+		{
+			if (size >= SL_COUNT)
+				size += BIT((__detail::find_last_set(size) - SL_BITS)) - 1;
+			map_bin(size, fl, sl);
+		}
+
+		static ui32 get_bin_index(ui32 fl, ui32 sl)
+		{
+			return fl * SL_COUNT + sl;
+		}
+
+		static siz calc_padding(siz offset, siz alignment)
+		{
+			//calc_aligned_value would sanitize alignment up to DEFAULT_ALIGNMENT, but offsets are not pointers
+			return ((offset + alignment - 1) / alignment) * alignment - offset;
+		}
+
+		bl fits(ui32 index, siz size, siz alignment) const
+		{
+			const node& n = _nodes[index];
+			const siz padding = calc_padding(n.offset, alignment);
+			return padding <= n.size && size <= n.size - padding;
+		}
+
+		/*
+			walks the free lists from the bin size maps to, for when the rounded up search found nothing
+			blocks in these bins may or may not fit, but an exact fit (like our whole size) only lives here
+		*/
+		ui32 find_fitting_node(siz size, siz alignment) const
+		{
+			ui32 fl = 0, sl = 0;
+			map_bin(size, fl, sl);
+			while (find_free_bin(fl, sl))
+			{
+				for (ui32 i = _bins[get_bin_index(fl, sl)]; i != INVALID_NODE; i = _nodes[i].next_free)
+					if (fits(i, size, alignment))
+						return i;
+
+				if (++sl == SL_COUNT)
+				{
+					sl = 0;
+					if (++fl == FL_COUNT)
+						break;
+				}
+			}
+			return INVALID_NODE;
+		}
+
+		bl find_free_bin(ui32& fl, ui32& sl) const
+		{
+			ui32 sl_bitmap = sl < SL_COUNT ? _sl_bitmaps[fl] & (UI32_MAX << sl) : 0;
+			if (!sl_bitmap)
+			{
+				const ui64 fl_bitmap = fl + 1 < 64 ? _fl_bitmap & (UI64_MAX << (fl + 1)) : 0;
+				if (!fl_bitmap)
+					return false;
+
+				fl = __detail::find_first_set(fl_bitmap);
+				sl_bitmap = _sl_bitmaps[fl];
+			}
+
+			sl = __detail::find_first_set(sl_bitmap);
+			return true;
+		}
+
+		ui32 create_node(siz offset, siz size)
+		{
+			ui32 index = INVALID_NODE;
+			if (_unused_nodes.empty())
+			{
+				NP_ENGINE_ASSERT(_nodes.size() < INVALID_NODE, "tlsf_offset_allocator ran out of node indices");
+				index = (ui32)_nodes.size();
+				_nodes.emplace_back();
+			}
+			else
+			{
+				index = _unused_nodes.back();
+				_unused_nodes.pop_back();
+			}
+
+			_nodes[index] = node{};
+			_nodes[index].offset = offset;
+			_nodes[index].size = size;
+			return index;
+		}
+
+		void destroy_node(ui32 index)
+		{
+			_nodes[index] = node{};
+			_unused_nodes.emplace_back(index);
+		}
+
+		void insert_free(ui32 index)
+		{
+			node& n = _nodes[index];
+			ui32 fl = 0, sl = 0;
+			map_bin(n.size, fl, sl);
+			const ui32 bin = get_bin_index(fl, sl);
+
+			n.used = false;
+			n.prev_free = INVALID_NODE;
+			n.next_free = _bins[bin];
+			if (n.next_free != INVALID_NODE)
+				_nodes[n.next_free].prev_free = index;
+
+			_bins[bin] = index;
+			_fl_bitmap |= BIT(fl);
+			_sl_bitmaps[fl] |= (ui32)BIT(sl);
+			_free_block_count++;
+		}
+
+		void remove_free(ui32 index)
+		{
+			node& n = _nodes[index];
+			if (n.prev_free != INVALID_NODE)
+			{
+				_nodes[n.prev_free].next_free = n.next_free;
+			}
+			else
+			{
+				ui32 fl = 0, sl = 0;
+				map_bin(n.size, fl, sl);
+				const ui32 bin = get_bin_index(fl, sl);
+				_bins[bin] = n.next_free;
+
+				if (_bins[bin] == INVALID_NODE)
+				{
+					_sl_bitmaps[fl] &= ~(ui32)BIT(sl);
+					if (!_sl_bitmaps[fl])
+						_fl_bitmap &= ~BIT(fl);
+				}
+			}
+
+			if (n.next_free != INVALID_NODE)
+				_nodes[n.next_free].prev_free = n.prev_free;
+
+			n.prev_free = INVALID_NODE;
+			n.next_free = INVALID_NODE;
+			_free_block_count--;
+		}
+
+		/*
+			splits the given size off the front of the node, returning the new node that holds the front
+		*/
+		ui32 split_front(ui32 index, siz size)
+		{
+			const ui32 front = create_node(_nodes[index].offset, size);
+			node& n = _nodes[index];
+			node& f = _nodes[front];
+
+			f.prev_physical = n.prev_physical;
+			f.next_physical = index;
+			if (n.prev_physical != INVALID_NODE)
+				_nodes[n.prev_physical].next_physical = front;
+
+			n.prev_physical = front;
+			n.offset += size;
+			n.size -= size;
+			return front;
+		}
+
+		/*
+			merges the next physical node into the given node, the next node is destroyed
+		*/
+		void merge_next(ui32 index)
+		{
+			node& n = _nodes[index];
+			const ui32 next = n.next_physical;
+			node& x = _nodes[next];
+
+			n.size += x.size;
+			n.next_physical = x.next_physical;
+			if (x.next_physical != INVALID_NODE)
+				_nodes[x.next_physical].prev_physical = index;
+
+			destroy_node(next);
+		}
+
+	public:
+		tlsf_offset_allocator(siz size, siz reserve_node_count = 128): _size(0)
+		{
+			_nodes.reserve(reserve_node_count);
+			_unused_nodes.reserve(reserve_node_count);
+			reset(size);
+		}
+
+		/*
+			forgets every allocation -- outstanding nodes must not be deallocated after this
+		*/
+		void reset(siz size)
+		{
+			_size = size;
+			_free_size = 0;
+			_free_block_count = 0;
+			_allocation_count = 0;
+			_fl_bitmap = 0;
+
+			for (ui32 i = 0; i < FL_COUNT; i++)
+				_sl_bitmaps[i] = 0;
+
+			for (ui32 i = 0; i < BIN_COUNT; i++)
+				_bins[i] = INVALID_NODE;
+
+			_nodes.clear();
+			_unused_nodes.clear();
+
+			if (_size > 0)
+			{
+				insert_free(create_node(0, _size));
+				_free_size = _size;
+			}
+		}
+
+		/*
+			alignment is not limited to powers of 2
+			any padding needed for alignment is split off and kept free, so allocation.offset is the aligned offset
+			a request that only an exact or already aligned block fits walks a few free lists, otherwise this is O(1)
+		*/
+		allocation allocate(siz size, siz alignment = 1)
+		{
+			allocation a{};
+			alignment = alignment == 0 ? 1 : alignment;
+
+			if (size == 0 || size > _free_size)
+				return a;
+
+			/*
+				any block in the bin found for size + alignment - 1 fits, but it skips blocks that only fit because
+				their offset is already aligned, or fit exactly -- those are found by walking the lists the search skipped
+			*/
+			ui32 index = INVALID_NODE;
+			if (alignment - 1 <= _size - size)
+			{
+				ui32 fl = 0, sl = 0;
+				map_search_bin(size + alignment - 1, fl, sl);
+				if (find_free_bin(fl, sl))
+					index = _bins[get_bin_index(fl, sl)];
+			}
+
+			if (index == INVALID_NODE)
+				index = find_fitting_node(size, alignment);
+
+			if (index == INVALID_NODE)
+				return a;
+
+			remove_free(index);
+
+			const siz padding = calc_padding(_nodes[index].offset, alignment);
+			if (padding > 0)
+				insert_free(split_front(index, padding));
+
+			if (_nodes[index].size > size)
+			{
+				const ui32 used = split_front(index, size);
+				insert_free(index);
+				index = used;
+			}
+
+			node& n = _nodes[index];
+			n.used = true;
+			_free_size -= n.size;
+			_allocation_count++;
+
+			a.offset = n.offset;
+			a.size = n.size;
+			a.node = index;
+			return a;
+		}
+
+		bl deallocate(ui32 index)
+		{
+			if (index >= _nodes.size() || !_nodes[index].used)
+				return false;
+
+			_free_size += _nodes[index].size;
+			_allocation_count--;
+			_nodes[index].used = false;
+
+			const ui32 prev = _nodes[index].prev_physical;
+			if (prev != INVALID_NODE && !_nodes[prev].used)
+			{
+				remove_free(prev);
+				merge_next(prev);
+				index = prev;
+			}
+
+			const ui32 next = _nodes[index].next_physical;
+			if (next != INVALID_NODE && !_nodes[next].used)
+			{
+				remove_free(next);
+				merge_next(index);
+			}
+
+			insert_free(index);
+			return true;
+		}
+
+		bl deallocate(allocation& a)
+		{
+			const bl deallocated = deallocate(a.node);
+			if (deallocated)
+				a = {};
+			return deallocated;
+		}
+
+		siz get_size() const
+		{
+			return _size;
+		}
+
+		siz get_free_size() const
+		{
+			return _free_size;
+		}
+
+		siz get_allocation_count() const
+		{
+			return _allocation_count;
+		}
+
+		/*
+			the largest free block always lives in the highest non-empty bin, so only that one list is walked
+		*/
+		siz get_largest_free_size() const
+		{
+			siz largest = 0;
+			if (_fl_bitmap)
+			{
+				const ui32 fl = __detail::find_last_set(_fl_bitmap);
+				const ui32 sl = __detail::find_last_set(_sl_bitmaps[fl]);
+				for (ui32 i = _bins[get_bin_index(fl, sl)]; i != INVALID_NODE; i = _nodes[i].next_free)
+					largest = ::std::max(largest, _nodes[i].size);
+			}
+			return largest;
+		}
+
+		stats get_stats() const
+		{
+			stats s{};
+			s.size = _size;
+			s.free_size = _free_size;
+			s.largest_free_size = get_largest_free_size();
+			s.free_block_count = _free_block_count;
+			s.allocation_count = _allocation_count;
+			return s;
+		}
+	};
+} // namespace np::mem
+
+#endif /* NP_ENGINE_MEM_TLSF_OFFSET_ALLOCATOR_HPP */
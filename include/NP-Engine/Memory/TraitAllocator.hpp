@@ -9,6 +9,7 @@
 
 #include "NP-Engine/Foundation/Foundation.hpp"
 #include "NP-Engine/Primitive/Primitive.hpp"
+#include "NP-Engine/Insight/Metrics.hpp"
 
 #include "Allocator.hpp"
 #include "CAllocator.hpp"
@@ -29,6 +30,36 @@ namespace np::mem
 			NP_ENGINE_ASSERT(expected, "trait_allocator's registration is nullptr when it should not be");
 		}
 
+		static nsit::metric_counter& get_allocation_counter()
+		{
+			static nsit::metric_counter& counter =
+				nsit::metrics::get_counter("np_mem_trait_allocations_total", "allocations made through trait_allocator");
+			return counter;
+		}
+
+		static nsit::metric_counter& get_allocated_bytes_counter()
+		{
+			static nsit::metric_counter& counter =
+				nsit::metrics::get_counter("np_mem_trait_allocated_bytes_total", "bytes allocated through trait_allocator");
+			return counter;
+		}
+
+		static nsit::metric_counter& get_deallocation_counter()
+		{
+			static nsit::metric_counter& counter =
+				nsit::metrics::get_counter("np_mem_trait_deallocations_total", "deallocations made through trait_allocator");
+			return counter;
+		}
+
+		static void record_allocation(const block& b)
+		{
+			if (b.is_valid())
+			{
+				get_allocation_counter().increment();
+				get_allocated_bytes_counter().add(b.size);
+			}
+		}
+
 	public:
 		virtual ~trait_allocator() = default;
 
@@ -46,19 +77,25 @@ namespace np::mem
 		virtual block allocate(siz size, siz alignment) override
 		{
 			ensure_registration();
-			return _registered_allocator.load(mo_acquire)->allocate(size, alignment);
+			block b = _registered_allocator.load(mo_acquire)->allocate(size, alignment);
+			record_allocation(b);
+			return b;
 		}
 
 		virtual block reallocate(block& b, siz size, siz alignment) override
 		{
 			ensure_registration();
-			return _registered_allocator.load(mo_acquire)->reallocate(b, size, alignment);
+			block reallocated = _registered_allocator.load(mo_acquire)->reallocate(b, size, alignment);
+			record_allocation(reallocated);
+			return reallocated;
 		}
 
 		virtual block reallocate(void* ptr, siz size, siz alignment) override
 		{
 			ensure_registration();
-			return _registered_allocator.load(mo_acquire)->reallocate(ptr, size, alignment);
+			block reallocated = _registered_allocator.load(mo_acquire)->reallocate(ptr, size, alignment);
+			record_allocation(reallocated);
+			return reallocated;
 		}
 
 		virtual bl deallocate(block& b) override
@@ -69,25 +106,33 @@ namespace np::mem
 		virtual bl deallocate(void* ptr) override
 		{
 			ensure_registration();
-			return _registered_allocator.load(mo_acquire)->deallocate(ptr);
+			bl deallocated = _registered_allocator.load(mo_acquire)->deallocate(ptr);
+			if (deallocated)
+				get_deallocation_counter().increment();
+			return deallocated;
 		}
 
 		static inline void* realloc(void* ptr, siz size, siz alignment)
 		{
 			ensure_registration();
-			return _registered_allocator.load(mo_acquire)->reallocate(ptr, size, alignment).ptr;
+			block b = _registered_allocator.load(mo_acquire)->reallocate(ptr, size, alignment);
+			record_allocation(b);
+			return b.ptr;
 		}
 
 		static inline void* malloc(siz size, siz alignment)
 		{
 			ensure_registration();
-			return _registered_allocator.load(mo_acquire)->allocate(size, alignment).ptr;
+			block b = _registered_allocator.load(mo_acquire)->allocate(size, alignment);
+			record_allocation(b);
+			return b.ptr;
 		}
 
 		static inline void free(void* ptr)
 		{
 			ensure_registration();
-			_registered_allocator.load(mo_acquire)->deallocate(ptr);
+			if (_registered_allocator.load(mo_acquire)->deallocate(ptr))
+				get_deallocation_counter().increment();
 		}
 
 		static inline void register_allocator(allocator& a)
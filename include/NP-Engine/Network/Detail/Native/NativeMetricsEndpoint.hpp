@@ -0,0 +1,196 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#ifndef NP_ENGINE_NETWORK_NATIVE_METRICS_ENDPOINT_HPP
+#define NP_ENGINE_NETWORK_NATIVE_METRICS_ENDPOINT_HPP
+
+#include <cstring>
+#include <string>
+
+#include "NP-Engine/Foundation/Foundation.hpp"
+#include "NP-Engine/Primitive/Primitive.hpp"
+#include "NP-Engine/Thread/Thread.hpp"
+#include "NP-Engine/Insight/Insight.hpp"
+
+#include "NP-Engine/Network/Interface/Interface.hpp"
+
+#include "NativeNetworkInclude.hpp"
+
+namespace np::net::__detail
+{
+	/*
+		talks to raw sockets instead of going through Socket -- Accept would announce every scrape as a
+		NetworkClientEvent, and receiving jobs would outlive the short connections we hand out here
+	*/
+	class NativeMetricsEndpoint : public MetricsEndpoint
+	{
+	protected:
+		constexpr static siz REQUEST_SIZE = 2048;
+
+		ui64 _socket;
+		atm_bl _running;
+		thr::thread _thread;
+
+		static void CloseSocket(ui64 s)
+		{
+			shutdown(s, SD_BOTH);
+#if NP_ENGINE_PLATFORM_IS_WINDOWS
+			closesocket(s);
+#elif NP_ENGINE_PLATFORM_IS_LINUX
+			close(s);
+#else
+	#error implement native networking
+#endif
+		}
+
+		static void SetReceiveTimeout(ui64 s, tim::milliseconds timeout)
+		{
+#if NP_ENGINE_PLATFORM_IS_WINDOWS
+			DWORD value = (DWORD)timeout.count();
+			setsockopt(s, SOL_SOCKET, SO_RCVTIMEO, (chr*)&value, sizeof(DWORD));
+#elif NP_ENGINE_PLATFORM_IS_LINUX
+			timeval value{};
+			value.tv_sec = (i64)timeout.count() / 1000;
+			value.tv_usec = ((i64)timeout.count() % 1000) * 1000;
+			setsockopt(s, SOL_SOCKET, SO_RCVTIMEO, (chr*)&value, sizeof(timeval));
+#else
+	#error implement native networking
+#endif
+		}
+
+		static void SendAll(ui64 s, const ::std::string& bytes)
+		{
+			for (siz total = 0; total < bytes.size();)
+			{
+				i32 sent = send(s, bytes.data() + total, bytes.size() - total, 0);
+				if (sent <= 0)
+					break;
+				total += sent;
+			}
+		}
+
+		/*
+			we only care about the request line, but we read through the end of the headers so closing does not reset
+			the connection on the scraper before it reads our response
+		*/
+		static void Respond(ui64 client)
+		{
+			chr request[REQUEST_SIZE]{};
+			siz size = 0;
+
+			SetReceiveTimeout(client, tim::milliseconds(NP_ENGINE_NETWORK_METRICS_ENDPOINT_REQUEST_TIMEOUT));
+			while (size < REQUEST_SIZE - 1 && !::std::strstr(request, "\r\n\r\n"))
+			{
+				i32 recvd = recv(client, request + size, REQUEST_SIZE - 1 - size, 0);
+				if (recvd <= 0)
+					break;
+				size += recvd;
+			}
+
+			::std::string response;
+			if (::std::strncmp(request, "GET ", 4) == 0)
+			{
+				const ::std::string body = nsit::metrics::scrape();
+				response = "HTTP/1.1 200 OK\r\n"
+						   "Content-Type: text/plain; version=0.0.4; charset=utf-8\r\n"
+						   "Content-Length: " +
+					::std::to_string(body.size()) + "\r\nConnection: close\r\n\r\n" + body;
+			}
+			else
+			{
+				response = "HTTP/1.1 405 Method Not Allowed\r\nAllow: GET\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+			}
+
+			SendAll(client, response);
+		}
+
+		static void ServeProcedure(NativeMetricsEndpoint* self, ui64 listener)
+		{
+			while (self->_running.load(mo_acquire))
+			{
+				ui64 client = accept(listener, nullptr, nullptr);
+				if (client == INVALID_SOCKET)
+				{
+					// Stop shuts the listener down to get us out of accept
+					if (self->_running.load(mo_acquire))
+						thr::this_thread::yield();
+					continue;
+				}
+
+				Respond(client);
+				CloseSocket(client);
+			}
+		}
+
+	public:
+		NativeMetricsEndpoint(mem::sptr<Context> context):
+			MetricsEndpoint(context),
+			_socket(INVALID_SOCKET),
+			_running(false)
+		{}
+
+		virtual ~NativeMetricsEndpoint()
+		{
+			Stop();
+		}
+
+		virtual bl Start(const Ip& ip, ui16 port) override
+		{
+			Stop();
+
+			sockaddr_in saddrin4{};
+			sockaddr_in6 saddrin6{};
+			auto saddrin = ToSaddrin(ip, port, saddrin4, saddrin6);
+
+			_socket = socket(saddrin.first ? saddrin.first->sa_family : AF_INET, SOCK_STREAM, IPPROTO_TCP);
+			if (_socket != INVALID_SOCKET)
+			{
+				bl enable = true;
+				setsockopt(_socket, SOL_SOCKET, SO_REUSEADDR, (chr*)&enable, sizeof(bl));
+
+				if (!saddrin.first || bind(_socket, saddrin.first, saddrin.second) || listen(_socket, SOMAXCONN))
+				{
+					// NP_ENGINE_LOG_ERROR("MetricsEndpoint failed to listen on port " + to_str(port));
+					CloseSocket(_socket);
+					_socket = INVALID_SOCKET;
+				}
+			}
+
+			if (_socket != INVALID_SOCKET)
+			{
+				_running.store(true, mo_release);
+				_thread.run(ServeProcedure, this, _socket);
+			}
+
+			return IsRunning();
+		}
+
+		virtual void Stop() override
+		{
+			if (_running.exchange(false, mo_acq_rel))
+			{
+				shutdown(_socket, SD_BOTH);
+#if NP_ENGINE_PLATFORM_IS_WINDOWS
+				closesocket(_socket); // winsock only leaves accept once the socket is closed
+				_thread.join();
+#elif NP_ENGINE_PLATFORM_IS_LINUX
+				_thread.join();
+				close(_socket);
+#else
+	#error implement native networking
+#endif
+				_socket = INVALID_SOCKET;
+			}
+		}
+
+		virtual bl IsRunning() const override
+		{
+			return _running.load(mo_acquire);
+		}
+	};
+} // namespace np::net::__detail
+
+#endif /* NP_ENGINE_NETWORK_NATIVE_METRICS_ENDPOINT_HPP */
@@ -17,10 +17,8 @@ namespace np::net::__detail
 {
 	class NativeResolver : public Resolver
 	{
-	public:
-		NativeResolver(mem::sptr<Context> context): Resolver(context) {}
-
-		virtual Host GetHost(str name) override
+	protected:
+		virtual Host DetailGetHost(str name) override
 		{
 			Host host;
 			host.name = name;
@@ -32,7 +30,8 @@ namespace np::net::__detail
 			i32 err = getaddrinfo(host.name.c_str(), nullptr, &hints, &info);
 			if (!err)
 			{
-				host.name = info->ai_canonname;
+				if (info->ai_canonname)
+					host.name = info->ai_canonname;
 				for (addrinfo* it = info; it; it = it->ai_next)
 				{
 					switch (it->ai_family)
@@ -59,7 +58,7 @@ namespace np::net::__detail
 			return host;
 		}
 
-		virtual Host GetHost(const Ip& ip) override
+		virtual Host DetailGetHost(const Ip& ip) override
 		{
 			sockaddr_in saddrin4{};
 			sockaddr_in6 saddrin6{};
@@ -74,6 +73,9 @@ namespace np::net::__detail
 			host.aliases.emplace(host.name);
 			return host;
 		}
+
+	public:
+		NativeResolver(mem::sptr<Context> context): Resolver(context) {}
 	};
 } // namespace np::net::__detail
 
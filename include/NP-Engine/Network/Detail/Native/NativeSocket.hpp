@@ -39,6 +39,7 @@ namespace np::net::__detail
 					break;
 				}
 				total += sent;
+				GetBytesSentCounter().add(sent);
 			}
 		}
 
@@ -58,6 +59,7 @@ namespace np::net::__detail
 					break;
 				}
 				total += sent;
+				GetBytesSentCounter().add(sent);
 			}
 		}
 
@@ -87,6 +89,7 @@ namespace np::net::__detail
 					break;
 				}
 				total += recvd;
+				GetBytesReceivedCounter().add(recvd);
 
 				if (direct_mode)
 					break;
@@ -186,6 +189,7 @@ namespace np::net::__detail
 			if (msg)
 			{
 				self._inbox.Push(msg);
+				GetMessagesReceivedCounter().increment();
 				if (self._keep_receiving.load(mo_acquire))
 					self.SubmitReceivingJob();
 			}
@@ -207,6 +211,7 @@ namespace np::net::__detail
 	public:
 		NativeSocket(mem::sptr<Context> context):
 			Socket(context),
+			_socket(INVALID_SOCKET),
 			_protocol(Protocol::None),
 			_keep_receiving(false),
 			_direct_mode(false)
@@ -258,6 +263,7 @@ namespace np::net::__detail
 					_socket = INVALID_SOCKET;
 				}
 			}
+			GetOpenGauge().increment();
 
 			for (ui64 r : rejections)
 			{
@@ -277,6 +283,7 @@ namespace np::net::__detail
 
 			if (IsOpen())
 			{
+				GetOpenGauge().decrement();
 				shutdown(_socket, SD_BOTH);
 #if NP_ENGINE_PLATFORM_IS_WINDOWS
 				closesocket(_socket);
@@ -387,6 +394,8 @@ namespace np::net::__detail
 					NativeSocket& native_client = (NativeSocket&)*client;
 					native_client._socket = accept(_socket, (sockaddr*)&saddrin, &saddrin_size);
 					native_client._protocol = Protocol::Tcp;
+					if (native_client)
+						GetOpenGauge().increment();
 
 					if (enable_client_resolution && native_client)
 					{
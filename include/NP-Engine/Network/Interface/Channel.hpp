@@ -0,0 +1,315 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+/*
+	Reference:
+		- <https://gafferongames.com/post/reliable_ordered_messages/>
+		- <https://gafferongames.com/post/packet_fragmentation_and_reassembly/>
+		- <https://datatracker.ietf.org/doc/html/rfc6298>
+		- <https://datatracker.ietf.org/doc/html/rfc5681>
+*/
+
+#ifndef NP_ENGINE_NETWORK_INTERFACE_CHANNEL_HPP
+#define NP_ENGINE_NETWORK_INTERFACE_CHANNEL_HPP
+
+#ifndef NP_ENGINE_NETWORK_CHANNEL_PROTOCOL_ID
+	#define NP_ENGINE_NETWORK_CHANNEL_PROTOCOL_ID 0x4E50524C // "NPRL"
+#endif
+
+#ifndef NP_ENGINE_NETWORK_CHANNEL_FRAGMENT_SIZE
+	#define NP_ENGINE_NETWORK_CHANNEL_FRAGMENT_SIZE 1024
+#endif
+
+#include "NP-Engine/Primitive/Primitive.hpp"
+#include "NP-Engine/Time/Time.hpp"
+
+#include "Message.hpp"
+
+namespace np::net
+{
+	enum class ChannelType : ui32
+	{
+		None = 0,
+		Unreliable,
+		ReliableUnordered,
+		ReliableOrdered,
+
+		Max
+	};
+
+	static inline bl IsReliable(ChannelType type)
+	{
+		return type == ChannelType::ReliableUnordered || type == ChannelType::ReliableOrdered;
+	}
+
+	NP_ENGINE_STATIC_ASSERT((siz)MessageType::Max <= UI8_MAX, "MessageType must fit the channel header's ui8 wire field");
+
+	/*
+		every datagram our channels send starts with this header
+		one datagram holds one fragment of one message, so messages larger than a fragment are split across datagrams
+		on the wire each field is written in network byte order, back to back, with type as a ui8 -- see Write and Read
+	*/
+	struct ChannelPacketHeader
+	{
+		constexpr static ui8 AckOnlyFlag = BIT(0);
+		constexpr static ui8 HasAckFlag = BIT(1); // set once the sender has received something to ack
+
+		constexpr static siz WIRE_SIZE = sizeof(ui32) + sizeof(ui16) + sizeof(ui16) + sizeof(ui32) + sizeof(ui32) +
+			sizeof(ui32) + sizeof(ui16) + sizeof(ui16) + sizeof(ui8) + sizeof(ui8) + sizeof(ui8);
+
+		ui32 protocolId = NP_ENGINE_NETWORK_CHANNEL_PROTOCOL_ID;
+		ui16 sequence = 0;
+		ui16 ack = 0;
+		ui32 ackBits = 0; // bit i acknowledges (ack - 1 - i)
+		ui32 messageId = 0;
+		ui32 bodySize = 0; // size of the whole message body, not this fragment
+		ui16 fragmentIndex = 0;
+		ui16 fragmentCount = 0;
+		MessageType type = MessageType::None;
+		ui8 channel = 0;
+		ui8 flags = 0;
+
+		bl IsValid() const
+		{
+			return protocolId == NP_ENGINE_NETWORK_CHANNEL_PROTOCOL_ID;
+		}
+
+		bl IsAckOnly() const
+		{
+			return flags & AckOnlyFlag;
+		}
+
+		bl HasAck() const
+		{
+			return flags & HasAckFlag;
+		}
+
+		/*
+			writes WIRE_SIZE bytes
+		*/
+		void Write(ui8* bytes) const
+		{
+			bytes = WriteField(bytes, protocolId);
+			bytes = WriteField(bytes, sequence);
+			bytes = WriteField(bytes, ack);
+			bytes = WriteField(bytes, ackBits);
+			bytes = WriteField(bytes, messageId);
+			bytes = WriteField(bytes, bodySize);
+			bytes = WriteField(bytes, fragmentIndex);
+			bytes = WriteField(bytes, fragmentCount);
+			bytes = WriteField(bytes, (ui8)type);
+			bytes = WriteField(bytes, channel);
+			WriteField(bytes, flags);
+		}
+
+		/*
+			reads WIRE_SIZE bytes, returns false if they do not hold one of our headers
+		*/
+		bl Read(const ui8* bytes)
+		{
+			ui8 wire_type = 0;
+			bytes = ReadField(bytes, protocolId);
+			bytes = ReadField(bytes, sequence);
+			bytes = ReadField(bytes, ack);
+			bytes = ReadField(bytes, ackBits);
+			bytes = ReadField(bytes, messageId);
+			bytes = ReadField(bytes, bodySize);
+			bytes = ReadField(bytes, fragmentIndex);
+			bytes = ReadField(bytes, fragmentCount);
+			bytes = ReadField(bytes, wire_type);
+			bytes = ReadField(bytes, channel);
+			ReadField(bytes, flags);
+
+			type = wire_type < (ui8)MessageType::Max ? (MessageType)wire_type : MessageType::None;
+			return IsValid() && wire_type < (ui8)MessageType::Max;
+		}
+
+	private:
+		template <typename T>
+		static ui8* WriteField(ui8* bytes, T value)
+		{
+			for (siz i = 0; i < sizeof(T); i++)
+				bytes[i] = (ui8)(value >> ((sizeof(T) - 1 - i) * 8)); // most significant byte first
+			return bytes + sizeof(T);
+		}
+
+		template <typename T>
+		static const ui8* ReadField(const ui8* bytes, T& value)
+		{
+			value = 0;
+			for (siz i = 0; i < sizeof(T); i++)
+				value = (T)((value << 8) | bytes[i]);
+			return bytes + sizeof(T);
+		}
+	};
+
+	/*
+		sequences one header acknowledges -- its ack and one for each of its ackBits
+	*/
+	constexpr static siz CHANNEL_ACK_COVERAGE = 1 + sizeof(ChannelPacketHeader::ackBits) * 8;
+
+	constexpr static siz CHANNEL_MAX_FRAGMENT_COUNT =
+		(NP_ENGINE_NETWORK_MAX_MESSAGE_BODY_SIZE + NP_ENGINE_NETWORK_CHANNEL_FRAGMENT_SIZE - 1) /
+		NP_ENGINE_NETWORK_CHANNEL_FRAGMENT_SIZE;
+
+	NP_ENGINE_STATIC_ASSERT(CHANNEL_MAX_FRAGMENT_COUNT <= UI16_MAX,
+							"NP_ENGINE_NETWORK_CHANNEL_FRAGMENT_SIZE is too small for NP_ENGINE_NETWORK_MAX_MESSAGE_BODY_SIZE");
+
+	/*
+		returns true when sequence a is more recent than b, accounting for wrap around
+	*/
+	static inline bl IsSequenceGreater(ui16 a, ui16 b)
+	{
+		return ((a > b) && (a - b <= 32768)) || ((a < b) && (b - a > 32768));
+	}
+
+	/*
+		smoothed round trip time and retransmission timeout as described in rfc6298
+	*/
+	class RoundTripEstimator
+	{
+	public:
+		constexpr static dbl INITIAL_TIMEOUT_MS = 250.0;
+		constexpr static dbl MIN_TIMEOUT_MS = 50.0;
+		constexpr static dbl MAX_TIMEOUT_MS = 2000.0;
+
+	protected:
+		bl _has_sample;
+		dbl _smoothed_ms;
+		dbl _variance_ms;
+		dbl _timeout_ms;
+
+	public:
+		RoundTripEstimator()
+		{
+			Reset();
+		}
+
+		void Reset()
+		{
+			_has_sample = false;
+			_smoothed_ms = 0.0;
+			_variance_ms = 0.0;
+			_timeout_ms = INITIAL_TIMEOUT_MS;
+		}
+
+		void AddSample(tim::milliseconds sample)
+		{
+			const dbl sample_ms = sample.count();
+			if (!_has_sample)
+			{
+				_has_sample = true;
+				_smoothed_ms = sample_ms;
+				_variance_ms = sample_ms / 2.0;
+			}
+			else
+			{
+				_variance_ms = 0.75 * _variance_ms + 0.25 * ::std::abs(_smoothed_ms - sample_ms);
+				_smoothed_ms = 0.875 * _smoothed_ms + 0.125 * sample_ms;
+			}
+
+			_timeout_ms = ::std::clamp(_smoothed_ms + 4.0 * _variance_ms, MIN_TIMEOUT_MS, MAX_TIMEOUT_MS);
+		}
+
+		/*
+			exponential backoff after a retransmission timeout
+		*/
+		void Backoff()
+		{
+			_timeout_ms = ::std::min(_timeout_ms * 2.0, MAX_TIMEOUT_MS);
+		}
+
+		tim::milliseconds GetSmoothed() const
+		{
+			return tim::milliseconds(_smoothed_ms);
+		}
+
+		tim::milliseconds GetVariance() const
+		{
+			return tim::milliseconds(_variance_ms);
+		}
+
+		tim::milliseconds GetTimeout() const
+		{
+			return tim::milliseconds(_timeout_ms);
+		}
+	};
+
+	/*
+		packet-based AIMD congestion window with slow start, as described in rfc5681
+		only reliable fragments are held back by the window, and never more than one ack can cover
+	*/
+	class CongestionWindow
+	{
+	public:
+		constexpr static dbl INITIAL_WINDOW = 16.0;
+		constexpr static dbl MIN_WINDOW = 2.0;
+		constexpr static dbl MAX_WINDOW = (dbl)CHANNEL_ACK_COVERAGE;
+
+	protected:
+		dbl _window;
+		dbl _threshold;
+		tim::steady_timestamp _recovery_timestamp;
+
+	public:
+		CongestionWindow()
+		{
+			Reset();
+		}
+
+		void Reset()
+		{
+			_window = INITIAL_WINDOW;
+			_threshold = MAX_WINDOW;
+			_recovery_timestamp = tim::steady_clock::now();
+		}
+
+		void OnAck()
+		{
+			if (_window < _threshold)
+				_window += 1.0; // slow start
+			else
+				_window += 1.0 / _window; // congestion avoidance
+
+			_window = ::std::min(_window, MAX_WINDOW);
+		}
+
+		/*
+			we only cut the window once per round trip so a burst of losses does not collapse it
+		*/
+		void OnLoss(tim::steady_timestamp now, tim::milliseconds round_trip)
+		{
+			if (now >= _recovery_timestamp)
+			{
+				_threshold = ::std::max(_window / 2.0, MIN_WINDOW);
+				_window = _threshold;
+				_recovery_timestamp = now + tim::duration_cast<tim::steady_clock::duration>(round_trip);
+			}
+		}
+
+		siz GetWindow() const
+		{
+			return (siz)_window;
+		}
+	};
+
+	/*
+		used to simulate poor network conditions on the sending side of a connection -- great for testing on loopback
+		chances are within [0, 1]
+	*/
+	struct ChannelConditions
+	{
+		dbl lossChance = 0.0;
+		dbl reorderChance = 0.0;
+
+		bl IsIdeal() const
+		{
+			return lossChance <= 0.0 && reorderChance <= 0.0;
+		}
+	};
+} // namespace np::net
+
+#endif /* NP_ENGINE_NETWORK_INTERFACE_CHANNEL_HPP */
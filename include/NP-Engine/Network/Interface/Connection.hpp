@@ -0,0 +1,752 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#ifndef NP_ENGINE_NETWORK_INTERFACE_CONNECTION_HPP
+#define NP_ENGINE_NETWORK_INTERFACE_CONNECTION_HPP
+
+#ifndef NP_ENGINE_NETWORK_CHANNEL_SEQUENCE_BUFFER_SIZE
+	#define NP_ENGINE_NETWORK_CHANNEL_SEQUENCE_BUFFER_SIZE 1024
+#endif
+
+#ifndef NP_ENGINE_NETWORK_CHANNEL_MAX_RESENDS
+	#define NP_ENGINE_NETWORK_CHANNEL_MAX_RESENDS 16
+#endif
+
+#ifndef NP_ENGINE_NETWORK_CHANNEL_REASSEMBLY_TIMEOUT
+	#define NP_ENGINE_NETWORK_CHANNEL_REASSEMBLY_TIMEOUT 1000
+#endif
+
+// reliable messages a channel sends or takes past its oldest unacknowledged or undelivered one
+#ifndef NP_ENGINE_NETWORK_CHANNEL_MESSAGE_WINDOW
+	#define NP_ENGINE_NETWORK_CHANNEL_MESSAGE_WINDOW 64
+#endif
+
+// sequences acked after an in flight fragment before we call it lost without waiting on its timeout
+#ifndef NP_ENGINE_NETWORK_CHANNEL_LOSS_THRESHOLD
+	#define NP_ENGINE_NETWORK_CHANNEL_LOSS_THRESHOLD 3
+#endif
+
+// updates that send our acks again after we receive, so one lost ack does not leave the sender waiting on a timeout
+#ifndef NP_ENGINE_NETWORK_CHANNEL_ACK_REPEATS
+	#define NP_ENGINE_NETWORK_CHANNEL_ACK_REPEATS 2
+#endif
+
+// unreliable messages a channel reassembles at once
+#ifndef NP_ENGINE_NETWORK_CHANNEL_MAX_REASSEMBLIES
+	#define NP_ENGINE_NETWORK_CHANNEL_MAX_REASSEMBLIES 64
+#endif
+
+#include "NP-Engine/Primitive/Primitive.hpp"
+#include "NP-Engine/Memory/Memory.hpp"
+#include "NP-Engine/Container/Container.hpp"
+#include "NP-Engine/Time/Time.hpp"
+#include "NP-Engine/Random/Random.hpp"
+
+#include "Channel.hpp"
+#include "Message.hpp"
+#include "MessageQueue.hpp"
+#include "Socket.hpp"
+
+namespace np::net
+{
+	struct ConnectionStats
+	{
+		siz sentPackets = 0;
+		siz receivedPackets = 0;
+		siz resentPackets = 0;
+		siz ackedPackets = 0;
+		siz droppedPackets = 0; // dropped by ChannelConditions
+		siz invalidPackets = 0;
+		siz inFlight = 0;
+		siz window = 0;
+		tim::milliseconds roundTrip{0};
+		tim::milliseconds timeout{0};
+	};
+
+	/*
+		reliable-udp layered over a connected udp socket
+		each channel is either unreliable, reliable-unordered, or reliable-ordered
+		messages are fragmented into NP_ENGINE_NETWORK_CHANNEL_FRAGMENT_SIZE pieces and reassembled on the other end
+		every datagram carries selective acks for the last CHANNEL_ACK_COVERAGE sequences received, which drives rtt
+		estimation, retransmission of reliable fragments, and the congestion window -- the window never exceeds what one ack
+		covers, and we ack early when a burst would slide a sequence out of that coverage
+		a reliable fragment is resent once its timeout passes or NP_ENGINE_NETWORK_CHANNEL_LOSS_THRESHOLD later sequences are
+		acked, whichever is first
+		reliable channels only keep NP_ENGINE_NETWORK_CHANNEL_MESSAGE_WINDOW messages between sender and receiver, so a peer
+		cannot grow our held, delivered, or reassembly maps without bound
+
+		Send and GetInbox are thread safe -- everything else is expected to be called from the thread calling Update
+	*/
+	class Connection
+	{
+	protected:
+		constexpr static ui64 INVALID_KEY = UI64_MAX;
+
+		struct SentPacket
+		{
+			ui32 sequence = UI32_MAX;
+			ui64 key = INVALID_KEY;
+			tim::steady_timestamp timestamp;
+			bl acked = true;
+		};
+
+		struct PendingFragment
+		{
+			ChannelPacketHeader header;
+			con::vector<ui8> data;
+			tim::steady_timestamp timestamp;
+			ui16 sequence = 0;
+			ui32 resends = 0;
+			bl inFlight = false;
+		};
+
+		struct Reassembly
+		{
+			Message msg;
+			con::vector<bl> received;
+			siz receivedCount = 0;
+			tim::steady_timestamp timestamp;
+		};
+
+		struct ChannelState
+		{
+			ChannelType type = ChannelType::None;
+			ui32 nextMessageId = 0;
+			ui32 nextDeliverId = 0; // reliable ordered
+			ui32 deliveredFloor = 0; // reliable unordered
+			con::uset<ui32> delivered; // reliable unordered, everything above the floor
+			con::omap<ui32, Message> held; // reliable ordered, waiting on an earlier message
+			con::umap<ui32, Reassembly> reassemblies;
+			con::omap<ui32, siz> unacked; // reliable, fragments each message we sent still waits on
+			MessageQueue inbox;
+		};
+
+		using Outgoing = ::std::pair<ui8, Message>;
+
+		mem::sptr<Socket> _socket;
+		con::vector<mem::sptr<ChannelState>> _channels;
+		mutexed_wrapper<con::queue<Outgoing>> _outbox;
+
+		ui16 _local_sequence;
+		ui16 _remote_sequence;
+		bl _has_remote_sequence;
+		bl _ack_pending;
+		ui16 _ack_floor; // oldest sequence received since our last ack
+		ui32 _ack_repeats;
+		ui16 _largest_acked;
+		bl _has_largest_acked;
+		con::array<SentPacket, NP_ENGINE_NETWORK_CHANNEL_SEQUENCE_BUFFER_SIZE> _sent;
+		con::array<ui32, NP_ENGINE_NETWORK_CHANNEL_SEQUENCE_BUFFER_SIZE> _received;
+
+		con::umap<ui64, PendingFragment> _pending;
+		con::deque<ui64> _send_queue;
+		con::deque<ui64> _resend_queue;
+		siz _in_flight;
+		bl _lost;
+
+		RoundTripEstimator _round_trip;
+		CongestionWindow _window;
+		ConnectionStats _stats;
+
+		ChannelConditions _conditions;
+		rng::Random32 _random;
+		con::vector<ui8> _datagram;
+		con::vector<ui8> _held_datagram;
+
+		static ui64 GetKey(ui32 message_id, ui8 channel, ui16 fragment_index)
+		{
+			return ((ui64)message_id << 24) | ((ui64)channel << 16) | (ui64)fragment_index;
+		}
+
+		static ui32 GetKeyMessageId(ui64 key)
+		{
+			return (ui32)(key >> 24);
+		}
+
+		static ui8 GetKeyChannel(ui64 key)
+		{
+			return (ui8)(key >> 16);
+		}
+
+		static siz GetFragmentSize(const ChannelPacketHeader& header)
+		{
+			const siz offset = (siz)header.fragmentIndex * NP_ENGINE_NETWORK_CHANNEL_FRAGMENT_SIZE;
+			return offset < header.bodySize ? ::std::min((siz)header.bodySize - offset, (siz)NP_ENGINE_NETWORK_CHANNEL_FRAGMENT_SIZE)
+											: 0;
+		}
+
+		bl Roll(dbl chance)
+		{
+			return chance > 0.0 && _random.GetLemireWithinRange(1000000) < (ui32)(chance * 1000000.0);
+		}
+
+		void Transmit(con::vector<ui8>& datagram)
+		{
+			if (Roll(_conditions.lossChance))
+			{
+				_stats.droppedPackets++;
+			}
+			else if (_held_datagram.empty() && Roll(_conditions.reorderChance))
+			{
+				_held_datagram = datagram;
+			}
+			else
+			{
+				_socket->Send(datagram.data(), datagram.size());
+				FlushHeldDatagram();
+			}
+		}
+
+		void FlushHeldDatagram()
+		{
+			if (!_held_datagram.empty())
+			{
+				_socket->Send(_held_datagram.data(), _held_datagram.size());
+				_held_datagram.clear();
+			}
+		}
+
+		ui32 GetAckBits() const
+		{
+			ui32 bits = 0;
+			for (ui16 i = 0; i < CHANNEL_ACK_COVERAGE - 1; i++)
+			{
+				const ui16 sequence = _remote_sequence - 1 - i;
+				if (_received[sequence % NP_ENGINE_NETWORK_CHANNEL_SEQUENCE_BUFFER_SIZE] == sequence)
+					bits |= (ui32)BIT(i);
+			}
+			return bits;
+		}
+
+		void SetAck(ChannelPacketHeader& header)
+		{
+			if (_has_remote_sequence)
+			{
+				header.ack = _remote_sequence;
+				header.ackBits = GetAckBits();
+				header.flags |= ChannelPacketHeader::HasAckFlag;
+			}
+			_ack_pending = false;
+		}
+
+		void SendDatagram(ChannelPacketHeader header, const ui8* data, siz size, ui64 key)
+		{
+			const tim::steady_timestamp now = tim::steady_clock::now();
+			header.sequence = _local_sequence++;
+			SetAck(header);
+
+			SentPacket& sent = _sent[header.sequence % NP_ENGINE_NETWORK_CHANNEL_SEQUENCE_BUFFER_SIZE];
+			sent.sequence = header.sequence;
+			sent.key = key;
+			sent.timestamp = now;
+			sent.acked = false;
+
+			_datagram.resize(ChannelPacketHeader::WIRE_SIZE + size);
+			header.Write(_datagram.data());
+			if (size > 0)
+				mem::copy_bytes(_datagram.data() + ChannelPacketHeader::WIRE_SIZE, data, size);
+
+			_stats.sentPackets++;
+			Transmit(_datagram);
+		}
+
+		void SendAck()
+		{
+			ChannelPacketHeader header;
+			header.flags = ChannelPacketHeader::AckOnlyFlag;
+			SetAck(header);
+
+			_datagram.resize(ChannelPacketHeader::WIRE_SIZE);
+			header.Write(_datagram.data());
+			Transmit(_datagram);
+		}
+
+		void SendPending(ui64 key)
+		{
+			auto it = _pending.find(key);
+			if (it != _pending.end() && !it->second.inFlight)
+			{
+				PendingFragment& fragment = it->second;
+				fragment.inFlight = true;
+				fragment.timestamp = tim::steady_clock::now();
+				fragment.sequence = _local_sequence;
+				_in_flight++;
+				SendDatagram(fragment.header, fragment.data.data(), fragment.data.size(), key);
+			}
+		}
+
+		void Fragment(ui8 channel_index, Message& msg)
+		{
+			ChannelState& channel = *_channels[channel_index];
+			const siz body_size = msg.body ? msg.header.bodySize : 0;
+			const siz fragment_count =
+				::std::max(((siz)body_size + NP_ENGINE_NETWORK_CHANNEL_FRAGMENT_SIZE - 1) / NP_ENGINE_NETWORK_CHANNEL_FRAGMENT_SIZE,
+						   (siz)1);
+
+			ChannelPacketHeader header;
+			header.messageId = channel.nextMessageId++;
+			header.bodySize = (ui32)body_size;
+			header.fragmentCount = (ui16)fragment_count;
+			header.type = msg.header.type;
+			header.channel = channel_index;
+
+			const ui8* body = body_size > 0 ? (ui8*)msg.body->GetData() : nullptr;
+			for (siz i = 0; i < fragment_count; i++)
+			{
+				header.fragmentIndex = (ui16)i;
+				const ui8* data = body ? body + i * NP_ENGINE_NETWORK_CHANNEL_FRAGMENT_SIZE : nullptr;
+				const siz size = GetFragmentSize(header);
+
+				if (IsReliable(channel.type))
+				{
+					if (i == 0)
+						channel.unacked.emplace(header.messageId, fragment_count);
+
+					const ui64 key = GetKey(header.messageId, channel_index, header.fragmentIndex);
+					PendingFragment& fragment = _pending[key];
+					fragment.header = header;
+					fragment.data.assign(data, data + size);
+					_send_queue.emplace_back(key);
+				}
+				else
+				{
+					SendDatagram(header, data, size, INVALID_KEY);
+				}
+			}
+		}
+
+		void ProcessAck(ui16 sequence, tim::steady_timestamp now)
+		{
+			SentPacket& sent = _sent[sequence % NP_ENGINE_NETWORK_CHANNEL_SEQUENCE_BUFFER_SIZE];
+			if (sent.sequence == sequence && !sent.acked)
+			{
+				sent.acked = true;
+				_stats.ackedPackets++;
+				if (!_has_largest_acked || IsSequenceGreater(sequence, _largest_acked))
+				{
+					_largest_acked = sequence;
+					_has_largest_acked = true;
+				}
+
+				_round_trip.AddSample(tim::duration_cast<tim::milliseconds>(now - sent.timestamp));
+
+				auto it = sent.key != INVALID_KEY ? _pending.find(sent.key) : _pending.end();
+				if (it != _pending.end())
+				{
+					if (it->second.inFlight)
+						_in_flight--;
+					_pending.erase(it);
+					_window.OnAck();
+
+					con::omap<ui32, siz>& unacked = _channels[GetKeyChannel(sent.key)]->unacked;
+					auto message = unacked.find(GetKeyMessageId(sent.key));
+					if (message != unacked.end() && --message->second == 0)
+						unacked.erase(message);
+				}
+			}
+		}
+
+		void ProcessAcks(const ChannelPacketHeader& header, tim::steady_timestamp now)
+		{
+			ProcessAck(header.ack, now);
+			for (ui16 i = 0; i < CHANNEL_ACK_COVERAGE - 1; i++)
+				if (header.ackBits & (ui32)BIT(i))
+					ProcessAck(header.ack - 1 - i, now);
+		}
+
+		Message CreateMessage(MessageType type, siz body_size)
+		{
+			mem::allocator& allocator = _socket->GetServices()->GetAllocator();
+			Message msg;
+			msg.header.type = type;
+			msg.header.bodySize = body_size;
+
+			switch (type)
+			{
+			case MessageType::Text:
+				msg.body = mem::create_sptr<TextMessageBody>(allocator);
+				break;
+			case MessageType::Json:
+				msg.body = mem::create_sptr<JsonMessageBody>(allocator);
+				break;
+			default:
+				msg.body = mem::create_sptr<BlobMessageBody>(allocator);
+				break;
+			}
+
+			msg.body->SetSize(body_size);
+			return msg;
+		}
+
+		bl IsDuplicate(const ChannelState& channel, ui32 message_id) const
+		{
+			bl duplicate = false;
+			switch (channel.type)
+			{
+			case ChannelType::ReliableOrdered:
+				duplicate = message_id < channel.nextDeliverId || channel.held.count(message_id);
+				break;
+			case ChannelType::ReliableUnordered:
+				duplicate = message_id < channel.deliveredFloor || channel.delivered.count(message_id);
+				break;
+			default:
+				break;
+			}
+			return duplicate;
+		}
+
+		/*
+			false for fragments we will not take, so we do not ack them and a reliable sender resends them later
+			reliable channels take messages up to NP_ENGINE_NETWORK_CHANNEL_MESSAGE_WINDOW past their first undelivered one,
+			along with anything already delivered so its lost ack can be sent again
+		*/
+		bl CanReceive(const ChannelState& channel, const ChannelPacketHeader& header) const
+		{
+			bl can = true;
+			switch (channel.type)
+			{
+			case ChannelType::ReliableOrdered:
+				can = header.messageId < channel.nextDeliverId ||
+					header.messageId - channel.nextDeliverId < NP_ENGINE_NETWORK_CHANNEL_MESSAGE_WINDOW;
+				break;
+			case ChannelType::ReliableUnordered:
+				can = header.messageId < channel.deliveredFloor ||
+					header.messageId - channel.deliveredFloor < NP_ENGINE_NETWORK_CHANNEL_MESSAGE_WINDOW;
+				break;
+			default:
+				can = header.fragmentCount == 1 || channel.reassemblies.size() < NP_ENGINE_NETWORK_CHANNEL_MAX_REASSEMBLIES ||
+					channel.reassemblies.count(header.messageId);
+				break;
+			}
+			return can;
+		}
+
+		/*
+			a reliable message waits to be sent until the receiver is sure to take it
+		*/
+		bl CanSend(ui64 key) const
+		{
+			const ChannelState& channel = *_channels[GetKeyChannel(key)];
+			return channel.unacked.empty() ||
+				GetKeyMessageId(key) - channel.unacked.begin()->first < NP_ENGINE_NETWORK_CHANNEL_MESSAGE_WINDOW;
+		}
+
+		void Deliver(ChannelState& channel, ui32 message_id, Message& msg)
+		{
+			switch (channel.type)
+			{
+			case ChannelType::ReliableOrdered:
+				if (message_id == channel.nextDeliverId)
+				{
+					channel.inbox.Push(msg);
+					channel.nextDeliverId++;
+					for (auto it = channel.held.begin(); it != channel.held.end() && it->first == channel.nextDeliverId;
+						 it = channel.held.erase(it))
+					{
+						channel.inbox.Push(it->second);
+						channel.nextDeliverId++;
+					}
+				}
+				else
+				{
+					channel.held.emplace(message_id, msg);
+				}
+				break;
+
+			case ChannelType::ReliableUnordered:
+				channel.inbox.Push(msg);
+				channel.delivered.emplace(message_id);
+				for (auto it = channel.delivered.find(channel.deliveredFloor); it != channel.delivered.end();
+					 it = channel.delivered.find(channel.deliveredFloor))
+				{
+					channel.delivered.erase(it);
+					channel.deliveredFloor++;
+				}
+				break;
+
+			default:
+				channel.inbox.Push(msg);
+				break;
+			}
+		}
+
+		void ReceiveFragment(const ChannelPacketHeader& header, const ui8* data, siz size, tim::steady_timestamp now)
+		{
+			ChannelState& channel = *_channels[header.channel];
+			if (IsDuplicate(channel, header.messageId))
+				return;
+
+			auto it = channel.reassemblies.find(header.messageId);
+			if (it == channel.reassemblies.end())
+			{
+				it = channel.reassemblies.emplace(header.messageId, Reassembly{}).first;
+				Reassembly& reassembly = it->second;
+				reassembly.msg = CreateMessage(header.type, header.bodySize);
+				reassembly.received.resize(header.fragmentCount, false);
+				reassembly.timestamp = now;
+			}
+
+			Reassembly& reassembly = it->second;
+			if (reassembly.received.size() != header.fragmentCount ||
+				reassembly.msg.header.bodySize != header.bodySize || reassembly.received[header.fragmentIndex])
+				return;
+
+			if (size > 0)
+				mem::copy_bytes((ui8*)reassembly.msg.body->GetData() +
+									(siz)header.fragmentIndex * NP_ENGINE_NETWORK_CHANNEL_FRAGMENT_SIZE,
+								data, size);
+
+			reassembly.received[header.fragmentIndex] = true;
+			reassembly.receivedCount++;
+
+			if (reassembly.receivedCount == reassembly.received.size())
+			{
+				Message msg = reassembly.msg;
+				channel.reassemblies.erase(it);
+				Deliver(channel, header.messageId, msg);
+			}
+		}
+
+		void ReceiveDatagram(Message& datagram, tim::steady_timestamp now)
+		{
+			ChannelPacketHeader header;
+			const siz datagram_size = datagram.body ? datagram.header.bodySize : 0;
+			bl valid = datagram_size >= ChannelPacketHeader::WIRE_SIZE &&
+				header.Read((const ui8*)datagram.body->GetData());
+
+			if (valid && !header.IsAckOnly())
+				valid = header.channel < _channels.size() && header.fragmentIndex < header.fragmentCount &&
+					header.fragmentCount <= CHANNEL_MAX_FRAGMENT_COUNT &&
+					header.bodySize <= NP_ENGINE_NETWORK_MAX_MESSAGE_BODY_SIZE &&
+					datagram_size - ChannelPacketHeader::WIRE_SIZE == GetFragmentSize(header);
+
+			if (!valid)
+			{
+				_stats.invalidPackets++;
+				return;
+			}
+
+			_stats.receivedPackets++;
+			if (header.HasAck())
+				ProcessAcks(header, now);
+
+			if (!header.IsAckOnly() && CanReceive(*_channels[header.channel], header))
+			{
+				// ack what we have before this sequence slides one we have not acked out of what an ack covers
+				if (_ack_pending && IsSequenceGreater(header.sequence, (ui16)(_ack_floor + CHANNEL_ACK_COVERAGE - 1)))
+					SendAck();
+
+				if (!_ack_pending || IsSequenceGreater(_ack_floor, header.sequence))
+					_ack_floor = header.sequence;
+
+				_received[header.sequence % NP_ENGINE_NETWORK_CHANNEL_SEQUENCE_BUFFER_SIZE] = header.sequence;
+				_ack_repeats = NP_ENGINE_NETWORK_CHANNEL_ACK_REPEATS;
+				if (!_has_remote_sequence || IsSequenceGreater(header.sequence, _remote_sequence))
+				{
+					_remote_sequence = header.sequence;
+					_has_remote_sequence = true;
+				}
+				_ack_pending = true;
+
+				const ui8* data = (ui8*)datagram.body->GetData() + ChannelPacketHeader::WIRE_SIZE;
+				ReceiveFragment(header, data, datagram_size - ChannelPacketHeader::WIRE_SIZE, now);
+			}
+		}
+
+		void DetectLosses(tim::steady_timestamp now)
+		{
+			const tim::milliseconds timeout = _round_trip.GetTimeout();
+			bl lost_any = false;
+			bl timed_out_any = false;
+
+			for (auto it = _pending.begin(); it != _pending.end(); it++)
+			{
+				PendingFragment& fragment = it->second;
+				if (!fragment.inFlight)
+					continue;
+
+				const bl timed_out = now - fragment.timestamp > timeout;
+				const bl passed = _has_largest_acked &&
+					IsSequenceGreater(_largest_acked, (ui16)(fragment.sequence + NP_ENGINE_NETWORK_CHANNEL_LOSS_THRESHOLD - 1));
+
+				if (timed_out || passed)
+				{
+					fragment.inFlight = false;
+					fragment.resends++;
+					_in_flight--;
+					_resend_queue.emplace_back(it->first);
+					lost_any = true;
+					timed_out_any |= timed_out;
+
+					if (fragment.resends > NP_ENGINE_NETWORK_CHANNEL_MAX_RESENDS)
+						_lost = true;
+				}
+			}
+
+			if (lost_any)
+				_window.OnLoss(now, _round_trip.GetSmoothed());
+
+			if (timed_out_any)
+				_round_trip.Backoff();
+		}
+
+		void ExpireReassemblies(tim::steady_timestamp now)
+		{
+			const tim::milliseconds timeout(NP_ENGINE_NETWORK_CHANNEL_REASSEMBLY_TIMEOUT);
+			for (auto channel = _channels.begin(); channel != _channels.end(); channel++)
+			{
+				if (IsReliable((*channel)->type))
+					continue;
+
+				con::umap<ui32, Reassembly>& reassemblies = (*channel)->reassemblies;
+				for (auto it = reassemblies.begin(); it != reassemblies.end();)
+					it = now - it->second.timestamp > timeout ? reassemblies.erase(it) : ++it;
+			}
+		}
+
+	public:
+		/*
+			socket is expected to be an open udp socket that has already called ConnectTo and BindTo
+			the socket is switched to direct mode so each datagram is received as one blob
+		*/
+		Connection(mem::sptr<Socket> socket, con::vector<ChannelType> channels):
+			_socket(socket),
+			_local_sequence(0),
+			_remote_sequence(0),
+			_has_remote_sequence(false),
+			_ack_pending(false),
+			_ack_floor(0),
+			_ack_repeats(0),
+			_largest_acked(0),
+			_has_largest_acked(false),
+			_in_flight(0),
+			_lost(false)
+		{
+			NP_ENGINE_ASSERT(channels.size() <= UI8_MAX, "Connection supports up to " + to_str(UI8_MAX) + " channels");
+
+			mem::allocator& allocator = _socket->GetServices()->GetAllocator();
+			for (auto it = channels.begin(); it != channels.end() && _channels.size() < UI8_MAX; it++)
+			{
+				_channels.emplace_back(mem::create_sptr<ChannelState>(allocator));
+				_channels.back()->type = *it;
+			}
+
+			_received.fill(UI32_MAX);
+			_socket->Enable({SocketOptions::Direct});
+			_socket->StartReceiving();
+		}
+
+		~Connection()
+		{
+			_socket->StopReceiving();
+		}
+
+		void Send(ui8 channel, Message msg)
+		{
+			NP_ENGINE_ASSERT(channel < _channels.size(), "Connection channel is out of range");
+			NP_ENGINE_ASSERT(_socket->CanSend(msg), "Connection cannot send given message");
+
+			if (channel < _channels.size() && msg)
+				_outbox.get_access()->emplace(channel, msg);
+		}
+
+		void Update()
+		{
+			const tim::steady_timestamp now = tim::steady_clock::now();
+
+			MessageQueue& socket_inbox = _socket->GetInbox();
+			socket_inbox.ToggleState();
+			for (Message datagram = socket_inbox.Pop(); datagram; datagram = socket_inbox.Pop())
+				ReceiveDatagram(datagram, now);
+
+			con::queue<Outgoing> outgoing;
+			{
+				auto outbox = _outbox.get_access();
+				outgoing.swap(*outbox);
+			}
+
+			for (; !outgoing.empty(); outgoing.pop())
+				Fragment(outgoing.front().first, outgoing.front().second);
+
+			DetectLosses(now);
+			ExpireReassemblies(now);
+
+			for (; !_resend_queue.empty() && _in_flight < _window.GetWindow(); _resend_queue.pop_front())
+			{
+				if (_pending.count(_resend_queue.front()))
+					_stats.resentPackets++;
+				SendPending(_resend_queue.front());
+			}
+
+			// reliable channels share this queue, so one waiting on its message window holds back the rest
+			for (; !_send_queue.empty() && _in_flight < _window.GetWindow() && CanSend(_send_queue.front());
+				 _send_queue.pop_front())
+				SendPending(_send_queue.front());
+
+			if (_ack_pending)
+			{
+				SendAck();
+			}
+			else if (_ack_repeats > 0)
+			{
+				_ack_repeats--;
+				SendAck();
+			}
+
+			FlushHeldDatagram();
+		}
+
+		MessageQueue& GetInbox(ui8 channel)
+		{
+			return _channels[channel]->inbox;
+		}
+
+		ChannelType GetChannelType(ui8 channel) const
+		{
+			return _channels[channel]->type;
+		}
+
+		siz GetChannelCount() const
+		{
+			return _channels.size();
+		}
+
+		/*
+			true when a reliable fragment went unacknowledged for too many resends
+		*/
+		bl IsLost() const
+		{
+			return _lost;
+		}
+
+		void SetConditions(const ChannelConditions& conditions)
+		{
+			_conditions = conditions;
+		}
+
+		const ChannelConditions& GetConditions() const
+		{
+			return _conditions;
+		}
+
+		ConnectionStats GetStats() const
+		{
+			ConnectionStats stats = _stats;
+			stats.inFlight = _in_flight;
+			stats.window = _window.GetWindow();
+			stats.roundTrip = _round_trip.GetSmoothed();
+			stats.timeout = _round_trip.GetTimeout();
+			return stats;
+		}
+
+		mem::sptr<Socket> GetSocket() const
+		{
+			return _socket;
+		}
+	};
+} // namespace np::net
+
+#endif /* NP_ENGINE_NETWORK_INTERFACE_CONNECTION_HPP */
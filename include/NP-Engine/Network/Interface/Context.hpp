@@ -10,6 +10,7 @@
 #include "NP-Engine/Services/Services.hpp"
 
 #include "DetailType.hpp"
+#include "ResolverCache.hpp"
 
 namespace np::net
 {
@@ -17,6 +18,7 @@ namespace np::net
 	{
 	protected:
 		mem::sptr<srvc::Services> _services;
+		ResolverCache _resolver_cache;
 
 		Context(mem::sptr<srvc::Services> services): _services(services) {}
 
@@ -34,6 +36,11 @@ namespace np::net
 		{
 			return _services;
 		}
+
+		virtual ResolverCache& GetResolverCache()
+		{
+			return _resolver_cache;
+		}
 	};
 } // namespace np::net
 
@@ -14,7 +14,11 @@
 #include "Message.hpp"
 #include "NetworkEvents.hpp"
 #include "Socket.hpp"
+#include "Channel.hpp"
+#include "Connection.hpp"
 #include "Resolver.hpp"
+#include "ResolverCache.hpp"
 #include "Ip.hpp"
+#include "MetricsEndpoint.hpp"
 
 #endif /* NP_ENGINE_NETWORK_INTERFACE_HPP */
\ No newline at end of file
@@ -7,6 +7,8 @@
 #ifndef NP_ENGINE_NETWORK_INTERFACE_IP_HPP
 #define NP_ENGINE_NETWORK_INTERFACE_IP_HPP
 
+#include <sstream>
+
 #include "NP-Engine/Primitive/Primitive.hpp"
 #include "NP-Engine/Container/Container.hpp"
 #include "NP-Engine/String/String.hpp"
@@ -58,8 +60,25 @@ namespace np
 				return equal;
 			}
 
-			Ipv4& operator=(str s) // TODO: implement
+			/*
+				parses dotted decimal, ex: "127.0.0.1" -- invalidates on failure
+			*/
+			Ipv4& operator=(str s)
 			{
+				::std::stringstream ss(s);
+				str part = "";
+				siz count = 0;
+				bl valid = true;
+				for (; valid && ::std::getline(ss, part, '.'); count++)
+				{
+					valid = count < bytes.size() && !part.empty() && part.size() <= 3 &&
+						part.find_first_not_of("0123456789") == str::npos && ::std::stoul(part) <= UI8_MAX;
+					if (valid)
+						bytes[count] = (ui8)::std::stoul(part);
+				}
+
+				if (!valid || count != bytes.size())
+					Invalidate();
 				return *this;
 			}
 
@@ -109,11 +128,47 @@ namespace np
 				return equal;
 			}
 
-			Ipv6& operator=(str s) // TODO: implement
+			/*
+				parses hex groups with optional "::" compression, ex: "::1" or "fe80::1:2" -- invalidates on failure
+			*/
+			Ipv6& operator=(str s)
 			{
+				con::vector<ui16> head, tail;
+				bl valid = true;
+
+				const siz compress = s.find("::");
+				const str head_str = compress == str::npos ? s : s.substr(0, compress);
+				const str tail_str = compress == str::npos ? "" : s.substr(compress + 2);
+				valid = ParseGroups(head_str, head) && ParseGroups(tail_str, tail) && tail_str.find("::") == str::npos;
+
+				const siz count = head.size() + tail.size();
+				valid &= compress == str::npos ? count == shorts.size() : count < shorts.size();
+
+				Invalidate();
+				if (valid)
+				{
+					for (siz i = 0; i < head.size(); i++)
+						shorts[i] = head[i];
+					for (siz i = 0; i < tail.size(); i++)
+						shorts[shorts.size() - tail.size() + i] = tail[i];
+				}
 				return *this;
 			}
 
+			static bl ParseGroups(const str& s, con::vector<ui16>& groups)
+			{
+				::std::stringstream ss(s);
+				str part = "";
+				bl valid = true;
+				while (valid && !s.empty() && ::std::getline(ss, part, ':'))
+				{
+					valid = !part.empty() && part.size() <= 4 && part.find_first_not_of("0123456789abcdefABCDEF") == str::npos;
+					if (valid)
+						groups.emplace_back((ui16)::std::stoul(part, nullptr, 16));
+				}
+				return valid && (s.empty() || s.back() != ':');
+			}
+
 			virtual IpType GetType() const override
 			{
 				return IpType::V6;
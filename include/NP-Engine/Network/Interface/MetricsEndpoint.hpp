@@ -0,0 +1,60 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#ifndef NP_ENGINE_NETWORK_INTERFACE_METRICS_ENDPOINT_HPP
+#define NP_ENGINE_NETWORK_INTERFACE_METRICS_ENDPOINT_HPP
+
+#ifndef NP_ENGINE_NETWORK_METRICS_ENDPOINT_PORT
+	#define NP_ENGINE_NETWORK_METRICS_ENDPOINT_PORT 9464
+#endif
+
+// milliseconds a scraper gets to send its request before we answer anyway
+#ifndef NP_ENGINE_NETWORK_METRICS_ENDPOINT_REQUEST_TIMEOUT
+	#define NP_ENGINE_NETWORK_METRICS_ENDPOINT_REQUEST_TIMEOUT 200
+#endif
+
+#include "NP-Engine/Memory/Memory.hpp"
+
+#include "Context.hpp"
+#include "Ip.hpp"
+
+namespace np::net
+{
+	/*
+		serves nsit::metrics::scrape() over plain http on its own thread, so a prometheus scraper (or curl) can poll the
+		engine while it runs -- meant for localhost, there is no auth
+	*/
+	class MetricsEndpoint
+	{
+	protected:
+		mem::sptr<Context> _context;
+
+		MetricsEndpoint(mem::sptr<Context> context): _context(context) {}
+
+	public:
+		static mem::sptr<MetricsEndpoint> Create(mem::sptr<Context> context);
+
+		virtual ~MetricsEndpoint() = default;
+
+		virtual bl Start(const Ip& ip = Ipv4{127, 0, 0, 1}, ui16 port = NP_ENGINE_NETWORK_METRICS_ENDPOINT_PORT) = 0;
+
+		virtual void Stop() = 0;
+
+		virtual bl IsRunning() const = 0;
+
+		virtual DetailType GetDetailType() const
+		{
+			return _context->GetDetailType();
+		}
+
+		virtual mem::sptr<Context> GetContext() const
+		{
+			return _context;
+		}
+	};
+} // namespace np::net
+
+#endif /* NP_ENGINE_NETWORK_INTERFACE_METRICS_ENDPOINT_HPP */
@@ -13,24 +13,77 @@
 #include "Context.hpp"
 #include "Ip.hpp"
 #include "Host.hpp"
+#include "ResolverCache.hpp"
 
 namespace np::net
 {
+	/*
+		lookups go through the context's ResolverCache first, so hosts loaded from a hosts file resolve without a network
+		GetHostAsync runs the lookup on the job system and coalesces concurrent requests for the same name
+	*/
 	class Resolver
 	{
 	protected:
+		struct ResolveJobPayload
+		{
+			mem::sptr<Context> context;
+			mem::sptr<Resolver> resolver;
+			str name;
+		};
+
 		mem::sptr<Context> _context;
 
 		Resolver(mem::sptr<Context> context): _context(context) {}
 
+		static void ResolveJobCallback(mem::delegate& d);
+
+		static bl IsFound(const Host& host)
+		{
+			return !host.ipv4s.empty() || !host.ipv6s.empty();
+		}
+
+		virtual Host DetailGetHost(str name) = 0;
+
+		virtual Host DetailGetHost(const Ip& ip) = 0;
+
+		/*
+			the resolver GetHostAsync's job looks up with -- jobs may outlive us, so they get their own
+		*/
+		virtual mem::sptr<Resolver> CreateJobResolver()
+		{
+			return Create(_context);
+		}
+
 	public:
 		static mem::sptr<Resolver> Create(mem::sptr<Context> context);
 
 		virtual ~Resolver() = default;
 
-		virtual Host GetHost(str name) = 0;
+		/*
+			blocks on a cache miss
+		*/
+		Host GetHost(str name)
+		{
+			ResolverCache& cache = _context->GetResolverCache();
+			Host host;
+			bl found = false;
+			if (!cache.Get(name, host, found))
+			{
+				host = DetailGetHost(name);
+				cache.Put(name, host, IsFound(host));
+			}
+			return host;
+		}
+
+		Host GetHost(const Ip& ip)
+		{
+			return DetailGetHost(ip);
+		}
 
-		virtual Host GetHost(const Ip& ip) = 0;
+		/*
+			callback is invoked immediately on a cache hit, otherwise it is invoked from a job worker once the lookup completes
+		*/
+		void GetHostAsync(str name, ResolveCallback callback, void* caller);
 	};
 } // namespace np::net
 
@@ -0,0 +1,276 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#ifndef NP_ENGINE_NETWORK_INTERFACE_RESOLVER_CACHE_HPP
+#define NP_ENGINE_NETWORK_INTERFACE_RESOLVER_CACHE_HPP
+
+// getaddrinfo does not give us the record ttl, so positive entries live this long by default, see SetTtl
+#ifndef NP_ENGINE_NETWORK_RESOLVER_CACHE_TTL
+	#define NP_ENGINE_NETWORK_RESOLVER_CACHE_TTL 60000
+#endif
+
+// failed lookups are remembered for this long so we do not hammer dns for a name that does not exist
+#ifndef NP_ENGINE_NETWORK_RESOLVER_CACHE_NEGATIVE_TTL
+	#define NP_ENGINE_NETWORK_RESOLVER_CACHE_NEGATIVE_TTL 5000
+#endif
+
+#include <fstream>
+#include <sstream>
+#include <cctype>
+
+#include "NP-Engine/Primitive/Primitive.hpp"
+#include "NP-Engine/Container/Container.hpp"
+#include "NP-Engine/String/String.hpp"
+#include "NP-Engine/Time/Time.hpp"
+
+#include "Host.hpp"
+#include "Ip.hpp"
+
+namespace np::net
+{
+	using ResolveCallback = void (*)(void* caller, const Host& host, bl found);
+
+	/*
+		shared by every resolver created from the same context
+		holds ttl-expiring lookups, permanent hosts (from a hosts file or added by hand), and the callers waiting on
+		lookups that are in flight so concurrent requests for the same name only query once
+	*/
+	class ResolverCache
+	{
+	public:
+		struct Waiter
+		{
+			ResolveCallback callback = nullptr;
+			void* caller = nullptr;
+		};
+
+	protected:
+		struct Entry
+		{
+			Host host;
+			bl found = false;
+			bl permanent = false;
+			tim::steady_timestamp expiration;
+		};
+
+		mutexed_wrapper<con::umap<str, Entry>> _entries;
+		mutexed_wrapper<con::umap<str, con::vector<Waiter>>> _pending;
+		atm<i64> _ttl_ms;
+		atm<i64> _negative_ttl_ms;
+
+		static str ToKey(str name)
+		{
+			for (auto it = name.begin(); it != name.end(); it++)
+				*it = (chr)::std::tolower((ui8)*it);
+			return name;
+		}
+
+	public:
+		ResolverCache():
+			_ttl_ms(NP_ENGINE_NETWORK_RESOLVER_CACHE_TTL),
+			_negative_ttl_ms(NP_ENGINE_NETWORK_RESOLVER_CACHE_NEGATIVE_TTL)
+		{}
+
+		/*
+			how long entries put from now on live -- found lookups use ttl, failed ones use negative_ttl
+		*/
+		void SetTtl(tim::milliseconds ttl, tim::milliseconds negative_ttl)
+		{
+			_ttl_ms.store((i64)ttl.count(), mo_release);
+			_negative_ttl_ms.store((i64)negative_ttl.count(), mo_release);
+		}
+
+		tim::milliseconds GetTtl() const
+		{
+			return tim::milliseconds((dbl)_ttl_ms.load(mo_acquire));
+		}
+
+		tim::milliseconds GetNegativeTtl() const
+		{
+			return tim::milliseconds((dbl)_negative_ttl_ms.load(mo_acquire));
+		}
+
+		/*
+			returns true on a cache hit, where found tells if that hit was a positive or negative entry
+		*/
+		bl Get(str name, Host& host, bl& found)
+		{
+			const str key = ToKey(name);
+			const tim::steady_timestamp now = tim::steady_clock::now();
+			bl hit = false;
+
+			auto entries = _entries.get_access();
+			auto it = entries->find(key);
+			if (it != entries->end())
+			{
+				if (it->second.permanent || now < it->second.expiration)
+				{
+					host = it->second.host;
+					found = it->second.found;
+					hit = true;
+				}
+				else
+				{
+					entries->erase(it);
+				}
+			}
+
+			return hit;
+		}
+
+		void Put(str name, const Host& host, bl found)
+		{
+			const tim::milliseconds ttl = found ? GetTtl() : GetNegativeTtl();
+			const str key = ToKey(name);
+
+			auto entries = _entries.get_access();
+			Entry& entry = (*entries)[key];
+			if (!entry.permanent)
+			{
+				entry.host = host;
+				entry.found = found;
+				entry.expiration = tim::steady_clock::now() + tim::duration_cast<tim::steady_clock::duration>(ttl);
+			}
+		}
+
+		/*
+			permanent entries never expire and win over lookups -- the host is registered under its name and all aliases
+		*/
+		void AddHost(const Host& host)
+		{
+			auto entries = _entries.get_access();
+			con::vector<str> names{host.name};
+			names.insert(names.end(), host.aliases.begin(), host.aliases.end());
+
+			for (const str& name : names)
+			{
+				if (name.empty())
+					continue;
+
+				Entry& entry = (*entries)[ToKey(name)];
+				if (!entry.permanent)
+				{
+					entry.host.Clear();
+					entry.host.name = host.name;
+					entry.permanent = true;
+					entry.found = true;
+				}
+
+				entry.host.aliases.insert(host.aliases.begin(), host.aliases.end());
+				entry.host.aliases.emplace(host.name);
+				entry.host.ipv4s.insert(host.ipv4s.begin(), host.ipv4s.end());
+				entry.host.ipv6s.insert(host.ipv6s.begin(), host.ipv6s.end());
+			}
+		}
+
+		/*
+			loads "<ip> <name> [aliases...]" lines, ignoring '#' comments, like /etc/hosts
+			returns the number of entries loaded
+		*/
+		siz LoadHostsFile(str filename)
+		{
+			siz count = 0;
+			::std::ifstream file(filename);
+			for (str line = ""; file && ::std::getline(file, line);)
+			{
+				const siz comment = line.find('#');
+				if (comment != str::npos)
+					line.erase(comment);
+
+				::std::stringstream ss(line);
+				str address = "";
+				str name = "";
+				if (!(ss >> address >> name))
+					continue;
+
+				Host host;
+				host.name = name;
+				for (str alias = ""; ss >> alias;)
+					host.aliases.emplace(alias);
+
+				if (address.find(':') != str::npos)
+				{
+					Ipv6 ip;
+					ip = address;
+					if (ip || address == "::")
+						host.ipv6s.emplace(ip, 0);
+				}
+				else
+				{
+					Ipv4 ip;
+					ip = address;
+					if (ip || address == "0.0.0.0")
+						host.ipv4s.emplace(ip, 0);
+				}
+
+				if (!host.ipv4s.empty() || !host.ipv6s.empty())
+				{
+					AddHost(host);
+					count++;
+				}
+			}
+			return count;
+		}
+
+		/*
+			registers the caller as waiting on name
+			returns true when the caller is the first to wait, meaning the caller is responsible for the lookup
+		*/
+		bl AddWaiter(str name, ResolveCallback callback, void* caller)
+		{
+			auto pending = _pending.get_access();
+			auto it = pending->find(ToKey(name));
+			const bl first = it == pending->end();
+			if (first)
+				it = pending->emplace(ToKey(name), con::vector<Waiter>{}).first;
+			it->second.emplace_back(Waiter{callback, caller});
+			return first;
+		}
+
+		/*
+			caches the result and notifies everyone that waited on name
+		*/
+		void Complete(str name, const Host& host, bl found)
+		{
+			Put(name, host, found);
+
+			con::vector<Waiter> waiters;
+			{
+				auto pending = _pending.get_access();
+				auto it = pending->find(ToKey(name));
+				if (it != pending->end())
+				{
+					waiters.swap(it->second);
+					pending->erase(it);
+				}
+			}
+
+			for (const Waiter& waiter : waiters)
+				if (waiter.callback)
+					waiter.callback(waiter.caller, host, found);
+		}
+
+		/*
+			removes expired entries, permanent entries are kept
+		*/
+		void Prune()
+		{
+			const tim::steady_timestamp now = tim::steady_clock::now();
+			auto entries = _entries.get_access();
+			for (auto it = entries->begin(); it != entries->end();)
+				it = !it->second.permanent && now >= it->second.expiration ? entries->erase(it) : ++it;
+		}
+
+		void Clear(bl include_permanent = false)
+		{
+			auto entries = _entries.get_access();
+			for (auto it = entries->begin(); it != entries->end();)
+				it = include_permanent || !it->second.permanent ? entries->erase(it) : ++it;
+		}
+	};
+} // namespace np::net
+
+#endif /* NP_ENGINE_NETWORK_INTERFACE_RESOLVER_CACHE_HPP */
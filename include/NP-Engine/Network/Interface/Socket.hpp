@@ -17,6 +17,7 @@
 #include "NP-Engine/Services/Services.hpp"
 #include "NP-Engine/Math/Math.hpp"
 #include "NP-Engine/Container/Container.hpp"
+#include "NP-Engine/Insight/Metrics.hpp"
 
 #include "Context.hpp"
 #include "Message.hpp"
@@ -60,6 +61,38 @@ namespace np::net
 
 		Socket(mem::sptr<Context> context): _context(context) {}
 
+		static nsit::metric_gauge& GetOpenGauge()
+		{
+			static nsit::metric_gauge& gauge = nsit::metrics::get_gauge("np_net_sockets_open", "sockets currently open");
+			return gauge;
+		}
+
+		static nsit::metric_counter& GetBytesSentCounter()
+		{
+			static nsit::metric_counter& counter = nsit::metrics::get_counter("np_net_bytes_sent_total", "bytes sent by sockets");
+			return counter;
+		}
+
+		static nsit::metric_counter& GetBytesReceivedCounter()
+		{
+			static nsit::metric_counter& counter =
+				nsit::metrics::get_counter("np_net_bytes_received_total", "bytes received by sockets");
+			return counter;
+		}
+
+		static nsit::metric_counter& GetMessagesSentCounter()
+		{
+			static nsit::metric_counter& counter = nsit::metrics::get_counter("np_net_messages_sent_total", "messages sent by sockets");
+			return counter;
+		}
+
+		static nsit::metric_counter& GetMessagesReceivedCounter()
+		{
+			static nsit::metric_counter& counter =
+				nsit::metrics::get_counter("np_net_messages_received_total", "messages received by sockets");
+			return counter;
+		}
+
 	public:
 		static mem::sptr<Socket> Create(mem::sptr<Context> context);
 
@@ -89,13 +122,19 @@ namespace np::net
 		void Send(Message msg)
 		{
 			if (CanSend(msg))
+			{
 				DetailSend(msg);
+				GetMessagesSentCounter().increment();
+			}
 		}
 
 		void SendTo(Message msg, const Ip& ip, ui16 port)
 		{
 			if (CanSend(msg))
+			{
 				DetailSendTo(msg, ip, port);
+				GetMessagesSentCounter().increment();
+			}
 		}
 
 		void Send(void* src, siz byte_count)
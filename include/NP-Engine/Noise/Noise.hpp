@@ -8,6 +8,8 @@
 #define NP_ENGINE_NOISE_HPP
 
 #include "NP-Engine/Foundation/Foundation.hpp"
+#include "NoiseBatch.hpp"
+#include "NoiseField.hpp"
 #include "Perlin.hpp"
 #include "Simplex.hpp"
 #include "Turbulence.hpp"
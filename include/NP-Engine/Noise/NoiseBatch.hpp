@@ -0,0 +1,102 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#ifndef NP_ENGINE_NOISE_BATCH_HPP
+#define NP_ENGINE_NOISE_BATCH_HPP
+
+#include "NP-Engine/Foundation/Foundation.hpp"
+#include "NP-Engine/Primitive/Primitive.hpp"
+
+namespace np::noiz
+{
+	/*
+		instruction sets the batch kernels are built for, in order of preference
+	*/
+	enum class NoiseBatchIsa : ui32
+	{
+		Scalar = 0,
+		Sse41,
+		Avx2,
+		Avx512
+	};
+
+	/*
+		permutation widened to i32 so kernels can gather from it -- indices are always masked to [0, 512)
+	*/
+	struct alignas(64) NoiseBatchPermutation
+	{
+		constexpr static siz SIZE = 512;
+		i32 values[SIZE];
+	};
+
+	/*
+		when is_fractal is false the kernels return the raw noise value and the octave fields are ignored
+	*/
+	struct NoiseBatchOctaves
+	{
+		flt frequency = 1.f;
+		flt amplitude = 1.f;
+		flt lacunarity = 2.f;
+		flt persistence = 0.5f;
+		ui8 octave_count = 1;
+		bl is_fractal = false;
+	};
+
+	namespace __detail
+	{
+		/*
+			zs is nullptr for 2D kernels
+		*/
+		using NoiseBatchFunction = void (*)(const NoiseBatchPermutation& permutation, const NoiseBatchOctaves& octaves,
+											const flt* xs, const flt* ys, const flt* zs, flt* out, siz count);
+
+		struct NoiseBatchKernels
+		{
+			NoiseBatchIsa isa;
+			NoiseBatchFunction simplex_2d;
+			NoiseBatchFunction simplex_3d;
+			NoiseBatchFunction perlin_3d;
+		};
+
+		/*
+			each returns nullptr when its translation unit was not built for that instruction set
+		*/
+		const NoiseBatchKernels* GetSse41NoiseBatchKernels();
+		const NoiseBatchKernels* GetAvx2NoiseBatchKernels();
+		const NoiseBatchKernels* GetAvx512NoiseBatchKernels();
+	} // namespace __detail
+
+	/*
+		picks the widest kernels this cpu (and os) can run the first time it is asked, and lets that be overridden for
+		benchmarking or for pinning results across machines
+
+		the vector kernels perform the same float operations in the same order as the scalar noise functions, so they
+		are bit-for-bit equal to them -- unless the scalar code is built with fp contraction into fma (ex: -march=native
+		with gcc's default -ffp-contract=fast) in which case expect up to a few ulp of difference (about 1e-6 on [-1, 1])
+		the kernel translation units are built with fp contraction off for the same reason
+	*/
+	class NoiseBatch
+	{
+	public:
+		static NoiseBatchIsa GetSupportedIsa();
+
+		static NoiseBatchIsa GetIsa();
+
+		/*
+			clamps to GetSupportedIsa, and Scalar disables the kernels
+		*/
+		static void SetIsa(NoiseBatchIsa isa);
+
+		/*
+			nullptr when the scalar path should be used
+		*/
+		static const __detail::NoiseBatchKernels* GetKernels();
+
+		static const chr* GetIsaName(NoiseBatchIsa isa);
+	};
+} // namespace np::noiz
+
+#endif /* NP_ENGINE_NOISE_BATCH_HPP */
@@ -0,0 +1,342 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#ifndef NP_ENGINE_NOISE_BATCH_IMPL_HPP
+#define NP_ENGINE_NOISE_BATCH_IMPL_HPP
+
+#include "NP-Engine/Primitive/Primitive.hpp"
+
+#include "NoiseBatch.hpp"
+
+/*
+	only meant to be included by the kernel translation units, each after defining its lanes type:
+
+		struct Lanes
+		{
+			using F = float vector;
+			using I = i32 vector;
+			using M = lane mask;
+			constexpr static siz WIDTH;
+
+			F Load(const flt*), Set(flt), Add, Sub, Mul, Div, Negate, ToFlt(I), Select(M, F if set, F otherwise)
+			I SetI(i32), AddI, AndI, TruncToInt(F), SelectI(M, I, I), Gather(const i32* table, I indices)
+			M Less(F, F), Greater(F, F), GreaterEqual(F, F), LessI(I, I), EqualI(I, I), Test(I, i32 bits)
+			M And(M, M), Or(M, M), Not(M)
+			void Store(flt*, F)
+		};
+
+	everything mirrors the scalar code in Simplex.hpp and Perlin.hpp operation for operation -- keep them in sync
+	every lanes type must be uniquely named per translation unit, since these templates are compiled with different
+	target flags
+*/
+
+namespace np::noiz::__detail
+{
+	template <typename L>
+	struct NoiseBatchImpl
+	{
+		using F = typename L::F;
+		using I = typename L::I;
+		using M = typename L::M;
+
+		static I FastFloor(F n)
+		{
+			I i = L::TruncToInt(n);
+			return L::SelectI(L::Less(n, L::ToFlt(i)), L::AddI(i, L::SetI(-1)), i);
+		}
+
+		/*
+			permutation[(ui8)i]
+		*/
+		static I Hash(const i32* permutation, I i)
+		{
+			return L::Gather(permutation, L::AndI(i, L::SetI(255)));
+		}
+
+		/*
+			t < 0 ? 0 : t^4 * grad
+		*/
+		static F Contribution(F t, F grad)
+		{
+			const F zero = L::Set(0.f);
+			const M outside = L::Less(t, zero);
+			t = L::Mul(t, t);
+			return L::Select(outside, zero, L::Mul(L::Mul(t, t), grad));
+		}
+
+		static F SimplexGrad(I hash, F x, F y)
+		{
+			const I h = L::AndI(hash, L::SetI(0x3F));
+			const M less_4 = L::LessI(h, L::SetI(4));
+			const F u = L::Select(less_4, x, y);
+			const F v = L::Mul(L::Set(2.0f), L::Select(less_4, y, x));
+			return L::Add(L::Select(L::Test(h, 1), L::Negate(u), u), L::Select(L::Test(h, 2), L::Negate(v), v));
+		}
+
+		/*
+			shared by simplex and perlin
+		*/
+		static F Grad(I hash, F x, F y, F z)
+		{
+			const I h = L::AndI(hash, L::SetI(15));
+			const F u = L::Select(L::LessI(h, L::SetI(8)), x, y);
+			const M use_x = L::Or(L::EqualI(h, L::SetI(12)), L::EqualI(h, L::SetI(14)));
+			const F v = L::Select(L::LessI(h, L::SetI(4)), y, L::Select(use_x, x, z));
+			return L::Add(L::Select(L::Test(h, 1), L::Negate(u), u), L::Select(L::Test(h, 2), L::Negate(v), v));
+		}
+
+		static F Simplex(const i32* permutation, F x, F y)
+		{
+			constexpr flt F2 = 0.366025403f;
+			constexpr flt G2 = 0.211324865f;
+			const I one = L::SetI(1);
+			const I zero = L::SetI(0);
+
+			const F s = L::Mul(L::Add(x, y), L::Set(F2));
+			const I i = FastFloor(L::Add(x, s));
+			const I j = FastFloor(L::Add(y, s));
+
+			const F t = L::Mul(L::ToFlt(L::AddI(i, j)), L::Set(G2));
+			const F x0 = L::Sub(x, L::Sub(L::ToFlt(i), t));
+			const F y0 = L::Sub(y, L::Sub(L::ToFlt(j), t));
+
+			const M lower = L::Greater(x0, y0);
+			const I i1 = L::SelectI(lower, one, zero);
+			const I j1 = L::SelectI(lower, zero, one);
+
+			const F x1 = L::Add(L::Sub(x0, L::ToFlt(i1)), L::Set(G2));
+			const F y1 = L::Add(L::Sub(y0, L::ToFlt(j1)), L::Set(G2));
+			const F x2 = L::Add(L::Sub(x0, L::Set(1.0f)), L::Set(2.0f * G2));
+			const F y2 = L::Add(L::Sub(y0, L::Set(1.0f)), L::Set(2.0f * G2));
+
+			const F half = L::Set(0.5f);
+			const F t0 = L::Sub(L::Sub(half, L::Mul(x0, x0)), L::Mul(y0, y0));
+			const F t1 = L::Sub(L::Sub(half, L::Mul(x1, x1)), L::Mul(y1, y1));
+			const F t2 = L::Sub(L::Sub(half, L::Mul(x2, x2)), L::Mul(y2, y2));
+
+			const I gi0 = Hash(permutation, L::AddI(i, Hash(permutation, j)));
+			const I gi1 = Hash(permutation, L::AddI(L::AddI(i, i1), Hash(permutation, L::AddI(j, j1))));
+			const I gi2 = Hash(permutation, L::AddI(L::AddI(i, one), Hash(permutation, L::AddI(j, one))));
+
+			const F n0 = Contribution(t0, SimplexGrad(gi0, x0, y0));
+			const F n1 = Contribution(t1, SimplexGrad(gi1, x1, y1));
+			const F n2 = Contribution(t2, SimplexGrad(gi2, x2, y2));
+
+			return L::Mul(L::Set(45.23065f), L::Add(L::Add(n0, n1), n2));
+		}
+
+		static F Simplex(const i32* permutation, F x, F y, F z)
+		{
+			constexpr flt F3 = 1.0f / 3.0f;
+			constexpr flt G3 = 1.0f / 6.0f;
+			const I one = L::SetI(1);
+			const I zero = L::SetI(0);
+
+			const F s = L::Mul(L::Add(L::Add(x, y), z), L::Set(F3));
+			const I i = FastFloor(L::Add(x, s));
+			const I j = FastFloor(L::Add(y, s));
+			const I k = FastFloor(L::Add(z, s));
+
+			const F t = L::Mul(L::ToFlt(L::AddI(L::AddI(i, j), k)), L::Set(G3));
+			const F x0 = L::Sub(x, L::Sub(L::ToFlt(i), t));
+			const F y0 = L::Sub(y, L::Sub(L::ToFlt(j), t));
+			const F z0 = L::Sub(z, L::Sub(L::ToFlt(k), t));
+
+			// the scalar if/else ladder, flattened into masks
+			const M x_ge_y = L::GreaterEqual(x0, y0);
+			const M y_ge_z = L::GreaterEqual(y0, z0);
+			const M x_ge_z = L::GreaterEqual(x0, z0);
+
+			const I i1 = L::SelectI(L::And(x_ge_y, L::Or(y_ge_z, x_ge_z)), one, zero);
+			const I j1 = L::SelectI(L::And(L::Not(x_ge_y), y_ge_z), one, zero);
+			const I k1 = L::SelectI(L::And(L::Not(y_ge_z), L::Or(L::Not(x_ge_y), L::Not(x_ge_z))), one, zero);
+			const I i2 = L::SelectI(L::Or(x_ge_y, L::And(y_ge_z, x_ge_z)), one, zero);
+			const I j2 = L::SelectI(L::Or(L::Not(x_ge_y), y_ge_z), one, zero);
+			const I k2 = L::SelectI(L::Or(L::Not(y_ge_z), L::And(L::Not(x_ge_y), L::Not(x_ge_z))), one, zero);
+
+			const F x1 = L::Add(L::Sub(x0, L::ToFlt(i1)), L::Set(G3));
+			const F y1 = L::Add(L::Sub(y0, L::ToFlt(j1)), L::Set(G3));
+			const F z1 = L::Add(L::Sub(z0, L::ToFlt(k1)), L::Set(G3));
+			const F x2 = L::Add(L::Sub(x0, L::ToFlt(i2)), L::Set(2.0f * G3));
+			const F y2 = L::Add(L::Sub(y0, L::ToFlt(j2)), L::Set(2.0f * G3));
+			const F z2 = L::Add(L::Sub(z0, L::ToFlt(k2)), L::Set(2.0f * G3));
+			const F x3 = L::Add(L::Sub(x0, L::Set(1.0f)), L::Set(3.0f * G3));
+			const F y3 = L::Add(L::Sub(y0, L::Set(1.0f)), L::Set(3.0f * G3));
+			const F z3 = L::Add(L::Sub(z0, L::Set(1.0f)), L::Set(3.0f * G3));
+
+			const F base = L::Set(0.6f);
+			const F t0 = L::Sub(L::Sub(L::Sub(base, L::Mul(x0, x0)), L::Mul(y0, y0)), L::Mul(z0, z0));
+			const F t1 = L::Sub(L::Sub(L::Sub(base, L::Mul(x1, x1)), L::Mul(y1, y1)), L::Mul(z1, z1));
+			const F t2 = L::Sub(L::Sub(L::Sub(base, L::Mul(x2, x2)), L::Mul(y2, y2)), L::Mul(z2, z2));
+			const F t3 = L::Sub(L::Sub(L::Sub(base, L::Mul(x3, x3)), L::Mul(y3, y3)), L::Mul(z3, z3));
+
+			const I gi0 = Hash(permutation, L::AddI(i, Hash(permutation, L::AddI(j, Hash(permutation, k)))));
+			const I gi1 = Hash(permutation,
+							   L::AddI(L::AddI(i, i1),
+									   Hash(permutation, L::AddI(L::AddI(j, j1), Hash(permutation, L::AddI(k, k1))))));
+			const I gi2 = Hash(permutation,
+							   L::AddI(L::AddI(i, i2),
+									   Hash(permutation, L::AddI(L::AddI(j, j2), Hash(permutation, L::AddI(k, k2))))));
+			const I gi3 = Hash(permutation,
+							   L::AddI(L::AddI(i, one),
+									   Hash(permutation, L::AddI(L::AddI(j, one), Hash(permutation, L::AddI(k, one))))));
+
+			const F n0 = Contribution(t0, Grad(gi0, x0, y0, z0));
+			const F n1 = Contribution(t1, Grad(gi1, x1, y1, z1));
+			const F n2 = Contribution(t2, Grad(gi2, x2, y2, z2));
+			const F n3 = Contribution(t3, Grad(gi3, x3, y3, z3));
+
+			return L::Mul(L::Set(32.0f), L::Add(L::Add(L::Add(n0, n1), n2), n3));
+		}
+
+		static F Fade(F t)
+		{
+			const F inner = L::Add(L::Mul(t, L::Sub(L::Mul(t, L::Set(6.f)), L::Set(15.f))), L::Set(10.f));
+			return L::Mul(L::Mul(L::Mul(t, t), t), inner);
+		}
+
+		/*
+			glm::lerp is glm::mix: a * (1 - t) + b * t
+		*/
+		static F Lerp(F a, F b, F t)
+		{
+			return L::Add(L::Mul(a, L::Sub(L::Set(1.f), t)), L::Mul(b, t));
+		}
+
+		static F Perlin(const i32* permutation, F x, F y, F z)
+		{
+			const I mask = L::SetI(255);
+			const I one = L::SetI(1);
+			const F f_one = L::Set(1.f);
+
+			I X = FastFloor(x);
+			I Y = FastFloor(y);
+			I Z = FastFloor(z);
+
+			x = L::Sub(x, L::ToFlt(X));
+			y = L::Sub(y, L::ToFlt(Y));
+			z = L::Sub(z, L::ToFlt(Z));
+
+			X = L::AndI(X, mask);
+			Y = L::AndI(Y, mask);
+			Z = L::AndI(Z, mask);
+
+			const F u = Fade(x);
+			const F v = Fade(y);
+			const F w = Fade(z);
+
+			const I A = L::AddI(L::Gather(permutation, X), Y);
+			const I AA = L::AddI(L::Gather(permutation, A), Z);
+			const I AB = L::AddI(L::Gather(permutation, L::AddI(A, one)), Z);
+			const I B = L::AddI(L::Gather(permutation, L::AddI(X, one)), Y);
+			const I BA = L::AddI(L::Gather(permutation, B), Z);
+			const I BB = L::AddI(L::Gather(permutation, L::AddI(B, one)), Z);
+
+			const F x1 = L::Sub(x, f_one);
+			const F y1 = L::Sub(y, f_one);
+			const F z1 = L::Sub(z, f_one);
+
+			const F near_y0 = Lerp(Grad(L::Gather(permutation, AA), x, y, z), Grad(L::Gather(permutation, BA), x1, y, z), u);
+			const F near_y1 =
+				Lerp(Grad(L::Gather(permutation, AB), x, y1, z), Grad(L::Gather(permutation, BB), x1, y1, z), u);
+			const F far_y0 = Lerp(Grad(L::Gather(permutation, L::AddI(AA, one)), x, y, z1),
+								  Grad(L::Gather(permutation, L::AddI(BA, one)), x1, y, z1), u);
+			const F far_y1 = Lerp(Grad(L::Gather(permutation, L::AddI(AB, one)), x, y1, z1),
+								  Grad(L::Gather(permutation, L::AddI(BB, one)), x1, y1, z1), u);
+
+			return Lerp(Lerp(near_y0, near_y1, v), Lerp(far_y0, far_y1, v), w);
+		}
+
+		struct Simplex2D
+		{
+			static F Calculate(const i32* permutation, F x, F y, F)
+			{
+				return Simplex(permutation, x, y);
+			}
+		};
+
+		struct Simplex3D
+		{
+			static F Calculate(const i32* permutation, F x, F y, F z)
+			{
+				return Simplex(permutation, x, y, z);
+			}
+		};
+
+		struct Perlin3D
+		{
+			static F Calculate(const i32* permutation, F x, F y, F z)
+			{
+				return Perlin(permutation, x, y, z);
+			}
+		};
+
+		/*
+			mirrors Fractal: output += amplitude * noise(p * frequency), then output / denom
+		*/
+		template <typename N>
+		static F Evaluate(const i32* permutation, const NoiseBatchOctaves& octaves, F x, F y, F z)
+		{
+			if (!octaves.is_fractal)
+				return N::Calculate(permutation, x, y, z);
+
+			F output = L::Set(0.f);
+			flt denom = 0.f;
+			flt frequency = octaves.frequency;
+			flt amplitude = octaves.amplitude;
+
+			for (ui8 i = 0; i < octaves.octave_count; i++)
+			{
+				const F f = L::Set(frequency);
+				output = L::Add(output,
+								L::Mul(L::Set(amplitude), N::Calculate(permutation, L::Mul(x, f), L::Mul(y, f), L::Mul(z, f))));
+				denom += amplitude;
+				frequency *= octaves.lacunarity;
+				amplitude *= octaves.persistence;
+			}
+
+			return L::Div(output, L::Set(denom));
+		}
+
+		template <typename N>
+		static void Run(const NoiseBatchPermutation& permutation, const NoiseBatchOctaves& octaves, const flt* xs,
+						const flt* ys, const flt* zs, flt* out, siz count)
+		{
+			const i32* table = permutation.values;
+			const F zero = L::Set(0.f);
+			siz i = 0;
+
+			for (; i + L::WIDTH <= count; i += L::WIDTH)
+				L::Store(out + i,
+						 Evaluate<N>(table, octaves, L::Load(xs + i), L::Load(ys + i), zs ? L::Load(zs + i) : zero));
+
+			// pad the tail out to a full vector instead of falling back to scalar code
+			if (i < count)
+			{
+				flt x[L::WIDTH]{}, y[L::WIDTH]{}, z[L::WIDTH]{}, o[L::WIDTH]{};
+				const siz remaining = count - i;
+				for (siz j = 0; j < remaining; j++)
+				{
+					x[j] = xs[i + j];
+					y[j] = ys[i + j];
+					z[j] = zs ? zs[i + j] : 0.f;
+				}
+
+				L::Store(o, Evaluate<N>(table, octaves, L::Load(x), L::Load(y), L::Load(z)));
+
+				for (siz j = 0; j < remaining; j++)
+					out[i + j] = o[j];
+			}
+		}
+
+		static NoiseBatchKernels GetKernels(NoiseBatchIsa isa)
+		{
+			return {isa, Run<Simplex2D>, Run<Simplex3D>, Run<Perlin3D>};
+		}
+	};
+} // namespace np::noiz::__detail
+
+#endif /* NP_ENGINE_NOISE_BATCH_IMPL_HPP */
@@ -0,0 +1,549 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#ifndef NP_ENGINE_NOISE_FIELD_HPP
+#define NP_ENGINE_NOISE_FIELD_HPP
+
+// samples along each side of a 2D tile -- 64 * 64 floats is 16KB
+#ifndef NP_ENGINE_NOISE_FIELD_TILE_SIZE_2D
+	#define NP_ENGINE_NOISE_FIELD_TILE_SIZE_2D 64
+#endif
+
+// samples along each side of a 3D tile -- 16 * 16 * 16 floats is 16KB
+#ifndef NP_ENGINE_NOISE_FIELD_TILE_SIZE_3D
+	#define NP_ENGINE_NOISE_FIELD_TILE_SIZE_3D 16
+#endif
+
+// tiles kept in the cache before the least recently used are dropped
+#ifndef NP_ENGINE_NOISE_FIELD_CACHE_CAPACITY
+	#define NP_ENGINE_NOISE_FIELD_CACHE_CAPACITY 1024
+#endif
+
+#include <algorithm>
+#include <utility>
+
+#include "NP-Engine/Foundation/Foundation.hpp"
+#include "NP-Engine/Primitive/Primitive.hpp"
+#include "NP-Engine/Container/Container.hpp"
+#include "NP-Engine/Memory/Memory.hpp"
+#include "NP-Engine/Thread/Thread.hpp"
+#include "NP-Engine/Math/Math.hpp"
+#include "NP-Engine/JobSystem/JobSystem.hpp"
+#include "NP-Engine/GPU/Interface/Image.hpp"
+
+#include "Simplex.hpp"
+#include "Perlin.hpp"
+#include "Turbulence.hpp"
+
+namespace np::noiz
+{
+	/*
+		what a NoiseField samples -- Calculate is called from many job workers at once, so it must not mutate anything
+	*/
+	class NoiseFieldSource
+	{
+	public:
+		virtual ~NoiseFieldSource() = default;
+
+		/*
+			identifies the noise, its properties, and its seed -- tiles are cached under it
+		*/
+		virtual ui64 GetKey() const = 0;
+
+		/*
+			zs is nullptr for 2D fields
+		*/
+		virtual void Calculate(const flt* xs, const flt* ys, const flt* zs, flt* out, siz count) const = 0;
+	};
+
+	/*
+		samples Simplex::Fractal -- the simplex is copied, so later changes to the original do not reach the field
+	*/
+	class SimplexFieldSource : public NoiseFieldSource
+	{
+	protected:
+		Simplex _simplex;
+		ui64 _key;
+
+	public:
+		SimplexFieldSource(const Simplex& simplex): _simplex(simplex), _key(simplex.GetHash()) {}
+
+		virtual ui64 GetKey() const override
+		{
+			return _key;
+		}
+
+		virtual void Calculate(const flt* xs, const flt* ys, const flt* zs, flt* out, siz count) const override
+		{
+			if (zs)
+				_simplex.Fractal(xs, ys, zs, out, count);
+			else
+				_simplex.Fractal(xs, ys, out, count);
+		}
+	};
+
+	/*
+		samples Perlin::Fractal, at z = 0 for 2D fields
+	*/
+	class PerlinFieldSource : public NoiseFieldSource
+	{
+	protected:
+		Perlin _perlin;
+		ui64 _key;
+
+	public:
+		PerlinFieldSource(const Perlin& perlin): _perlin(perlin), _key(perlin.GetHash()) {}
+
+		virtual ui64 GetKey() const override
+		{
+			return _key;
+		}
+
+		virtual void Calculate(const flt* xs, const flt* ys, const flt* zs, flt* out, siz count) const override
+		{
+			if (zs)
+			{
+				_perlin.Fractal(xs, ys, zs, out, count);
+			}
+			else
+			{
+				con::vector<flt> zeros(count, 0.f);
+				_perlin.Fractal(xs, ys, zeros.data(), out, count);
+			}
+		}
+	};
+
+	/*
+		turbulates each point with SimplexTurbulence::TurbulateFractal, then samples Simplex::Fractal there
+	*/
+	class SimplexTurbulenceFieldSource : public NoiseFieldSource
+	{
+	protected:
+		SimplexTurbulence _turbulence;
+		Simplex _simplex;
+		ui64 _key;
+
+	public:
+		SimplexTurbulenceFieldSource(const SimplexTurbulence& turbulence, const Simplex& simplex):
+			_turbulence(turbulence),
+			_simplex(simplex),
+			_key(turbulence.GetHash())
+		{
+			const ui64 simplex_hash = simplex.GetHash();
+			_key = mat::hash_fnv1a_ui64(&simplex_hash, sizeof(ui64), _key);
+		}
+
+		virtual ui64 GetKey() const override
+		{
+			return _key;
+		}
+
+		virtual void Calculate(const flt* xs, const flt* ys, const flt* zs, flt* out, siz count) const override
+		{
+			con::vector<flt> x(xs, xs + count);
+			con::vector<flt> y(ys, ys + count);
+			if (zs)
+			{
+				con::vector<flt> z(zs, zs + count);
+				_turbulence.TurbulateFractal(x.data(), y.data(), z.data(), out, count);
+				_simplex.Fractal(x.data(), y.data(), z.data(), out, count);
+			}
+			else
+			{
+				_turbulence.TurbulateFractal(x.data(), y.data(), out, count);
+				_simplex.Fractal(x.data(), y.data(), out, count);
+			}
+		}
+	};
+
+	/*
+		a box of samples -- sample (x, y, z) sits at (x, y, z) * spacing * 2^lod in noise space
+		depth is 0 for 2D fields
+	*/
+	struct NoiseFieldRegion
+	{
+		i32 x = 0;
+		i32 y = 0;
+		i32 z = 0;
+		ui32 width = 0;
+		ui32 height = 0;
+		ui32 depth = 0;
+		ui32 lod = 0;
+
+		bl Is3D() const
+		{
+			return depth != 0;
+		}
+
+		siz GetSampleCount() const
+		{
+			return (siz)width * (siz)height * (Is3D() ? (siz)depth : 1);
+		}
+	};
+
+	struct NoiseFieldStats
+	{
+		ui64 tiles_hit = 0;
+		ui64 tiles_generated = 0;
+	};
+
+	/*
+		fills regions of noise by splitting them into fixed, cache sized tiles that are generated in parallel on the
+		job system and kept in an lru cache -- tiles sit on a grid per lod, so panning or re-querying an overlapping
+		region only generates the tiles it has not seen
+
+		the calling thread generates tiles alongside the workers, so Generate works (serially) even when the job
+		system is not running
+	*/
+	class NoiseField
+	{
+	public:
+		constexpr static ui32 TILE_SIZE_2D = NP_ENGINE_NOISE_FIELD_TILE_SIZE_2D;
+		constexpr static ui32 TILE_SIZE_3D = NP_ENGINE_NOISE_FIELD_TILE_SIZE_3D;
+
+	private:
+		struct TileKey
+		{
+			ui64 source_key = 0;
+			ui32 spacing_bits = 0;
+			ui32 lod = 0;
+			i32 x = 0;
+			i32 y = 0;
+			i32 z = 0;
+			bl is_3d = false;
+
+			bl operator==(const TileKey& other) const
+			{
+				return source_key == other.source_key && spacing_bits == other.spacing_bits && lod == other.lod &&
+					x == other.x && y == other.y && z == other.z && is_3d == other.is_3d;
+			}
+		};
+
+		struct TileKeyHash
+		{
+			siz operator()(const TileKey& key) const
+			{
+				const i32 coordinates[] = {key.x, key.y, key.z, (i32)key.lod, (i32)key.spacing_bits, (i32)key.is_3d};
+				return (siz)mat::hash_fnv1a_ui64(coordinates, sizeof(coordinates), key.source_key);
+			}
+		};
+
+		struct Tile
+		{
+			TileKey key;
+			con::vector<flt> samples;
+		};
+
+		using TileList = con::list<mem::sptr<Tile>>;
+
+		/*
+			sample coordinates for CreateTile, one per ParallelFor participant so they are reused across its tiles
+		*/
+		struct TileScratch
+		{
+			con::vector<flt> xs;
+			con::vector<flt> ys;
+			con::vector<flt> zs;
+		};
+
+		/*
+			one per Generate call, given to its ParallelFor
+		*/
+		struct GenerateState
+		{
+			NoiseField* field;
+			const NoiseFieldSource* source;
+			NoiseFieldRegion region;
+			flt spacing;
+			flt* out;
+			con::vector<TileKey> missing_tiles;
+			con::vector<TileScratch> scratches;
+		};
+
+		mem::trait_allocator _allocator;
+		jsys::JobSystem* _job_system;
+		flt _spacing;
+		siz _capacity;
+
+		mutex _cache_mutex;
+		TileList _tiles; // most recently used at the front
+		con::umap<TileKey, TileList::iterator, TileKeyHash> _tile_lookup;
+		NoiseFieldStats _stats;
+
+		static i32 FloorDivide(i32 a, i32 b)
+		{
+			return a / b - (a % b != 0 && (a < 0) != (b < 0));
+		}
+
+		static ui32 GetTileSize(bl is_3d)
+		{
+			return is_3d ? TILE_SIZE_3D : TILE_SIZE_2D;
+		}
+
+		static siz GetTileSampleCount(bl is_3d)
+		{
+			const siz size = GetTileSize(is_3d);
+			return is_3d ? size * size * size : size * size;
+		}
+
+		mem::sptr<Tile> FindTile(const TileKey& key)
+		{
+			mem::sptr<Tile> tile = nullptr;
+			auto it = _tile_lookup.find(key);
+			if (it != _tile_lookup.end())
+			{
+				_tiles.splice(_tiles.begin(), _tiles, it->second);
+				tile = *it->second;
+			}
+			return tile;
+		}
+
+		void InsertTile(mem::sptr<Tile> tile)
+		{
+			general_lock lock(_cache_mutex);
+			if (_tile_lookup.find(tile->key) == _tile_lookup.end())
+			{
+				_tiles.emplace_front(tile);
+				_tile_lookup.emplace(tile->key, _tiles.begin());
+				Trim();
+			}
+		}
+
+		void Trim()
+		{
+			while (_tiles.size() > _capacity)
+			{
+				_tile_lookup.erase(_tiles.back()->key);
+				_tiles.pop_back();
+			}
+		}
+
+		mem::sptr<Tile> CreateTile(const TileKey& key, const NoiseFieldSource& source, flt spacing, con::vector<flt>& xs,
+								   con::vector<flt>& ys, con::vector<flt>& zs)
+		{
+			const ui32 size = GetTileSize(key.is_3d);
+			const siz count = GetTileSampleCount(key.is_3d);
+			const flt step = spacing * (flt)BIT(key.lod);
+
+			mem::sptr<Tile> tile = mem::create_sptr<Tile>(_allocator);
+			tile->key = key;
+			tile->samples.resize(count);
+			xs.resize(count);
+			ys.resize(count);
+			zs.resize(count);
+
+			for (siz i = 0; i < count; i++)
+			{
+				xs[i] = (flt)((i64)key.x * size + (i64)(i % size)) * step;
+				ys[i] = (flt)((i64)key.y * size + (i64)((i / size) % size)) * step;
+				zs[i] = (flt)((i64)key.z * size + (i64)(i / ((siz)size * size))) * step;
+			}
+
+			source.Calculate(xs.data(), ys.data(), key.is_3d ? zs.data() : nullptr, tile->samples.data(), count);
+			return tile;
+		}
+
+		/*
+			copies the part of tile that overlaps region into out
+		*/
+		static void CopyTile(const Tile& tile, const NoiseFieldRegion& region, flt* out)
+		{
+			const bl is_3d = tile.key.is_3d;
+			const i64 size = GetTileSize(is_3d);
+			const i64 tile_x = (i64)tile.key.x * size;
+			const i64 tile_y = (i64)tile.key.y * size;
+			const i64 tile_z = (i64)tile.key.z * size;
+
+			const i64 begin_x = ::std::max(tile_x, (i64)region.x);
+			const i64 end_x = ::std::min(tile_x + size, (i64)region.x + region.width);
+			const i64 begin_y = ::std::max(tile_y, (i64)region.y);
+			const i64 end_y = ::std::min(tile_y + size, (i64)region.y + region.height);
+			const i64 begin_z = is_3d ? ::std::max(tile_z, (i64)region.z) : 0;
+			const i64 end_z = is_3d ? ::std::min(tile_z + size, (i64)region.z + region.depth) : 1;
+
+			for (i64 z = begin_z; z < end_z; z++)
+			{
+				for (i64 y = begin_y; y < end_y; y++)
+				{
+					const i64 tile_row = ((is_3d ? z - tile_z : 0) * size + (y - tile_y)) * size;
+					const i64 out_row = ((is_3d ? z - region.z : 0) * region.height + (y - region.y)) * region.width;
+					::std::copy_n(tile.samples.data() + tile_row + (begin_x - tile_x), end_x - begin_x,
+								  out + out_row + (begin_x - region.x));
+				}
+			}
+		}
+
+		static void GenerateTile(void* payload, siz participant, siz index)
+		{
+			GenerateState& state = *(GenerateState*)payload;
+			TileScratch& scratch = state.scratches[participant];
+			mem::sptr<Tile> tile = state.field->CreateTile(state.missing_tiles[index], *state.source, state.spacing,
+														   scratch.xs, scratch.ys, scratch.zs);
+			CopyTile(*tile, state.region, state.out);
+			state.field->InsertTile(tile);
+		}
+
+	public:
+		/*
+			job_system may be nullptr to generate on the calling thread only
+		*/
+		NoiseField(jsys::JobSystem* job_system = nullptr):
+			_job_system(job_system),
+			_spacing(1.f),
+			_capacity(NP_ENGINE_NOISE_FIELD_CACHE_CAPACITY)
+		{}
+
+		void SetJobSystem(jsys::JobSystem* job_system)
+		{
+			_job_system = job_system;
+		}
+
+		/*
+			distance between lod 0 samples in noise space -- part of the tile key, so changing it does not clear the cache
+		*/
+		void SetSpacing(flt spacing)
+		{
+			_spacing = spacing;
+		}
+
+		flt GetSpacing() const
+		{
+			return _spacing;
+		}
+
+		void SetCacheCapacity(siz tile_count)
+		{
+			general_lock lock(_cache_mutex);
+			_capacity = tile_count;
+			Trim();
+		}
+
+		siz GetCacheCapacity() const
+		{
+			return _capacity;
+		}
+
+		siz GetCachedTileCount()
+		{
+			general_lock lock(_cache_mutex);
+			return _tiles.size();
+		}
+
+		void ClearCache()
+		{
+			general_lock lock(_cache_mutex);
+			_tile_lookup.clear();
+			_tiles.clear();
+		}
+
+		NoiseFieldStats GetStats()
+		{
+			general_lock lock(_cache_mutex);
+			return _stats;
+		}
+
+		/*
+			writes region.GetSampleCount() samples to out -- x fastest, then y, then z
+		*/
+		void Generate(const NoiseFieldSource& source, const NoiseFieldRegion& region, flt* out)
+		{
+			if (region.GetSampleCount() == 0)
+				return;
+
+			const bl is_3d = region.Is3D();
+			const i32 size = (i32)GetTileSize(is_3d);
+			const i32 first_x = FloorDivide(region.x, size);
+			const i32 last_x = FloorDivide((i32)((i64)region.x + region.width - 1), size);
+			const i32 first_y = FloorDivide(region.y, size);
+			const i32 last_y = FloorDivide((i32)((i64)region.y + region.height - 1), size);
+			const i32 first_z = is_3d ? FloorDivide(region.z, size) : 0;
+			const i32 last_z = is_3d ? FloorDivide((i32)((i64)region.z + region.depth - 1), size) : 0;
+
+			TileKey key{};
+			key.source_key = source.GetKey();
+			mem::copy_bytes(mem::address_of(key.spacing_bits), mem::address_of(_spacing), sizeof(flt));
+			key.lod = region.lod;
+			key.is_3d = is_3d;
+
+			con::vector<mem::sptr<Tile>> cached_tiles;
+			GenerateState state{};
+			state.field = this;
+			state.source = mem::address_of(source);
+			state.region = region;
+			state.spacing = _spacing;
+			state.out = out;
+
+			{
+				general_lock lock(_cache_mutex);
+				for (key.z = first_z; key.z <= last_z; key.z++)
+				{
+					for (key.y = first_y; key.y <= last_y; key.y++)
+					{
+						for (key.x = first_x; key.x <= last_x; key.x++)
+						{
+							mem::sptr<Tile> tile = FindTile(key);
+							if (tile)
+								cached_tiles.emplace_back(tile);
+							else
+								state.missing_tiles.emplace_back(key);
+						}
+					}
+				}
+
+				_stats.tiles_hit += cached_tiles.size();
+				_stats.tiles_generated += state.missing_tiles.size();
+			}
+
+			for (const mem::sptr<Tile>& tile : cached_tiles)
+				CopyTile(*tile, region, out);
+
+			const siz missing_count = state.missing_tiles.size();
+			state.scratches.resize(_job_system ? _job_system->GetJobWokerCount() + 1 : 1);
+			if (_job_system)
+			{
+				_job_system->ParallelFor(missing_count, GenerateTile, mem::address_of(state));
+			}
+			else
+			{
+				for (siz i = 0; i < missing_count; i++)
+					GenerateTile(mem::address_of(state), 0, i);
+			}
+		}
+
+		void Generate(const NoiseFieldSource& source, const NoiseFieldRegion& region, con::vector<flt>& out)
+		{
+			out.resize(region.GetSampleCount());
+			Generate(source, region, out.data());
+		}
+
+		/*
+			2D regions only -- resizes image to the region and maps [-1, 1] to opaque grayscale
+		*/
+		void Generate(const NoiseFieldSource& source, const NoiseFieldRegion& region, gpu::Image& image)
+		{
+			NP_ENGINE_ASSERT(!region.Is3D(), "only 2D noise fields can be written to an image");
+
+			con::vector<flt> samples;
+			Generate(source, region, samples);
+
+			if (image.GetWidth() != region.width || image.GetHeight() != region.height)
+				image.SetSize(region.width, region.height);
+
+			gpu::Color color{};
+			for (ui32 y = 0; y < region.height; y++)
+			{
+				for (ui32 x = 0; x < region.width; x++)
+				{
+					const flt value = ::std::clamp(samples[(siz)y * region.width + x] * 0.5f + 0.5f, 0.f, 1.f);
+					color.r = color.g = color.b = (ui8)(value * UI8_MAX + 0.5f);
+					image.Set(x, y, color);
+				}
+			}
+		}
+	};
+} // namespace np::noiz
+
+#endif /* NP_ENGINE_NOISE_FIELD_HPP */
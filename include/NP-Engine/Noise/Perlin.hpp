@@ -13,7 +13,7 @@
 #include "NP-Engine/Random/Random.hpp"
 #include "NP-Engine/Math/Math.hpp"
 
-// TODO: add SIMD
+#include "NoiseBatch.hpp"
 
 namespace np::noiz
 {
@@ -175,6 +175,25 @@ namespace np::noiz
 			}
 		}
 
+		inline void GetBatchPermutation(NoiseBatchPermutation& permutation) const
+		{
+			NP_ENGINE_STATIC_ASSERT(NoiseBatchPermutation::SIZE == PERMUTATION_SIZE, "batch permutation must match ours");
+			for (siz i = 0; i < PERMUTATION_SIZE; i++)
+				permutation.values[i] = _permutation[i];
+		}
+
+		inline NoiseBatchOctaves GetBatchOctaves() const
+		{
+			NoiseBatchOctaves octaves;
+			octaves.frequency = _frequency;
+			octaves.amplitude = _amplitude;
+			octaves.lacunarity = _lacunarity;
+			octaves.persistence = _persistence;
+			octaves.octave_count = _octave_count;
+			octaves.is_fractal = true;
+			return octaves;
+		}
+
 	public:
 		Perlin(const rng::Random64& engine = rng::Random64()): rng::Random64Base(engine)
 		{
@@ -333,6 +352,26 @@ namespace np::noiz
 			return _warp_octave_displacement;
 		}
 
+		/*
+			covers the permutation and every property, so equal hashes give equal noise
+		*/
+		inline ui64 GetHash() const
+		{
+			const flt properties[] = {_frequency,
+									  _amplitude,
+									  _lacunarity,
+									  _persistence,
+									  _fractional_increment,
+									  _warp_octave_multiplier,
+									  _warp_octave_increment,
+									  _warp_octave_displacement};
+			const ui8 counts[] = {_octave_count, _rigidity, _warp_octave_count};
+
+			ui64 hash = mat::hash_fnv1a_ui64(_permutation, PERMUTATION_SIZE);
+			hash = mat::hash_fnv1a_ui64(properties, sizeof(properties), hash);
+			return mat::hash_fnv1a_ui64(counts, sizeof(counts), hash);
+		}
+
 		inline flt operator()(flt x, flt y, flt z) const
 		{
 			return GetAmplitude() * CalculateNoiseValue(GetFrequency() * x, GetFrequency() * y, GetFrequency() * z);
@@ -402,6 +441,46 @@ namespace np::noiz
 			return output / denom;
 		}
 
+		/*
+			batch CalculateNoiseValue -- out[i] is the noise at (xs[i], ys[i], zs[i])
+			runs on the kernels NoiseBatch picked (see NoiseBatch.hpp for how closely they match), else loops the scalar
+			function
+		*/
+		inline void CalculateNoiseValues(const flt* xs, const flt* ys, const flt* zs, flt* out, siz count) const
+		{
+			const __detail::NoiseBatchKernels* kernels = NoiseBatch::GetKernels();
+			if (kernels)
+			{
+				NoiseBatchPermutation permutation;
+				GetBatchPermutation(permutation);
+				kernels->perlin_3d(permutation, NoiseBatchOctaves{}, xs, ys, zs, out, count);
+			}
+			else
+			{
+				for (siz i = 0; i < count; i++)
+					out[i] = CalculateNoiseValue(xs[i], ys[i], zs[i]);
+			}
+		}
+
+		/*
+			batch Fractal -- out[i] is the fractal at (xs[i], ys[i], zs[i])
+		*/
+		inline void Fractal(const flt* xs, const flt* ys, const flt* zs, flt* out, siz count) const
+		{
+			const __detail::NoiseBatchKernels* kernels = NoiseBatch::GetKernels();
+			if (kernels)
+			{
+				NoiseBatchPermutation permutation;
+				GetBatchPermutation(permutation);
+				kernels->perlin_3d(permutation, GetBatchOctaves(), xs, ys, zs, out, count);
+			}
+			else
+			{
+				for (siz i = 0; i < count; i++)
+					out[i] = Fractal(xs[i], ys[i], zs[i]);
+			}
+		}
+
 		inline flt Fractional(flt x, flt y) const
 		{
 			flt output = 0.f;
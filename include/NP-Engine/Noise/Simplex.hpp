@@ -13,7 +13,7 @@
 #include "NP-Engine/Random/Random.hpp"
 #include "NP-Engine/Math/Math.hpp"
 
-// TODO: add SIMD
+#include "NoiseBatch.hpp"
 
 namespace np::noiz
 {
@@ -203,6 +203,27 @@ namespace np::noiz
 				_permutation[i] = i;
 		}
 
+		/*
+			Hash wraps with (ui8) so the upper half just repeats
+		*/
+		inline void GetBatchPermutation(NoiseBatchPermutation& permutation) const
+		{
+			for (siz i = 0; i < NoiseBatchPermutation::SIZE; i++)
+				permutation.values[i] = _permutation[i % PERMUTATION_SIZE];
+		}
+
+		inline NoiseBatchOctaves GetBatchOctaves() const
+		{
+			NoiseBatchOctaves octaves;
+			octaves.frequency = _frequency;
+			octaves.amplitude = _amplitude;
+			octaves.lacunarity = _lacunarity;
+			octaves.persistence = _persistence;
+			octaves.octave_count = _octave_count;
+			octaves.is_fractal = true;
+			return octaves;
+		}
+
 	public:
 		Simplex(const rng::Random64& engine = rng::Random64()): rng::Random64Base(engine)
 		{
@@ -357,6 +378,26 @@ namespace np::noiz
 			return _warp_octave_displacement;
 		}
 
+		/*
+			covers the permutation and every property, so equal hashes give equal noise
+		*/
+		inline ui64 GetHash() const
+		{
+			const flt properties[] = {_frequency,
+									  _amplitude,
+									  _lacunarity,
+									  _persistence,
+									  _fractional_increment,
+									  _warp_octave_multiplier,
+									  _warp_octave_increment,
+									  _warp_octave_displacement};
+			const ui8 counts[] = {_octave_count, _rigidity, _warp_octave_count};
+
+			ui64 hash = mat::hash_fnv1a_ui64(_permutation, PERMUTATION_SIZE);
+			hash = mat::hash_fnv1a_ui64(properties, sizeof(properties), hash);
+			return mat::hash_fnv1a_ui64(counts, sizeof(counts), hash);
+		}
+
 		inline flt operator()(flt x) const
 		{
 			return GetAmplitude() * CalculateNoiseValue(GetFrequency() * x);
@@ -894,6 +935,78 @@ namespace np::noiz
 			return output / denom;
 		}
 
+		/*
+			batch CalculateNoiseValue -- out[i] is the noise at (xs[i], ys[i])
+			runs on the kernels NoiseBatch picked (see NoiseBatch.hpp for how closely they match), else loops the scalar
+			function
+		*/
+		inline void CalculateNoiseValues(const flt* xs, const flt* ys, flt* out, siz count) const
+		{
+			const __detail::NoiseBatchKernels* kernels = NoiseBatch::GetKernels();
+			if (kernels)
+			{
+				NoiseBatchPermutation permutation;
+				GetBatchPermutation(permutation);
+				kernels->simplex_2d(permutation, NoiseBatchOctaves{}, xs, ys, nullptr, out, count);
+			}
+			else
+			{
+				for (siz i = 0; i < count; i++)
+					out[i] = CalculateNoiseValue(xs[i], ys[i]);
+			}
+		}
+
+		inline void CalculateNoiseValues(const flt* xs, const flt* ys, const flt* zs, flt* out, siz count) const
+		{
+			const __detail::NoiseBatchKernels* kernels = NoiseBatch::GetKernels();
+			if (kernels)
+			{
+				NoiseBatchPermutation permutation;
+				GetBatchPermutation(permutation);
+				kernels->simplex_3d(permutation, NoiseBatchOctaves{}, xs, ys, zs, out, count);
+			}
+			else
+			{
+				for (siz i = 0; i < count; i++)
+					out[i] = CalculateNoiseValue(xs[i], ys[i], zs[i]);
+			}
+		}
+
+		/*
+			batch Fractal -- out[i] is the fractal at (xs[i], ys[i])
+		*/
+		inline void Fractal(const flt* xs, const flt* ys, flt* out, siz count) const
+		{
+			const __detail::NoiseBatchKernels* kernels = NoiseBatch::GetKernels();
+			if (kernels)
+			{
+				NoiseBatchPermutation permutation;
+				GetBatchPermutation(permutation);
+				kernels->simplex_2d(permutation, GetBatchOctaves(), xs, ys, nullptr, out, count);
+			}
+			else
+			{
+				for (siz i = 0; i < count; i++)
+					out[i] = Fractal(xs[i], ys[i]);
+			}
+		}
+
+		inline void Fractal(const flt* xs, const flt* ys, const flt* zs, flt* out, siz count) const
+		{
+			const __detail::NoiseBatchKernels* kernels = NoiseBatch::GetKernels();
+			if (kernels)
+			{
+				NoiseBatchPermutation permutation;
+				GetBatchPermutation(permutation);
+				kernels->simplex_3d(permutation, GetBatchOctaves(), xs, ys, zs, out, count);
+			}
+			else
+			{
+				for (siz i = 0; i < count; i++)
+					out[i] = Fractal(xs[i], ys[i], zs[i]);
+			}
+		}
+
 		inline flt Fractional(flt x) const
 		{
 			flt output = 0.f;
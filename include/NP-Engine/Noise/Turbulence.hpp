@@ -154,6 +154,17 @@ namespace np::noiz
 			return _simplexes;
 		}
 
+		inline ui64 GetHash() const
+		{
+			ui64 hash = mat::hash_fnv1a_ui64(&_scalar, sizeof(flt));
+			for (const Simplex& simplex : _simplexes)
+			{
+				const ui64 simplex_hash = simplex.GetHash();
+				hash = mat::hash_fnv1a_ui64(&simplex_hash, sizeof(ui64), hash);
+			}
+			return hash;
+		}
+
 		inline void Turbulate(flt& x) const
 		{
 			x += _simplexes[0](x) * _scalar;
@@ -198,6 +209,35 @@ namespace np::noiz
 			z += _simplexes[2].Fractal(x, y, z) * _scalar;
 		}
 
+		/*
+			batch TurbulateFractal -- scratch must hold count values
+		*/
+		inline void TurbulateFractal(flt* xs, flt* ys, flt* scratch, siz count) const
+		{
+			_simplexes[0].Fractal(xs, ys, scratch, count);
+			for (siz i = 0; i < count; i++)
+				xs[i] += scratch[i] * _scalar;
+
+			_simplexes[1].Fractal(xs, ys, scratch, count);
+			for (siz i = 0; i < count; i++)
+				ys[i] += scratch[i] * _scalar;
+		}
+
+		inline void TurbulateFractal(flt* xs, flt* ys, flt* zs, flt* scratch, siz count) const
+		{
+			_simplexes[0].Fractal(xs, ys, zs, scratch, count);
+			for (siz i = 0; i < count; i++)
+				xs[i] += scratch[i] * _scalar;
+
+			_simplexes[1].Fractal(xs, ys, zs, scratch, count);
+			for (siz i = 0; i < count; i++)
+				ys[i] += scratch[i] * _scalar;
+
+			_simplexes[2].Fractal(xs, ys, zs, scratch, count);
+			for (siz i = 0; i < count; i++)
+				zs[i] += scratch[i] * _scalar;
+		}
+
 		inline void TurbulateFractal(flt& x, flt& y, flt& z, flt& w) const
 		{
 			x += _simplexes[0].Fractal(x, y, z, w) * _scalar;
@@ -7,11 +7,30 @@
 #ifndef NP_ENGINE_SYNC_TYPES_HPP
 #define NP_ENGINE_SYNC_TYPES_HPP
 
+#ifndef NP_ENGINE_SYNC_CONTENTION_ENABLE
+	#define NP_ENGINE_SYNC_CONTENTION_ENABLE false
+#endif
+
+// lets an empty member take no space, msvc only honors its own spelling and we build as C++17
+#if defined(_MSC_VER)
+	#define NP_ENGINE_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+#elif defined(__has_cpp_attribute)
+	#if __has_cpp_attribute(no_unique_address)
+		#define NP_ENGINE_NO_UNIQUE_ADDRESS [[no_unique_address]]
+	#endif
+#endif
+#ifndef NP_ENGINE_NO_UNIQUE_ADDRESS
+	#define NP_ENGINE_NO_UNIQUE_ADDRESS
+#endif
+
 #include <mutex>
+#include <shared_mutex>
 #include <atomic>
 #include <chrono>
 #include <thread>
 #include <condition_variable>
+#include <cstring>
+#include <type_traits>
 
 #include "PrimitiveTypes.hpp"
 
@@ -20,18 +39,154 @@ namespace np
 	using mutex = ::std::mutex;
 	using scoped_lock = ::std::scoped_lock<mutex>;
 	using general_lock = ::std::unique_lock<mutex>;
+	using shared_mutex = ::std::shared_mutex;
+	using shared_lock = ::std::shared_lock<shared_mutex>;
+	using exclusive_lock = ::std::unique_lock<shared_mutex>;
 	using condition = ::std::condition_variable;
 
 	inline constexpr ::std::try_to_lock_t try_lock = ::std::try_to_lock;
 	inline constexpr ::std::defer_lock_t defer_lock = ::std::defer_lock;
 	inline constexpr ::std::adopt_lock_t adopt_lock = ::std::adopt_lock;
 
+	template <typename T>
+	using atm = ::std::atomic<T>;
+
+	using atm_ui8 = ::std::atomic_uint8_t;
+	using atm_ui16 = ::std::atomic_uint16_t;
+	using atm_ui32 = ::std::atomic_uint32_t;
+	using atm_ui64 = ::std::atomic_uint64_t;
+
+	using atm_i8 = ::std::atomic_int8_t;
+	using atm_i16 = ::std::atomic_int16_t;
+	using atm_i32 = ::std::atomic_int32_t;
+	using atm_i64 = ::std::atomic_int64_t;
+	using atm_siz = ::std::atomic_size_t;
+
+	using atm_flt = ::std::atomic<flt>;
+	using atm_dbl = ::std::atomic<dbl>;
+
+	using atm_chr = ::std::atomic_char;
+	using atm_uchr = ::std::atomic_uchar;
+
+	using atm_bl = ::std::atomic_bool;
+	using atm_flag = ::std::atomic_flag;
+
+	inline constexpr ::std::memory_order mo_relaxed = ::std::memory_order_relaxed;
+	inline constexpr ::std::memory_order mo_consume = ::std::memory_order_consume;
+	inline constexpr ::std::memory_order mo_acquire = ::std::memory_order_acquire;
+	inline constexpr ::std::memory_order mo_release = ::std::memory_order_release;
+	inline constexpr ::std::memory_order mo_acq_rel = ::std::memory_order_acq_rel;
+	inline constexpr ::std::memory_order mo_seq_cst = ::std::memory_order_seq_cst;
+	/*
+		how often a wrapper was acquired and how long acquiring it waited -- only counted when
+		NP_ENGINE_SYNC_CONTENTION_ENABLE is true, otherwise always zero
+	*/
+	struct contention_stats
+	{
+		ui64 acquisitions = 0;
+		ui64 contended_acquisitions = 0;
+		::std::chrono::nanoseconds wait_time{0};
+	};
+
+	namespace __detail
+	{
+		class contention_counter
+		{
+		public:
+			constexpr static bl ENABLED = NP_ENGINE_SYNC_CONTENTION_ENABLE;
+
+		private:
+#if NP_ENGINE_SYNC_CONTENTION_ENABLE
+			atm_ui64 _acquisitions{0};
+			atm_ui64 _contended_acquisitions{0};
+			atm_ui64 _wait_nanoseconds{0};
+#endif
+
+		public:
+			void add([[maybe_unused]] bl contended, [[maybe_unused]] ::std::chrono::nanoseconds wait_time)
+			{
+#if NP_ENGINE_SYNC_CONTENTION_ENABLE
+				_acquisitions.fetch_add(1, mo_relaxed);
+				if (contended)
+				{
+					_contended_acquisitions.fetch_add(1, mo_relaxed);
+					_wait_nanoseconds.fetch_add((ui64)wait_time.count(), mo_relaxed);
+				}
+#endif
+			}
+
+			/*
+				locks the given deferred lock, only timing it when the first try fails
+			*/
+			template <typename L>
+			void lock(L& l)
+			{
+				if constexpr (ENABLED)
+				{
+					if (l.try_lock())
+					{
+						add(false, ::std::chrono::nanoseconds{0});
+					}
+					else
+					{
+						::std::chrono::steady_clock::time_point start = ::std::chrono::steady_clock::now();
+						l.lock();
+						add(true, ::std::chrono::steady_clock::now() - start);
+					}
+				}
+				else
+				{
+					l.lock();
+				}
+			}
+
+			/*
+				tries the given deferred lock until it is acquired or the duration passes
+			*/
+			template <typename L, class R, class P>
+			void lock_for(L& l, const ::std::chrono::duration<R, P>& duration)
+			{
+				::std::chrono::steady_clock::time_point start = ::std::chrono::steady_clock::now();
+				bl contended = false;
+				while (!l.try_lock() && (::std::chrono::steady_clock::now() - start) < duration)
+				{
+					contended = true;
+					::std::this_thread::yield();
+				}
+
+				if (l)
+					add(contended, ::std::chrono::steady_clock::now() - start);
+			}
+
+			contention_stats get() const
+			{
+				contention_stats stats{};
+#if NP_ENGINE_SYNC_CONTENTION_ENABLE
+				stats.acquisitions = _acquisitions.load(mo_relaxed);
+				stats.contended_acquisitions = _contended_acquisitions.load(mo_relaxed);
+				stats.wait_time = ::std::chrono::nanoseconds(_wait_nanoseconds.load(mo_relaxed));
+#endif
+				return stats;
+			}
+
+			void reset()
+			{
+#if NP_ENGINE_SYNC_CONTENTION_ENABLE
+				_acquisitions.store(0, mo_relaxed);
+				_contended_acquisitions.store(0, mo_relaxed);
+				_wait_nanoseconds.store(0, mo_relaxed);
+#endif
+			}
+		};
+	} // namespace __detail
+
 	template <typename T>
 	class mutexed_wrapper
 	{
 	protected:
 		mutex _m;
 		T _object;
+		NP_ENGINE_NO_UNIQUE_ADDRESS __detail::contention_counter _contention;
 
 	public:
 		class access
@@ -43,6 +198,11 @@ namespace np
 		public:
 			access(T* object, mutex& m): _l(m), _object(object) {}
 
+			access(T* object, mutex& m, __detail::contention_counter& contention): _l(m, defer_lock), _object(object)
+			{
+				contention.lock(_l);
+			}
+
 			template <class R, class P>
 			access(T* object, mutex& m, const ::std::chrono::duration<R, P>& duration): _l(m, try_lock), _object(nullptr)
 			{
@@ -55,6 +215,17 @@ namespace np
 					_object = object;
 			}
 
+			template <class R, class P>
+			access(T* object, mutex& m, __detail::contention_counter& contention,
+				   const ::std::chrono::duration<R, P>& duration):
+				_l(m, defer_lock),
+				_object(nullptr)
+			{
+				contention.lock_for(_l, duration);
+				if (_l)
+					_object = object;
+			}
+
 			operator bl() const
 			{
 				return _object;
@@ -85,47 +256,266 @@ namespace np
 
 		access get_access()
 		{
-			return {&_object, _m};
+			return {&_object, _m, _contention};
 		}
 
 		template <class R, class P>
 		access try_get_access_for(const ::std::chrono::duration<R, P>& duration)
 		{
-			return {&_object, _m, duration};
+			return {&_object, _m, _contention, duration};
+		}
+
+		contention_stats get_contention() const
+		{
+			return _contention.get();
+		}
+
+		void reset_contention()
+		{
+			_contention.reset();
 		}
 	};
 
-	using condition = ::std::condition_variable;
+	/*
+		mutexed_wrapper for read-mostly objects -- any number of get_shared_access readers hold it at once, and get_access
+		is exclusive
+	*/
+	template <typename T>
+	class shared_mutexed_wrapper
+	{
+	protected:
+		mutable shared_mutex _m;
+		T _object;
+		mutable __detail::contention_counter _contention;
 
+	public:
+		class access
+		{
+		protected:
+			exclusive_lock _l;
+			T* _object;
+
+		public:
+			access(T* object, shared_mutex& m, __detail::contention_counter& contention): _l(m, defer_lock), _object(object)
+			{
+				contention.lock(_l);
+			}
+
+			template <class R, class P>
+			access(T* object, shared_mutex& m, __detail::contention_counter& contention,
+				   const ::std::chrono::duration<R, P>& duration):
+				_l(m, defer_lock),
+				_object(nullptr)
+			{
+				contention.lock_for(_l, duration);
+				if (_l)
+					_object = object;
+			}
+
+			operator bl() const
+			{
+				return _object;
+			}
+
+			T& operator*() const
+			{
+				return *_object;
+			}
+
+			T* operator->() const
+			{
+				return _object;
+			}
+		};
+
+		class shared_access
+		{
+		protected:
+			shared_lock _l;
+			const T* _object;
+
+		public:
+			shared_access(const T* object, shared_mutex& m, __detail::contention_counter& contention):
+				_l(m, defer_lock),
+				_object(object)
+			{
+				contention.lock(_l);
+			}
+
+			template <class R, class P>
+			shared_access(const T* object, shared_mutex& m, __detail::contention_counter& contention,
+						  const ::std::chrono::duration<R, P>& duration):
+				_l(m, defer_lock),
+				_object(nullptr)
+			{
+				contention.lock_for(_l, duration);
+				if (_l)
+					_object = object;
+			}
+
+			operator bl() const
+			{
+				return _object;
+			}
+
+			const T& operator*() const
+			{
+				return *_object;
+			}
+
+			const T* operator->() const
+			{
+				return _object;
+			}
+		};
+
+		template <typename... Args>
+		shared_mutexed_wrapper(Args&&... args): _object(::std::forward<Args>(args)...)
+		{}
+
+		shared_mutexed_wrapper(shared_mutexed_wrapper<T>&& other) noexcept: _object(::std::move(other._object)) {}
+
+		shared_mutexed_wrapper& operator=(shared_mutexed_wrapper<T>&& other) noexcept
+		{
+			_object = ::std::move(other._object);
+			return *this;
+		}
+
+		access get_access()
+		{
+			return {&_object, _m, _contention};
+		}
+
+		shared_access get_shared_access() const
+		{
+			return {&_object, _m, _contention};
+		}
+
+		template <class R, class P>
+		access try_get_access_for(const ::std::chrono::duration<R, P>& duration)
+		{
+			return {&_object, _m, _contention, duration};
+		}
+
+		template <class R, class P>
+		shared_access try_get_shared_access_for(const ::std::chrono::duration<R, P>& duration) const
+		{
+			return {&_object, _m, _contention, duration};
+		}
+
+		contention_stats get_contention() const
+		{
+			return _contention.get();
+		}
+
+		void reset_contention()
+		{
+			_contention.reset();
+		}
+	};
+
+	/*
+		sequence lock for small trivially copyable snapshots (positions, sizes, settings) -- load never blocks store and
+		just copies again when a store overlapped it, while stores are serialized by spinning on an odd sequence
+		the object lives in relaxed atomic words so an overlapping copy is a retry, not a data race
+	*/
 	template <typename T>
-	using atm = ::std::atomic<T>;
+	class seqlock_wrapper
+	{
+	private:
+		static_assert(::std::is_trivially_copyable_v<T>, "seqlock_wrapper requires a trivially copyable type");
+		static_assert(::std::is_default_constructible_v<T>, "seqlock_wrapper requires a default constructible type");
 
-	using atm_ui8 = ::std::atomic_uint8_t;
-	using atm_ui16 = ::std::atomic_uint16_t;
-	using atm_ui32 = ::std::atomic_uint32_t;
-	using atm_ui64 = ::std::atomic_uint64_t;
+		constexpr static siz WORD_COUNT = (sizeof(T) + sizeof(ui64) - 1) / sizeof(ui64);
 
-	using atm_i8 = ::std::atomic_int8_t;
-	using atm_i16 = ::std::atomic_int16_t;
-	using atm_i32 = ::std::atomic_int32_t;
-	using atm_i64 = ::std::atomic_int64_t;
-	using atm_siz = ::std::atomic_size_t;
+		atm_ui64 _sequence;
+		atm_ui64 _words[WORD_COUNT];
+		mutable __detail::contention_counter _contention;
 
-	using atm_flt = ::std::atomic<flt>;
-	using atm_dbl = ::std::atomic<dbl>;
+		void store_words(const T& object)
+		{
+			ui64 words[WORD_COUNT]{};
+			::std::memcpy(words, &object, sizeof(T));
+			for (siz i = 0; i < WORD_COUNT; i++)
+				_words[i].store(words[i], mo_relaxed);
+		}
 
-	using atm_chr = ::std::atomic_char;
-	using atm_uchr = ::std::atomic_uchar;
+	public:
+		seqlock_wrapper(const T& object = T{}): _sequence(0)
+		{
+			store_words(object);
+		}
 
-	using atm_bl = ::std::atomic_bool;
-	using atm_flag = ::std::atomic_flag;
+		T load() const
+		{
+			::std::chrono::steady_clock::time_point start{};
+			bl contended = false;
+			ui64 words[WORD_COUNT];
 
-	inline constexpr ::std::memory_order mo_relaxed = ::std::memory_order_relaxed;
-	inline constexpr ::std::memory_order mo_consume = ::std::memory_order_consume;
-	inline constexpr ::std::memory_order mo_acquire = ::std::memory_order_acquire;
-	inline constexpr ::std::memory_order mo_release = ::std::memory_order_release;
-	inline constexpr ::std::memory_order mo_acq_rel = ::std::memory_order_acq_rel;
-	inline constexpr ::std::memory_order mo_seq_cst = ::std::memory_order_seq_cst;
+			for (;;)
+			{
+				const ui64 sequence = _sequence.load(mo_acquire);
+				if ((sequence & 1) == 0)
+				{
+					for (siz i = 0; i < WORD_COUNT; i++)
+						words[i] = _words[i].load(mo_relaxed);
+
+					::std::atomic_thread_fence(mo_acquire);
+					if (_sequence.load(mo_relaxed) == sequence)
+						break;
+				}
+
+				if constexpr (__detail::contention_counter::ENABLED)
+					if (!contended)
+						start = ::std::chrono::steady_clock::now();
+
+				contended = true;
+				::std::this_thread::yield();
+			}
+
+			if constexpr (__detail::contention_counter::ENABLED)
+				_contention.add(contended, contended ? ::std::chrono::steady_clock::now() - start : ::std::chrono::nanoseconds{0});
+
+			T object;
+			::std::memcpy(&object, words, sizeof(T));
+			return object;
+		}
+
+		void store(const T& object)
+		{
+			::std::chrono::steady_clock::time_point start{};
+			bl contended = false;
+
+			ui64 sequence = _sequence.load(mo_relaxed);
+			while ((sequence & 1) || !_sequence.compare_exchange_weak(sequence, sequence + 1, mo_acquire, mo_relaxed))
+			{
+				if constexpr (__detail::contention_counter::ENABLED)
+					if (!contended)
+						start = ::std::chrono::steady_clock::now();
+
+				contended = true;
+				::std::this_thread::yield();
+				sequence = _sequence.load(mo_relaxed);
+			}
+
+			::std::atomic_thread_fence(mo_release);
+			store_words(object);
+			_sequence.store(sequence + 2, mo_release);
+
+			if constexpr (__detail::contention_counter::ENABLED)
+				_contention.add(contended, contended ? ::std::chrono::steady_clock::now() - start : ::std::chrono::nanoseconds{0});
+		}
+
+		contention_stats get_contention() const
+		{
+			return _contention.get();
+		}
+
+		void reset_contention()
+		{
+			_contention.reset();
+		}
+	};
 } // namespace np
 
 #endif /* NP_ENGINE_SYNC_TYPES_HPP */
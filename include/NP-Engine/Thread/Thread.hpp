@@ -86,6 +86,11 @@ namespace np::thr
 
 		bl set_affinity(siz core_number);
 
+		/*
+			cpu time this thread has spent running, zero when it is not running or the platform cannot tell us
+		*/
+		tim::nanoseconds get_cpu_time();
+
 		id get_id()
 		{
 			auto thread_access = _thread_block.get_access();
@@ -99,6 +104,8 @@ namespace np::thr
 		using namespace ::std::this_thread;
 
 		bl set_affinity(siz core_number);
+
+		tim::nanoseconds get_cpu_time();
 	} // namespace this_thread
 
 	using thread_pool = mem::object_pool<thread, thread::ALIGNMENT>;
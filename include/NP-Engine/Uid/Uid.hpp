@@ -10,6 +10,22 @@
 #define NP_ENGINE_UID_HANDLE_INVALID_KEY 0
 #define NP_ENGINE_UID_HANDLE_INVALID_GENERATION 0
 
+// slots are allocated a page at a time, and pages are never moved so lookups need no lock
+#ifndef NP_ENGINE_UID_SYSTEM_PAGE_SIZE_BIT
+	#define NP_ENGINE_UID_SYSTEM_PAGE_SIZE_BIT 10
+#endif
+
+#ifndef NP_ENGINE_UID_SYSTEM_MAX_PAGE_COUNT
+	#define NP_ENGINE_UID_SYSTEM_MAX_PAGE_COUNT 4096
+#endif
+
+// the set of uids in use is split into this many shards so Has and CreateUid rarely contend
+#ifndef NP_ENGINE_UID_SYSTEM_SHARD_COUNT
+	#define NP_ENGINE_UID_SYSTEM_SHARD_COUNT 16
+#endif
+
+#include <type_traits>
+
 #include "NP-Engine/Primitive/Primitive.hpp"
 #include "NP-Engine/Container/Container.hpp"
 #include "NP-Engine/Memory/Memory.hpp"
@@ -91,151 +107,248 @@ namespace np::uid
 			}
 		};
 
-		struct UidRecord
+		constexpr static siz PAGE_SIZE = BIT(NP_ENGINE_UID_SYSTEM_PAGE_SIZE_BIT);
+		constexpr static siz PAGE_MASK = PAGE_SIZE - 1;
+		constexpr static siz MAX_PAGE_COUNT = NP_ENGINE_UID_SYSTEM_MAX_PAGE_COUNT;
+		constexpr static siz MAX_KEY_COUNT = PAGE_SIZE * MAX_PAGE_COUNT;
+		constexpr static siz SHARD_COUNT = NP_ENGINE_UID_SYSTEM_SHARD_COUNT;
+
+		NP_ENGINE_STATIC_ASSERT(MAX_KEY_COUNT <= UI32_MAX, "UidHandle::KeyType must be able to index every slot");
+		NP_ENGINE_STATIC_ASSERT(sizeof(Uid) == sizeof(ui64) * 2 && ::std::is_trivially_copyable_v<Uid>,
+								"UidSlot stores a Uid as two words");
+
+		/*
+			a uid is stored as two atomic words so a lookup never reads a torn uid
+			lookups check the generation before and after reading the words, so a slot reused mid-read is caught
+		*/
+		struct UidSlot
 		{
-			mem::sptr<Uid> uidSptr = nullptr;
-			UidHandle::GenerationType generation = NP_ENGINE_UID_HANDLE_INVALID_GENERATION;
-
-			bl IsValid() const
-			{
-				return uidSptr && generation != NP_ENGINE_UID_HANDLE_INVALID_GENERATION;
-			}
-
-			operator bl() const
-			{
-				return IsValid();
-			}
-
-			void Invalidate()
-			{
-				uidSptr.reset();
-				generation = NP_ENGINE_UID_HANDLE_INVALID_GENERATION;
-			}
+			atm<UidHandle::GenerationType> generation{NP_ENGINE_UID_HANDLE_INVALID_GENERATION};
+			atm_ui64 uidWords[2]{};
+			atm<UidHandle::KeyType> nextFreeKey{NP_ENGINE_UID_HANDLE_INVALID_KEY};
 		};
 
-		struct UidBookKeeping
+		struct UidPage
 		{
-			UidHandle nextHandle;
-			UidGenerator generator;
-			con::uset<UidHandle::KeyType> releasedKeys;
-			con::umap<UidHandle::KeyType, UidRecord> keyToRecord;
-			con::uset<Uid> masterSet;
+			UidSlot slots[PAGE_SIZE];
 		};
 
 		mem::trait_allocator _allocator;
 		const HndlDestroyer _destroyer;
-		mem::accumulating_pool<Uid, mem::DEFAULT_ALIGNMENT> _pool;
-		mutexed_wrapper<UidBookKeeping> _bookkeeping;
+		atm<UidPage*> _pages[MAX_PAGE_COUNT];
+		atm<UidHandle::KeyType> _next_key;
+		atm_ui64 _free_keys; // head of our free key stack as (tag << 32) | key, the tag keeps us clear of aba
+		mutexed_wrapper<con::uset<Uid>> _shards[SHARD_COUNT];
 
-		static UidHandle::KeyType GetNextKey(UidBookKeeping& bookkeeping)
+		static UidGenerator& GetGenerator()
 		{
-			UidHandle::KeyType k = NP_ENGINE_UID_HANDLE_INVALID_KEY;
+			thread_local UidGenerator generator{};
+			return generator;
+		}
 
-			if (bookkeeping.releasedKeys.size())
+		static UidHandle::GenerationType GetNextGeneration(UidHandle::GenerationType generation)
+		{
+			do
+				++generation;
+			while (generation == NP_ENGINE_UID_HANDLE_INVALID_GENERATION);
+			return generation;
+		}
+
+		static siz GetShardIndex(const Uid& id)
+		{
+			return ::std::hash<Uid>{}(id) % SHARD_COUNT;
+		}
+
+		static void StoreUid(UidSlot& slot, const Uid& id)
+		{
+			ui64 words[2]{};
+			mem::copy_bytes(words, &id, sizeof(Uid));
+			slot.uidWords[0].store(words[0], mo_relaxed);
+			slot.uidWords[1].store(words[1], mo_relaxed);
+		}
+
+		static Uid LoadUid(const UidSlot& slot)
+		{
+			const ui64 words[2]{slot.uidWords[0].load(mo_relaxed), slot.uidWords[1].load(mo_relaxed)};
+			Uid id{};
+			mem::copy_bytes(&id, words, sizeof(Uid));
+			return id;
+		}
+
+		UidSlot* GetSlot(UidHandle::KeyType key) const
+		{
+			UidPage* page = key < MAX_KEY_COUNT ? _pages[key >> NP_ENGINE_UID_SYSTEM_PAGE_SIZE_BIT].load(mo_acquire) : nullptr;
+			return page ? &page->slots[key & PAGE_MASK] : nullptr;
+		}
+
+		UidSlot* GetOrCreateSlot(UidHandle::KeyType key)
+		{
+			UidSlot* slot = GetSlot(key);
+			if (!slot && key < MAX_KEY_COUNT)
 			{
-				k = *bookkeeping.releasedKeys.begin();
-				bookkeeping.releasedKeys.erase(bookkeeping.releasedKeys.begin());
+				atm<UidPage*>& page = _pages[key >> NP_ENGINE_UID_SYSTEM_PAGE_SIZE_BIT];
+				UidPage* expected = nullptr;
+				UidPage* created = mem::create<UidPage>(_allocator);
+
+				if (created && !page.compare_exchange_strong(expected, created, mo_acq_rel, mo_acquire))
+					mem::destroy<UidPage>(_allocator, created); //another thread beat us to it
+
+				slot = GetSlot(key);
 			}
-			else
+			return slot;
+		}
+
+		UidHandle::KeyType AcquireKey()
+		{
+			ui64 head = _free_keys.load(mo_acquire);
+			while ((UidHandle::KeyType)head != NP_ENGINE_UID_HANDLE_INVALID_KEY)
 			{
-				do
-					++bookkeeping.nextHandle.key;
-				while (bookkeeping.nextHandle.key == NP_ENGINE_UID_HANDLE_INVALID_KEY);
-				k = bookkeeping.nextHandle.key;
+				const UidHandle::KeyType key = (UidHandle::KeyType)head;
+				const UidHandle::KeyType next = GetSlot(key)->nextFreeKey.load(mo_relaxed);
+				const ui64 desired = (((head >> 32) + 1) << 32) | next;
+				if (_free_keys.compare_exchange_weak(head, desired, mo_acq_rel, mo_acquire))
+					return key;
 			}
 
-			return k;
+			const UidHandle::KeyType key = _next_key.fetch_add(1, mo_relaxed);
+			return key < MAX_KEY_COUNT ? key : NP_ENGINE_UID_HANDLE_INVALID_KEY;
 		}
 
-		static UidHandle::GenerationType GetNextGeneration(UidBookKeeping& bookkeeping)
+		void ReleaseKey(UidHandle::KeyType key)
 		{
+			UidSlot* slot = GetSlot(key);
+			ui64 head = _free_keys.load(mo_relaxed);
 			do
-				++bookkeeping.nextHandle.generation;
-			while (bookkeeping.nextHandle.generation == NP_ENGINE_UID_HANDLE_INVALID_GENERATION);
-			return bookkeeping.nextHandle.generation;
+				slot->nextFreeKey.store((UidHandle::KeyType)head, mo_relaxed);
+			while (!_free_keys.compare_exchange_weak(head, (((head >> 32) + 1) << 32) | key, mo_release, mo_relaxed));
 		}
 
 		void ReleaseHandle(UidHandle& hndl)
 		{
 			if (hndl.IsValid())
 			{
-				auto bookkeeping = _bookkeeping.get_access();
-				auto it = bookkeeping->keyToRecord.find(hndl.key);
-				if (it != bookkeeping->keyToRecord.end())
+				UidSlot* slot = GetSlot(hndl.key);
+				if (slot)
 				{
-					UidRecord record = it->second;
-					if (hndl.generation == record.generation && _pool.contains(record.uidSptr))
+					//the slot is ours until we bump its generation, so the uid we read here is stable
+					const Uid id = LoadUid(*slot);
+					UidHandle::GenerationType generation = hndl.generation;
+					if (slot->generation.compare_exchange_strong(generation, GetNextGeneration(generation), mo_acq_rel,
+																 mo_relaxed))
 					{
-						bookkeeping->keyToRecord.erase(it);
-						bookkeeping->releasedKeys.emplace(hndl.key);
-						bookkeeping->masterSet.erase(*record.uidSptr);
-						record.Invalidate();
-						hndl.Invalidate();
+						_shards[GetShardIndex(id)].get_access()->erase(id);
+						ReleaseKey(hndl.key);
 					}
 				}
+				hndl.Invalidate();
 			}
 		}
 
 	public:
-		UidSystem(): _destroyer(*this, _allocator) {}
+		UidSystem():
+			_destroyer(*this, _allocator),
+			_next_key(NP_ENGINE_UID_HANDLE_INVALID_KEY + 1),
+			_free_keys(NP_ENGINE_UID_HANDLE_INVALID_KEY)
+		{
+			for (siz i = 0; i < MAX_PAGE_COUNT; i++)
+				_pages[i].store(nullptr, mo_relaxed);
+		}
 
 		~UidSystem()
 		{
 			Dispose();
+
+			for (siz i = 0; i < MAX_PAGE_COUNT; i++)
+			{
+				UidPage* page = _pages[i].exchange(nullptr, mo_acq_rel);
+				if (page)
+					mem::destroy<UidPage>(_allocator, page);
+			}
 		}
 
+		/*
+			invalidates every handle, but keeps our pages around for reuse
+			this is not meant to race with CreateUid or handles being released
+		*/
 		void Dispose()
 		{
+			for (siz i = 0; i < MAX_PAGE_COUNT; i++)
 			{
-				auto bookkeeping = _bookkeeping.get_access();
-				bookkeeping->keyToRecord.clear();
-				bookkeeping->masterSet.clear();
-				bookkeeping->releasedKeys.clear();
-				bookkeeping->nextHandle = UidHandle{};
+				UidPage* page = _pages[i].load(mo_acquire);
+				if (page)
+					for (siz j = 0; j < PAGE_SIZE; j++)
+					{
+						UidSlot& slot = page->slots[j];
+						slot.generation.store(GetNextGeneration(slot.generation.load(mo_relaxed)), mo_release);
+						slot.nextFreeKey.store(NP_ENGINE_UID_HANDLE_INVALID_KEY, mo_relaxed);
+					}
 			}
-			_pool.clear();
+
+			_free_keys.store(NP_ENGINE_UID_HANDLE_INVALID_KEY, mo_release);
+			_next_key.store(NP_ENGINE_UID_HANDLE_INVALID_KEY + 1, mo_release);
+
+			for (siz i = 0; i < SHARD_COUNT; i++)
+				_shards[i].get_access()->clear();
 		}
 
 		mem::sptr<UidHandle> CreateUid()
 		{
 			mem::sptr<UidHandle> hndl = nullptr;
-			mem::sptr<Uid> id = _pool.create_object();
+			const UidHandle::KeyType key = AcquireKey();
+			UidSlot* slot = key != NP_ENGINE_UID_HANDLE_INVALID_KEY ? GetOrCreateSlot(key) : nullptr;
 
-			if (id)
+			if (slot)
 			{
-				auto bookkeeping = _bookkeeping.get_access();
-				do
-					*id = bookkeeping->generator();
-				while (bookkeeping->masterSet.count(*id));
-				bookkeeping->masterSet.emplace(*id);
+				Uid id{};
+				UidGenerator& generator = GetGenerator();
+				for (bl inserted = false; !inserted;)
+				{
+					id = generator();
+					inserted = _shards[GetShardIndex(id)].get_access()->emplace(id).second;
+				}
+
+				//only we own this key right now, so the uid is written before the generation publishes it
+				//the fence keeps the release's generation bump ahead of our words, like seqlock_wrapper's writer, so a
+				//stale GetUid that reads our words is sure to see the bump when it checks the generation again
+				::std::atomic_thread_fence(mo_release);
+				StoreUid(*slot, id);
+				const UidHandle::GenerationType generation = GetNextGeneration(slot->generation.load(mo_relaxed));
+				slot->generation.store(generation, mo_release);
 
-				const UidHandle next{GetNextKey(*bookkeeping), GetNextGeneration(*bookkeeping)};
 				HndlBlock* blocks = mem::create<HndlBlock>(_allocator);
-				UidHandle* object = mem::construct<UidHandle>(blocks->object_block, next);
+				UidHandle* object = mem::construct<UidHandle>(blocks->object_block, UidHandle{key, generation});
 				hndl = mem::sptr<UidHandle>(mem::construct<HndlResource>(blocks->resource_block, _destroyer, object));
-				bookkeeping->keyToRecord.emplace(hndl->key, UidRecord{id, hndl->generation});
 			}
 
 			return hndl;
 		}
 
-		Uid GetUid(mem::sptr<UidHandle> hndl)
+		/*
+			wait-free, returns a nil uid when the handle is stale
+		*/
+		Uid GetUid(const UidHandle& hndl) const
 		{
-			mem::sptr<Uid> id = nullptr;
-			if (hndl && hndl->IsValid())
+			Uid id{};
+			const UidSlot* slot = hndl.IsValid() ? GetSlot(hndl.key) : nullptr;
+			if (slot && slot->generation.load(mo_acquire) == hndl.generation)
 			{
-				auto bookkeeping = _bookkeeping.get_access();
-				auto it = bookkeeping->keyToRecord.find(hndl->key);
-				if (it != bookkeeping->keyToRecord.end() && hndl->generation == it->second.generation)
-					id = it->second.uidSptr;
+				id = LoadUid(*slot);
+				::std::atomic_thread_fence(mo_acquire);
+				if (slot->generation.load(mo_relaxed) != hndl.generation)
+					id = Uid{};
 			}
-			return id ? *id : Uid{};
+			return id;
+		}
+
+		Uid GetUid(mem::sptr<UidHandle> hndl) const
+		{
+			return hndl ? GetUid(*hndl) : Uid{};
 		}
 
 		bl Has(uid::Uid id)
 		{
-			auto bookkeeping = _bookkeeping.get_access();
-			return bookkeeping->masterSet.find(id) != bookkeeping->masterSet.end();
+			auto shard = _shards[GetShardIndex(id)].get_access();
+			return shard->find(id) != shard->end();
 		}
 	};
 } // namespace np::uid
@@ -114,8 +114,10 @@ namespace np::win::__detail
 
 		static void KeyCallback(GLFWwindow* glfw_window, i32 key, i32 scan, i32 action, i32 modifiers)
 		{
+			const tim::steady_timestamp timestamp = tim::steady_clock::now();
 			GlfwWindow* window = (GlfwWindow*)glfwGetWindowUserPointer(glfw_window);
 			nput::KeyCodeState state;
+			state.SetTimestamp(timestamp);
 
 			// TODO: what is scancode?!
 
@@ -575,8 +577,10 @@ namespace np::win::__detail
 
 		static void MouseButtonCallback(GLFWwindow* glfw_window, i32 button, i32 action, i32 modifiers)
 		{
+			const tim::steady_timestamp timestamp = tim::steady_clock::now();
 			GlfwWindow* window = (GlfwWindow*)glfwGetWindowUserPointer(glfw_window);
 			nput::MouseCodeState state;
+			state.SetTimestamp(timestamp);
 
 			switch (action)
 			{
@@ -616,15 +620,19 @@ namespace np::win::__detail
 
 		static void MousePositionCallback(GLFWwindow* glfw_window, dbl x, dbl y)
 		{
+			const tim::steady_timestamp timestamp = tim::steady_clock::now();
 			GlfwWindow* window = (GlfwWindow*)glfwGetWindowUserPointer(glfw_window);
 			window->_mouse_position.SetPosition({x, y});
+			window->_mouse_position.SetTimestamp(timestamp);
 			window->InvokeMousePositionCallbacks(window->_mouse_position);
 		}
 
 		static void MouseEnterCallback(GLFWwindow* glfw_window, i32 entered)
 		{
+			const tim::steady_timestamp timestamp = tim::steady_clock::now();
 			GlfwWindow* window = (GlfwWindow*)glfwGetWindowUserPointer(glfw_window);
 			window->_mouse_position.SetIsOverSurface(entered);
+			window->_mouse_position.SetTimestamp(timestamp);
 			window->InvokeMousePositionCallbacks(window->_mouse_position);
 		}
 
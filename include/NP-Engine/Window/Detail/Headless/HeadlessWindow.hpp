@@ -0,0 +1,563 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#ifndef NP_ENGINE_HEADLESS_WINDOW_HPP
+#define NP_ENGINE_HEADLESS_WINDOW_HPP
+
+#include "NP-Engine/Foundation/Foundation.hpp"
+#include "NP-Engine/Primitive/Primitive.hpp"
+#include "NP-Engine/Memory/Memory.hpp"
+#include "NP-Engine/Container/Container.hpp"
+#include "NP-Engine/Time/Time.hpp"
+#include "NP-Engine/String/String.hpp"
+
+#include "NP-Engine/Vendor/GlmInclude.hpp"
+
+#include "NP-Engine/Window/Interface/WindowImpl.hpp"
+#include "NP-Engine/Window/Interface/WindowEvents.hpp"
+
+namespace np::win::__detail
+{
+	enum class HeadlessScriptType : ui32
+	{
+		None = 0,
+		Size,
+		Position,
+		Minimize,
+		Maximize,
+		Focus,
+		Close,
+		Key,
+		Mouse,
+		MousePosition,
+		Controller
+	};
+
+	/*
+		one scripted occurrence for a headless window -- only the members for its type are read
+	*/
+	struct HeadlessScriptEntry
+	{
+		HeadlessScriptType type = HeadlessScriptType::None;
+		::glm::uvec2 size{};
+		::glm::ivec2 position{};
+		bl value = false; // minimized, maximized, or focused
+		nput::KeyCodeState keyState{};
+		nput::MouseCodeState mouseState{};
+		nput::MousePosition mousePosition{};
+		nput::ControllerCodeState controllerState{};
+	};
+
+	/*
+		a window with no display -- its framebuffer is off-screen and sized from the window size and framebuffer scale
+		scripted entries are played back by Window::Update(DetailType::Headless), the same point glfw polls its events, and
+		go through the same callbacks, so window events reach the EventSubmitter and input reaches the input callbacks the
+		way a glfw window's would
+		scripting is thread safe, playback happens on the owning thread
+	*/
+	class HeadlessWindow : public Window
+	{
+	protected:
+		mutex _m;
+		con::vector<HeadlessScriptEntry> _script;
+		con::vector<HeadlessScriptEntry> _playing;
+		atm_siz _played_count;
+
+		str _title;
+		::glm::uvec2 _size;
+		::glm::ivec2 _position;
+		ui32 _framebuffer_scale;
+		bl _is_showing;
+		bl _is_minimized;
+		bl _is_maximized;
+		bl _is_focused;
+		nput::MousePosition _mouse_position;
+
+		static mutexed_wrapper<con::uset<HeadlessWindow*>>& GetWindows()
+		{
+			static mutexed_wrapper<con::uset<HeadlessWindow*>> windows;
+			return windows;
+		}
+
+		void ApplySize(::glm::uvec2 size)
+		{
+			if (_size != size)
+			{
+				_size = size;
+				InvokeSizeCallbacks(_size);
+				InvokeFramebufferSizeCallbacks(GetFramebufferSize());
+			}
+		}
+
+		void ApplyPosition(::glm::ivec2 position)
+		{
+			if (_position != position)
+			{
+				_position = position;
+				InvokePositionCallbacks(_position);
+			}
+		}
+
+		void ApplyMinimize(bl minimized)
+		{
+			if (_is_minimized != minimized)
+			{
+				_is_minimized = minimized;
+				InvokeMinimizeCallbacks(_is_minimized);
+				InvokeFramebufferSizeCallbacks(GetFramebufferSize());
+			}
+		}
+
+		void ApplyMaximize(bl maximized)
+		{
+			if (_is_maximized != maximized)
+			{
+				_is_maximized = maximized;
+				InvokeMaximizeCallbacks(_is_maximized);
+			}
+		}
+
+		void ApplyFocus(bl focused)
+		{
+			if (_is_focused != focused)
+			{
+				_is_focused = focused;
+				InvokeFocusCallbacks(_is_focused);
+			}
+		}
+
+		/*
+			input scripted without a timestamp happens when it is played
+		*/
+		template <typename T>
+		static T GetStamped(T input, tim::steady_timestamp timestamp)
+		{
+			if (input.GetTimestamp() == tim::steady_timestamp{})
+				input.SetTimestamp(timestamp);
+			return input;
+		}
+
+		void Play(const HeadlessScriptEntry& entry)
+		{
+			const tim::steady_timestamp timestamp = tim::steady_clock::now();
+			switch (entry.type)
+			{
+			case HeadlessScriptType::Size:
+				ApplySize(entry.size);
+				break;
+
+			case HeadlessScriptType::Position:
+				ApplyPosition(entry.position);
+				break;
+
+			case HeadlessScriptType::Minimize:
+				ApplyMinimize(entry.value);
+				break;
+
+			case HeadlessScriptType::Maximize:
+				ApplyMaximize(entry.value);
+				break;
+
+			case HeadlessScriptType::Focus:
+				ApplyFocus(entry.value);
+				break;
+
+			case HeadlessScriptType::Close:
+				Close();
+				break;
+
+			case HeadlessScriptType::Key:
+				InvokeKeyCallbacks(GetStamped(entry.keyState, timestamp));
+				break;
+
+			case HeadlessScriptType::Mouse:
+				InvokeMouseCallbacks(GetStamped(entry.mouseState, timestamp));
+				break;
+
+			case HeadlessScriptType::MousePosition:
+				_mouse_position = GetStamped(entry.mousePosition, timestamp);
+				InvokeMousePositionCallbacks(_mouse_position);
+				break;
+
+			case HeadlessScriptType::Controller:
+				InvokeControllerCallbacks(GetStamped(entry.controllerState, timestamp));
+				break;
+
+			default:
+				break;
+			}
+		}
+
+		/*
+			plays what was scripted before this call -- entries scripted by callbacks during playback wait for the next
+		*/
+		void PlayScript()
+		{
+			{
+				scoped_lock lock(_m);
+				if (_script.empty())
+					return;
+
+				_playing.swap(_script);
+			}
+
+			for (const HeadlessScriptEntry& entry : _playing)
+				Play(entry);
+
+			_played_count.fetch_add(_playing.size(), mo_relaxed);
+			_playing.clear();
+		}
+
+	public:
+		static void Init() {}
+
+		static void Terminate() {}
+
+		/*
+			callbacks played from here must not create or destroy headless windows -- WindowLayer does both outside of Poll
+		*/
+		static void Update()
+		{
+			auto windows = GetWindows().get_access();
+			for (HeadlessWindow* window : *windows)
+				if (window->IsOwningThread())
+					window->PlayScript();
+		}
+
+		static con::vector<str> GetRequiredGpuExtentions()
+		{
+			return {};
+		}
+
+		HeadlessWindow(mem::sptr<srvc::Services> services, uid::Uid id):
+			Window(services, id),
+			_played_count(0),
+			_size(800, 600), // TODO: get default window size and title from config service
+			_position(0, 0),
+			_framebuffer_scale(1),
+			_is_showing(true),
+			_is_minimized(false),
+			_is_maximized(false),
+			_is_focused(true)
+		{
+			GetWindows().get_access()->emplace(this);
+		}
+
+		virtual ~HeadlessWindow()
+		{
+			GetWindows().get_access()->erase(this);
+		}
+
+		DetailType GetDetailType() const override
+		{
+			return DetailType::Headless;
+		}
+
+		void Close() override
+		{
+			if (IsOwningThread())
+			{
+				if (!InvokePreventCloseCallbacks() && _is_showing)
+				{
+					_is_showing = false;
+					mem::sptr<evnt::Event> e =
+						mem::create_sptr<WindowCloseEvent>(_services->GetAllocator(), evnt::EventType::Did, GetUid());
+					_services->GetEventSubmitter().Submit(e);
+				}
+			}
+			else
+			{
+				mem::sptr<evnt::Event> e =
+					mem::create_sptr<WindowCloseEvent>(_services->GetAllocator(), evnt::EventType::Will, GetUid());
+				_services->GetEventSubmitter().Submit(e);
+			}
+		}
+
+		void SetTitle(str title) override
+		{
+			if (IsOwningThread())
+			{
+				_title = title;
+				mem::sptr<evnt::Event> e =
+					mem::create_sptr<WindowTitleEvent>(_services->GetAllocator(), evnt::EventType::Did, GetUid(), _title);
+				_services->GetEventSubmitter().Submit(e);
+			}
+			else
+			{
+				mem::sptr<evnt::Event> e =
+					mem::create_sptr<WindowTitleEvent>(_services->GetAllocator(), evnt::EventType::Will, GetUid(), title);
+				_services->GetEventSubmitter().Submit(e);
+			}
+		}
+
+		str GetTitle() override
+		{
+			return _title;
+		}
+
+		void SetSize(::glm::uvec2 size) override
+		{
+			if (IsOwningThread())
+			{
+				ApplySize(size);
+			}
+			else
+			{
+				mem::sptr<evnt::Event> e =
+					mem::create_sptr<WindowSizeEvent>(_services->GetAllocator(), evnt::EventType::Will, GetUid(), size);
+				_services->GetEventSubmitter().Submit(e);
+			}
+		}
+
+		::glm::uvec2 GetSize() override
+		{
+			return _size;
+		}
+
+		void SetPosition(::glm::ivec2 position) override
+		{
+			if (IsOwningThread())
+			{
+				ApplyPosition(position);
+			}
+			else
+			{
+				mem::sptr<evnt::Event> e =
+					mem::create_sptr<WindowPositionEvent>(_services->GetAllocator(), evnt::EventType::Will, GetUid(), position);
+				_services->GetEventSubmitter().Submit(e);
+			}
+		}
+
+		::glm::ivec2 GetPosition() override
+		{
+			return _position;
+		}
+
+		void Minimize() override
+		{
+			if (IsOwningThread())
+			{
+				ApplyMinimize(true);
+			}
+			else
+			{
+				mem::sptr<evnt::Event> e =
+					mem::create_sptr<WindowMinimizeEvent>(_services->GetAllocator(), evnt::EventType::Will, GetUid(), true);
+				_services->GetEventSubmitter().Submit(e);
+			}
+		}
+
+		void RestoreFromMinimize() override
+		{
+			if (IsOwningThread())
+			{
+				ApplyMinimize(false);
+			}
+			else
+			{
+				mem::sptr<evnt::Event> e =
+					mem::create_sptr<WindowMinimizeEvent>(_services->GetAllocator(), evnt::EventType::Will, GetUid(), false);
+				_services->GetEventSubmitter().Submit(e);
+			}
+		}
+
+		void Maximize() override
+		{
+			if (IsOwningThread())
+			{
+				ApplyMaximize(true);
+			}
+			else
+			{
+				mem::sptr<evnt::Event> e =
+					mem::create_sptr<WindowMaximizeEvent>(_services->GetAllocator(), evnt::EventType::Will, GetUid(), true);
+				_services->GetEventSubmitter().Submit(e);
+			}
+		}
+
+		void RestoreFromMaximize() override
+		{
+			if (IsOwningThread())
+			{
+				ApplyMaximize(false);
+			}
+			else
+			{
+				mem::sptr<evnt::Event> e =
+					mem::create_sptr<WindowMaximizeEvent>(_services->GetAllocator(), evnt::EventType::Will, GetUid(), false);
+				_services->GetEventSubmitter().Submit(e);
+			}
+		}
+
+		bl IsSnapped() override
+		{
+			return false;
+		}
+
+		bl IsMinimized() override
+		{
+			return _is_minimized;
+		}
+
+		bl IsMaximized() override
+		{
+			return _is_maximized;
+		}
+
+		void Focus() override
+		{
+			if (IsOwningThread())
+			{
+				ApplyFocus(true);
+			}
+			else
+			{
+				mem::sptr<evnt::Event> e =
+					mem::create_sptr<WindowFocusEvent>(_services->GetAllocator(), evnt::EventType::Will, GetUid(), true);
+				_services->GetEventSubmitter().Submit(e);
+			}
+		}
+
+		bl IsFocused() override
+		{
+			return _is_focused;
+		}
+
+		/*
+			minimized windows have an empty framebuffer, like they do on windows
+		*/
+		::glm::uvec2 GetFramebufferSize() override
+		{
+			return _is_minimized ? ::glm::uvec2{0, 0} : _size * _framebuffer_scale;
+		}
+
+		/*
+			framebuffer pixels per window unit, like a high dpi display would have
+		*/
+		void SetFramebufferScale(ui32 scale)
+		{
+			_framebuffer_scale = ::std::max(scale, (ui32)1);
+		}
+
+		ui32 GetFramebufferScale() const
+		{
+			return _framebuffer_scale;
+		}
+
+		void* GetDetailWindow() override
+		{
+			return nullptr;
+		}
+
+		void* GetNativeWindow() override
+		{
+			return nullptr;
+		}
+
+		/*
+			queues the given entries for the next Window::Update(DetailType::Headless)
+		*/
+		void Script(const HeadlessScriptEntry entries[], siz count)
+		{
+			scoped_lock lock(_m);
+			_script.insert(_script.end(), entries, entries + count);
+		}
+
+		void Script(const HeadlessScriptEntry& entry)
+		{
+			Script(mem::address_of(entry), 1);
+		}
+
+		void ScriptSize(::glm::uvec2 size)
+		{
+			HeadlessScriptEntry entry{};
+			entry.type = HeadlessScriptType::Size;
+			entry.size = size;
+			Script(entry);
+		}
+
+		void ScriptPosition(::glm::ivec2 position)
+		{
+			HeadlessScriptEntry entry{};
+			entry.type = HeadlessScriptType::Position;
+			entry.position = position;
+			Script(entry);
+		}
+
+		void ScriptMinimize(bl minimized)
+		{
+			HeadlessScriptEntry entry{};
+			entry.type = HeadlessScriptType::Minimize;
+			entry.value = minimized;
+			Script(entry);
+		}
+
+		void ScriptMaximize(bl maximized)
+		{
+			HeadlessScriptEntry entry{};
+			entry.type = HeadlessScriptType::Maximize;
+			entry.value = maximized;
+			Script(entry);
+		}
+
+		void ScriptFocus(bl focused)
+		{
+			HeadlessScriptEntry entry{};
+			entry.type = HeadlessScriptType::Focus;
+			entry.value = focused;
+			Script(entry);
+		}
+
+		void ScriptClose()
+		{
+			HeadlessScriptEntry entry{};
+			entry.type = HeadlessScriptType::Close;
+			Script(entry);
+		}
+
+		void ScriptKey(const nput::KeyCodeState& state)
+		{
+			HeadlessScriptEntry entry{};
+			entry.type = HeadlessScriptType::Key;
+			entry.keyState = state;
+			Script(entry);
+		}
+
+		void ScriptMouse(const nput::MouseCodeState& state)
+		{
+			HeadlessScriptEntry entry{};
+			entry.type = HeadlessScriptType::Mouse;
+			entry.mouseState = state;
+			Script(entry);
+		}
+
+		void ScriptMousePosition(const nput::MousePosition& position)
+		{
+			HeadlessScriptEntry entry{};
+			entry.type = HeadlessScriptType::MousePosition;
+			entry.mousePosition = position;
+			Script(entry);
+		}
+
+		void ScriptController(const nput::ControllerCodeState& state)
+		{
+			HeadlessScriptEntry entry{};
+			entry.type = HeadlessScriptType::Controller;
+			entry.controllerState = state;
+			Script(entry);
+		}
+
+		/*
+			entries played back since this window was created
+		*/
+		siz GetPlayedCount() const
+		{
+			return _played_count.load(mo_relaxed);
+		}
+	};
+} // namespace np::win::__detail
+
+#endif /* NP_ENGINE_HEADLESS_WINDOW_HPP */
@@ -15,7 +15,8 @@ namespace np::win
 	{
 		None,
 		Glfw,
-		Sdl
+		Sdl,
+		Headless
 	};
 } // namespace np::win
 
@@ -44,21 +44,21 @@ namespace np::win
 		mem::sptr<srvc::Services> _services;
 		const uid::Uid _id;
 
-		mutexed_wrapper<con::uset<PreventCloseCallback>> _prevent_close_callbacks;
-		mutexed_wrapper<con::uset<SizeCallback>> _size_callbacks;
-		mutexed_wrapper<con::uset<PositionCallback>> _position_callbacks;
-		mutexed_wrapper<con::uset<FramebufferSizeCallback>> _framebuffer_size_callbacks;
-		mutexed_wrapper<con::uset<MinimizeCallback>> _minimize_callbacks;
-		mutexed_wrapper<con::uset<MaximizeCallback>> _maximize_callbacks;
-		mutexed_wrapper<con::uset<FocusCallback>> _focus_callbacks;
-
-		mutexed_wrapper<con::umap<void*, PreventCloseCallback>> _prevent_close_caller_callbacks;
-		mutexed_wrapper<con::umap<void*, SizeCallback>> _size_caller_callbacks;
-		mutexed_wrapper<con::umap<void*, PositionCallback>> _position_caller_callbacks;
-		mutexed_wrapper<con::umap<void*, FramebufferSizeCallback>> _framebuffer_size_caller_callbacks;
-		mutexed_wrapper<con::umap<void*, MinimizeCallback>> _minimize_caller_callbacks;
-		mutexed_wrapper<con::umap<void*, MaximizeCallback>> _maximize_caller_callbacks;
-		mutexed_wrapper<con::umap<void*, FocusCallback>> _focus_caller_callbacks;
+		shared_mutexed_wrapper<con::uset<PreventCloseCallback>> _prevent_close_callbacks;
+		shared_mutexed_wrapper<con::uset<SizeCallback>> _size_callbacks;
+		shared_mutexed_wrapper<con::uset<PositionCallback>> _position_callbacks;
+		shared_mutexed_wrapper<con::uset<FramebufferSizeCallback>> _framebuffer_size_callbacks;
+		shared_mutexed_wrapper<con::uset<MinimizeCallback>> _minimize_callbacks;
+		shared_mutexed_wrapper<con::uset<MaximizeCallback>> _maximize_callbacks;
+		shared_mutexed_wrapper<con::uset<FocusCallback>> _focus_callbacks;
+
+		shared_mutexed_wrapper<con::umap<void*, PreventCloseCallback>> _prevent_close_caller_callbacks;
+		shared_mutexed_wrapper<con::umap<void*, SizeCallback>> _size_caller_callbacks;
+		shared_mutexed_wrapper<con::umap<void*, PositionCallback>> _position_caller_callbacks;
+		shared_mutexed_wrapper<con::umap<void*, FramebufferSizeCallback>> _framebuffer_size_caller_callbacks;
+		shared_mutexed_wrapper<con::umap<void*, MinimizeCallback>> _minimize_caller_callbacks;
+		shared_mutexed_wrapper<con::umap<void*, MaximizeCallback>> _maximize_caller_callbacks;
+		shared_mutexed_wrapper<con::umap<void*, FocusCallback>> _focus_caller_callbacks;
 
 		bl InvokePreventCloseCallbacks();
 
@@ -11,6 +11,7 @@
 #endif
 
 #include "NP-Engine/GPU/Detail/Vulkan/VulkanBufferResource.hpp"
+#include "NP-Engine/GPU/Detail/Null/NullBufferResource.hpp"
 
 namespace np::gpu
 {
@@ -25,6 +26,11 @@ namespace np::gpu
 			resource = mem::create_sptr<__detail::VulkanBufferResource>(device->GetServices()->GetAllocator(), device, usage,
 																		size, queue_families);
 			break;
+
+		case DetailType::Null:
+			resource = mem::create_sptr<__detail::NullBufferResource>(device->GetServices()->GetAllocator(), device, usage, size,
+																				  queue_families);
+			break;
 		}
 
 		return resource;
@@ -0,0 +1,39 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#include "NP-Engine/GPU/Interface/CommandBuffer.hpp"
+#include "NP-Engine/GPU/Interface/CommandStream.hpp"
+
+#if NP_ENGINE_PLATFORM_IS_LINUX || NP_ENGINE_PLATFORM_IS_WINDOWS
+	#include "NP-Engine/GPU/Detail/OpenGL/OpenGLGraphics.hpp"
+#endif
+
+#include "NP-Engine/GPU/Detail/Vulkan/VulkanCommandStream.hpp"
+#include "NP-Engine/GPU/Detail/Null/NullCommandBuffer.hpp"
+
+namespace np::gpu
+{
+	bl CommandBuffer::Record(const CommandStream& stream)
+	{
+		bl recorded = false;
+
+		switch (GetDetailType())
+		{
+		case DetailType::Vulkan:
+			recorded = __detail::VulkanCommandStream::Record(*static_cast<__detail::VulkanCommandBuffer*>(this), stream);
+			break;
+
+		case DetailType::Null:
+			recorded = __detail::NullCommandBuffer::Record(*static_cast<__detail::NullCommandBuffer*>(this), stream);
+			break;
+
+		default:
+			break;
+		}
+
+		return recorded;
+	}
+} // namespace np::gpu
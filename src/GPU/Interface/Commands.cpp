@@ -11,6 +11,7 @@
 #endif
 
 #include "NP-Engine/GPU/Detail/Vulkan/VulkanCommands.hpp"
+#include "NP-Engine/GPU/Detail/Null/NullCommands.hpp"
 
 namespace np::gpu
 {
@@ -144,6 +145,136 @@ namespace np::gpu
 		return command;
 	}
 
+	static inline mem::sptr<Command> CreateNullCommand(mem::sptr<srvc::Services> services, CommandType command_type)
+	{
+		mem::sptr<Command> command = nullptr;
+
+		switch (command_type)
+		{
+			//copy
+		case CommandType::CopyBuffer:
+			command = mem::create_sptr<__detail::NullCommand<CopyBufferCommand>>(services->GetAllocator());
+			break;
+		case CommandType::CopyImage:
+			command = mem::create_sptr<__detail::NullCommand<CopyImageCommand>>(services->GetAllocator());
+			break;
+		case CommandType::CopyBufferToImage:
+			command = mem::create_sptr<__detail::NullCommand<CopyBufferToImageCommand>>(services->GetAllocator());
+			break;
+		case CommandType::CopyImageToBuffer:
+			command = mem::create_sptr<__detail::NullCommand<CopyImageToBufferCommand>>(services->GetAllocator());
+			break;
+
+			//fills and assigns
+		case CommandType::FillBuffer:
+			command = mem::create_sptr<__detail::NullCommand<FillBufferCommand>>(services->GetAllocator());
+			break;
+		case CommandType::AssignBuffer:
+			command = mem::create_sptr<__detail::NullCommand<AssignBufferCommand>>(services->GetAllocator());
+			break;
+
+			//render pass
+		case CommandType::BeginRenderPass:
+			command = mem::create_sptr<__detail::NullCommand<BeginRenderPassCommand>>(services->GetAllocator());
+			break;
+		case CommandType::EndRenderPass:
+			command = mem::create_sptr<__detail::NullCommand<EndRenderPassCommand>>(services->GetAllocator());
+			break;
+		case CommandType::NextSubpass:
+			command = mem::create_sptr<__detail::NullCommand<NextSubpassCommand>>(services->GetAllocator());
+			break;
+
+			//binds
+		case CommandType::BindPipeline:
+			command = mem::create_sptr<__detail::NullCommand<BindPipelineCommand>>(services->GetAllocator());
+			break;
+		case CommandType::BindIndexBuffer:
+			command = mem::create_sptr<__detail::NullCommand<BindIndexBufferCommand>>(services->GetAllocator());
+			break;
+		case CommandType::BindVertexBuffers:
+			command = mem::create_sptr<__detail::NullCommand<BindVertexBuffersCommand>>(services->GetAllocator());
+			break;
+		case CommandType::BindResourceGroups:
+			command = mem::create_sptr<__detail::NullCommand<BindResourceGroupsCommand>>(services->GetAllocator());
+			break;
+
+			//general
+		case CommandType::Barrier:
+			command = mem::create_sptr<__detail::NullCommand<BarrierCommand>>(services->GetAllocator());
+			break;
+		case CommandType::ExecuteCommands:
+			command = mem::create_sptr<__detail::NullExecuteCommandsCommand>(services->GetAllocator());
+			break;
+		case CommandType::PushData:
+			command = mem::create_sptr<__detail::NullCommand<PushDataCommand>>(services->GetAllocator());
+			break;
+
+			//set
+		case CommandType::SetViewports:
+			command = mem::create_sptr<__detail::NullCommand<SetViewportsCommand>>(services->GetAllocator());
+			break;
+		case CommandType::SetScissors:
+			command = mem::create_sptr<__detail::NullCommand<SetScissorsCommand>>(services->GetAllocator());
+			break;
+		case CommandType::SetRasterizationDepthBias:
+			command = mem::create_sptr<__detail::NullCommand<SetRasterizationDepthBiasCommand>>(services->GetAllocator());
+			break;
+		case CommandType::SetLineWidth:
+			command = mem::create_sptr<__detail::NullCommand<SetLineWidthCommand>>(services->GetAllocator());
+			break;
+		case CommandType::SetDepthBounds:
+			command = mem::create_sptr<__detail::NullCommand<SetDepthBoundsCommand>>(services->GetAllocator());
+			break;
+		case CommandType::SetBlendConstants:
+			command = mem::create_sptr<__detail::NullCommand<SetBlendConstantsCommand>>(services->GetAllocator());
+			break;
+		case CommandType::SetStencilCompareMask:
+			command = mem::create_sptr<__detail::NullCommand<SetStencilCompareMaskCommand>>(services->GetAllocator());
+			break;
+		case CommandType::SetStencilWriteMask:
+			command = mem::create_sptr<__detail::NullCommand<SetStencilWriteMaskCommand>>(services->GetAllocator());
+			break;
+		case CommandType::SetStencilReferenceValue:
+			command = mem::create_sptr<__detail::NullCommand<SetStencilReferenceValueCommand>>(services->GetAllocator());
+			break;
+
+			//dispath
+		case CommandType::Dispatch:
+			command = mem::create_sptr<__detail::NullCommand<DispatchCommand>>(services->GetAllocator());
+			break;
+		case CommandType::IndirectDispatch:
+			command = mem::create_sptr<__detail::NullCommand<IndirectDispatchCommand>>(services->GetAllocator());
+			break;
+
+			//flag
+		case CommandType::WaitFlags:
+			command = mem::create_sptr<__detail::NullCommand<WaitFlagsCommand>>(services->GetAllocator());
+			break;
+		case CommandType::SetFlag:
+			command = mem::create_sptr<__detail::NullCommand<SetFlagCommand>>(services->GetAllocator());
+			break;
+		case CommandType::ResetFlag:
+			command = mem::create_sptr<__detail::NullCommand<ResetFlagCommand>>(services->GetAllocator());
+			break;
+
+			//draw
+		case CommandType::Draw:
+			command = mem::create_sptr<__detail::NullCommand<DrawCommand>>(services->GetAllocator());
+			break;
+		case CommandType::DrawIndexed:
+			command = mem::create_sptr<__detail::NullCommand<DrawIndexedCommand>>(services->GetAllocator());
+			break;
+		case CommandType::DrawIndirect:
+			command = mem::create_sptr<__detail::NullDrawIndirectCommand>(services->GetAllocator());
+			break;
+		case CommandType::DrawIndexedIndirect:
+			command = mem::create_sptr<__detail::NullDrawIndexedIndirectCommand>(services->GetAllocator());
+			break;
+		}
+
+		return command;
+	}
+
 	mem::sptr<Command> Command::Create(DetailType detail_type, mem::sptr<srvc::Services> services, CommandType command_type)
 	{
 		mem::sptr<Command> command = nullptr;
@@ -153,6 +284,10 @@ namespace np::gpu
 		case DetailType::Vulkan:
 			command = CreateVulkanCommand(services, command_type);
 			break;
+
+		case DetailType::Null:
+			command = CreateNullCommand(services, command_type);
+			break;
 		}
 
 		return command;
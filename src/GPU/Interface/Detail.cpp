@@ -11,6 +11,7 @@
 #endif
 
 #include "NP-Engine/GPU/Detail/Vulkan/VulkanInstance.hpp"
+#include "NP-Engine/GPU/Detail/Null/NullInstance.hpp"
 
 namespace np::gpu
 {
@@ -24,6 +25,10 @@ namespace np::gpu
 			instance = mem::create_sptr<__detail::VulkanInstance>(services->GetAllocator(), services);
 			break;
 
+		case DetailType::Null:
+			instance = mem::create_sptr<__detail::NullInstance>(services->GetAllocator(), services);
+			break;
+
 		default:
 			break;
 		}
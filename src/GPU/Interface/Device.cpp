@@ -11,6 +11,7 @@
 #endif
 
 #include "NP-Engine/GPU/Detail/Vulkan/VulkanDevice.hpp"
+#include "NP-Engine/GPU/Detail/Null/NullDevice.hpp"
 
 namespace np::gpu
 {
@@ -26,6 +27,10 @@ namespace np::gpu
 			device = mem::create_sptr<__detail::VulkanDevice>(instance->GetServices()->GetAllocator(), instance, usage, target);
 			break;
 
+		case DetailType::Null:
+			device = mem::create_sptr<__detail::NullDevice>(instance->GetServices()->GetAllocator(), instance, usage, target);
+			break;
+
 		default:
 			break;
 		}
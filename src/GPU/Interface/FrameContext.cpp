@@ -11,6 +11,7 @@
 #endif
 
 #include "NP-Engine/GPU/Detail/Vulkan/VulkanFrameContext.hpp"
+#include "NP-Engine/GPU/Detail/Null/NullFrameContext.hpp"
 
 namespace np::gpu
 {
@@ -25,6 +26,11 @@ namespace np::gpu
 				mem::create_sptr<__detail::VulkanFrameContext>(device->GetServices()->GetAllocator(), device, queue_families);
 			break;
 
+		case DetailType::Null:
+			context =
+				mem::create_sptr<__detail::NullFrameContext>(device->GetServices()->GetAllocator(), device, queue_families);
+			break;
+
 		default:
 			break;
 		}
@@ -11,6 +11,7 @@
 #endif
 
 #include "NP-Engine/GPU/Detail/Vulkan/VulkanFramebuffer.hpp"
+#include "NP-Engine/GPU/Detail/Null/NullFramebuffer.hpp"
 
 namespace np::gpu
 {
@@ -26,6 +27,11 @@ namespace np::gpu
 																		width, height, layer_count, views);
 			break;
 
+		case DetailType::Null:
+			framebuffer = mem::create_sptr<__detail::NullFramebuffer>(render_pass->GetServices()->GetAllocator(), render_pass,
+																	  width, height, layer_count, views);
+			break;
+
 		default:
 			break;
 		}
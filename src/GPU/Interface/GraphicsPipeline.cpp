@@ -11,6 +11,7 @@
 #endif
 
 #include "NP-Engine/GPU/Detail/Vulkan/VulkanGraphicsPipeline.hpp"
+#include "NP-Engine/GPU/Detail/Null/NullGraphicsPipeline.hpp"
 
 namespace np::gpu
 {
@@ -33,6 +34,11 @@ namespace np::gpu
 				multisample, depth_stencil, blend, dynamic_usage, cache);
 			break;
 
+		case DetailType::Null:
+			pipeline = mem::create_sptr<__detail::NullGraphicsPipeline>(render_pass->GetServices()->GetAllocator(), render_pass,
+																		usage, layout, shaders);
+			break;
+
 		default:
 			break;
 		}
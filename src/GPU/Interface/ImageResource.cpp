@@ -11,6 +11,7 @@
 #endif
 
 #include "NP-Engine/GPU/Detail/Vulkan/VulkanImageResource.hpp"
+#include "NP-Engine/GPU/Detail/Null/NullImageResource.hpp"
 
 namespace np::gpu
 {
@@ -27,6 +28,12 @@ namespace np::gpu
 																	format, mip_count, layer_count, sample_count, width, height,
 																	depth, queue_families);
 			break;
+
+		case DetailType::Null:
+			image = mem::create_sptr<__detail::NullImageResource>(device->GetServices()->GetAllocator(), device, usage, format,
+																  mip_count, layer_count, sample_count, width, height, depth,
+																  queue_families);
+			break;
 		}
 
 		return image;
@@ -41,6 +48,10 @@ namespace np::gpu
 		case DetailType::Vulkan:
 			is = __detail::VulkanImageResource::IsSupported(device, usage, format, format_features);
 			break;
+
+		case DetailType::Null:
+			is = __detail::NullImageResource::IsSupported(device, usage, format, format_features);
+			break;
 		}
 
 		return is;
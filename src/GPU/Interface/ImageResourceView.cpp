@@ -11,6 +11,7 @@
 #endif
 
 #include "NP-Engine/GPU/Detail/Vulkan/VulkanImageResourceView.hpp"
+#include "NP-Engine/GPU/Detail/Null/NullImageResourceView.hpp"
 
 namespace np::gpu
 {
@@ -25,6 +26,11 @@ namespace np::gpu
 			view = mem::create_sptr<__detail::VulkanImageResourceView>(device->GetServices()->GetAllocator(), device, image,
 																	   usage);
 			break;
+
+		case DetailType::Null:
+			view = mem::create_sptr<__detail::NullImageResourceView>(device->GetServices()->GetAllocator(), device, image,
+																	 usage);
+			break;
 		}
 
 		return view;
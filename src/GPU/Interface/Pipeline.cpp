@@ -11,6 +11,7 @@
 #endif
 
 #include "NP-Engine/GPU/Detail/Vulkan/VulkanPipeline.hpp"
+#include "NP-Engine/GPU/Detail/Null/NullPipeline.hpp"
 
 namespace np::gpu
 {
@@ -26,6 +27,11 @@ namespace np::gpu
 																			  resource_layouts, push_data);
 			break;
 
+		case DetailType::Null:
+			layout = mem::create_sptr<__detail::NullPipelineResourceLayout>(device->GetServices()->GetAllocator(), device,
+																			resource_layouts, push_data);
+			break;
+
 		default:
 			break;
 		}
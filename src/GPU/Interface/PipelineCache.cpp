@@ -0,0 +1,60 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#include <fstream>
+
+#include "NP-Engine/FileSystem/FileSystem.hpp"
+#include "NP-Engine/Math/Math.hpp"
+
+#include "NP-Engine/GPU/Interface/PipelineCache.hpp"
+
+namespace np::gpu
+{
+	con::vector<ui8> PipelineCache::Load(str filename)
+	{
+		con::vector<ui8> bytes;
+		::std::ifstream ifile(filename, ::std::ios::binary | ::std::ios::ate);
+		if (ifile.is_open())
+		{
+			bytes.resize((siz)ifile.tellg());
+			ifile.seekg(0);
+			ifile.read((chr*)bytes.data(), bytes.size());
+			if (!ifile.good())
+				bytes.clear();
+		}
+		return bytes;
+	}
+
+	bl PipelineCache::Save(str filename) const
+	{
+		const con::vector<ui8> bytes = GetBytes();
+		if (bytes.empty())
+			return false;
+
+		const ui64 hash = mat::hash_fnv1a_ui64(bytes.data(), bytes.size());
+		if (hash == _saved_hash.load(mo_acquire) && fsys::exists(filename))
+			return true;
+
+		const str filename_tmp = filename + ".tmp";
+		bl saved = false;
+		{
+			::std::ofstream ofile(filename_tmp, ::std::ios::binary | ::std::ios::trunc);
+			if (ofile.is_open())
+			{
+				ofile.write((const chr*)bytes.data(), bytes.size());
+				saved = ofile.good();
+			}
+		}
+
+		saved = saved && fsys::rename(filename_tmp, filename);
+		if (saved)
+			_saved_hash.store(hash, mo_release);
+		else
+			fsys::remove_all(filename_tmp);
+
+		return saved;
+	}
+} // namespace np::gpu
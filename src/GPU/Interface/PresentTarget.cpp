@@ -11,6 +11,7 @@
 #endif
 
 #include "NP-Engine/GPU/Detail/Vulkan/VulkanPresentTarget.hpp"
+#include "NP-Engine/GPU/Detail/Null/NullPresentTarget.hpp"
 
 namespace np::gpu
 {
@@ -24,6 +25,10 @@ namespace np::gpu
 			target = mem::create_sptr<__detail::VulkanPresentTarget>(instance->GetServices()->GetAllocator(), instance, window);
 			break;
 
+		case DetailType::Null:
+			target = mem::create_sptr<__detail::NullPresentTarget>(instance->GetServices()->GetAllocator(), instance, window);
+			break;
+
 		default:
 			break;
 		}
@@ -11,6 +11,7 @@
 #endif
 
 #include "NP-Engine/GPU/Detail/Vulkan/VulkanQueue.hpp"
+#include "NP-Engine/GPU/Detail/Null/NullQueue.hpp"
 
 namespace np::gpu
 {
@@ -24,6 +25,10 @@ namespace np::gpu
 			queue = mem::create_sptr<__detail::VulkanQueue>(device->GetServices()->GetAllocator(), device, family, index);
 			break;
 
+		case DetailType::Null:
+			queue = mem::create_sptr<__detail::NullQueue>(device->GetServices()->GetAllocator(), device, family, index);
+			break;
+
 		default:
 			break;
 		}
@@ -0,0 +1,33 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#include "NP-Engine/GPU/Interface/RenderGraph.hpp"
+
+#if NP_ENGINE_PLATFORM_IS_LINUX || NP_ENGINE_PLATFORM_IS_WINDOWS
+	#include "NP-Engine/GPU/Detail/OpenGL/OpenGLGraphics.hpp"
+#endif
+
+#include "NP-Engine/GPU/Detail/Vulkan/VulkanRenderGraph.hpp"
+
+namespace np::gpu
+{
+	bl RenderGraph::Realize(mem::sptr<Device> device, const con::vector<DeviceQueueFamily>& queue_families)
+	{
+		bl realized = false;
+
+		switch (device->GetDetailType())
+		{
+		case DetailType::Vulkan:
+			realized = __detail::VulkanRenderGraph::Realize(*this, device, queue_families);
+			break;
+
+		default:
+			break;
+		}
+
+		return realized;
+	}
+} // namespace np::gpu
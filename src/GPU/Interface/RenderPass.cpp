@@ -11,6 +11,7 @@
 #endif
 
 #include "NP-Engine/GPU/Detail/Vulkan/VulkanRenderPass.hpp"
+#include "NP-Engine/GPU/Detail/Null/NullRenderPass.hpp"
 
 namespace np::gpu
 {
@@ -28,6 +29,11 @@ namespace np::gpu
 																subpasses, dependencies);
 			break;
 
+		case DetailType::Null:
+			pass = mem::create_sptr<__detail::NullRenderPass>(device->GetServices()->GetAllocator(), device, descriptions,
+															  subpasses, dependencies);
+			break;
+
 		default:
 			break;
 		}
@@ -11,6 +11,7 @@
 #endif
 
 #include "NP-Engine/GPU/Detail/Vulkan/VulkanResource.hpp"
+#include "NP-Engine/GPU/Detail/Null/NullResource.hpp"
 
 namespace np::gpu
 {
@@ -25,6 +26,11 @@ namespace np::gpu
 				mem::create_sptr<__detail::VulkanResourceLayout>(device->GetServices()->GetAllocator(), device, descriptions);
 			break;
 
+		case DetailType::Null:
+			layout =
+				mem::create_sptr<__detail::NullResourceLayout>(device->GetServices()->GetAllocator(), device, descriptions);
+			break;
+
 		default:
 			break;
 		}
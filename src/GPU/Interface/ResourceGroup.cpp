@@ -11,6 +11,7 @@
 #endif
 
 #include "NP-Engine/GPU/Detail/Vulkan/VulkanResourceGroup.hpp"
+#include "NP-Engine/GPU/Detail/Null/NullResourceGroup.hpp"
 
 namespace np::gpu
 {
@@ -25,6 +26,10 @@ namespace np::gpu
 			pool = mem::create_sptr<__detail::VulkanResourceGroupPool>(device->GetServices()->GetAllocator(), device, size, descriptions);
 			break;
 
+		case DetailType::Null:
+			pool = mem::create_sptr<__detail::NullResourceGroupPool>(device->GetServices()->GetAllocator(), device, size, descriptions);
+			break;
+
 		default:
 			break;
 		}
@@ -11,6 +11,7 @@
 #endif
 
 #include "NP-Engine/GPU/Detail/Vulkan/VulkanSamplerResource.hpp"
+#include "NP-Engine/GPU/Detail/Null/NullSamplerResource.hpp"
 
 namespace np::gpu
 {
@@ -26,6 +27,11 @@ namespace np::gpu
 			resource = mem::create_sptr<__detail::VulkanSamplerResource>(device->GetServices()->GetAllocator(), device, usage,
 																		 anisotrophy, op, lod_bounds, border, address_modes);
 			break;
+
+		case DetailType::Null:
+			resource = mem::create_sptr<__detail::NullSamplerResource>(device->GetServices()->GetAllocator(), device, usage,
+																	   anisotrophy, op, lod_bounds, border, address_modes);
+			break;
 		}
 
 		return resource;
@@ -11,6 +11,8 @@
 #endif
 
 #include "NP-Engine/GPU/Detail/Vulkan/VulkanShader.hpp"
+#include "NP-Engine/GPU/Detail/Vulkan/VulkanShaderCache.hpp"
+#include "NP-Engine/GPU/Detail/Null/NullShader.hpp"
 
 namespace np::gpu
 {
@@ -25,10 +27,41 @@ namespace np::gpu
 															  entrypoint);
 			break;
 
+		case DetailType::Null:
+			shader = mem::create_sptr<__detail::NullShader>(device->GetServices()->GetAllocator(), device, stage, filename,
+															entrypoint);
+			break;
+
 		default:
 			break;
 		}
 
 		return shader;
 	}
+
+	void Shader::Prepare(DetailType detail_type, const con::vector<ShaderSource>& sources, jsys::JobSystem* job_system)
+	{
+		switch (detail_type)
+		{
+		case DetailType::Vulkan:
+			__detail::VulkanShaderCache::Prepare(sources, job_system);
+			break;
+
+		default:
+			break;
+		}
+	}
+
+	void Shader::ClearCache(DetailType detail_type)
+	{
+		switch (detail_type)
+		{
+		case DetailType::Vulkan:
+			__detail::VulkanShaderCache::Clear();
+			break;
+
+		default:
+			break;
+		}
+	}
 } // namespace np::gpu
\ No newline at end of file
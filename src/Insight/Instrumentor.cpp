@@ -9,4 +9,6 @@
 namespace np::nsit
 {
 	mutexed_wrapper<instrumentor::properties> instrumentor::_properties;
+	atm_bl instrumentor::_is_tracing(true);
+	atm_bl instrumentor::_is_saving_on_trace(false);
 } // namespace np::nsit
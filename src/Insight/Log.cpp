@@ -14,4 +14,5 @@ namespace np::nsit
 	::std::shared_ptr<spdlog::logger> log::_logger;
 	::std::shared_ptr<::spdlog::sinks::sink> log::_stdout_sink;
 	::std::shared_ptr<::spdlog::sinks::sink> log::_file_sink;
+	::std::shared_ptr<async_log_writer> log::_async_writer;
 } // namespace np::nsit
@@ -0,0 +1,229 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <system_error>
+
+#include "NP-Engine/Thread/Thread.hpp"
+
+#include "NP-Engine/Insight/Metrics.hpp"
+
+namespace np::nsit
+{
+	namespace __detail
+	{
+		enum class metric_type : ui32
+		{
+			counter,
+			gauge,
+			histogram
+		};
+
+		struct metric_entry
+		{
+			::std::string name;
+			::std::string help;
+			metric_type type;
+			::std::unique_ptr<metric_counter> counter;
+			::std::unique_ptr<metric_gauge> gauge;
+			::std::unique_ptr<metric_histogram> histogram;
+		};
+
+		struct metrics_registry
+		{
+			mutex entries_mutex;
+			::std::vector<metric_entry> entries;
+
+			mutex snapshot_mutex;
+			condition snapshot_condition;
+			bl is_snapshotting = false;
+			::std::string snapshot_filepath;
+			tim::milliseconds snapshot_interval;
+			thr::thread snapshot_thread;
+
+			metric_entry& get_entry(const ::std::string& name, const ::std::string& help, metric_type type)
+			{
+				for (metric_entry& entry : entries)
+				{
+					if (entry.name == name)
+					{
+						NP_ENGINE_ASSERT(entry.type == type, "metric '" + name + "' was already registered as another type");
+						return entry;
+					}
+				}
+
+				metric_entry& entry = entries.emplace_back();
+				entry.name = name;
+				entry.help = help;
+				entry.type = type;
+				switch (type)
+				{
+				case metric_type::counter:
+					entry.counter = ::std::make_unique<metric_counter>();
+					break;
+				case metric_type::gauge:
+					entry.gauge = ::std::make_unique<metric_gauge>();
+					break;
+				case metric_type::histogram:
+					entry.histogram = ::std::make_unique<metric_histogram>();
+					break;
+				}
+				return entry;
+			}
+		};
+
+		/*
+			never destroyed -- metrics are cached in function local statics all over the engine, and some of those
+			(like trait_allocator's) are still being touched during static destruction
+		*/
+		static metrics_registry& get_metrics_registry()
+		{
+			static metrics_registry* registry = new metrics_registry();
+			return *registry;
+		}
+
+		static void write_metric(::std::ostream& os, const metric_entry& entry)
+		{
+			if (!entry.help.empty())
+				os << "# HELP " << entry.name << " " << entry.help << "\n";
+
+			switch (entry.type)
+			{
+			case metric_type::counter:
+				os << "# TYPE " << entry.name << " counter\n";
+				os << entry.name << " " << entry.counter->get() << "\n";
+				break;
+
+			case metric_type::gauge:
+				os << "# TYPE " << entry.name << " gauge\n";
+				os << entry.name << " " << entry.gauge->get() << "\n";
+				break;
+
+			case metric_type::histogram:
+			{
+				const histogram_snapshot snapshot = entry.histogram->get_snapshot();
+				const ::std::pair<const chr*, dbl> quantiles[] = {{"0.5", 0.5}, {"0.9", 0.9}, {"0.99", 0.99}, {"0.999", 0.999}};
+
+				os << "# TYPE " << entry.name << " summary\n";
+				for (const auto& quantile : quantiles)
+					os << entry.name << "{quantile=\"" << quantile.first << "\"} "
+					   << snapshot.get_value_at_quantile(quantile.second) << "\n";
+				os << entry.name << "{quantile=\"1\"} " << snapshot.max << "\n";
+				os << entry.name << "_sum " << snapshot.sum << "\n";
+				os << entry.name << "_count " << snapshot.count << "\n";
+				break;
+			}
+			}
+		}
+
+		static void snapshot_procedure(metrics_registry* registry)
+		{
+			general_lock lock(registry->snapshot_mutex);
+			while (registry->is_snapshotting)
+			{
+				registry->snapshot_condition.wait_for(lock, registry->snapshot_interval);
+				const ::std::string filepath = registry->snapshot_filepath;
+
+				lock.unlock();
+				metrics::save(filepath);
+				lock.lock();
+			}
+		}
+	} // namespace __detail
+
+	metric_counter& metrics::get_counter(const ::std::string& name, const ::std::string& help)
+	{
+		__detail::metrics_registry& registry = __detail::get_metrics_registry();
+		general_lock lock(registry.entries_mutex);
+		return *registry.get_entry(name, help, __detail::metric_type::counter).counter;
+	}
+
+	metric_gauge& metrics::get_gauge(const ::std::string& name, const ::std::string& help)
+	{
+		__detail::metrics_registry& registry = __detail::get_metrics_registry();
+		general_lock lock(registry.entries_mutex);
+		return *registry.get_entry(name, help, __detail::metric_type::gauge).gauge;
+	}
+
+	metric_histogram& metrics::get_histogram(const ::std::string& name, const ::std::string& help)
+	{
+		__detail::metrics_registry& registry = __detail::get_metrics_registry();
+		general_lock lock(registry.entries_mutex);
+		return *registry.get_entry(name, help, __detail::metric_type::histogram).histogram;
+	}
+
+	::std::string metrics::scrape()
+	{
+		__detail::metrics_registry& registry = __detail::get_metrics_registry();
+		::std::ostringstream os;
+		general_lock lock(registry.entries_mutex);
+		for (const __detail::metric_entry& entry : registry.entries)
+			__detail::write_metric(os, entry);
+		return os.str();
+	}
+
+	bl metrics::save(const ::std::string& filepath)
+	{
+		const ::std::string tmp_filepath = filepath + ".tmp";
+		bl saved = false;
+		{
+			::std::ofstream os(tmp_filepath, ::std::ios::out | ::std::ios::trunc);
+			if (os.is_open())
+			{
+				os << scrape();
+				saved = os.good();
+			}
+		}
+
+		if (saved)
+		{
+			::std::error_code error;
+			::std::filesystem::rename(tmp_filepath, filepath, error);
+			saved = !error;
+		}
+		return saved;
+	}
+
+	void metrics::start_snapshots(const ::std::string& filepath, tim::milliseconds interval)
+	{
+		stop_snapshots();
+
+		__detail::metrics_registry& registry = __detail::get_metrics_registry();
+		{
+			general_lock lock(registry.snapshot_mutex);
+			registry.is_snapshotting = true;
+			registry.snapshot_filepath = filepath;
+			registry.snapshot_interval = interval;
+		}
+		registry.snapshot_thread.run(__detail::snapshot_procedure, &registry);
+	}
+
+	void metrics::stop_snapshots()
+	{
+		__detail::metrics_registry& registry = __detail::get_metrics_registry();
+		bl was_snapshotting = false;
+		{
+			general_lock lock(registry.snapshot_mutex);
+			was_snapshotting = registry.is_snapshotting;
+			registry.is_snapshotting = false;
+		}
+
+		if (was_snapshotting)
+		{
+			registry.snapshot_condition.notify_all();
+			registry.snapshot_thread.join();
+		}
+	}
+
+	bl metrics::is_snapshotting()
+	{
+		__detail::metrics_registry& registry = __detail::get_metrics_registry();
+		general_lock lock(registry.snapshot_mutex);
+		return registry.is_snapshotting;
+	}
+} // namespace np::nsit
@@ -0,0 +1,487 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#include <fstream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "NP-Engine/Platform/Platform.hpp"
+
+#if NP_ENGINE_PLATFORM_IS_LINUX
+	#include <cerrno>
+	#include <csignal>
+	#include <ctime>
+	#include <pthread.h>
+	#include <unistd.h>
+	#include <sys/syscall.h>
+	#include <execinfo.h>
+	#include <dlfcn.h>
+	#include <cxxabi.h>
+#endif
+
+#include "NP-Engine/Thread/Thread.hpp"
+#include "NP-Engine/Time/Time.hpp"
+
+#include "NP-Engine/Insight/SamplingProfiler.hpp"
+
+namespace np::nsit
+{
+#if NP_ENGINE_PLATFORM_IS_LINUX
+	namespace __detail
+	{
+		// frames[0] is the signal handler and frames[1] is the kernel's signal trampoline
+		constexpr static siz PROFILER_SKIPPED_FRAME_COUNT = 2;
+
+		using profiler_stack = ::std::vector<const void*>; // [tag, outermost frame, ..., innermost frame]
+		using profiler_stacks = ::std::map<profiler_stack, ui64>;
+
+		struct profiler_sample
+		{
+			const void* tag = nullptr;
+			i32 depth = 0;
+			void* frames[NP_ENGINE_SAMPLING_PROFILER_MAX_DEPTH];
+		};
+
+		/*
+			single producer ring -- only the owning thread's signal handler advances head, and only the collector
+			advances tail
+		*/
+		struct profiler_thread_buffer
+		{
+			::std::string name = "";
+			timer_t timer{};
+			bl has_timer = false;
+			atm_siz head{0};
+			atm_siz tail{0};
+			atm_ui64 dropped{0};
+			profiler_sample samples[NP_ENGINE_SAMPLING_PROFILER_BUFFER_SIZE];
+			profiler_stacks stacks; // guarded by the registry
+		};
+
+		struct profiler_registry
+		{
+			mutex buffers_mutex;
+			::std::vector<::std::unique_ptr<profiler_thread_buffer>> buffers;
+			::std::vector<::std::pair<::std::string, profiler_stacks>> retired_stacks; // from threads that have exited
+			ui64 sample_count = 0;
+			ui64 retired_dropped_count = 0;
+			ui32 frequency = NP_ENGINE_SAMPLING_PROFILER_FREQUENCY;
+			bl has_signal_handler = false;
+
+			mutex collector_mutex;
+			condition collector_condition;
+			bl keep_collecting = false;
+			thr::thread collector_thread;
+		};
+
+		static atm_bl profiler_is_sampling(false);
+		static thread_local profiler_thread_buffer* profiler_buffer = nullptr;
+
+		/*
+			never destroyed -- threads may unregister during static destruction
+		*/
+		static profiler_registry& get_profiler_registry()
+		{
+			static profiler_registry* registry = new profiler_registry();
+			return *registry;
+		}
+
+		/*
+			async-signal-safe: no locks, no allocations -- backtrace is primed in start so it does not load libgcc here
+		*/
+		static void profiler_signal_handler(i32, siginfo_t*, void*)
+		{
+			const i32 saved_errno = errno;
+			profiler_thread_buffer* buffer = profiler_buffer;
+
+			if (buffer && profiler_is_sampling.load(mo_relaxed))
+			{
+				const siz head = buffer->head.load(mo_relaxed);
+				if (head - buffer->tail.load(mo_acquire) < NP_ENGINE_SAMPLING_PROFILER_BUFFER_SIZE)
+				{
+					profiler_sample& sample = buffer->samples[head % NP_ENGINE_SAMPLING_PROFILER_BUFFER_SIZE];
+					sample.tag = sampling_profiler::get_thread_tag();
+					sample.depth = backtrace(sample.frames, NP_ENGINE_SAMPLING_PROFILER_MAX_DEPTH);
+					buffer->head.store(head + 1, mo_release);
+				}
+				else
+				{
+					buffer->dropped.fetch_add(1, mo_relaxed);
+				}
+			}
+
+			errno = saved_errno;
+		}
+
+		static void set_profiler_timer(profiler_thread_buffer& buffer, ui32 frequency)
+		{
+			if (buffer.has_timer)
+			{
+				itimerspec spec{};
+				if (frequency != 0)
+				{
+					const i64 period = 1000000000 / (i64)frequency;
+					spec.it_interval.tv_sec = period / 1000000000;
+					spec.it_interval.tv_nsec = period % 1000000000;
+					spec.it_value = spec.it_interval;
+				}
+				timer_settime(buffer.timer, 0, &spec, nullptr);
+			}
+		}
+
+		/*
+			registry's buffers_mutex must be held
+		*/
+		static void collect_profiler_buffer(profiler_registry& registry, profiler_thread_buffer& buffer)
+		{
+			const siz head = buffer.head.load(mo_acquire);
+			for (siz tail = buffer.tail.load(mo_relaxed); tail != head; tail++)
+			{
+				const profiler_sample& sample = buffer.samples[tail % NP_ENGINE_SAMPLING_PROFILER_BUFFER_SIZE];
+				profiler_stack stack;
+				stack.reserve(sample.depth + 1);
+				stack.emplace_back(sample.tag);
+				for (i32 i = sample.depth - 1; i >= (i32)PROFILER_SKIPPED_FRAME_COUNT; i--)
+					stack.emplace_back(sample.frames[i]);
+
+				buffer.stacks[stack]++;
+				registry.sample_count++;
+			}
+			buffer.tail.store(head, mo_release);
+		}
+
+		static void collect_profiler_buffers(profiler_registry& registry)
+		{
+			for (auto& buffer : registry.buffers)
+				collect_profiler_buffer(registry, *buffer);
+		}
+
+		static void profiler_collector_procedure(profiler_registry* registry)
+		{
+			general_lock lock(registry->collector_mutex);
+			while (registry->keep_collecting)
+			{
+				registry->collector_condition.wait_for(lock, tim::milliseconds(NP_ENGINE_SAMPLING_PROFILER_COLLECT_INTERVAL));
+				general_lock buffers_lock(registry->buffers_mutex);
+				collect_profiler_buffers(*registry);
+			}
+		}
+
+		/*
+			return addresses point just past their call, so step back into the call when looking them up
+		*/
+		static ::std::string symbolize(const void* address, bl is_return_address,
+									   ::std::unordered_map<const void*, ::std::string>& cache)
+		{
+			const void* lookup = is_return_address ? (const chr*)address - 1 : address;
+			auto it = cache.find(lookup);
+			if (it != cache.end())
+				return it->second;
+
+			::std::string symbol;
+			Dl_info info{};
+			const bl found = dladdr(lookup, &info) != 0;
+			if (found && info.dli_sname)
+			{
+				i32 status = 0;
+				chr* demangled = abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+				symbol = status == 0 && demangled ? demangled : info.dli_sname;
+				::std::free(demangled);
+			}
+			else if (found && info.dli_fname)
+			{
+				::std::ostringstream os;
+				::std::string module = info.dli_fname;
+				os << module.substr(module.find_last_of('/') + 1) << "+0x" << ::std::hex
+				   << ((const chr*)lookup - (const chr*)info.dli_fbase);
+				symbol = os.str();
+			}
+			else
+			{
+				::std::ostringstream os;
+				os << lookup;
+				symbol = os.str();
+			}
+
+			// folded stacks split frames on ';' and the count on the last ' '
+			for (chr& c : symbol)
+				if (c == ';')
+					c = ':';
+
+			return cache.emplace(lookup, symbol).first->second;
+		}
+
+		/*
+			distinct return addresses inside one function fold into the same line here
+		*/
+		static void fold_stacks(::std::map<::std::string, ui64>& folded, const ::std::string& name, const profiler_stacks& stacks,
+								::std::unordered_map<const void*, ::std::string>& cache)
+		{
+			for (const auto& stack : stacks)
+			{
+				::std::string line = name;
+				if (stack.first.front())
+					line += ";[job] " + symbolize(stack.first.front(), false, cache);
+
+				for (siz i = 1; i < stack.first.size(); i++)
+					line += ";" + symbolize(stack.first[i], i + 1 < stack.first.size(), cache);
+
+				folded[line] += stack.second;
+			}
+		}
+
+		/*
+			unregisters on thread exit
+		*/
+		struct profiler_thread_registration
+		{
+			~profiler_thread_registration()
+			{
+				sampling_profiler::unregister_thread();
+			}
+		};
+	} // namespace __detail
+
+	bl sampling_profiler::is_supported()
+	{
+		return true;
+	}
+
+	void sampling_profiler::register_thread(const ::std::string& name)
+	{
+		static thread_local __detail::profiler_thread_registration registration;
+		(void)registration;
+
+		__detail::profiler_registry& registry = __detail::get_profiler_registry();
+		general_lock lock(registry.buffers_mutex);
+
+		if (__detail::profiler_buffer)
+		{
+			__detail::profiler_buffer->name = name;
+		}
+		else
+		{
+			::std::unique_ptr<__detail::profiler_thread_buffer> buffer = ::std::make_unique<__detail::profiler_thread_buffer>();
+			buffer->name = name;
+
+			clockid_t clock{};
+			if (pthread_getcpuclockid(pthread_self(), &clock) == 0)
+			{
+				sigevent event{};
+				event.sigev_notify = SIGEV_THREAD_ID;
+				event.sigev_signo = SIGPROF;
+				event._sigev_un._tid = (pid_t)syscall(SYS_gettid);
+				buffer->has_timer = timer_create(clock, &event, &buffer->timer) == 0;
+			}
+
+			__detail::profiler_buffer = buffer.get();
+			::std::atomic_signal_fence(mo_release);
+
+			if (__detail::profiler_is_sampling.load(mo_acquire))
+				__detail::set_profiler_timer(*buffer, registry.frequency);
+
+			registry.buffers.emplace_back(::std::move(buffer));
+		}
+	}
+
+	void sampling_profiler::unregister_thread()
+	{
+		__detail::profiler_thread_buffer* buffer = __detail::profiler_buffer;
+		if (buffer)
+		{
+			__detail::profiler_buffer = nullptr;
+			::std::atomic_signal_fence(mo_release);
+
+			__detail::profiler_registry& registry = __detail::get_profiler_registry();
+			general_lock lock(registry.buffers_mutex);
+
+			if (buffer->has_timer)
+				timer_delete(buffer->timer);
+
+			__detail::collect_profiler_buffer(registry, *buffer);
+			registry.retired_dropped_count += buffer->dropped.load(mo_relaxed);
+			if (!buffer->stacks.empty())
+				registry.retired_stacks.emplace_back(buffer->name, ::std::move(buffer->stacks));
+
+			for (auto it = registry.buffers.begin(); it != registry.buffers.end(); it++)
+			{
+				if (it->get() == buffer)
+				{
+					registry.buffers.erase(it);
+					break;
+				}
+			}
+		}
+	}
+
+	bl sampling_profiler::start(ui32 frequency)
+	{
+		stop();
+
+		__detail::profiler_registry& registry = __detail::get_profiler_registry();
+		{
+			general_lock lock(registry.buffers_mutex);
+
+			if (!registry.has_signal_handler)
+			{
+				// the first backtrace may dlopen libgcc, which is not safe in a signal handler
+				void* frames[1];
+				backtrace(frames, 1);
+
+				// the handler stays installed, a SIGPROF still in flight after stop must not hit the default action
+				struct sigaction action{};
+				action.sa_sigaction = __detail::profiler_signal_handler;
+				action.sa_flags = SA_SIGINFO | SA_RESTART;
+				sigemptyset(&action.sa_mask);
+				registry.has_signal_handler = sigaction(SIGPROF, &action, nullptr) == 0;
+			}
+
+			if (registry.has_signal_handler && frequency != 0)
+			{
+				registry.frequency = frequency;
+				__detail::profiler_is_sampling.store(true, mo_release);
+				for (auto& buffer : registry.buffers)
+					__detail::set_profiler_timer(*buffer, registry.frequency);
+			}
+		}
+
+		if (is_running())
+		{
+			{
+				general_lock lock(registry.collector_mutex);
+				registry.keep_collecting = true;
+			}
+			registry.collector_thread.run(__detail::profiler_collector_procedure, &registry);
+		}
+
+		return is_running();
+	}
+
+	void sampling_profiler::stop()
+	{
+		__detail::profiler_registry& registry = __detail::get_profiler_registry();
+		{
+			general_lock lock(registry.buffers_mutex);
+			for (auto& buffer : registry.buffers)
+				__detail::set_profiler_timer(*buffer, 0);
+			__detail::profiler_is_sampling.store(false, mo_release);
+		}
+
+		{
+			general_lock lock(registry.collector_mutex);
+			registry.keep_collecting = false;
+		}
+		registry.collector_condition.notify_all();
+		registry.collector_thread.join();
+
+		general_lock lock(registry.buffers_mutex);
+		__detail::collect_profiler_buffers(registry);
+	}
+
+	bl sampling_profiler::is_running()
+	{
+		return __detail::profiler_is_sampling.load(mo_acquire);
+	}
+
+	bl sampling_profiler::save(const ::std::string& filepath)
+	{
+		__detail::profiler_registry& registry = __detail::get_profiler_registry();
+		::std::unordered_map<const void*, ::std::string> cache;
+		::std::ofstream os(filepath, ::std::ios::out | ::std::ios::trunc);
+
+		if (os.is_open())
+		{
+			::std::map<::std::string, ui64> folded;
+			{
+				general_lock lock(registry.buffers_mutex);
+				__detail::collect_profiler_buffers(registry);
+
+				for (const auto& retired : registry.retired_stacks)
+					__detail::fold_stacks(folded, retired.first, retired.second, cache);
+
+				for (const auto& buffer : registry.buffers)
+					__detail::fold_stacks(folded, buffer->name, buffer->stacks, cache);
+			}
+
+			for (const auto& line : folded)
+				os << line.first << " " << line.second << "\n";
+		}
+
+		return os.good();
+	}
+
+	void sampling_profiler::reset()
+	{
+		__detail::profiler_registry& registry = __detail::get_profiler_registry();
+		general_lock lock(registry.buffers_mutex);
+		__detail::collect_profiler_buffers(registry);
+
+		for (auto& buffer : registry.buffers)
+		{
+			buffer->stacks.clear();
+			buffer->dropped.store(0, mo_relaxed);
+		}
+
+		registry.retired_stacks.clear();
+		registry.retired_dropped_count = 0;
+		registry.sample_count = 0;
+	}
+
+	sampling_profiler_stats sampling_profiler::get_stats()
+	{
+		__detail::profiler_registry& registry = __detail::get_profiler_registry();
+		general_lock lock(registry.buffers_mutex);
+		__detail::collect_profiler_buffers(registry);
+
+		sampling_profiler_stats stats{};
+		stats.samples = registry.sample_count;
+		stats.dropped = registry.retired_dropped_count;
+		stats.threads = registry.buffers.size();
+		for (const auto& buffer : registry.buffers)
+			stats.dropped += buffer->dropped.load(mo_relaxed);
+		return stats;
+	}
+
+#else
+	bl sampling_profiler::is_supported()
+	{
+		return false;
+	}
+
+	void sampling_profiler::register_thread(const ::std::string& name) {}
+
+	void sampling_profiler::unregister_thread() {}
+
+	bl sampling_profiler::start(ui32 frequency)
+	{
+		return false;
+	}
+
+	void sampling_profiler::stop() {}
+
+	bl sampling_profiler::is_running()
+	{
+		return false;
+	}
+
+	bl sampling_profiler::save(const ::std::string& filepath)
+	{
+		return false;
+	}
+
+	void sampling_profiler::reset() {}
+
+	sampling_profiler_stats sampling_profiler::get_stats()
+	{
+		return {};
+	}
+#endif
+} // namespace np::nsit
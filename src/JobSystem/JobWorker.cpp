@@ -5,7 +5,6 @@
 //##===----------------------------------------------------------------------===##//
 
 #include "NP-Engine/Insight/Insight.hpp"
-#include "NP-Engine/String/String.hpp" //just for insight usage
 
 #include "NP-Engine/JobSystem/JobWorker.hpp"
 #include "NP-Engine/JobSystem/JobSystem.hpp"
@@ -14,10 +13,12 @@ namespace np::jsys
 {
 	void JobWorker::WorkProcedure(const WorkPayload& payload)
 	{
-		NP_ENGINE_PROFILE_SCOPE("WorkerThreadProcedure: " + to_str(payload.self->_id));
+		NP_ENGINE_PROFILE_SCOPE_ARG("WorkerThreadProcedure", payload.self->_id);
 
 		JobWorker& self = *payload.self;
 		JobSystem& system = *payload.system;
+		NP_ENGINE_PROFILE_THREAD_NAME("job worker " + ::std::to_string(self._id));
+		nsit::sampling_profiler::register_thread("job worker " + ::std::to_string(self._id));
 		mutex sleep_mutex;
 		general_lock sleep_lock(sleep_mutex);
 		IsAwakeFunctor is_awake_functor{self};
@@ -29,6 +30,8 @@ namespace np::jsys
 
 			self.ResetWakeCounter();
 		}
+
+		nsit::sampling_profiler::unregister_thread();
 	}
 
 	bl JobWorker::TryPriorityBasedJob(JobSystem& system)
@@ -0,0 +1,74 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#include "NP-Engine/Insight/Insight.hpp"
+
+#include "NP-Engine/JobSystem/ServiceThread.hpp"
+#include "NP-Engine/JobSystem/JobSystem.hpp"
+
+namespace np::jsys
+{
+	void ServiceThread::RunProcedure(ServiceThread* self)
+	{
+		NP_ENGINE_PROFILE_THREAD_NAME(self->_name);
+		nsit::sampling_profiler::register_thread(self->_name);
+
+		{
+			NP_ENGINE_PROFILE_SCOPE_ARG("ServiceThreadProcedure", self->_id);
+			self->_callback(*self);
+		}
+
+		self->_cpu_ns.store((ui64)thr::this_thread::get_cpu_time().count(), mo_release);
+		nsit::sampling_profiler::unregister_thread();
+	}
+
+	void ServiceThread::StartWork(siz id)
+	{
+		bl was_running = _keep_running.exchange(true, mo_release);
+		NP_ENGINE_ASSERT(!was_running && !IsRunning(), "ServiceThread is already running.");
+
+		_id = id;
+		_cpu_ns.store(0, mo_release);
+		_helped_job_count.store(0, mo_release);
+		_start_ns.store(GetNowNanoseconds(), mo_release);
+		_stop_ns.store(0, mo_release);
+
+		scoped_lock lock(_thread_mutex);
+		_thread = mem::create_sptr<thr::thread>(_allocator);
+		_thread->run(RunProcedure, this);
+
+		if (HasAffinity())
+			_thread->set_affinity(_affinity);
+	}
+
+	bl ServiceThread::HelpJobSystem()
+	{
+		JobRecord next = _job_system.GetNextJob();
+		if (next.IsValid())
+		{
+			if (next.job->CanExecute())
+			{
+				(*next.job)(_id);
+				_helped_job_count.fetch_add(1, mo_release);
+			}
+			else
+			{
+				_job_system.SubmitJob(NormalizePriority(next.priority), next.job);
+			}
+		}
+		return next.IsValid();
+	}
+
+	mem::sptr<Job> ServiceThread::CreateJob()
+	{
+		return _job_system.CreateJob();
+	}
+
+	void ServiceThread::SubmitJob(JobPriority priority, mem::sptr<Job> job)
+	{
+		_job_system.SubmitJob(priority, job);
+	}
+} // namespace np::jsys
@@ -0,0 +1,31 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#include "NP-Engine/Foundation/Foundation.hpp"
+
+#include "NP-Engine/Network/Interface/Interface.hpp"
+
+#include "NP-Engine/Network/Detail/Native/NativeMetricsEndpoint.hpp"
+
+namespace np::net
+{
+	mem::sptr<MetricsEndpoint> MetricsEndpoint::Create(mem::sptr<Context> context)
+	{
+		mem::sptr<MetricsEndpoint> endpoint = nullptr;
+
+		switch (context->GetDetailType())
+		{
+		case DetailType::Native:
+			endpoint = mem::create_sptr<__detail::NativeMetricsEndpoint>(context->GetServices()->GetAllocator(), context);
+			break;
+
+		default:
+			break;
+		}
+
+		return endpoint;
+	}
+} // namespace np::net
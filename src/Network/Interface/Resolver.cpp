@@ -29,4 +29,42 @@ namespace np::net
 		return resolver;
 	}
 
+	void Resolver::ResolveJobCallback(mem::delegate& d)
+	{
+		ResolveJobPayload* payload = (ResolveJobPayload*)d.GetPayload();
+		mem::sptr<Context> context = payload->context;
+		mem::sptr<Resolver> resolver = payload->resolver;
+		str name = payload->name;
+		mem::destroy<ResolveJobPayload>(context->GetServices()->GetAllocator(), payload);
+
+		Host host;
+		if (resolver)
+			host = resolver->DetailGetHost(name);
+
+		context->GetResolverCache().Complete(name, host, IsFound(host));
+	}
+
+	void Resolver::GetHostAsync(str name, ResolveCallback callback, void* caller)
+	{
+		ResolverCache& cache = _context->GetResolverCache();
+		Host host;
+		bl found = false;
+
+		if (cache.Get(name, host, found))
+		{
+			if (callback)
+				callback(caller, host, found);
+		}
+		else if (cache.AddWaiter(name, callback, caller))
+		{
+			mem::sptr<srvc::Services> services = _context->GetServices();
+			jsys::JobSystem& job_system = services->GetJobSystem();
+
+			mem::sptr<jsys::Job> job = job_system.CreateJob();
+			job->SetPayload(mem::create<ResolveJobPayload>(services->GetAllocator(),
+														   ResolveJobPayload{_context, CreateJobResolver(), name}));
+			job->SetCallback(ResolveJobCallback);
+			job_system.SubmitJob(jsys::JobPriority::Normal, job);
+		}
+	}
 } // namespace np::net
\ No newline at end of file
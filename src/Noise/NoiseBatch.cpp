@@ -0,0 +1,141 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#include "NP-Engine/Noise/NoiseBatch.hpp"
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_AMD64) || defined(_M_IX86))
+	#include <intrin.h>
+	#include <immintrin.h>
+#endif
+
+namespace np::noiz
+{
+	namespace __detail
+	{
+		static NoiseBatchIsa DetectNoiseBatchIsa()
+		{
+			NoiseBatchIsa isa = NoiseBatchIsa::Scalar;
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+			// these also check that the os saves the wider registers
+			__builtin_cpu_init();
+			if (__builtin_cpu_supports("avx512f"))
+				isa = NoiseBatchIsa::Avx512;
+			else if (__builtin_cpu_supports("avx2"))
+				isa = NoiseBatchIsa::Avx2;
+			else if (__builtin_cpu_supports("sse4.1"))
+				isa = NoiseBatchIsa::Sse41;
+
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_AMD64) || defined(_M_IX86))
+			i32 info[4]{};
+			__cpuid(info, 0);
+			const i32 max_leaf = info[0];
+
+			__cpuid(info, 1);
+			const bl sse41 = info[2] & BIT(19);
+			const bl osxsave = info[2] & BIT(27);
+			const ui64 xcr0 = osxsave ? _xgetbv(0) : 0;
+			const bl os_avx = (xcr0 & 0x6) == 0x6; // xmm and ymm
+			const bl os_avx512 = (xcr0 & 0xE6) == 0xE6; // xmm, ymm, opmask, and zmm
+
+			bl avx2 = false;
+			bl avx512f = false;
+			if (max_leaf >= 7)
+			{
+				__cpuidex(info, 7, 0);
+				avx2 = info[1] & BIT(5);
+				avx512f = info[1] & BIT(16);
+			}
+
+			if (avx512f && os_avx512)
+				isa = NoiseBatchIsa::Avx512;
+			else if (avx2 && os_avx)
+				isa = NoiseBatchIsa::Avx2;
+			else if (sse41)
+				isa = NoiseBatchIsa::Sse41;
+#endif
+
+			return isa;
+		}
+
+		static const NoiseBatchKernels* GetNoiseBatchKernels(NoiseBatchIsa isa)
+		{
+			switch (isa)
+			{
+			case NoiseBatchIsa::Avx512:
+				return GetAvx512NoiseBatchKernels();
+			case NoiseBatchIsa::Avx2:
+				return GetAvx2NoiseBatchKernels();
+			case NoiseBatchIsa::Sse41:
+				return GetSse41NoiseBatchKernels();
+			default:
+				return nullptr;
+			}
+		}
+
+		/*
+			a lower isa may not have been built even though a higher one was
+		*/
+		static NoiseBatchIsa GetBuiltNoiseBatchIsa(NoiseBatchIsa isa)
+		{
+			while (isa != NoiseBatchIsa::Scalar && !GetNoiseBatchKernels(isa))
+				isa = (NoiseBatchIsa)((ui32)isa - 1);
+			return isa;
+		}
+
+		static NoiseBatchIsa GetBestNoiseBatchIsa()
+		{
+			static const NoiseBatchIsa best = GetBuiltNoiseBatchIsa(DetectNoiseBatchIsa());
+			return best;
+		}
+
+		static atm<const NoiseBatchKernels*>& GetActiveNoiseBatchKernels()
+		{
+			static atm<const NoiseBatchKernels*> kernels{GetNoiseBatchKernels(GetBestNoiseBatchIsa())};
+			return kernels;
+		}
+	} // namespace __detail
+
+	NoiseBatchIsa NoiseBatch::GetSupportedIsa()
+	{
+		return __detail::GetBestNoiseBatchIsa();
+	}
+
+	NoiseBatchIsa NoiseBatch::GetIsa()
+	{
+		const __detail::NoiseBatchKernels* kernels = GetKernels();
+		return kernels ? kernels->isa : NoiseBatchIsa::Scalar;
+	}
+
+	void NoiseBatch::SetIsa(NoiseBatchIsa isa)
+	{
+		if ((ui32)isa > (ui32)GetSupportedIsa())
+			isa = GetSupportedIsa();
+
+		const __detail::NoiseBatchKernels* kernels = __detail::GetNoiseBatchKernels(__detail::GetBuiltNoiseBatchIsa(isa));
+		__detail::GetActiveNoiseBatchKernels().store(kernels, mo_release);
+	}
+
+	const __detail::NoiseBatchKernels* NoiseBatch::GetKernels()
+	{
+		return __detail::GetActiveNoiseBatchKernels().load(mo_acquire);
+	}
+
+	const chr* NoiseBatch::GetIsaName(NoiseBatchIsa isa)
+	{
+		switch (isa)
+		{
+		case NoiseBatchIsa::Avx512:
+			return "avx512";
+		case NoiseBatchIsa::Avx2:
+			return "avx2";
+		case NoiseBatchIsa::Sse41:
+			return "sse4.1";
+		default:
+			return "scalar";
+		}
+	}
+} // namespace np::noiz
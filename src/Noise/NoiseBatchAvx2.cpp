@@ -0,0 +1,173 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#include "NP-Engine/Noise/NoiseBatch.hpp"
+
+#if defined(__AVX2__)
+	#define NP_ENGINE_NOISE_BATCH_AVX2 1
+#endif
+
+#if NP_ENGINE_NOISE_BATCH_AVX2
+
+	#include <immintrin.h>
+
+	#include "NP-Engine/Noise/NoiseBatchImpl.hpp"
+
+namespace np::noiz::__detail
+{
+	struct Avx2NoiseBatchLanes
+	{
+		using F = __m256;
+		using I = __m256i;
+		using M = __m256;
+		constexpr static siz WIDTH = 8;
+
+		static F Load(const flt* p)
+		{
+			return _mm256_loadu_ps(p);
+		}
+
+		static void Store(flt* p, F a)
+		{
+			_mm256_storeu_ps(p, a);
+		}
+
+		static F Set(flt a)
+		{
+			return _mm256_set1_ps(a);
+		}
+
+		static I SetI(i32 a)
+		{
+			return _mm256_set1_epi32(a);
+		}
+
+		static F Add(F a, F b)
+		{
+			return _mm256_add_ps(a, b);
+		}
+
+		static F Sub(F a, F b)
+		{
+			return _mm256_sub_ps(a, b);
+		}
+
+		static F Mul(F a, F b)
+		{
+			return _mm256_mul_ps(a, b);
+		}
+
+		static F Div(F a, F b)
+		{
+			return _mm256_div_ps(a, b);
+		}
+
+		static F Negate(F a)
+		{
+			return _mm256_xor_ps(a, _mm256_set1_ps(-0.f));
+		}
+
+		static I AddI(I a, I b)
+		{
+			return _mm256_add_epi32(a, b);
+		}
+
+		static I AndI(I a, I b)
+		{
+			return _mm256_and_si256(a, b);
+		}
+
+		static F ToFlt(I a)
+		{
+			return _mm256_cvtepi32_ps(a);
+		}
+
+		static I TruncToInt(F a)
+		{
+			return _mm256_cvttps_epi32(a);
+		}
+
+		static M Less(F a, F b)
+		{
+			return _mm256_cmp_ps(a, b, _CMP_LT_OQ);
+		}
+
+		static M Greater(F a, F b)
+		{
+			return _mm256_cmp_ps(a, b, _CMP_GT_OQ);
+		}
+
+		static M GreaterEqual(F a, F b)
+		{
+			return _mm256_cmp_ps(a, b, _CMP_GE_OQ);
+		}
+
+		static M LessI(I a, I b)
+		{
+			return _mm256_castsi256_ps(_mm256_cmpgt_epi32(b, a));
+		}
+
+		static M EqualI(I a, I b)
+		{
+			return _mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b));
+		}
+
+		static M Test(I a, i32 bits)
+		{
+			const I b = _mm256_set1_epi32(bits);
+			return _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(a, b), b));
+		}
+
+		static M And(M a, M b)
+		{
+			return _mm256_and_ps(a, b);
+		}
+
+		static M Or(M a, M b)
+		{
+			return _mm256_or_ps(a, b);
+		}
+
+		static M Not(M a)
+		{
+			return _mm256_xor_ps(a, _mm256_castsi256_ps(_mm256_set1_epi32(-1)));
+		}
+
+		static F Select(M m, F a, F b)
+		{
+			return _mm256_blendv_ps(b, a, m);
+		}
+
+		static I SelectI(M m, I a, I b)
+		{
+			return _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(b), _mm256_castsi256_ps(a), m));
+		}
+
+		static I Gather(const i32* table, I indices)
+		{
+			return _mm256_i32gather_epi32(table, indices, 4);
+		}
+	};
+
+	const NoiseBatchKernels* GetAvx2NoiseBatchKernels()
+	{
+		static const NoiseBatchKernels kernels =
+			NoiseBatchImpl<Avx2NoiseBatchLanes>::GetKernels(NoiseBatchIsa::Avx2);
+		return &kernels;
+	}
+} // namespace np::noiz::__detail
+
+#else
+
+namespace np::noiz::__detail
+{
+	const NoiseBatchKernels* GetAvx2NoiseBatchKernels()
+	{
+		return nullptr;
+	}
+} // namespace np::noiz::__detail
+
+#endif
@@ -0,0 +1,176 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#include "NP-Engine/Noise/NoiseBatch.hpp"
+
+#if defined(__AVX512F__)
+	#define NP_ENGINE_NOISE_BATCH_AVX512 1
+#endif
+
+#if NP_ENGINE_NOISE_BATCH_AVX512
+
+	#include <immintrin.h>
+
+	#include "NP-Engine/Noise/NoiseBatchImpl.hpp"
+
+namespace np::noiz::__detail
+{
+	/*
+		sticks to avx512f -- masks live in k registers, and float xor is done on the integer side since _mm512_xor_ps
+		needs avx512dq
+	*/
+	struct Avx512NoiseBatchLanes
+	{
+		using F = __m512;
+		using I = __m512i;
+		using M = __mmask16;
+		constexpr static siz WIDTH = 16;
+
+		static F Load(const flt* p)
+		{
+			return _mm512_loadu_ps(p);
+		}
+
+		static void Store(flt* p, F a)
+		{
+			_mm512_storeu_ps(p, a);
+		}
+
+		static F Set(flt a)
+		{
+			return _mm512_set1_ps(a);
+		}
+
+		static I SetI(i32 a)
+		{
+			return _mm512_set1_epi32(a);
+		}
+
+		static F Add(F a, F b)
+		{
+			return _mm512_add_ps(a, b);
+		}
+
+		static F Sub(F a, F b)
+		{
+			return _mm512_sub_ps(a, b);
+		}
+
+		static F Mul(F a, F b)
+		{
+			return _mm512_mul_ps(a, b);
+		}
+
+		static F Div(F a, F b)
+		{
+			return _mm512_div_ps(a, b);
+		}
+
+		static F Negate(F a)
+		{
+			return _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(a), _mm512_set1_epi32((i32)0x80000000)));
+		}
+
+		static I AddI(I a, I b)
+		{
+			return _mm512_add_epi32(a, b);
+		}
+
+		static I AndI(I a, I b)
+		{
+			return _mm512_and_si512(a, b);
+		}
+
+		static F ToFlt(I a)
+		{
+			return _mm512_cvtepi32_ps(a);
+		}
+
+		static I TruncToInt(F a)
+		{
+			return _mm512_cvttps_epi32(a);
+		}
+
+		static M Less(F a, F b)
+		{
+			return _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ);
+		}
+
+		static M Greater(F a, F b)
+		{
+			return _mm512_cmp_ps_mask(a, b, _CMP_GT_OQ);
+		}
+
+		static M GreaterEqual(F a, F b)
+		{
+			return _mm512_cmp_ps_mask(a, b, _CMP_GE_OQ);
+		}
+
+		static M LessI(I a, I b)
+		{
+			return _mm512_cmplt_epi32_mask(a, b);
+		}
+
+		static M EqualI(I a, I b)
+		{
+			return _mm512_cmpeq_epi32_mask(a, b);
+		}
+
+		static M Test(I a, i32 bits)
+		{
+			return _mm512_test_epi32_mask(a, _mm512_set1_epi32(bits));
+		}
+
+		static M And(M a, M b)
+		{
+			return (M)(a & b);
+		}
+
+		static M Or(M a, M b)
+		{
+			return (M)(a | b);
+		}
+
+		static M Not(M a)
+		{
+			return (M)~a;
+		}
+
+		static F Select(M m, F a, F b)
+		{
+			return _mm512_mask_blend_ps(m, b, a);
+		}
+
+		static I SelectI(M m, I a, I b)
+		{
+			return _mm512_mask_blend_epi32(m, b, a);
+		}
+
+		static I Gather(const i32* table, I indices)
+		{
+			return _mm512_i32gather_epi32(indices, table, 4);
+		}
+	};
+
+	const NoiseBatchKernels* GetAvx512NoiseBatchKernels()
+	{
+		static const NoiseBatchKernels kernels =
+			NoiseBatchImpl<Avx512NoiseBatchLanes>::GetKernels(NoiseBatchIsa::Avx512);
+		return &kernels;
+	}
+} // namespace np::noiz::__detail
+
+#else
+
+namespace np::noiz::__detail
+{
+	const NoiseBatchKernels* GetAvx512NoiseBatchKernels()
+	{
+		return nullptr;
+	}
+} // namespace np::noiz::__detail
+
+#endif
@@ -0,0 +1,179 @@
+//##===----------------------------------------------------------------------===##//
+//
+//  Author: Nathan Phipps 10/19/26
+//
+//##===----------------------------------------------------------------------===##//
+
+#include "NP-Engine/Noise/NoiseBatch.hpp"
+
+// msvc has no sse4.1 switch, so x64 builds always have it available
+#if defined(__SSE4_1__) || (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_AMD64)))
+	#define NP_ENGINE_NOISE_BATCH_SSE41 1
+#endif
+
+#if NP_ENGINE_NOISE_BATCH_SSE41
+
+	#include <smmintrin.h>
+
+	#include "NP-Engine/Noise/NoiseBatchImpl.hpp"
+
+namespace np::noiz::__detail
+{
+	struct Sse41NoiseBatchLanes
+	{
+		using F = __m128;
+		using I = __m128i;
+		using M = __m128;
+		constexpr static siz WIDTH = 4;
+
+		static F Load(const flt* p)
+		{
+			return _mm_loadu_ps(p);
+		}
+
+		static void Store(flt* p, F a)
+		{
+			_mm_storeu_ps(p, a);
+		}
+
+		static F Set(flt a)
+		{
+			return _mm_set1_ps(a);
+		}
+
+		static I SetI(i32 a)
+		{
+			return _mm_set1_epi32(a);
+		}
+
+		static F Add(F a, F b)
+		{
+			return _mm_add_ps(a, b);
+		}
+
+		static F Sub(F a, F b)
+		{
+			return _mm_sub_ps(a, b);
+		}
+
+		static F Mul(F a, F b)
+		{
+			return _mm_mul_ps(a, b);
+		}
+
+		static F Div(F a, F b)
+		{
+			return _mm_div_ps(a, b);
+		}
+
+		static F Negate(F a)
+		{
+			return _mm_xor_ps(a, _mm_set1_ps(-0.f));
+		}
+
+		static I AddI(I a, I b)
+		{
+			return _mm_add_epi32(a, b);
+		}
+
+		static I AndI(I a, I b)
+		{
+			return _mm_and_si128(a, b);
+		}
+
+		static F ToFlt(I a)
+		{
+			return _mm_cvtepi32_ps(a);
+		}
+
+		static I TruncToInt(F a)
+		{
+			return _mm_cvttps_epi32(a);
+		}
+
+		static M Less(F a, F b)
+		{
+			return _mm_cmplt_ps(a, b);
+		}
+
+		static M Greater(F a, F b)
+		{
+			return _mm_cmpgt_ps(a, b);
+		}
+
+		static M GreaterEqual(F a, F b)
+		{
+			return _mm_cmpge_ps(a, b);
+		}
+
+		static M LessI(I a, I b)
+		{
+			return _mm_castsi128_ps(_mm_cmplt_epi32(a, b));
+		}
+
+		static M EqualI(I a, I b)
+		{
+			return _mm_castsi128_ps(_mm_cmpeq_epi32(a, b));
+		}
+
+		static M Test(I a, i32 bits)
+		{
+			const I b = _mm_set1_epi32(bits);
+			return _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(a, b), b));
+		}
+
+		static M And(M a, M b)
+		{
+			return _mm_and_ps(a, b);
+		}
+
+		static M Or(M a, M b)
+		{
+			return _mm_or_ps(a, b);
+		}
+
+		static M Not(M a)
+		{
+			return _mm_xor_ps(a, _mm_castsi128_ps(_mm_set1_epi32(-1)));
+		}
+
+		static F Select(M m, F a, F b)
+		{
+			return _mm_blendv_ps(b, a, m);
+		}
+
+		static I SelectI(M m, I a, I b)
+		{
+			return _mm_castps_si128(_mm_blendv_ps(_mm_castsi128_ps(b), _mm_castsi128_ps(a), m));
+		}
+
+		/*
+			no gather before avx2
+		*/
+		static I Gather(const i32* table, I indices)
+		{
+			alignas(16) i32 i[WIDTH];
+			_mm_store_si128((__m128i*)i, indices);
+			return _mm_setr_epi32(table[i[0]], table[i[1]], table[i[2]], table[i[3]]);
+		}
+	};
+
+	const NoiseBatchKernels* GetSse41NoiseBatchKernels()
+	{
+		static const NoiseBatchKernels kernels =
+			NoiseBatchImpl<Sse41NoiseBatchLanes>::GetKernels(NoiseBatchIsa::Sse41);
+		return &kernels;
+	}
+} // namespace np::noiz::__detail
+
+#else
+
+namespace np::noiz::__detail
+{
+	const NoiseBatchKernels* GetSse41NoiseBatchKernels()
+	{
+		return nullptr;
+	}
+} // namespace np::noiz::__detail
+
+#endif
@@ -6,9 +6,14 @@
 
 #include "NP-Engine/Thread/Thread.hpp"
 
-#if NP_ENGINE_PLATFORM_IS_LINUX
-	#include <pthread.h> //pthread_setaffinity_np
+#if NP_ENGINE_PLATFORM_IS_APPLE
+	#include <pthread.h> //pthread_mach_thread_np
+	#include <mach/mach.h> //thread_info
+
+#elif NP_ENGINE_PLATFORM_IS_LINUX
+	#include <pthread.h> //pthread_setaffinity_np, pthread_getcpuclockid
 	#include <sched.h> //cpu_set_t
+	#include <time.h> //clock_gettime
 
 #elif NP_ENGINE_PLATFORM_IS_WINDOWS
 	#include <Windows.h>
@@ -18,6 +23,52 @@
 
 namespace np::thr
 {
+	namespace __detail
+	{
+#if NP_ENGINE_PLATFORM_IS_APPLE
+		static tim::nanoseconds get_cpu_time(mach_port_t port)
+		{
+			tim::nanoseconds time{};
+			thread_basic_info_data_t info{};
+			mach_msg_type_number_t count = THREAD_BASIC_INFO_COUNT;
+			if (thread_info(port, THREAD_BASIC_INFO, (thread_info_t)&info, &count) == KERN_SUCCESS)
+			{
+				time = tim::seconds((dbl)(info.user_time.seconds + info.system_time.seconds)) +
+					tim::microseconds((dbl)(info.user_time.microseconds + info.system_time.microseconds));
+			}
+			return time;
+		}
+
+#elif NP_ENGINE_PLATFORM_IS_LINUX
+		static tim::nanoseconds get_cpu_time(pthread_t handle)
+		{
+			tim::nanoseconds time{};
+			clockid_t clock{};
+			timespec spec{};
+			if (pthread_getcpuclockid(handle, &clock) == 0 && clock_gettime(clock, &spec) == 0)
+				time = tim::seconds((dbl)spec.tv_sec) + tim::nanoseconds((dbl)spec.tv_nsec);
+
+			return time;
+		}
+
+#elif NP_ENGINE_PLATFORM_IS_WINDOWS
+		static tim::nanoseconds get_cpu_time(HANDLE handle)
+		{
+			tim::nanoseconds time{};
+			FILETIME creation{}, exit{}, kernel{}, user{};
+			if (GetThreadTimes(handle, &creation, &exit, &kernel, &user))
+			{
+				// filetimes count 100ns ticks
+				const ui64 kernel_ticks = ((ui64)kernel.dwHighDateTime << 32) | (ui64)kernel.dwLowDateTime;
+				const ui64 user_ticks = ((ui64)user.dwHighDateTime << 32) | (ui64)user.dwLowDateTime;
+				time = tim::nanoseconds((dbl)(kernel_ticks + user_ticks) * 100.0);
+			}
+			return time;
+		}
+
+#endif
+	} // namespace __detail
+
 	bl thread::set_affinity(siz core_number)
 	{
 		auto thread_access = _thread_block.get_access();
@@ -52,6 +103,25 @@ namespace np::thr
 		return set;
 	}
 
+	tim::nanoseconds thread::get_cpu_time()
+	{
+		auto thread_access = _thread_block.get_access();
+		::std::thread* thread = get_thread(*thread_access);
+		tim::nanoseconds time{};
+
+		if (thread)
+		{
+#if NP_ENGINE_PLATFORM_IS_APPLE
+			time = __detail::get_cpu_time(pthread_mach_thread_np(thread->native_handle()));
+
+#elif NP_ENGINE_PLATFORM_IS_LINUX || NP_ENGINE_PLATFORM_IS_WINDOWS
+			time = __detail::get_cpu_time(thread->native_handle());
+
+#endif
+		}
+		return time;
+	}
+
 	namespace this_thread
 	{
 		bl set_affinity(siz core_number)
@@ -75,5 +145,23 @@ namespace np::thr
 #endif
 			return set;
 		}
+
+		tim::nanoseconds get_cpu_time()
+		{
+			tim::nanoseconds time{};
+#if NP_ENGINE_PLATFORM_IS_APPLE
+			mach_port_t port = mach_thread_self();
+			time = __detail::get_cpu_time(port);
+			mach_port_deallocate(mach_task_self(), port);
+
+#elif NP_ENGINE_PLATFORM_IS_LINUX
+			time = __detail::get_cpu_time(pthread_self());
+
+#elif NP_ENGINE_PLATFORM_IS_WINDOWS
+			time = __detail::get_cpu_time(GetCurrentThread());
+
+#endif
+			return time;
+		}
 	} // namespace this_thread
 } // namespace np::thr
\ No newline at end of file
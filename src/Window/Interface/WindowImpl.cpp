@@ -8,6 +8,7 @@
 #include "NP-Engine/Window/Interface/WindowEvents.hpp"
 
 #include "NP-Engine/Window/Detail/Glfw/GlfwWindow.hpp"
+#include "NP-Engine/Window/Detail/Headless/HeadlessWindow.hpp"
 
 namespace np::win
 {
@@ -19,6 +20,10 @@ namespace np::win
 			__detail::GlfwWindow::Init();
 			break;
 
+		case DetailType::Headless:
+			__detail::HeadlessWindow::Init();
+			break;
+
 		default:
 			break;
 		}
@@ -32,6 +37,10 @@ namespace np::win
 			__detail::GlfwWindow::Terminate();
 			break;
 
+		case DetailType::Headless:
+			__detail::HeadlessWindow::Terminate();
+			break;
+
 		default:
 			break;
 		}
@@ -45,6 +54,10 @@ namespace np::win
 			__detail::GlfwWindow::Update();
 			break;
 
+		case DetailType::Headless:
+			__detail::HeadlessWindow::Update();
+			break;
+
 		default:
 			break;
 		}
@@ -60,6 +73,10 @@ namespace np::win
 			extensions = __detail::GlfwWindow::GetRequiredGpuExtentions();
 			break;
 
+		case DetailType::Headless:
+			extensions = __detail::HeadlessWindow::GetRequiredGpuExtentions();
+			break;
+
 		default:
 			break;
 		}
@@ -77,6 +94,10 @@ namespace np::win
 			window = mem::create_sptr<__detail::GlfwWindow>(services->GetAllocator(), services, id);
 			break;
 
+		case DetailType::Headless:
+			window = mem::create_sptr<__detail::HeadlessWindow>(services->GetAllocator(), services, id);
+			break;
+
 		default:
 			break;
 		}
@@ -88,12 +109,12 @@ namespace np::win
 	{
 		bl prevent = false;
 		{
-			auto callbacks = _prevent_close_callbacks.get_access();
+			auto callbacks = _prevent_close_callbacks.get_shared_access();
 			for (auto it = callbacks->begin(); it != callbacks->end(); it++)
 				prevent |= (*it)(nullptr);
 		}
 		{
-			auto callbacks = _prevent_close_caller_callbacks.get_access();
+			auto callbacks = _prevent_close_caller_callbacks.get_shared_access();
 			for (auto it = callbacks->begin(); it != callbacks->end(); it++)
 				prevent |= it->second(it->first);
 		}
@@ -106,12 +127,12 @@ namespace np::win
 		_services->GetEventSubmitter().Submit(e);
 
 		{
-			auto callbacks = _size_callbacks.get_access();
+			auto callbacks = _size_callbacks.get_shared_access();
 			for (auto it = callbacks->begin(); it != callbacks->end(); it++)
 				(*it)(nullptr, size);
 		}
 		{
-			auto callbacks = _size_caller_callbacks.get_access();
+			auto callbacks = _size_caller_callbacks.get_shared_access();
 			for (auto it = callbacks->begin(); it != callbacks->end(); it++)
 				it->second(it->first, size);
 		}
@@ -123,12 +144,12 @@ namespace np::win
 		_services->GetEventSubmitter().Submit(e);
 
 		{
-			auto callbacks = _position_callbacks.get_access();
+			auto callbacks = _position_callbacks.get_shared_access();
 			for (auto it = callbacks->begin(); it != callbacks->end(); it++)
 				(*it)(nullptr, position);
 		}
 		{
-			auto callbacks = _position_caller_callbacks.get_access();
+			auto callbacks = _position_caller_callbacks.get_shared_access();
 			for (auto it = callbacks->begin(); it != callbacks->end(); it++)
 				it->second(it->first, position);
 		}
@@ -140,12 +161,12 @@ namespace np::win
 		_services->GetEventSubmitter().Submit(e);
 
 		{
-			auto callbacks = _framebuffer_size_callbacks.get_access();
+			auto callbacks = _framebuffer_size_callbacks.get_shared_access();
 			for (auto it = callbacks->begin(); it != callbacks->end(); it++)
 				(*it)(nullptr, framebuffer_size);
 		}
 		{
-			auto callbacks = _framebuffer_size_caller_callbacks.get_access();
+			auto callbacks = _framebuffer_size_caller_callbacks.get_shared_access();
 			for (auto it = callbacks->begin(); it != callbacks->end(); it++)
 				it->second(it->first, framebuffer_size);
 		}
@@ -157,12 +178,12 @@ namespace np::win
 		_services->GetEventSubmitter().Submit(e);
 
 		{
-			auto callbacks = _minimize_callbacks.get_access();
+			auto callbacks = _minimize_callbacks.get_shared_access();
 			for (auto it = callbacks->begin(); it != callbacks->end(); it++)
 				(*it)(nullptr, minimized);
 		}
 		{
-			auto callbacks = _minimize_caller_callbacks.get_access();
+			auto callbacks = _minimize_caller_callbacks.get_shared_access();
 			for (auto it = callbacks->begin(); it != callbacks->end(); it++)
 				it->second(it->first, minimized);
 		}
@@ -174,12 +195,12 @@ namespace np::win
 		_services->GetEventSubmitter().Submit(e);
 
 		{
-			auto callbacks = _maximize_callbacks.get_access();
+			auto callbacks = _maximize_callbacks.get_shared_access();
 			for (auto it = callbacks->begin(); it != callbacks->end(); it++)
 				(*it)(nullptr, maximized);
 		}
 		{
-			auto callbacks = _maximize_caller_callbacks.get_access();
+			auto callbacks = _maximize_caller_callbacks.get_shared_access();
 			for (auto it = callbacks->begin(); it != callbacks->end(); it++)
 				it->second(it->first, maximized);
 		}
@@ -191,12 +212,12 @@ namespace np::win
 		_services->GetEventSubmitter().Submit(e);
 
 		{
-			auto callbacks = _focus_callbacks.get_access();
+			auto callbacks = _focus_callbacks.get_shared_access();
 			for (auto it = callbacks->begin(); it != callbacks->end(); it++)
 				(*it)(nullptr, focused);
 		}
 		{
-			auto callbacks = _focus_caller_callbacks.get_access();
+			auto callbacks = _focus_caller_callbacks.get_shared_access();
 			for (auto it = callbacks->begin(); it != callbacks->end(); it++)
 				it->second(it->first, focused);
 		}
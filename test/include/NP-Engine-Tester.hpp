@@ -42,6 +42,10 @@ namespace np::app
 			alignas(BIT(4)) ::glm::mat4 projection{};
 		};
 
+		// the largest minUniformBufferOffsetAlignment vulkan allows, so every frame's ubo offset is bindable
+		constexpr static siz UBO_ALIGNMENT = 256;
+
+	public:
 		struct Scene
 		{
 			tim::steady_timestamp startTimestamp = tim::steady_clock::now();
@@ -60,14 +64,25 @@ namespace np::app
 			mem::sptr<gpu::GraphicsPipeline> graphicsPipeline = nullptr;
 			mem::sptr<gpu::CommandBufferPool> commandBufferPool = nullptr;
 			mem::sptr<gpu::ResourceGroupPool> resourceGroupPool = nullptr;
+			mem::sptr<gpu::ResourceGroupCache> resourceGroupCache = nullptr;
+			con::vector<mem::sptr<gpu::ResourceLayout>> resourceLayouts{};
+			gpu::CommandStream commandStream{};
+			con::vector<gpu::CommandStream> batchStreams{};
+			mem::sptr<gpu::SecondaryCommandRecorder> secondaryRecorder = nullptr;
+			jsys::JobSystem* jobSystem = nullptr;
+			con::vector<gpu::ResourceGroup*> resourceGroupPointers{};
+			mem::sptr<gpu::PipelineCache> pipelineCache = nullptr;
+			str pipelineCacheFilename{};
+			tim::steady_timestamp pipelineCacheSaveTimestamp = tim::steady_clock::now();
 
 			siz frameCounter = 0;
 			siz frameCount = SIZ_MAX;
+			siz renderedFrameCount = 0; // since frames were last ensured
 			con::vector<mem::sptr<gpu::CommandBuffer>> commandBuffers{};
 			con::vector<mem::sptr<gpu::Fence>> submitCompleteFences{};
 			con::vector<mem::sptr<gpu::Semaphore>> frameReadySemaphores{};
 			con::vector<mem::sptr<gpu::Semaphore>> submitCompleteSemaphores{};
-			con::vector<mem::sptr<gpu::BufferResource>> uboBuffers{};
+			mem::sptr<gpu::StagingRing> uboStagingRing = nullptr;
 			mem::sptr<gpu::ImageResourceView> statueImageResourceView = nullptr;
 			mem::sptr<gpu::SamplerResource> statueSamplerResource = nullptr;
 			gpu::Format depthStencilFormat = gpu::Format::None;
@@ -86,6 +101,15 @@ namespace np::app
 			{
 				if (device)
 					device->WaitUntilIdle();
+
+				SavePipelineCache();
+			}
+
+			void SavePipelineCache()
+			{
+				pipelineCacheSaveTimestamp = tim::steady_clock::now();
+				if (pipelineCache && !pipelineCacheFilename.empty())
+					pipelineCache->Save(pipelineCacheFilename);
 			}
 
 			void EnsureFramebuffers(const con::vector<mem::sptr<gpu::Frame>>& frames)
@@ -104,6 +128,10 @@ namespace np::app
 				for (auto it = commandBuffers.begin(); it != commandBuffers.end(); it++)
 					if (!*it)
 						*it = commandBufferPool->CreateCommandBuffer();
+
+				if (!secondaryRecorder || secondaryRecorder->GetFrameCount() != frameCount)
+					secondaryRecorder = mem::create_sptr<gpu::SecondaryCommandRecorder>(device->GetServices()->GetAllocator(),
+																						queue, frameCount, jobSystem);
 			}
 
 			void EnsureFrameSyncronizations()
@@ -196,20 +224,20 @@ namespace np::app
 					image_barrier_1.range.usage = image_barrier_0.range.usage;
 
 					mem::sptr<gpu::BarrierCommand> barrier_cmd_0 = 
-						gpu::Command::Create(gpu::DetailType::Vulkan, services, gpu::CommandType::Barrier);
+						gpu::Command::Create(device->GetDetailType(), services, gpu::CommandType::Barrier);
 					barrier_cmd_0->dstStage = gpu::Stage::Transfer;
 					barrier_cmd_0->srcStage = gpu::Stage::Top;
 					barrier_cmd_0->imageBarriers = { image_barrier_0 };
 
 					mem::sptr<gpu::CopyBufferToImageCommand> copy_buffer_to_image_cmd = 
-						gpu::Command::Create(gpu::DetailType::Vulkan, services, gpu::CommandType::CopyBufferToImage);
+						gpu::Command::Create(device->GetDetailType(), services, gpu::CommandType::CopyBufferToImage);
 					copy_buffer_to_image_cmd->buffer = statue_buffer_resource;
 					copy_buffer_to_image_cmd->image = statue_image_resource;
 					copy_buffer_to_image_cmd->imageUsage = gpu::ImageResourceUsage::Transfer | gpu::ImageResourceUsage::Write;
 					copy_buffer_to_image_cmd->ranges = { copy_buffer_to_image_range };
 
 					mem::sptr<gpu::BarrierCommand> barrier_cmd_1 = 
-						gpu::Command::Create(gpu::DetailType::Vulkan, services, gpu::CommandType::Barrier);
+						gpu::Command::Create(device->GetDetailType(), services, gpu::CommandType::Barrier);
 					barrier_cmd_1->dstStage = gpu::Stage::VertexInput;
 					barrier_cmd_1->srcStage = gpu::Stage::Transfer;
 					barrier_cmd_1->imageBarriers = { image_barrier_1 };
@@ -276,12 +304,10 @@ namespace np::app
 			{
 				EnsureStatueResources();
 
-				uboBuffers.resize(frameCount);
-				for (auto it = uboBuffers.begin(); it != uboBuffers.end(); it++)
-					if (!*it)
-						*it = gpu::BufferResource::Create(device,
-							gpu::BufferResourceUsage::Uniform | gpu::BufferResourceUsage::HostAccessible | gpu::BufferResourceUsage::AutoClearCache,
-							mem::calc_aligned_size(sizeof(Ubo), mem::DEFAULT_ALIGNMENT), {queue->GetDeviceQueueFamily()});
+				if (!uboStagingRing || uboStagingRing->GetFrameCount() != frameCount)
+					uboStagingRing = mem::create_sptr<gpu::StagingRing>(device->GetServices()->GetAllocator(), frameContext,
+																		mem::calc_aligned_size(sizeof(Ubo), UBO_ALIGNMENT),
+																		gpu::BufferResourceUsage::Uniform);
 
 				mem::sptr<gpu::PipelineResourceLayout> pipeline_layout = graphicsPipeline->GetPipelineResourceLayout();
 
@@ -290,15 +316,29 @@ namespace np::app
 				{
 					resourceGroups.clear();
 					resourceGroupPool = gpu::ResourceGroupPool::Create(device, frameCount, pipeline_layout->GetResourceDesciptions());
+					resourceGroupCache = mem::create_sptr<gpu::ResourceGroupCache>(device->GetServices()->GetAllocator(),
+																					resourceGroupPool, frameCount);
 					is_resource_group_pool_reset = true;
 				}
 
-				con::vector<mem::sptr<gpu::ResourceLayout>> resource_layouts = pipeline_layout->GetResourceLayouts();
+				resourceLayouts = pipeline_layout->GetResourceLayouts();
+
+				// the cache hands out the first layout's group every frame, so only the layouts after it come from the pool
+				con::vector<mem::sptr<gpu::ResourceLayout>> pooled_layouts{};
+				if (!resourceLayouts.empty())
+					pooled_layouts.assign(resourceLayouts.begin() + 1, resourceLayouts.end());
 
 				resourceGroups.resize(frameCount);
 				for (auto it = resourceGroups.begin(); it != resourceGroups.end(); it++)
-					if (it->size() != resource_layouts.size() || is_resource_group_pool_reset)
-						*it = resourceGroupPool->CreateResourceGroups(resource_layouts);
+					if (it->size() != resourceLayouts.size() || is_resource_group_pool_reset)
+					{
+						it->assign(resourceLayouts.empty() ? 0 : 1, nullptr);
+						if (!pooled_layouts.empty())
+						{
+							con::vector<mem::sptr<gpu::ResourceGroup>> pooled_groups = resourceGroupPool->CreateResourceGroups(pooled_layouts);
+							it->insert(it->end(), pooled_groups.begin(), pooled_groups.end());
+						}
+					}
 			}
 
 			void EnsureFrames()
@@ -306,6 +346,7 @@ namespace np::app
 				con::vector<mem::sptr<gpu::Frame>> frames = frameContext->GetFrames();
 				frameCounter = 0;
 				frameCount = frames.size();
+				renderedFrameCount = 0;
 
 				EnsureDepthStencilResources();
 				EnsureFramebuffers(frames);
@@ -337,6 +378,8 @@ namespace np::app
 					{
 						mem::sptr<gpu::Fence> submit_complete_fence = submitCompleteFences[frameCounter];
 						submit_complete_fence->Wait();
+						secondaryRecorder->BeginFrame(frameCounter);
+						uboStagingRing->BeginFrame(frameCounter);
 						submit_complete_fence->Reset();
 
 						tim::seconds s = startTimestamp - tim::steady_clock::now();
@@ -346,83 +389,73 @@ namespace np::app
 						ubo.view = ::glm::lookAt(::glm::vec3{ 2, 2, 2 }, ::glm::vec3{ 0, 0, 0 }, ::glm::vec3{ 0, 0, 1 });
 						ubo.projection = ::glm::perspective(::glm::radians(45.f), (flt)frameContext->GetFrameAspectRatio(), 0.1f, 10.f);
 						ubo.projection[1][1] *= -1; //compensate for glm legacy where y axis was inverted
-						con::vector<ui8> ubo_bytes(sizeof(Ubo));
-						mem::copy_bytes(ubo_bytes.data(), &ubo, ubo_bytes.size());
-						uboBuffers[frameCounter]->SetBytes(0, ubo_bytes);
-						uboBuffers[frameCounter]->ClearCacheForDevice(0, ubo_bytes.size());
+						gpu::StagingAllocation ubo_allocation = uboStagingRing->Write(&ubo, sizeof(Ubo), UBO_ALIGNMENT);
 
+						// each frame binds the same resources every time around, so after the first lap this writes nothing
 						con::vector<mem::sptr<gpu::ResourceGroup>>& resource_group = resourceGroups[frameCounter];
-						gpu::Result assignment_result = resource_group[0]->ApplyResourceAssignments({ 
+						resourceGroupCache->BeginFrame();
+						resource_group[0] = resourceGroupCache->Acquire(resourceLayouts[0], { 
 							{
 								{1, {{statueImageResourceView, statueSamplerResource, gpu::ImageResourceUsage::Shader}}}
 							},
 							{
-								{0, {{uboBuffers[frameCounter], 0, uboBuffers[frameCounter]->GetSize()}}}
+								{0, {{ubo_allocation.buffer, ubo_allocation.offset, ubo_allocation.size}}}
 							},
 						{} });
+						NP_ENGINE_ASSERT(renderedFrameCount < frameCount || resourceGroupCache->GetStats().updateCount == 0,
+										 "ResourceGroupCache must not write groups after the first lap of frames");
 
-						mem::sptr<srvc::Services> services = detailInstance->GetServices();
 						mem::sptr<gpu::Frame> frame = frameContext->GetAcquiredFrame();
 
 						gpu::ClearColor clear_color{};
 						gpu::ClearColor depth_stencil_clear_color{ gpu::Color{}, 1, 0 };
 
-						mem::sptr<gpu::BeginRenderPassCommand> begin_renderpass_cmd =
-							gpu::Command::Create(gpu::DetailType::Vulkan, services, gpu::CommandType::BeginRenderPass);
-						begin_renderpass_cmd->framebuffer = framebuffers[frameContext->GetAcquiredFrameIndex()];
-						begin_renderpass_cmd->renderArea = {
-							{/*no offset*/}, frameContext->GetFrameWidth(), frameContext->GetFrameHeight() };
-						begin_renderpass_cmd->clearColors = { clear_color, depth_stencil_clear_color };
-
-						mem::sptr<gpu::BindPipelineCommand> bind_pipeline_cmd =
-							gpu::Command::Create(gpu::DetailType::Vulkan, services, gpu::CommandType::BindPipeline);
-						bind_pipeline_cmd->pipeline = graphicsPipeline;
-						bind_pipeline_cmd->usage = gpu::PipelineUsage::Graphics;
-
-						mem::sptr<gpu::SetViewportsCommand> set_viewports_cmd =
-							gpu::Command::Create(gpu::DetailType::Vulkan, services, gpu::CommandType::SetViewports);
-						set_viewports_cmd->viewports = { {{}, (dbl)frameContext->GetFrameWidth(), (dbl)frameContext->GetFrameHeight(), {0, 1}} };
-
-						mem::sptr<gpu::SetScissorsCommand> set_scissors_cmd =
-							gpu::Command::Create(gpu::DetailType::Vulkan, services, gpu::CommandType::SetScissors);
-						set_scissors_cmd->scissors = { {{}, frameContext->GetFrameWidth(), frameContext->GetFrameHeight()} };
-
-						mem::sptr<gpu::BindVertexBuffersCommand> bind_vertex_buffers_cmd =
-							gpu::Command::Create(gpu::DetailType::Vulkan, services, gpu::CommandType::BindVertexBuffers);
-						bind_vertex_buffers_cmd->contexts = { {vertexBuffer, 0} };
-
-						mem::sptr<gpu::BindIndexBufferCommand> bind_index_buffer_cmd =
-							gpu::Command::Create(gpu::DetailType::Vulkan, services, gpu::CommandType::BindIndexBuffer);
-						bind_index_buffer_cmd->buffer = indexBuffer;
-						bind_index_buffer_cmd->stride = sizeof(ui16);
-
-						mem::sptr<gpu::BindResourceGroupsCommand> bind_resource_groups_cmd =
-							gpu::Command::Create(gpu::DetailType::Vulkan, services, gpu::CommandType::BindResourceGroups);
-						bind_resource_groups_cmd->pipeline = graphicsPipeline;
-						bind_resource_groups_cmd->resourceGroups = { resourceGroups[frameCounter] };
-
-						mem::sptr<gpu::DrawIndexedCommand> draw_indexed_cmd =
-							gpu::Command::Create(gpu::DetailType::Vulkan, services, gpu::CommandType::DrawIndexed);
-						draw_indexed_cmd->indexCount = indices.size();
+						const siz frame_width = frameContext->GetFrameWidth();
+						const siz frame_height = frameContext->GetFrameHeight();
+						const gpu::ClearColor clear_colors[] = {clear_color, depth_stencil_clear_color};
+						const gpu::Viewport viewport{{}, (dbl)frame_width, (dbl)frame_height, {0, 1}};
+						const gpu::Scissor scissor{{}, frame_width, frame_height};
+						gpu::BufferResource* const vertex_buffers[] = {mem::address_of(*vertexBuffer)};
+						const siz vertex_buffer_offsets[] = {0};
+
+						resourceGroupPointers.clear();
+						for (mem::sptr<gpu::ResourceGroup>& group : resource_group)
+							resourceGroupPointers.emplace_back(mem::address_of(*group));
+
+						// split the triangles into a batch per recorder participant, each recorded into its own secondary
+						const siz triangle_count = indices.size() / 3;
+						const siz batch_count = ::std::max(::std::min(secondaryRecorder->GetParticipantCount(), triangle_count), (siz)1);
+						batchStreams.resize(batch_count);
+						for (siz i = 0; i < batch_count; i++)
+						{
+							const siz triangle_begin = triangle_count * i / batch_count;
+							const siz triangle_end = triangle_count * (i + 1) / batch_count;
+
+							gpu::CommandStream& batch = batchStreams[i];
+							batch.Clear();
+							batch.BindPipeline(mem::address_of(*graphicsPipeline), gpu::PipelineUsage::Graphics);
+							batch.SetViewports(&viewport, 1);
+							batch.SetScissors(&scissor, 1);
+							batch.BindVertexBuffers(vertex_buffers, vertex_buffer_offsets, 1);
+							batch.BindIndexBuffer(mem::address_of(*indexBuffer), 0, sizeof(ui16));
+							batch.BindResourceGroups(mem::address_of(*graphicsPipeline), 0, resourceGroupPointers.data(),
+													 resourceGroupPointers.size());
+							batch.DrawIndexed((triangle_end - triangle_begin) * 3, triangle_begin * 3);
+						}
 
-						mem::sptr<gpu::EndRenderPassCommand> end_renderpass_cmd =
-							gpu::Command::Create(gpu::DetailType::Vulkan, services, gpu::CommandType::EndRenderPass);
-						end_renderpass_cmd->framebuffer = begin_renderpass_cmd->framebuffer;
+						mem::sptr<gpu::Framebuffer> framebuffer = framebuffers[frameContext->GetAcquiredFrameIndex()];
+						commandStream.Clear();
+						commandStream.BeginRenderPass(mem::address_of(*framebuffer), {{/*no offset*/}, frame_width, frame_height},
+													  clear_colors, 2, gpu::SubpassUsage::HasSecondary);
+						secondaryRecorder->Record(commandStream, framebuffer, 0, batchStreams);
+						commandStream.EndRenderPass();
 
 						mem::sptr<gpu::CommandBuffer> command_buffer = commandBuffers[frameCounter];
 						mem::sptr<gpu::Semaphore> submit_complete_semaphore = submitCompleteSemaphores[frameCounter];
 
 						commandBufferPool->Reset(command_buffer, gpu::CommandBufferUsage::None);
 						commandBufferPool->Begin(command_buffer, gpu::CommandBufferUsage::SingleUse);
-						command_buffer->Add(begin_renderpass_cmd);
-						command_buffer->Add(bind_pipeline_cmd);
-						command_buffer->Add(set_viewports_cmd);
-						command_buffer->Add(set_scissors_cmd);
-						command_buffer->Add(bind_vertex_buffers_cmd);
-						command_buffer->Add(bind_index_buffer_cmd);
-						command_buffer->Add(bind_resource_groups_cmd);
-						command_buffer->Add(draw_indexed_cmd);
-						command_buffer->Add(end_renderpass_cmd);
+						command_buffer->Record(commandStream);
 						commandBufferPool->End(command_buffer, gpu::CommandBufferUsage::None);
 
 						gpu::Submit submit{};
@@ -430,6 +463,8 @@ namespace np::app
 						submit.waitStageSemaphores = { {gpu::Stage::PresentComplete, frame_ready_semaphore} };
 						submit.signalSemaphores = { submit_complete_semaphore };
 						bl submit_success = queue->Submit({ submit }, submit_complete_fence);
+						secondaryRecorder->EndFrame(submit_complete_fence);
+						uboStagingRing->EndFrame(submit_complete_fence);
 
 						gpu::Present present{};
 						present.frameContexts = { frameContext };
@@ -441,16 +476,22 @@ namespace np::app
 							should_rebuild_frames |= present_results.individualResults[i].ContainsAny(gpu::Result::OutOfDate | gpu::Result::Suboptimal);
 
 						frameCounter = (frameCounter + 1) % frameCount;
+						renderedFrameCount++;
 
 						if (should_rebuild_frames)
 							RebuildFrames();
 					}
 
+					// Save skips the write when no pipelines were added since the last one
+					if (tim::steady_clock::now() - pipelineCacheSaveTimestamp > tim::seconds(30))
+						SavePipelineCache();
+
 					isRendering.store(false, mo_release);
 				}
 			}
 		};
 
+	private:
 		WindowLayer& _window_layer;
 		mem::sptr<uid::UidHandle> _window_id_handle;
 		mem::sptr<win::Window> _window;
@@ -471,6 +512,9 @@ namespace np::app
 		mem::sptr<net::Socket> _http_socket;
 		mem::sptr<net::Socket> _udp_server;
 		mem::sptr<net::Socket> _udp_client;
+		mem::sptr<net::Connection> _channel_server;
+		mem::sptr<net::Connection> _channel_client;
+		mem::sptr<net::MetricsEndpoint> _metrics_endpoint;
 
 		tim::steady_timestamp _clients_send_msg_timestamp;
 
@@ -479,6 +523,11 @@ namespace np::app
 			NP_ENGINE_LOG_INFO("key code callback");
 		}
 
+		static void LogResolvedHost(void*, const net::Host& host, bl found)
+		{
+			NP_ENGINE_LOG_INFO("resolved " + host.name + (found ? " (found)" : " (not found)"));
+		}
+
 		static void LogSubmitMouseState(void*, const nput::MouseCodeState&)
 		{
 			NP_ENGINE_LOG_INFO("mouse code callback");
@@ -653,42 +702,19 @@ namespace np::app
 			mem::sptr<gpu::Resource> resource = payload->scene->GetResource(model_id);
 		}*/
 
-		static void CreateSceneCallback(mem::delegate& d)
+	public:
+		/*
+			builds the scene that renders the given window on the given instance's detail type
+			the null type runs this same scene without a gpu, so benchmarks can time our render path anywhere
+		*/
+		static mem::sptr<Scene> CreateScene(mem::sptr<srvc::Services> services, mem::sptr<win::Window> window,
+											mem::sptr<gpu::DetailInstance> detail_instance)
 		{
-			GameLayer& self = *((GameLayer*)d.GetPayload());
-
-			self._window->SetTitle("My Game Window >:D");
-
-			void* input_queue = mem::address_of(self._services->GetInputQueue());
-			self._window->SetKeyCallback(input_queue, nput::InputListener::SubmitKeyState);
-			self._window->SetMouseCallback(input_queue, nput::InputListener::SubmitMouseState);
-			self._window->SetMousePositionCallback(input_queue, nput::InputListener::SubmitMousePosition);
-			self._window->SetControllerCallback(input_queue, nput::InputListener::SubmitControllerState);
-			//*
-			//self._window->SetFramebufferSizeCallback(mem::address_of(self), RenderOnFramebufferSize);
-			self._window->SetSizeCallback(mem::address_of(self), RenderOnSize);
-			//*/
-			/*
-			self._window->SetPreventCloseCallback(mem::address_of(self), PreventWindowClose);
-			//*/
-			/*
-			self._window->SetKeyCallback(mem::address_of(self), LogSubmitKeyState);
-			self._window->SetMouseCallback(mem::address_of(self), LogSubmitMouseState);
-			//self._window->SetMousePositionCallback(mem::address_of(self), LogSubmitMousePosition);
-			self._window->SetControllerCallback(mem::address_of(self), LogSubmitControllerState);
-			//self._window->SetFocusCallback(mem::address_of(self), LogFocus);
-			//self._window->SetFramebufferSizeCallback(mem::address_of(self), LogFramebufferSize);
-			self._window->SetMaximizeCallback(mem::address_of(self), LogMaximize);
-			self._window->SetMinimizeCallback(mem::address_of(self), LogMinimize);
-			//self._window->SetPositionCallback(mem::address_of(self), LogPosition);
-			//self._window->SetSizeCallback(mem::address_of(self), LogSize);
-			//*/
-
-			mem::sptr<srvc::Services> services = self._services;
+			const gpu::DetailType detail_type = detail_instance->GetDetailType();
 			mem::sptr<Scene> scene = mem::create_sptr<Scene>(services->GetAllocator());
 
-			scene->detailInstance = gpu::DetailInstance::Create(gpu::DetailType::Vulkan, self._services);
-			scene->presentTarget = gpu::PresentTarget::Create(scene->detailInstance, self._window);
+			scene->detailInstance = detail_instance;
+			scene->presentTarget = gpu::PresentTarget::Create(scene->detailInstance, window);
 			scene->device = gpu::Device::Create(scene->detailInstance, gpu::DeviceUsage::Graphics | gpu::DeviceUsage::Present,
 												scene->presentTarget);
 
@@ -699,12 +725,22 @@ namespace np::app
 					break;
 				}
 
+			scene->pipelineCacheFilename = fsys::append("Vulkan", "pipeline-cache.bin");
+			scene->pipelineCache = scene->device->GetPipelineCache();
+			scene->pipelineCache->Absorb(
+				scene->device->CreatePipelineCache(gpu::PipelineCache::Load(scene->pipelineCacheFilename)));
+
 			scene->frameContext = gpu::FrameContext::Create(scene->device, {scene->queue->GetDeviceQueueFamily()});
 
-			scene->vertexShader = gpu::Shader::Create(scene->device, gpu::Stage::Vertex,
-													  fsys::append("Vulkan", "shaders", "vertex.glsl"), "main");
-			scene->fragmentShader = gpu::Shader::Create(scene->device, gpu::Stage::Fragment,
-														fsys::append("Vulkan", "shaders", "fragment.glsl"), "main");
+			const con::vector<gpu::ShaderSource> shader_sources{
+				{gpu::Stage::Vertex, fsys::append("Vulkan", "shaders", "vertex.glsl")},
+				{gpu::Stage::Fragment, fsys::append("Vulkan", "shaders", "fragment.glsl")}};
+			gpu::Shader::Prepare(detail_type, shader_sources, mem::address_of(services->GetJobSystem()));
+
+			scene->vertexShader =
+				gpu::Shader::Create(scene->device, shader_sources[0].stage, shader_sources[0].filename, "main");
+			scene->fragmentShader =
+				gpu::Shader::Create(scene->device, shader_sources[1].stage, shader_sources[1].filename, "main");
 
 			//this is where we would consolodate our descriptions
 
@@ -820,12 +856,16 @@ namespace np::app
 				{}};
 			gpu::DynamicUsage graphics_dynamic_usage = gpu::DynamicUsage::Scissor | gpu::DynamicUsage::Viewport;
 
+			const tim::steady_timestamp pipeline_start = tim::steady_clock::now();
 			scene->graphicsPipeline = gpu::GraphicsPipeline::Create(
 				scene->renderpass, graphics_pipeline_usage, graphics_pipeline_layout, graphics_shaders, input_vertex_formatting,
 				input_instance_formatting, graphics_topology, 0, graphics_viewports, graphics_scissors, graphics_rasterization,
-				graphics_multisample, graphics_depth_stencil, graphics_blend, graphics_dynamic_usage, nullptr);
+				graphics_multisample, graphics_depth_stencil, graphics_blend, graphics_dynamic_usage, scene->pipelineCache);
+			NP_ENGINE_LOG_INFO("graphics pipeline created in " +
+							   to_str(tim::milliseconds_dbl(tim::steady_clock::now() - pipeline_start).count()) + "ms");
 
 			scene->commandBufferPool = scene->queue->CreateCommandBufferPool(gpu::CommandBufferPoolUsage::Resettable);
+			scene->jobSystem = mem::address_of(services->GetJobSystem());
 			
 			scene->EnsureFrames();
 
@@ -883,12 +923,12 @@ namespace np::app
 			staging_index_buffer->SetBytes(0, index_buffer_bytes);
 			staging_index_buffer->ClearCacheForDevice(0, index_buffer_bytes.size());
 
-			mem::sptr<gpu::CopyBufferCommand> copy_vertex_buffer_cmd = gpu::Command::Create(gpu::DetailType::Vulkan, services, gpu::CommandType::CopyBuffer);
+			mem::sptr<gpu::CopyBufferCommand> copy_vertex_buffer_cmd = gpu::Command::Create(detail_type, services, gpu::CommandType::CopyBuffer);
 			copy_vertex_buffer_cmd->dst = scene->vertexBuffer;
 			copy_vertex_buffer_cmd->src = staging_vertex_buffer;
 			copy_vertex_buffer_cmd->ranges = { {0, 0, vertex_buffer_bytes.size()} };
 
-			mem::sptr<gpu::CopyBufferCommand> copy_index_buffer_cmd = gpu::Command::Create(gpu::DetailType::Vulkan, services, gpu::CommandType::CopyBuffer);
+			mem::sptr<gpu::CopyBufferCommand> copy_index_buffer_cmd = gpu::Command::Create(detail_type, services, gpu::CommandType::CopyBuffer);
 			copy_index_buffer_cmd->dst = scene->indexBuffer;
 			copy_index_buffer_cmd->src = staging_index_buffer;
 			copy_index_buffer_cmd->ranges = { {0, 0, index_buffer_bytes.size()} };
@@ -907,7 +947,43 @@ namespace np::app
 			scene->queue->Submit({ submit }, fence);
 			fence->Wait();
 
-			self._scene = scene;
+			return scene;
+		}
+
+	private:
+		static void CreateSceneCallback(mem::delegate& d)
+		{
+			GameLayer& self = *((GameLayer*)d.GetPayload());
+
+			self._window->SetTitle("My Game Window >:D");
+
+			void* input_queue = mem::address_of(self._services->GetInputQueue());
+			self._window->SetKeyCallback(input_queue, nput::InputListener::SubmitKeyState);
+			self._window->SetMouseCallback(input_queue, nput::InputListener::SubmitMouseState);
+			self._window->SetMousePositionCallback(input_queue, nput::InputListener::SubmitMousePosition);
+			self._window->SetControllerCallback(input_queue, nput::InputListener::SubmitControllerState);
+			//*
+			//self._window->SetFramebufferSizeCallback(mem::address_of(self), RenderOnFramebufferSize);
+			self._window->SetSizeCallback(mem::address_of(self), RenderOnSize);
+			//*/
+			/*
+			self._window->SetPreventCloseCallback(mem::address_of(self), PreventWindowClose);
+			//*/
+			/*
+			self._window->SetKeyCallback(mem::address_of(self), LogSubmitKeyState);
+			self._window->SetMouseCallback(mem::address_of(self), LogSubmitMouseState);
+			//self._window->SetMousePositionCallback(mem::address_of(self), LogSubmitMousePosition);
+			self._window->SetControllerCallback(mem::address_of(self), LogSubmitControllerState);
+			//self._window->SetFocusCallback(mem::address_of(self), LogFocus);
+			//self._window->SetFramebufferSizeCallback(mem::address_of(self), LogFramebufferSize);
+			self._window->SetMaximizeCallback(mem::address_of(self), LogMaximize);
+			self._window->SetMinimizeCallback(mem::address_of(self), LogMinimize);
+			//self._window->SetPositionCallback(mem::address_of(self), LogPosition);
+			//self._window->SetSizeCallback(mem::address_of(self), LogSize);
+			//*/
+
+			self._scene = CreateScene(self._services, self._window,
+									  gpu::DetailInstance::Create(gpu::DetailType::Vulkan, self._services));
 		}
 
 		void SubmitCreateSceneJob()
@@ -919,7 +995,6 @@ namespace np::app
 			_services->GetJobSystem().SubmitJob(jsys::JobPriority::Higher, create_scene_job);
 		}
 
-		nput::KeyCodeStates _prev_keys;
 		nput::MouseCodeStates _prev_mouse;
 		nput::MousePosition _prev_mouse_position;
 
@@ -1033,7 +1108,7 @@ namespace np::app
 			if (keys[Key::P].IsActive())
 				_camera.projectionType = gpu::ProjectionType::Perspective;
 
-			if (keys[Key::C].IsActive() && !_prev_keys[Key::C].IsActive())
+			if (input.WasActivated(Key::C))
 			{
 				_camera._contains = false;
 				//(*_scene.get_access())->UnregisterVisible(_services->GetUidSystem().GetUid(_model_handle));
@@ -1041,7 +1116,7 @@ namespace np::app
 				//(*_scene.get_access())->UnregisterResource(_services->GetUidSystem().GetUid(_model_handle));
 			}
 
-			if (keys[Key::V].IsActive() && !_prev_keys[Key::V].IsActive())
+			if (input.WasActivated(Key::V))
 			{
 				_camera._contains = true;
 				// uid::Uid model_id = _services->GetUidSystem().GetUid(_model_handle);
@@ -1106,9 +1181,6 @@ namespace np::app
 				_mouse_is_dragging = false;
 			}
 
-			for (siz i = 0; i < keys.size(); i++)
-				_prev_keys[i] = keys[i];
-
 			for (siz i = 0; i < mouse.size(); i++)
 				_prev_mouse[i] = mouse[i];
 
@@ -1213,6 +1285,15 @@ namespace np::app
 
 			//-----------------------------------------------------------
 
+			/*
+			// curl http://127.0.0.1:9464/metrics
+			_metrics_endpoint = net::MetricsEndpoint::Create(_network_context);
+			_metrics_endpoint->Start();
+			nsit::metrics::start_snapshots(fsys::append(fsys::get_current_path(), "NP-Engine-Metrics.prom"));
+			//*/
+
+			//-----------------------------------------------------------
+
 			/*
 			_udp_server = net::Socket::Create(_network_context);
 			_udp_server->Open(net::Protocol::Udp);
@@ -1227,6 +1308,35 @@ namespace np::app
 
 			//-----------------------------------------------------------
 
+			/*
+			{
+				con::vector<net::ChannelType> channels{net::ChannelType::Unreliable, net::ChannelType::ReliableUnordered,
+													   net::ChannelType::ReliableOrdered};
+
+				mem::sptr<net::Socket> server = net::Socket::Create(_network_context);
+				server->Open(net::Protocol::Udp);
+				server->BindTo(net::Ipv4{127, 0, 0, 1}, 56555);
+				server->ConnectTo(net::Ipv4{127, 0, 0, 1}, 56556);
+
+				mem::sptr<net::Socket> client = net::Socket::Create(_network_context);
+				client->Open(net::Protocol::Udp);
+				client->BindTo(net::Ipv4{127, 0, 0, 1}, 56556);
+				client->ConnectTo(net::Ipv4{127, 0, 0, 1}, 56555);
+
+				_channel_server = mem::create_sptr<net::Connection>(_services->GetAllocator(), server, channels);
+				_channel_client = mem::create_sptr<net::Connection>(_services->GetAllocator(), client, channels);
+
+				// simulate a bad network on loopback
+				net::ChannelConditions conditions;
+				conditions.lossChance = 0.1;
+				conditions.reorderChance = 0.1;
+				_channel_server->SetConditions(conditions);
+				_channel_client->SetConditions(conditions);
+			}
+			//*/
+
+			//-----------------------------------------------------------
+
 			/*
 			mem::sptr<net::Resolver> resv = net::Resolver::Create(_network_context);
 
@@ -1245,6 +1355,21 @@ namespace np::app
 
 			//-----------------------------------------------------------
 
+			/*
+			{
+				// hosts file entries resolve offline and never expire
+				_network_context->GetResolverCache().LoadHostsFile("/etc/hosts");
+
+				// concurrent requests for the same name are coalesced into one lookup
+				mem::sptr<net::Resolver> async_resv = net::Resolver::Create(_network_context);
+				async_resv->GetHostAsync("localhost", LogResolvedHost, this);
+				async_resv->GetHostAsync("example.com", LogResolvedHost, this);
+				async_resv->GetHostAsync("example.com", LogResolvedHost, this);
+			}
+			//*/
+
+			//-----------------------------------------------------------
+
 			//SubmitClientConnectToTcpServerJob();
 		}
 
@@ -1254,6 +1379,10 @@ namespace np::app
 			//_udp_server->Close();
 			//_http_socket->Close();
 
+			if (_metrics_endpoint)
+				_metrics_endpoint->Stop();
+			nsit::metrics::stop_snapshots();
+
 			net::Terminate(net::DetailType::Native);
 		}
 
@@ -1336,6 +1465,34 @@ namespace np::app
 				}
 			}
 			if (false)
+			{
+				tim::steady_timestamp now = tim::steady_clock::now();
+				if (now - _clients_send_msg_timestamp > tim::milliseconds(1000))
+				{
+					_clients_send_msg_timestamp = now;
+					net::Message msg;
+					msg.header.type = net::MessageType::Blob;
+					msg.header.bodySize = NP_ENGINE_NETWORK_CHANNEL_FRAGMENT_SIZE * 8 + 7;
+					msg.body = mem::create_sptr<net::BlobMessageBody>(_services->GetAllocator());
+					msg.body->SetSize(msg.header.bodySize);
+					_channel_client->Send(2, msg);
+				}
+
+				_channel_client->Update();
+				_channel_server->Update();
+
+				net::MessageQueue& inbox = _channel_server->GetInbox(2);
+				inbox.ToggleState();
+				for (net::Message msg = inbox.Pop(); msg; msg = inbox.Pop())
+				{
+					net::ConnectionStats stats = _channel_client->GetStats();
+					NP_ENGINE_LOG_INFO("Channel server received " + to_str(msg.header.bodySize) +
+									   " bytes, rtt: " + to_str(stats.roundTrip.count()) +
+									   "ms, resent: " + to_str(stats.resentPackets) +
+									   ", dropped: " + to_str(stats.droppedPackets));
+				}
+			}
+			if (false)
 			{
 				net::MessageQueue& inbox = _http_socket->GetInbox();
 				inbox.ToggleState();
@@ -1404,12 +1561,12 @@ namespace np::app
 		GameLayer _game_layer;
 		atm_bl _keep_running;
 
-		static void AppLoopCallback(mem::delegate& d)
+		static void AppLoopCallback(jsys::ServiceThread& service)
 		{
 			NP_ENGINE_PROFILE_FUNCTION();
 			NP_ENGINE_LOG_INFO("App Loop Start");
 
-			GameApp& self = *((GameApp*)d.GetPayload());
+			GameApp& self = *((GameApp*)service.GetPayload());
 			evnt::EventQueue& event_queue = self._services->GetEventQueue();
 			nput::InputQueue& input_queue = self._services->GetInputQueue();
 
@@ -1421,7 +1578,7 @@ namespace np::app
 			mem::sptr<evnt::Event> e = nullptr;
 			con::vector<Layer*>::iterator it{};
 
-			while (self._keep_running.load(mo_acquire))
+			while (self._keep_running.load(mo_acquire) && service.KeepRunning())
 			{
 				NP_ENGINE_PROFILE_SCOPE("app loop");
 
@@ -1456,17 +1613,20 @@ namespace np::app
 			NP_ENGINE_LOG_INFO("App Loop End");
 		}
 
-		static void RenderCallback(mem::delegate& d)
+		static void RenderCallback(jsys::ServiceThread& service)
 		{
 			NP_ENGINE_PROFILE_FUNCTION();
-			NP_ENGINE_LOG_INFO("Rendering Job Start");
+			NP_ENGINE_LOG_INFO("Rendering Service Start");
 
-			GameApp& self = *((GameApp*)d.GetPayload());
+			GameApp& self = *((GameApp*)service.GetPayload());
 			thr::thread_duration_sleeper sleeper{ self.GetPlatformDefaultApplicationLoopDuration() };
+			nsit::metric_histogram& frame_histogram = nsit::metrics::get_histogram("np_app_frame_ns", "time spent rendering a frame");
 
-			while (self._keep_running.load(mo_acquire))
+			while (self._keep_running.load(mo_acquire) && service.KeepRunning())
 			{
+				tim::steady_timestamp frame_start = tim::steady_clock::now();
 				self._game_layer.Render();
+				frame_histogram.record(tim::steady_clock::now() - frame_start);
 
 				//TODO: if our window is maximized or full screen, we can render like crazy
 
@@ -1476,51 +1636,28 @@ namespace np::app
 					sleeper.sleep();
 			}
 
-			NP_ENGINE_LOG_INFO("Rendering Job End");
+			NP_ENGINE_LOG_INFO("Rendering Service End");
 		}
 
 		void CustomizeJobSystem()
 		{
 			const ui32 core_count = thr::thread::hardware_concurrency();
 			NP_ENGINE_ASSERT(core_count >= 4, "NP Engine Test requires at least four cores");
-			const siz worker_count = ::std::max(core_count, 8u);
+			const siz worker_count = ::std::max(core_count, 8u) - 2;
 
 			/*
 				Thread-to-Core Layout:
-					- core 0: main thread (polling loop) and worker 0 (app loop)
+					- core 0: main thread (polling loop) and the app loop service thread
 						- I'm fine with core crowding here since the polling loop should not be intensive enough to consistently throttle app loop
 						- TODO: ^ investigate
-					- core 1: worker 1 (rendering)
-					- core 2+: worker 2+ for normal job executing
+					- core 1: the render service thread
+					- core 2+: job workers for normal job executing, which the job system keeps off the service cores
 			*/
 
 			jsys::JobSystem& job_system = _services->GetJobSystem();
-			job_system.SetIsOffsettingWorkerThreadAffinity(false);
 			job_system.SetJobWorkerCount(worker_count);
-
-			con::vector<jsys::JobWorker>& job_workers = job_system.GetJobWorkers();
-			jsys::JobWorker& app_loop_worker = job_workers[0];
-			jsys::JobWorker& render_worker = job_workers[1];
-
-			app_loop_worker.ClearCoworkers();
-			render_worker.ClearCoworkers();
-			for (auto it = job_workers.begin(); it != job_workers.end(); it++)
-			{
-				it->RemoveCoworker(app_loop_worker);
-				it->RemoveCoworker(render_worker);
-			}
-
-			mem::sptr<jsys::Job> app_loop_job = job_system.CreateJob();
-			app_loop_job->SetCanBeStolen(false);
-			app_loop_job->SetPayload(this);
-			app_loop_job->SetCallback(AppLoopCallback);
-			app_loop_worker.SubmitImmediateJob(app_loop_job);
-
-			mem::sptr<jsys::Job> render_job = job_system.CreateJob();
-			render_job->SetCanBeStolen(false);
-			render_job->SetPayload(this);
-			render_job->SetCallback(RenderCallback);
-			render_worker.SubmitImmediateJob(render_job);
+			job_system.CreateServiceThread("app loop", 0, AppLoopCallback, this);
+			job_system.CreateServiceThread("render", 1, RenderCallback, this);
 		}
 
 		void PollingLoop()
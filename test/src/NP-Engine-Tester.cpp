@@ -6,12 +6,1052 @@
 
 #include <exception>
 
+#include <NP-Engine/GPU/Detail/Null/NullDevice.hpp>
+#include <NP-Engine/Window/Detail/Headless/HeadlessWindow.hpp>
+
 #include "NP-Engine-Tester.hpp"
 
 // TODO: I think our test app should change working dir
 // TODO: I think our test app should contain all assets, including shaders
 // TODO: move as much as we can into test proj
 
+/*
+	checks that blocks a request fits exactly are found, even when no bin boundary lines up with the request -- in an empty
+	allocator and in a fragmented one
+*/
+void CheckTlsfOffsetAllocator()
+{
+	using namespace ::np;
+	using allocation = mem::tlsf_offset_allocator::allocation;
+	constexpr siz size = 1000003;
+	constexpr siz block_size = 3000; // a multiple of 8 that is not on a bin boundary
+	constexpr siz block_count = 32;
+
+	mem::tlsf_offset_allocator allocator(size);
+	allocation whole = allocator.allocate(size);
+	NP_ENGINE_ASSERT(whole.is_valid() && whole.offset == 0 && whole.size == size, "an empty allocator must fit its size");
+	NP_ENGINE_ASSERT(!allocator.allocate(1).is_valid(), "a full allocator must fit nothing");
+	allocator.deallocate(whole);
+
+	whole = allocator.allocate(size, 256);
+	NP_ENGINE_ASSERT(whole.is_valid() && whole.offset == 0, "offset 0 is already aligned, so the whole size must fit");
+	allocator.deallocate(whole);
+
+	con::vector<allocation> blocks(block_count);
+	for (allocation& block : blocks)
+		block = allocator.allocate(block_size);
+	allocation rest = allocator.allocate(size - block_count * block_size);
+	NP_ENGINE_ASSERT(rest.is_valid() && allocator.get_free_size() == 0, "the rest must fit exactly");
+
+	for (siz i = 0; i < block_count; i += 2)
+		allocator.deallocate(blocks[i]);
+
+	for (siz i = 0; i < block_count; i += 2)
+	{
+		// every hole is block_size at a multiple of block_size, so an 8 aligned block_size fits only exactly
+		blocks[i] = allocator.allocate(block_size, 8);
+		NP_ENGINE_ASSERT(blocks[i].is_valid() && blocks[i].offset % block_size == 0,
+						 "a fragmented allocator must fit its holes exactly");
+	}
+	NP_ENGINE_ASSERT(allocator.get_free_size() == 0, "every hole must be filled");
+
+	for (allocation& block : blocks)
+		allocator.deallocate(block);
+	allocator.deallocate(rest);
+
+	const mem::tlsf_offset_allocator::stats stats = allocator.get_stats();
+	NP_ENGINE_ASSERT(stats.free_block_count == 1 && stats.largest_free_size == size, "freed blocks must merge back");
+}
+
+/*
+	a network context without a backend, so resolvers made from it only look up what a check gives them
+*/
+class ResolverCheckContext : public ::np::net::Context
+{
+public:
+	ResolverCheckContext(::np::mem::sptr<::np::srvc::Services> services): ::np::net::Context(services) {}
+};
+
+/*
+	counts its lookups, each taking lookup_delay so concurrent requests overlap -- only "found.test" is found
+*/
+class CountingResolver : public ::np::net::Resolver
+{
+protected:
+	::np::atm_siz& _lookup_count;
+	::np::tim::milliseconds _lookup_delay;
+
+	::np::net::Host DetailGetHost(::np::str name) override
+	{
+		using namespace ::np;
+
+		_lookup_count.fetch_add(1, mo_release);
+		thr::this_thread::sleep_for(_lookup_delay);
+
+		net::Host host;
+		host.name = name;
+		if (name == "found.test")
+		{
+			net::Ipv4 ip;
+			ip = "10.0.0.1";
+			host.ipv4s.emplace(ip, 0);
+		}
+		return host;
+	}
+
+	::np::net::Host DetailGetHost(const ::np::net::Ip& ip) override
+	{
+		return {};
+	}
+
+	::np::mem::sptr<::np::net::Resolver> CreateJobResolver() override
+	{
+		return ::np::mem::create_sptr<CountingResolver>(_context->GetServices()->GetAllocator(), _context, _lookup_count,
+														 _lookup_delay);
+	}
+
+public:
+	CountingResolver(::np::mem::sptr<::np::net::Context> context, ::np::atm_siz& lookup_count,
+					 ::np::tim::milliseconds lookup_delay):
+		::np::net::Resolver(context),
+		_lookup_count(lookup_count),
+		_lookup_delay(lookup_delay)
+	{}
+};
+
+struct ResolverCheck
+{
+	::np::atm_siz lookupCount{0};
+	::np::atm_siz resolvedCount{0};
+	::np::atm_siz foundCount{0};
+};
+
+void ResolverCheckCallback(void* caller, const ::np::net::Host& host, ::np::bl found)
+{
+	ResolverCheck& check = *((ResolverCheck*)caller);
+	if (found)
+		check.foundCount.fetch_add(1, ::np::mo_release);
+	check.resolvedCount.fetch_add(1, ::np::mo_release);
+}
+
+/*
+	checks the resolver cache against a counting resolver with short ttls, without touching a hosts file or dns
+*/
+void CheckResolverCache()
+{
+	using namespace ::np;
+
+	const tim::milliseconds ttl(100);
+	const tim::milliseconds negative_ttl(50);
+	const tim::milliseconds lookup_delay(20);
+	const siz request_count = 4;
+
+	ResolverCheck check{};
+	mem::trait_allocator allocator;
+	mem::sptr<srvc::Services> services = mem::create_sptr<srvc::Services>(allocator);
+	mem::sptr<net::Context> context = mem::create_sptr<ResolverCheckContext>(allocator, services);
+	mem::sptr<net::Resolver> resolver = mem::create_sptr<CountingResolver>(allocator, context, check.lookupCount, lookup_delay);
+	net::ResolverCache& cache = context->GetResolverCache();
+	cache.SetTtl(ttl, negative_ttl);
+	services->GetJobSystem().Start();
+
+	net::Host permanent;
+	permanent.name = "permanent.test";
+	net::Ipv4 permanent_ip;
+	permanent_ip = "10.0.0.2";
+	permanent.ipv4s.emplace(permanent_ip, 0);
+	cache.AddHost(permanent);
+
+	net::Host host = resolver->GetHost("Permanent.Test");
+	NP_ENGINE_ASSERT(!host.ipv4s.empty() && check.lookupCount.load(mo_acquire) == 0,
+					 "hosts added to the cache resolve without a lookup, by any case");
+
+	for (siz i = 0; i < request_count; i++)
+		resolver->GetHostAsync("found.test", ResolverCheckCallback, mem::address_of(check));
+
+	while (check.resolvedCount.load(mo_acquire) < request_count)
+		thr::this_thread::yield();
+
+	NP_ENGINE_ASSERT(check.lookupCount.load(mo_acquire) == 1 && check.foundCount.load(mo_acquire) == request_count,
+					 "concurrent requests for one name must coalesce into one lookup");
+
+	host = resolver->GetHost("found.test");
+	NP_ENGINE_ASSERT(!host.ipv4s.empty() && check.lookupCount.load(mo_acquire) == 1,
+					 "a lookup within its ttl must be a cache hit");
+
+	thr::this_thread::sleep_for(ttl + lookup_delay);
+	host = resolver->GetHost("found.test");
+	NP_ENGINE_ASSERT(!host.ipv4s.empty() && check.lookupCount.load(mo_acquire) == 2, "an expired lookup must query again");
+
+	host = resolver->GetHost("missing.test");
+	bl found = true;
+	const bl hit = cache.Get("missing.test", host, found);
+	host = resolver->GetHost("missing.test");
+	NP_ENGINE_ASSERT(hit && !found && host.ipv4s.empty() && check.lookupCount.load(mo_acquire) == 3,
+					 "a failed lookup must be cached as not found until its negative ttl");
+
+	thr::this_thread::sleep_for(negative_ttl + lookup_delay);
+	resolver->GetHost("missing.test");
+	NP_ENGINE_ASSERT(check.lookupCount.load(mo_acquire) == 4, "an expired failed lookup must query again");
+
+	NP_ENGINE_LOG_INFO("resolver cache: " + to_str(request_count) + " coalesced requests, " +
+					   to_str(check.lookupCount.load(mo_acquire)) + " lookups");
+
+	services->GetJobSystem().Stop();
+}
+
+/*
+	a blob whose first bytes are its index, followed by bytes derived from that index -- sizes vary so some messages span
+	several fragments
+*/
+::np::net::Message CreateChannelCheckMessage(::np::mem::allocator& allocator, ::np::ui32 index)
+{
+	using namespace ::np;
+
+	net::Message msg;
+	msg.header.type = net::MessageType::Blob;
+	msg.header.bodySize = sizeof(ui32) + (index % 5) * NP_ENGINE_NETWORK_CHANNEL_FRAGMENT_SIZE + index % 97;
+	msg.body = mem::create_sptr<net::BlobMessageBody>(allocator);
+	msg.body->SetSize(msg.header.bodySize);
+
+	ui8* bytes = (ui8*)msg.body->GetData();
+	mem::copy_bytes(bytes, &index, sizeof(ui32));
+	for (siz i = sizeof(ui32); i < msg.header.bodySize; i++)
+		bytes[i] = (ui8)(index * 31 + i);
+
+	return msg;
+}
+
+/*
+	gets the index of a message made by CreateChannelCheckMessage, returns false if its size or bytes do not match it
+*/
+::np::bl ReadChannelCheckMessage(const ::np::net::Message& msg, ::np::ui32& index)
+{
+	using namespace ::np;
+
+	if (!msg.body || msg.header.bodySize < sizeof(ui32))
+		return false;
+
+	const ui8* bytes = (const ui8*)msg.body->GetData();
+	mem::copy_bytes(&index, bytes, sizeof(ui32));
+	bl matches = msg.header.bodySize == sizeof(ui32) + (index % 5) * NP_ENGINE_NETWORK_CHANNEL_FRAGMENT_SIZE + index % 97;
+	for (siz i = sizeof(ui32); matches && i < msg.header.bodySize; i++)
+		matches = bytes[i] == (ui8)(index * 31 + i);
+
+	return matches;
+}
+
+/*
+	sends message_count messages on every channel type over loopback with loss and reordering, then checks the reliable
+	channels deliver every message once with its bytes intact, and the ordered channel delivers them in order
+*/
+void CheckChannels(::np::siz message_count = 64)
+{
+	using namespace ::np;
+
+	const con::vector<net::ChannelType> channels{net::ChannelType::Unreliable, net::ChannelType::ReliableUnordered,
+												 net::ChannelType::ReliableOrdered};
+	const tim::milliseconds timeout(30000);
+
+	mem::trait_allocator allocator;
+	mem::sptr<srvc::Services> services = mem::create_sptr<srvc::Services>(allocator);
+	services->GetJobSystem().Start();
+	mem::sptr<net::Context> context = net::Context::Create(net::DetailType::Native, services);
+
+	mem::sptr<net::Socket> server_socket = net::Socket::Create(context);
+	server_socket->Open(net::Protocol::Udp);
+	server_socket->BindTo(net::Ipv4{127, 0, 0, 1}, 56565);
+	server_socket->ConnectTo(net::Ipv4{127, 0, 0, 1}, 56566);
+
+	mem::sptr<net::Socket> client_socket = net::Socket::Create(context);
+	client_socket->Open(net::Protocol::Udp);
+	client_socket->BindTo(net::Ipv4{127, 0, 0, 1}, 56566);
+	client_socket->ConnectTo(net::Ipv4{127, 0, 0, 1}, 56565);
+
+	mem::sptr<net::Connection> server = mem::create_sptr<net::Connection>(allocator, server_socket, channels);
+	mem::sptr<net::Connection> client = mem::create_sptr<net::Connection>(allocator, client_socket, channels);
+
+	net::ChannelConditions conditions;
+	conditions.lossChance = 0.1;
+	conditions.reorderChance = 0.1;
+	server->SetConditions(conditions);
+	client->SetConditions(conditions);
+
+	for (ui8 channel = 0; channel < channels.size(); channel++)
+		for (ui32 i = 0; i < message_count; i++)
+			client->Send(channel, CreateChannelCheckMessage(allocator, i));
+
+	con::vector<con::vector<ui32>> received(channels.size());
+	siz mismatch_count = 0;
+	const tim::steady_timestamp start = tim::steady_clock::now();
+	while ((received[1].size() < message_count || received[2].size() < message_count) &&
+		   tim::steady_clock::now() - start < timeout && !client->IsLost())
+	{
+		client->Update();
+		server->Update();
+
+		for (ui8 channel = 0; channel < channels.size(); channel++)
+		{
+			net::MessageQueue& inbox = server->GetInbox(channel);
+			inbox.ToggleState();
+			for (net::Message msg = inbox.Pop(); msg; msg = inbox.Pop())
+			{
+				ui32 index = 0;
+				if (!ReadChannelCheckMessage(msg, index))
+					mismatch_count++;
+				received[channel].emplace_back(index);
+			}
+		}
+
+		thr::this_thread::sleep_for(tim::milliseconds(1));
+	}
+	const dbl duration = tim::milliseconds(tim::steady_clock::now() - start).count();
+
+	bl in_order = received[2].size() == message_count;
+	for (siz i = 0; in_order && i < received[2].size(); i++)
+		in_order = received[2][i] == i;
+
+	con::vector<ui32> unordered = received[1];
+	::std::sort(unordered.begin(), unordered.end());
+	bl all_once = unordered.size() == message_count;
+	for (siz i = 0; all_once && i < unordered.size(); i++)
+		all_once = unordered[i] == i;
+
+	NP_ENGINE_ASSERT(mismatch_count == 0, "every delivered message must keep its size and bytes");
+	NP_ENGINE_ASSERT(all_once, "the reliable unordered channel must deliver every message once");
+	NP_ENGINE_ASSERT(in_order, "the reliable ordered channel must deliver every message once, in order");
+	NP_ENGINE_ASSERT(received[0].size() <= message_count, "the unreliable channel cannot deliver more than was sent");
+
+	const net::ConnectionStats stats = client->GetStats();
+	NP_ENGINE_LOG_INFO("channels " + to_str(message_count) + " messages per channel in " + to_str(duration) +
+					   "ms -- unreliable delivered: " + to_str(received[0].size()) + ", sent: " +
+					   to_str(stats.sentPackets) + ", dropped: " + to_str(stats.droppedPackets) + ", resent: " +
+					   to_str(stats.resentPackets) + ", rtt: " + to_str(stats.roundTrip.count()) + "ms");
+
+	server.reset();
+	client.reset();
+	server_socket->Close();
+	client_socket->Close();
+	services->GetJobSystem().Stop();
+}
+
+/*
+	checks that every batch isa returns the scalar noise values bit for bit, at random points and octave counts
+*/
+void CheckNoiseBatch(::np::siz sample_count = 4099) // odd, so every isa runs its tail
+{
+	using namespace ::np;
+
+	rng::Random32 random;
+	noiz::Simplex simplex;
+	noiz::Perlin perlin;
+	con::vector<flt> xs(sample_count), ys(sample_count), zs(sample_count), out(sample_count);
+	for (siz i = 0; i < sample_count; i++)
+	{
+		xs[i] = (flt)random.GetLemireWithinRange(1 << 20) / 1024.f - 512.f;
+		ys[i] = (flt)random.GetLemireWithinRange(1 << 20) / 1024.f - 512.f;
+		zs[i] = (flt)random.GetLemireWithinRange(1 << 20) / 1024.f - 512.f;
+	}
+
+	const noiz::NoiseBatchIsa supported = noiz::NoiseBatch::GetSupportedIsa();
+	for (ui32 isa = 0; isa <= (ui32)supported; isa++)
+	{
+		noiz::NoiseBatch::SetIsa((noiz::NoiseBatchIsa)isa);
+		const str name = noiz::NoiseBatch::GetIsaName(noiz::NoiseBatch::GetIsa());
+
+		for (ui8 octave_count : {1, 3, 8})
+		{
+			simplex.SetOctaveCount(octave_count);
+			perlin.SetOctaveCount(octave_count);
+			siz mismatch_count = 0;
+
+			simplex.CalculateNoiseValues(xs.data(), ys.data(), out.data(), sample_count);
+			for (siz i = 0; i < sample_count; i++)
+				mismatch_count += out[i] != simplex.CalculateNoiseValue(xs[i], ys[i]);
+
+			simplex.CalculateNoiseValues(xs.data(), ys.data(), zs.data(), out.data(), sample_count);
+			for (siz i = 0; i < sample_count; i++)
+				mismatch_count += out[i] != simplex.CalculateNoiseValue(xs[i], ys[i], zs[i]);
+
+			simplex.Fractal(xs.data(), ys.data(), out.data(), sample_count);
+			for (siz i = 0; i < sample_count; i++)
+				mismatch_count += out[i] != simplex.Fractal(xs[i], ys[i]);
+
+			simplex.Fractal(xs.data(), ys.data(), zs.data(), out.data(), sample_count);
+			for (siz i = 0; i < sample_count; i++)
+				mismatch_count += out[i] != simplex.Fractal(xs[i], ys[i], zs[i]);
+
+			perlin.CalculateNoiseValues(xs.data(), ys.data(), zs.data(), out.data(), sample_count);
+			for (siz i = 0; i < sample_count; i++)
+				mismatch_count += out[i] != perlin.CalculateNoiseValue(xs[i], ys[i], zs[i]);
+
+			perlin.Fractal(xs.data(), ys.data(), zs.data(), out.data(), sample_count);
+			for (siz i = 0; i < sample_count; i++)
+				mismatch_count += out[i] != perlin.Fractal(xs[i], ys[i], zs[i]);
+
+			NP_ENGINE_ASSERT(mismatch_count == 0,
+							 "noise batch " + name + " with " + to_str(octave_count) + " octaves differs from scalar at " +
+								 to_str(mismatch_count) + " points");
+		}
+	}
+
+	noiz::NoiseBatch::SetIsa(supported);
+}
+
+/*
+	logs ns/sample of the batch noise functions for every instruction set this machine supports
+*/
+void BenchmarkNoiseBatch(::np::siz sample_count = 1 << 20)
+{
+	using namespace ::np;
+
+	noiz::Simplex simplex;
+	noiz::Perlin perlin;
+	con::vector<flt> xs(sample_count), ys(sample_count), zs(sample_count), out(sample_count);
+	for (siz i = 0; i < sample_count; i++)
+	{
+		xs[i] = (flt)(i % 1024) * 0.37f;
+		ys[i] = (flt)(i / 1024) * 0.37f;
+		zs[i] = (flt)(i % 7) * 0.37f;
+	}
+
+	const noiz::NoiseBatchIsa supported = noiz::NoiseBatch::GetSupportedIsa();
+	for (ui32 isa = 0; isa <= (ui32)supported; isa++)
+	{
+		noiz::NoiseBatch::SetIsa((noiz::NoiseBatchIsa)isa);
+		const str name = noiz::NoiseBatch::GetIsaName(noiz::NoiseBatch::GetIsa());
+
+		for (ui8 octave_count : {1, 4, 8})
+		{
+			simplex.SetOctaveCount(octave_count);
+			perlin.SetOctaveCount(octave_count);
+
+			tim::steady_timestamp start = tim::steady_clock::now();
+			simplex.Fractal(xs.data(), ys.data(), out.data(), sample_count);
+			const dbl simplex_2d = tim::nanoseconds(tim::steady_clock::now() - start).count() / sample_count;
+
+			start = tim::steady_clock::now();
+			simplex.Fractal(xs.data(), ys.data(), zs.data(), out.data(), sample_count);
+			const dbl simplex_3d = tim::nanoseconds(tim::steady_clock::now() - start).count() / sample_count;
+
+			start = tim::steady_clock::now();
+			perlin.Fractal(xs.data(), ys.data(), zs.data(), out.data(), sample_count);
+			const dbl perlin_3d = tim::nanoseconds(tim::steady_clock::now() - start).count() / sample_count;
+
+			NP_ENGINE_LOG_INFO("noise batch " + name + ", " + to_str(octave_count) +
+							   " octaves, ns/sample -- simplex 2D: " + to_str(simplex_2d) + ", simplex 3D: " +
+							   to_str(simplex_3d) + ", perlin 3D: " + to_str(perlin_3d));
+		}
+	}
+
+	noiz::NoiseBatch::SetIsa(supported);
+}
+
+/*
+	logs ms per dms extraction of synthetic blob masks from 256x256 to 8192x8192, on this thread and on a job system
+*/
+void BenchmarkDmsImage()
+{
+	using namespace ::np;
+
+	jsys::JobSystem job_system;
+	job_system.Start();
+
+	for (ui32 size = 256; size <= 8192; size *= 2)
+	{
+		gpu::Image image(size, size);
+		gpu::Color color{};
+		for (ui32 y = 0; y < size; y++)
+		{
+			for (ui32 x = 0; x < size; x++)
+			{
+				// the same blobs, about 30 pixels across, tile every size
+				dbl value = ::std::sin(x * 0.07) * ::std::sin(y * 0.06) + 0.2 * ::std::sin((x + y) * 0.11);
+				color.r = color.g = color.b = color.a = value > 0.4 ? 0 : UI8_MAX;
+				image.Set(x, y, color);
+			}
+		}
+
+		alg::DmsImage dms_image(image);
+
+		tim::steady_timestamp start = tim::steady_clock::now();
+		alg::DmsImage::Extraction extraction = dms_image.GetExtraction(0.5, gpu::ColorChannel::Red);
+		const dbl serial = tim::milliseconds_dbl(tim::steady_clock::now() - start).count();
+
+		start = tim::steady_clock::now();
+		extraction = dms_image.GetExtraction(0.5, gpu::ColorChannel::Red, mem::address_of(job_system));
+		const dbl parallel = tim::milliseconds_dbl(tim::steady_clock::now() - start).count();
+
+		NP_ENGINE_LOG_INFO("dms image " + to_str(size) + "x" + to_str(size) + ", " + to_str(extraction.size()) +
+						   " shapes, ms -- serial: " + to_str(serial) + ", job system: " + to_str(parallel));
+	}
+
+	job_system.Stop();
+}
+
+/*
+	logs ms to prepare the tester's shaders with an empty shader cache (cold) and a full one (warm), on this thread and on
+	a job system
+*/
+void BenchmarkShaderCache()
+{
+	using namespace ::np;
+
+	const con::vector<gpu::ShaderSource> sources{{gpu::Stage::Vertex, fsys::append("Vulkan", "shaders", "vertex.glsl")},
+												 {gpu::Stage::Fragment, fsys::append("Vulkan", "shaders", "fragment.glsl")}};
+
+	jsys::JobSystem job_system;
+	job_system.Start();
+
+	for (jsys::JobSystem* prepare_job_system : {(jsys::JobSystem*)nullptr, mem::address_of(job_system)})
+	{
+		gpu::Shader::ClearCache(gpu::DetailType::Vulkan);
+
+		tim::steady_timestamp start = tim::steady_clock::now();
+		gpu::Shader::Prepare(gpu::DetailType::Vulkan, sources, prepare_job_system);
+		const dbl cold = tim::milliseconds_dbl(tim::steady_clock::now() - start).count();
+
+		start = tim::steady_clock::now();
+		gpu::Shader::Prepare(gpu::DetailType::Vulkan, sources, prepare_job_system);
+		const dbl warm = tim::milliseconds_dbl(tim::steady_clock::now() - start).count();
+
+		NP_ENGINE_LOG_INFO("shader cache " + to_str(sources.size()) + " shaders " +
+						   (prepare_job_system ? "on job system" : "serial") + ", ms -- cold: " + to_str(cold) +
+						   ", warm: " + to_str(warm));
+	}
+
+	job_system.Stop();
+}
+
+/*
+	logs ns per draw to record a scissor, vertex buffer bind, and indexed draw as Command objects versus into a CommandStream,
+	then to translate each onto a null command buffer -- the null backend walks the stream the way vulkan does, so
+	translation is timed without a device
+*/
+void BenchmarkCommandStream(::np::siz draw_count = 1 << 18)
+{
+	using namespace ::np;
+
+	mem::trait_allocator allocator;
+	mem::sptr<srvc::Services> services = mem::create_sptr<srvc::Services>(allocator);
+	gpu::__detail::NullCommandBuffer command_buffer(services, false);
+	const gpu::Scissor scissor{{}, 1920, 1080};
+	gpu::BufferResource* const vertex_buffers[] = {nullptr};
+	const siz vertex_buffer_offsets[] = {0};
+
+	for (siz pass = 0; pass < 2; pass++) // the first pass warms the allocators and the stream's capacity
+	{
+		con::vector<mem::sptr<gpu::Command>> commands;
+		commands.reserve(draw_count * 3);
+
+		tim::steady_timestamp start = tim::steady_clock::now();
+		for (siz i = 0; i < draw_count; i++)
+		{
+			mem::sptr<gpu::SetScissorsCommand> set_scissors_cmd =
+				gpu::Command::Create(gpu::DetailType::Null, services, gpu::CommandType::SetScissors);
+			set_scissors_cmd->scissors = {scissor};
+
+			mem::sptr<gpu::BindVertexBuffersCommand> bind_vertex_buffers_cmd =
+				gpu::Command::Create(gpu::DetailType::Null, services, gpu::CommandType::BindVertexBuffers);
+			bind_vertex_buffers_cmd->contexts = {{nullptr, 0}};
+
+			mem::sptr<gpu::DrawIndexedCommand> draw_indexed_cmd =
+				gpu::Command::Create(gpu::DetailType::Null, services, gpu::CommandType::DrawIndexed);
+			draw_indexed_cmd->indexCount = 36;
+
+			commands.emplace_back(set_scissors_cmd);
+			commands.emplace_back(bind_vertex_buffers_cmd);
+			commands.emplace_back(draw_indexed_cmd);
+		}
+		const dbl command_ns = tim::nanoseconds(tim::steady_clock::now() - start).count() / (dbl)draw_count;
+
+		command_buffer.Clear();
+		bl translated = true;
+		start = tim::steady_clock::now();
+		for (const mem::sptr<gpu::Command>& command : commands)
+			translated &= command_buffer.Add(command);
+		const dbl command_translate_ns = tim::nanoseconds(tim::steady_clock::now() - start).count() / (dbl)draw_count;
+		NP_ENGINE_ASSERT(translated && command_buffer.GetCommands().size() == draw_count * 3,
+						 "every command must apply to the null command buffer");
+		commands.clear();
+
+		gpu::CommandStream stream;
+		start = tim::steady_clock::now();
+		for (siz i = 0; i < draw_count; i++)
+		{
+			stream.SetScissors(&scissor, 1);
+			stream.BindVertexBuffers(vertex_buffers, vertex_buffer_offsets, 1);
+			stream.DrawIndexed(36);
+		}
+		const dbl stream_ns = tim::nanoseconds(tim::steady_clock::now() - start).count() / (dbl)draw_count;
+
+		stream.Clear();
+		start = tim::steady_clock::now();
+		for (siz i = 0; i < draw_count; i++)
+		{
+			stream.SetScissors(&scissor, 1);
+			stream.BindVertexBuffers(vertex_buffers, vertex_buffer_offsets, 1);
+			stream.DrawIndexed(36);
+		}
+		const dbl reused_stream_ns = tim::nanoseconds(tim::steady_clock::now() - start).count() / (dbl)draw_count;
+
+		command_buffer.Clear();
+		start = tim::steady_clock::now();
+		translated = static_cast<gpu::CommandBuffer&>(command_buffer).Record(stream); // the dispatch every backend goes through
+		const dbl stream_translate_ns = tim::nanoseconds(tim::steady_clock::now() - start).count() / (dbl)draw_count;
+		NP_ENGINE_ASSERT(translated && command_buffer.GetCommands().size() == draw_count * 3,
+						 "every packet must record onto the null command buffer");
+
+		if (pass == 1)
+			NP_ENGINE_LOG_INFO("command recording " + to_str(draw_count) + " draws, ns/draw -- commands: " +
+							   to_str(command_ns) + ", stream: " + to_str(stream_ns) +
+							   ", reused stream: " + to_str(reused_stream_ns) + ", stream bytes/draw: " +
+							   to_str(stream.GetSize() / draw_count) + ", null translation ns/draw -- commands: " +
+							   to_str(command_translate_ns) + ", stream: " + to_str(stream_translate_ns));
+	}
+}
+
+/*
+	compiles a deferred frame on the cpu and checks its culling, barriers, and transient image placement
+*/
+void CheckRenderGraph()
+{
+	using namespace ::np;
+	using Usage = gpu::ImageResourceUsage;
+	constexpr siz MB = 1 << 20;
+
+	gpu::RenderGraph graph;
+	const siz backbuffer = graph.ImportImage("backbuffer", nullptr, Usage::None, Usage::Present);
+	const siz gbuffer = graph.CreateImage("gbuffer", {Usage::Color | Usage::Shader, gpu::Format::None, 1920, 1080});
+	const siz depth = graph.CreateImage("depth", {Usage::Depth | Usage::Shader, gpu::Format::None, 1920, 1080});
+	const siz hdr = graph.CreateImage("hdr", {Usage::Color | Usage::Shader, gpu::Format::None, 1920, 1080});
+	const siz bloom = graph.CreateImage("bloom", {Usage::Color | Usage::Shader, gpu::Format::None, 960, 540});
+	const siz debug = graph.CreateImage("debug", {Usage::Color, gpu::Format::None, 1920, 1080});
+	graph.SetMemoryRequirements(gbuffer, {8 * MB, 4096});
+	graph.SetMemoryRequirements(depth, {4 * MB, 4096});
+	graph.SetMemoryRequirements(hdr, {8 * MB, 4096});
+	graph.SetMemoryRequirements(bloom, {2 * MB, 4096});
+	graph.SetMemoryRequirements(debug, {8 * MB, 4096});
+
+	const siz gbuffer_pass = graph.AddPass("gbuffer", nullptr, nullptr);
+	graph.Write(gbuffer_pass, gbuffer, gpu::Access::Image, gpu::Stage::FragmentOutput, Usage::Color);
+	graph.Write(gbuffer_pass, depth, gpu::Access::Depth, gpu::Stage::FragmentOutput, Usage::Depth);
+
+	const siz lighting_pass = graph.AddPass("lighting", nullptr, nullptr);
+	graph.Read(lighting_pass, gbuffer, gpu::Access::Shader, gpu::Stage::Fragment, Usage::Shader | Usage::Read);
+	graph.Read(lighting_pass, depth, gpu::Access::Shader, gpu::Stage::Fragment, Usage::Depth | Usage::Read);
+	graph.Write(lighting_pass, hdr, gpu::Access::Image, gpu::Stage::FragmentOutput, Usage::Color);
+
+	const siz debug_pass = graph.AddPass("debug", nullptr, nullptr); // nothing reads debug
+	graph.Read(debug_pass, depth, gpu::Access::Shader, gpu::Stage::Fragment, Usage::Depth | Usage::Read);
+	graph.Write(debug_pass, debug, gpu::Access::Image, gpu::Stage::FragmentOutput, Usage::Color);
+
+	const siz bloom_pass = graph.AddPass("bloom", nullptr, nullptr);
+	graph.Read(bloom_pass, hdr, gpu::Access::Shader, gpu::Stage::Fragment, Usage::Shader | Usage::Read);
+	graph.Write(bloom_pass, bloom, gpu::Access::Image, gpu::Stage::FragmentOutput, Usage::Color);
+
+	const siz composite_pass = graph.AddPass("composite", nullptr, nullptr);
+	graph.Read(composite_pass, hdr, gpu::Access::Shader, gpu::Stage::Fragment, Usage::Shader | Usage::Read);
+	graph.Read(composite_pass, bloom, gpu::Access::Shader, gpu::Stage::Fragment, Usage::Shader | Usage::Read);
+	graph.Write(composite_pass, backbuffer, gpu::Access::Image, gpu::Stage::FragmentOutput, Usage::Color);
+
+	graph.Compile();
+
+	for (siz pass : graph.GetLivePasses())
+	{
+		str line = graph.GetPassName(pass) + ":";
+		for (const gpu::RenderGraphBarrier& barrier : graph.GetBarriers(pass).barriers)
+			line += " " + graph.GetResourceName(barrier.resource) + "(" + to_str((ui32)barrier.srcUsage) + "->" +
+				to_str((ui32)barrier.dstUsage) + ")";
+		NP_ENGINE_LOG_INFO(line);
+	}
+
+	NP_ENGINE_ASSERT(!graph.IsLive(debug_pass) && graph.GetLivePasses().size() == 4, "debug pass must be culled");
+	NP_ENGINE_ASSERT(graph.GetBarriers(gbuffer_pass).barriers.size() == 2, "gbuffer and depth start undefined");
+	NP_ENGINE_ASSERT(graph.GetBarriers(lighting_pass).barriers.size() == 3, "gbuffer and depth to read, hdr from undefined");
+	NP_ENGINE_ASSERT(graph.GetBarriers(bloom_pass).barriers.size() == 2, "hdr to read, bloom from undefined");
+	NP_ENGINE_ASSERT(graph.GetBarriers(composite_pass).barriers.size() == 2,
+					 "bloom to read and backbuffer from undefined -- hdr is already readable by fragment shaders");
+	NP_ENGINE_ASSERT(graph.GetFinalBarriers().barriers.size() == 1 &&
+						 graph.GetFinalBarriers().barriers[0].dstUsage == Usage::Present,
+					 "backbuffer ends in present");
+	NP_ENGINE_ASSERT(!graph.GetPlacement(debug).IsValid(), "culled images take no memory");
+	NP_ENGINE_ASSERT(graph.GetPlacement(bloom).offset == graph.GetPlacement(gbuffer).offset,
+					 "bloom starts after gbuffer is done, so it takes its memory");
+
+	NP_ENGINE_LOG_INFO("render graph transient memory: " + to_str(graph.GetHeapRequirements(0).size / MB) +
+					   "MB aliased, " + to_str(graph.GetUnaliasedSize() / MB) + "MB unaliased");
+}
+
+/*
+	logs cpu ms per frame of the tester's scene rendering a headless window on the null gpu backend, excluding fence waits,
+	so its cpu cost can be tracked on machines without a gpu -- the fake latencies keep frames in flight the way a device
+	would, and the window is resized halfway through so the scene rebuilds its frames
+*/
+void BenchmarkNullScene(::np::siz frame_count = 1 << 10)
+{
+	using namespace ::np;
+
+	mem::trait_allocator allocator;
+	mem::sptr<srvc::Services> services = mem::create_sptr<srvc::Services>(allocator);
+	services->GetJobSystem().Start();
+	app::WindowLayer window_layer(services);
+
+	mem::sptr<uid::UidHandle> window_id_handle = services->GetUidSystem().CreateUid();
+	mem::sptr<win::Window> window =
+		window_layer.CreateWindow(win::DetailType::Headless, services->GetUidSystem().GetUid(window_id_handle));
+	win::__detail::HeadlessWindow& headless_window = static_cast<win::__detail::HeadlessWindow&>(*window);
+
+	mem::sptr<gpu::DetailInstance> instance = gpu::DetailInstance::Create(gpu::DetailType::Null, services);
+	static_cast<gpu::__detail::NullInstance&>(*instance).SetLatencies(
+		{tim::milliseconds(0.05), tim::milliseconds(4), tim::milliseconds(0.1)});
+
+	mem::sptr<app::GameLayer::Scene> scene = app::GameLayer::CreateScene(services, window, instance);
+	gpu::__detail::NullDevice& device = static_cast<gpu::__detail::NullDevice&>(*scene->device);
+	device.ResetRecord();
+
+	tim::steady_clock::duration cpu_duration{0};
+	tim::steady_clock::duration max_cpu_duration{0};
+
+	for (siz frame = 0; frame < frame_count; frame++)
+	{
+		if (frame == frame_count / 2)
+		{
+			headless_window.ScriptSize({1280, 720});
+			window_layer.Poll(tim::milliseconds(0));
+		}
+
+		// the scene waits on this same fence first, so waiting here keeps the fake gpu time out of what we measure
+		scene->submitCompleteFences[scene->frameCounter]->Wait();
+
+		const tim::steady_timestamp start = tim::steady_clock::now();
+		scene->Render();
+		const tim::steady_clock::duration duration = tim::steady_clock::now() - start;
+		cpu_duration += duration;
+		max_cpu_duration = ::std::max(max_cpu_duration, duration);
+	}
+
+	scene->device->WaitUntilIdle();
+	const gpu::__detail::NullRecord record = device.GetRecord();
+	const siz batch_count = scene->batchStreams.size();
+	scene.reset();
+	window.reset();
+	services->GetJobSystem().Stop();
+
+	NP_ENGINE_LOG_INFO("null scene " + to_str(frame_count) + " frames, " + to_str(batch_count) +
+					   " batches, cpu ms/frame -- mean: " +
+					   to_str(tim::milliseconds(cpu_duration).count() / (dbl)frame_count) +
+					   ", max: " + to_str(tim::milliseconds(max_cpu_duration).count()) + ", submitted -- command buffers: " +
+					   to_str(record.commandBufferCount) + ", commands: " + to_str(record.commandCount) +
+					   ", draws: " + to_str(record.drawCount) + ", presents: " + to_str(record.presentCount));
+}
+
+/*
+	logs the polling loop's cost per frame and per event with a headless window playing scripted window and input
+	events, which reach the EventSubmitter and the input queue the way a glfw window's do
+*/
+void BenchmarkHeadlessWindow(::np::siz frame_count = 1 << 10, ::np::siz events_per_frame = 1 << 8)
+{
+	using namespace ::np;
+	using ScriptType = win::__detail::HeadlessScriptType;
+
+	mem::trait_allocator allocator;
+	mem::sptr<srvc::Services> services = mem::create_sptr<srvc::Services>(allocator);
+	evnt::EventQueue& event_queue = services->GetEventQueue();
+	nput::InputQueue& input_queue = services->GetInputQueue();
+	app::WindowLayer window_layer(services);
+
+	mem::sptr<uid::UidHandle> window_id_handle = services->GetUidSystem().CreateUid();
+	const uid::Uid window_id = services->GetUidSystem().GetUid(window_id_handle);
+	mem::sptr<win::Window> window = window_layer.CreateWindow(win::DetailType::Headless, window_id);
+	win::__detail::HeadlessWindow& headless_window = static_cast<win::__detail::HeadlessWindow&>(*window);
+	window->SetKeyCallback(mem::address_of(input_queue), nput::InputListener::SubmitKeyState);
+	window->SetMousePositionCallback(mem::address_of(input_queue), nput::InputListener::SubmitMousePosition);
+
+	con::vector<win::__detail::HeadlessScriptEntry> script(events_per_frame);
+	siz event_count = 0;
+	tim::steady_clock::duration loop_duration{0};
+
+	for (siz frame = 0; frame < frame_count; frame++)
+	{
+		// every entry changes something, so each one submits an event or an input state
+		for (siz i = 0; i < script.size(); i++)
+		{
+			win::__detail::HeadlessScriptEntry& entry = script[i];
+			switch (i % 4)
+			{
+			case 0:
+				entry.type = ScriptType::Size;
+				entry.size = {800 + (frame + i) % 64, 600};
+				break;
+
+			case 1:
+				entry.type = ScriptType::MousePosition;
+				entry.mousePosition.SetPosition({(flt)i, (flt)frame});
+				break;
+
+			case 2:
+				entry.type = ScriptType::Key;
+				entry.keyState.SetCode(nput::KeyCode::Space);
+				entry.keyState.SetIsActive(i % 8 == 2);
+				break;
+
+			default:
+				entry.type = ScriptType::Focus;
+				entry.value = i % 8 == 3;
+				break;
+			}
+		}
+		headless_window.Script(script.data(), script.size());
+
+		const tim::steady_timestamp start = tim::steady_clock::now();
+		window_layer.BeforePoll();
+		window_layer.Poll(tim::milliseconds(0));
+		window_layer.AfterPoll();
+		window_layer.CleanupPoll();
+
+		event_queue.ToggleState();
+		for (mem::sptr<evnt::Event> e = event_queue.Pop(); e; e = event_queue.Pop(), event_count++)
+			window_layer.OnEvent(e);
+
+		input_queue.ApplySubmissions();
+		loop_duration += tim::steady_clock::now() - start;
+	}
+
+	// a scripted close takes the same path as closing a glfw window, so the layer destroys the window
+	headless_window.ScriptClose();
+	window_layer.Poll(tim::milliseconds(0));
+	event_queue.ToggleState();
+	for (mem::sptr<evnt::Event> e = event_queue.Pop(); e; e = event_queue.Pop())
+		window_layer.OnEvent(e);
+	window_layer.CleanupPoll();
+	NP_ENGINE_ASSERT(!window_layer.Get(window_id), "the scripted close must destroy the window");
+
+	const siz played_count = headless_window.GetPlayedCount();
+	window.reset();
+	event_queue.Clear();
+
+	const dbl loop_ns = tim::nanoseconds(loop_duration).count();
+	NP_ENGINE_LOG_INFO("headless window " + to_str(frame_count) + " frames, " + to_str(played_count) +
+					   " scripted, " + to_str(event_count) + " events -- us/frame: " +
+					   to_str(loop_ns / 1000.0 / (dbl)frame_count) + ", ns/scripted: " +
+					   to_str(loop_ns / (dbl)played_count) + ", events/s: " +
+					   to_str((dbl)event_count / (loop_ns / 1000000000.0)));
+}
+
+struct ServiceThreadBenchmark
+{
+	::np::siz jobCount = 0;
+	::np::siz batchSize = 0;
+	::np::atm_siz executedCount{0};
+	::np::dbl producerNs = 0;
+};
+
+void ServiceThreadBenchmarkJobCallback(::np::mem::delegate& d)
+{
+	ServiceThreadBenchmark& benchmark = *((ServiceThreadBenchmark*)d.GetPayload());
+	benchmark.executedCount.fetch_add(1, ::np::mo_release);
+}
+
+/*
+	submits every job in batches, helping the pool through each batch instead of waiting on it
+*/
+void ServiceThreadBenchmarkCallback(::np::jsys::ServiceThread& service)
+{
+	using namespace ::np;
+
+	ServiceThreadBenchmark& benchmark = *((ServiceThreadBenchmark*)service.GetPayload());
+	const tim::steady_timestamp start = tim::steady_clock::now();
+
+	for (siz submitted = 0; submitted < benchmark.jobCount && service.KeepRunning(); submitted += benchmark.batchSize)
+	{
+		mem::sptr<jsys::Job> job = nullptr;
+		for (siz i = 0; i < benchmark.batchSize && submitted + i < benchmark.jobCount; i++)
+		{
+			job = service.CreateJob();
+			job->SetPayload(mem::address_of(benchmark));
+			job->SetCallback(ServiceThreadBenchmarkJobCallback);
+			service.SubmitJob(jsys::JobPriority::Normal, job);
+		}
+
+		service.HelpUntilComplete(job);
+	}
+
+	while (benchmark.executedCount.load(mo_acquire) < benchmark.jobCount && service.KeepRunning())
+		if (!service.HelpJobSystem())
+			thr::this_thread::yield();
+
+	benchmark.producerNs = tim::nanoseconds(tim::steady_clock::now() - start).count();
+}
+
+/*
+	logs ns/job of jobs fed to the pool by an unpinned service thread, and how much of that service's cpu time went to
+	helping the pool
+*/
+void BenchmarkServiceThread(::np::siz job_count = 1 << 18, ::np::siz batch_size = 1 << 8)
+{
+	using namespace ::np;
+
+	ServiceThreadBenchmark benchmark{};
+	benchmark.jobCount = job_count;
+	benchmark.batchSize = batch_size;
+
+	jsys::JobSystem job_system;
+	mem::sptr<jsys::ServiceThread> service = job_system.CreateServiceThread(
+		"service thread benchmark", jsys::ServiceThread::NO_AFFINITY, ServiceThreadBenchmarkCallback,
+		mem::address_of(benchmark));
+
+	job_system.Start();
+	while (benchmark.executedCount.load(mo_acquire) < job_count)
+		thr::this_thread::yield();
+
+	job_system.Stop();
+
+	const jsys::ServiceThreadStats stats = service->GetStats();
+	NP_ENGINE_LOG_INFO("service thread " + to_str(job_count) + " jobs, " + to_str(job_system.GetJobWokerCount()) +
+					   " workers -- ns/job: " + to_str(benchmark.producerNs / (dbl)job_count) + ", helped jobs: " +
+					   to_str(stats.helpedJobCount) + ", service cpu ms: " +
+					   to_str(tim::milliseconds(stats.cpuTime).count()) + ", service run ms: " +
+					   to_str(tim::milliseconds(stats.runTime).count()));
+
+	job_system.Clear();
+}
+
+/*
+	records a synthetic session of key taps and mouse moves to a file, then replays the file into another input queue
+	logs ns/record to submit and apply on each, and checks that the replay applies the same records in the same frames
+	with the same activation counts -- every tap here presses and releases within one frame
+*/
+void BenchmarkInputReplay(::np::siz frame_count = 1 << 12, ::np::siz taps_per_frame = 1 << 5)
+{
+	using namespace ::np;
+
+	const str filename = fsys::append(fsys::get_current_path(), "NP-Engine-Input.npir");
+	nput::InputRecording recording;
+	nput::InputQueue recorded_queue;
+	recorded_queue.SetRecording(mem::address_of(recording));
+
+	nput::KeyCodeState key_state;
+	nput::MousePosition mouse_position;
+	siz recorded_activation_count = 0;
+
+	tim::steady_timestamp start = tim::steady_clock::now();
+	for (siz frame = 0; frame < frame_count; frame++)
+	{
+		for (siz i = 0; i < taps_per_frame; i++)
+		{
+			key_state.SetCode((siz)nput::KeyCode::A + (frame + i) % 26);
+			key_state.SetIsActive(true);
+			key_state.SetTimestamp(tim::steady_clock::now());
+			recorded_queue.Submit(key_state);
+
+			key_state.SetIsActive(false);
+			key_state.SetTimestamp(tim::steady_clock::now());
+			recorded_queue.Submit(key_state);
+
+			mouse_position.SetPosition({(flt)i, (flt)frame});
+			mouse_position.SetTimestamp(tim::steady_clock::now());
+			recorded_queue.Submit(mouse_position);
+		}
+
+		recorded_queue.ApplySubmissions();
+		for (siz code = (siz)nput::KeyCode::A; code <= (siz)nput::KeyCode::Z; code++)
+			recorded_activation_count += recorded_queue.GetActivationCount((nput::KeyCode)code);
+	}
+	const dbl record_ns = tim::nanoseconds(tim::steady_clock::now() - start).count();
+	recorded_queue.SetRecording(nullptr);
+
+	const bl saved = recording.Save(filename);
+	NP_ENGINE_ASSERT(saved, "could not save input recording");
+
+	nput::InputRecording loaded;
+	const bl was_loaded = loaded.Load(filename);
+	NP_ENGINE_ASSERT(was_loaded, "could not load input recording");
+	fsys::remove_all(filename);
+
+	nput::InputRecording replayed;
+	nput::InputQueue replayed_queue;
+	nput::InputReplay replay(loaded);
+	replayed_queue.SetRecording(mem::address_of(replayed));
+	siz replayed_activation_count = 0;
+
+	start = tim::steady_clock::now();
+	while (!replay.IsDone())
+	{
+		replay.SubmitFrame(replayed_queue);
+		replayed_queue.ApplySubmissions();
+		for (siz code = (siz)nput::KeyCode::A; code <= (siz)nput::KeyCode::Z; code++)
+			replayed_activation_count += replayed_queue.GetActivationCount((nput::KeyCode)code);
+	}
+	const dbl replay_ns = tim::nanoseconds(tim::steady_clock::now() - start).count();
+	replayed_queue.SetRecording(nullptr);
+
+	// frame records are stamped when applied, everything else keeps its recorded timestamp
+	const con::vector<nput::InputRecord>& expected = recording.GetRecords();
+	const con::vector<nput::InputRecord>& actual = replayed.GetRecords();
+	siz mismatch_count = expected.size() == actual.size() ? 0 : 1;
+	for (siz i = 0; i < expected.size() && i < actual.size(); i++)
+	{
+		const bl matches = expected[i].type == actual[i].type && expected[i].code == actual[i].code &&
+			expected[i].isActive == actual[i].isActive && expected[i].activityLevel == actual[i].activityLevel &&
+			expected[i].isOverSurface == actual[i].isOverSurface && expected[i].position == actual[i].position &&
+			(expected[i].type == nput::InputRecordType::Frame || expected[i].timestampNs == actual[i].timestampNs);
+
+		if (!matches)
+			mismatch_count++;
+	}
+
+	NP_ENGINE_ASSERT(mismatch_count == 0, "replay must apply the recorded records in the recorded frames");
+	NP_ENGINE_ASSERT(recorded_activation_count == frame_count * taps_per_frame, "every tap must be counted");
+	NP_ENGINE_ASSERT(replayed_activation_count == recorded_activation_count, "replay must count the same taps");
+
+	const dbl record_count = (dbl)(expected.size() - recording.GetFrameCount());
+	NP_ENGINE_LOG_INFO("input replay " + to_str(frame_count) + " frames, " + to_str((siz)record_count) + " records, " +
+					   to_str(replayed_activation_count) + " taps, " + to_str(mismatch_count) + " mismatches, " +
+					   to_str(recorded_queue.GetDroppedCount() + replayed_queue.GetDroppedCount()) +
+					   " dropped -- record ns/record: " + to_str(record_ns / record_count) +
+					   ", replay ns/record: " + to_str(replay_ns / record_count));
+}
+
+/*
+	checks are quick and only need the cpu, so they run before every launch
+*/
+void RunChecks()
+{
+	CheckTlsfOffsetAllocator();
+	CheckNoiseBatch();
+	CheckResolverCache();
+	CheckChannels();
+	CheckRenderGraph();
+}
+
+/*
+	benchmarks take a while, so they only run when asked for with --benchmarks, in place of the game app
+*/
+void RunBenchmarks()
+{
+	BenchmarkNoiseBatch();
+	BenchmarkDmsImage();
+	BenchmarkShaderCache();
+	BenchmarkCommandStream();
+	BenchmarkNullScene();
+	BenchmarkHeadlessWindow();
+	BenchmarkServiceThread();
+	BenchmarkInputReplay();
+}
+
+/*
+	--checks runs only the checks, --benchmarks runs the checks and benchmarks, --samples runs the sampling profiler
+*/
+::np::bl HasArgument(::np::i32 argc, ::np::chr** argv, const ::np::str& argument)
+{
+	for (::np::i32 i = 1; i < argc; i++)
+		if (argument == argv[i])
+			return true;
+
+	return false;
+}
+
 ::np::i32 main(::np::i32 argc, ::np::chr** argv)
 {
 	using namespace ::np;
@@ -26,14 +1066,30 @@
 	try
 	{
 		sys::init();
+		nsit::sampling_profiler::register_thread("main");
+		if (HasArgument(argc, argv, "--samples"))
+			nsit::sampling_profiler::start(); // flamegraph.pl NP-Engine-Samples.folded > samples.svg
+
+		RunChecks();
+		const bl run_benchmarks = HasArgument(argc, argv, "--benchmarks");
+		if (run_benchmarks)
+			RunBenchmarks();
+
+		const bl run_application = !run_benchmarks && !HasArgument(argc, argv, "--checks");
 		mem::accumulating_allocator<mem::red_black_tree_allocator> allocator{};
 		mem::trait_allocator::register_allocator(allocator);
+		if (run_application)
 		{
 			NP_ENGINE_PROFILE_SCOPE("application lifespan");
 			mem::sptr<srvc::Services> services = mem::create_sptr<srvc::Services>(allocator);
 			mem::sptr<app::Application> application = mem::create_sptr<app::GameApp>(services->GetAllocator(), services);
 			application->Run(argc, argv);
 		}
+		if (nsit::sampling_profiler::is_running())
+		{
+			nsit::sampling_profiler::stop();
+			nsit::sampling_profiler::save(fsys::append(fsys::get_current_path(), "NP-Engine-Samples.folded"));
+		}
 		NP_ENGINE_PROFILE_SAVE();
 		NP_ENGINE_PROFILE_RESET();
 		mem::trait_allocator::reset_registration();
@@ -57,6 +1113,11 @@
 		NP_ENGINE_LOG_ERROR(message);
 	}
 
+	const nsit::async_log_stats log_stats = nsit::log::get_async_stats();
+	NP_ENGINE_LOG_INFO("log enqueue latency mean: " + to_str(log_stats.get_mean_enqueue_latency().count()) +
+					   "ns, max: " + to_str(log_stats.max_enqueue_latency.count()) + "ns, dropped: " + to_str(log_stats.dropped));
+	nsit::log::shutdown();
+
 	if (exit_val != 0)
 		win::Popup::Show(nullptr, "NP-Engine Exit Code: " + to_str(exit_val), message, style, buttons);
 